@@ -0,0 +1,174 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Bench.cpp
+ * Author:  raymond@burkholder.net
+ * Project: AlpacaReplay
+ * Created: October 19, 2026 23:55
+ */
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <cstdlib>
+#include <iostream>
+
+#include <TFAlpaca/data_stream.hpp>
+
+#include "Bench.hpp"
+
+namespace replay {
+
+namespace {
+
+using steady_t = std::chrono::steady_clock;
+
+// written on one thread (decoder or stream strand), read once that thread is done
+struct Tally {
+
+  std::size_t nTrades;
+  std::size_t nQuotes;
+  std::size_t nBars;
+  double dblChecksum;
+  std::atomic<std::size_t> nItems;
+  steady_t::time_point tpFirst;
+  steady_t::time_point tpLast;
+
+  Tally(): nTrades {}, nQuotes {}, nBars {}, dblChecksum {}, nItems {} {}
+
+  void Stamp() {
+    tpLast = steady_t::now();
+    if ( 0 == nItems ) tpFirst = tpLast;
+    nItems++;
+  }
+
+  bool operator==( const Tally& rhs ) const {
+    return ( nTrades == rhs.nTrades ) && ( nQuotes == rhs.nQuotes ) && ( nBars == rhs.nBars ) && ( dblChecksum == rhs.dblChecksum );
+  }
+};
+
+std::ostream& operator<<( std::ostream& os, const Tally& tally ) {
+  os << tally.nTrades << " trades, " << tally.nQuotes << " quotes, " << tally.nBars << " bars, checksum " << tally.dblChecksum;
+  return os;
+}
+
+void Emit( const std::string& sVariant, const std::string& sParam, std::size_t nItems, double dblSeconds ) {
+  // same layout as the Benchmark results
+  std::cout
+    << "alpaca_stream " << sVariant << " " << sParam
+    << ": " << nItems << " items"
+    << " in " << dblSeconds << " s"
+    << ", " << (std::size_t)( ( 0.0 < dblSeconds ) ? ( nItems / dblSeconds ) : 0.0 ) << "/s"
+    << ", " << ( ( 0 < nItems ) ? ( 1e9 * dblSeconds / nItems ) : 0.0 ) << " ns/item"
+    << std::endl;
+}
+
+} // namespace anonymous
+
+int Bench( const Frames& frames, const ou::ReplayServer::Options& options ) {
+
+  const std::string sParam( "frames=" + std::to_string( frames.Frame().size() ) + ",bytes=" + std::to_string( frames.Bytes() ) );
+
+  // 1. decode only
+
+  Tally direct;
+  ou::tf::alpaca::StreamDecoder decoder;
+  decoder.Set(
+    [&direct]( const std::string_view&, const ou::tf::Trade& trade ){
+      direct.nTrades++; direct.dblChecksum += trade.Price(); direct.nItems++;
+    },
+    [&direct]( const std::string_view&, const ou::tf::Quote& quote ){
+      direct.nQuotes++; direct.dblChecksum += quote.Bid() + quote.Ask(); direct.nItems++;
+    },
+    [&direct]( const std::string_view&, const ou::tf::Bar& bar ){
+      direct.nBars++; direct.dblChecksum += bar.Close(); direct.nItems++;
+    },
+    nullptr
+  );
+
+  const steady_t::time_point tpBegin( steady_t::now() );
+  for ( const std::string& sFrame: frames.Frame() ) decoder.Decode( sFrame );
+  Emit( "decode", sParam, direct.nItems, std::chrono::duration<double>( steady_t::now() - tpBegin ).count() );
+
+  const ou::tf::alpaca::StreamDecoder::Stats& stats( decoder.GetStats() );
+  if ( 0 < ( stats.nMalformed + stats.nSkipped ) ) {
+    std::cout << "alpaca_stream " << stats.nMalformed << " malformed, " << stats.nSkipped << " skipped" << std::endl;
+  }
+
+  // 2. through the stand in
+
+  ou::ReplayServer::Options optionsServer( options );
+  optionsServer.nPort = 0;
+  ou::ReplayServer server( frames.Frame(), optionsServer );
+  std::atomic<bool> bReplayDone( false );
+  server.Set( [&bReplayDone]( std::size_t ){ bReplayDone = true; } );
+  server.Start();
+
+  Tally wire;
+  boost::asio::io_context context;
+  auto pStream = std::make_shared<ou::tf::alpaca::session::data_stream>( context );
+  pStream->set(
+    [&wire]( const std::string_view&, const ou::tf::Trade& trade ){
+      wire.nTrades++; wire.dblChecksum += trade.Price(); wire.Stamp();
+    },
+    [&wire]( const std::string_view&, const ou::tf::Quote& quote ){
+      wire.nQuotes++; wire.dblChecksum += quote.Bid() + quote.Ask(); wire.Stamp();
+    },
+    [&wire]( const std::string_view&, const ou::tf::Bar& bar ){
+      wire.nBars++; wire.dblChecksum += bar.Close(); wire.Stamp();
+    }
+  );
+
+  std::atomic<bool> bConnected( false );
+  pStream->connect(
+    "127.0.0.1", std::to_string( server.Port() ), "/v2/iex", "replay", "replay",
+    [&bConnected]( bool bAuthenticated ){ if ( bAuthenticated ) bConnected = true; } // false once the stand in closes
+  );
+  pStream->subscribe( ou::tf::alpaca::session::data_stream::trades, "*" );
+  pStream->subscribe( ou::tf::alpaca::session::data_stream::quotes, "*" );
+  pStream->subscribe( ou::tf::alpaca::session::data_stream::bars, "*" );
+
+  std::thread threadClient( [&context](){ context.run(); } );
+
+  // the replay, then the client draining what remains
+  const steady_t::time_point tpGiveUp( steady_t::now() + std::chrono::seconds( 600 ) );
+  while ( !bReplayDone && ( steady_t::now() < tpGiveUp ) ) std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+  std::size_t nLast {};
+  do {
+    nLast = wire.nItems;
+    std::this_thread::sleep_for( std::chrono::milliseconds( 200 ) );
+  } while ( ( nLast != wire.nItems ) || ( ( wire.nItems < direct.nItems ) && !bReplayDone ) );
+
+  pStream->disconnect();
+  threadClient.join();
+  server.Stop();
+
+  Emit(
+    ( 0.0 < options.dblRate ) ? "websocket_paced" : "websocket", sParam,
+    wire.nItems, std::chrono::duration<double>( wire.tpLast - wire.tpFirst ).count() );
+
+  if ( bConnected && ( direct == wire ) ) {
+    std::cout << "alpaca_stream check ok: " << wire << std::endl;
+    return EXIT_SUCCESS;
+  }
+  else {
+    std::cout << "alpaca_stream check failed" << std::endl;
+    std::cout << "  decode:    " << direct << std::endl;
+    std::cout << "  websocket: " << wire << std::endl;
+    return EXIT_FAILURE;
+  }
+}
+
+} // namespace replay
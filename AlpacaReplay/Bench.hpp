@@ -0,0 +1,36 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Bench.hpp
+ * Author:  raymond@burkholder.net
+ * Project: AlpacaReplay
+ * Created: October 19, 2026 23:55
+ */
+
+#pragma once
+
+// the frames decoded in memory, then the same frames through the stand in server
+//   and alpaca::session::data_stream over a loopback websocket
+// both passes must agree on message counts and a price checksum, which makes this the stream test as well
+
+#include <OUCommon/ReplayServer.h>
+
+#include "Frames.hpp"
+
+namespace replay {
+
+int Bench( const Frames&, const ou::ReplayServer::Options& ); // EXIT_FAILURE when the passes disagree
+
+} // namespace replay
@@ -0,0 +1,145 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Frames.cpp
+ * Author:  raymond@burkholder.net
+ * Project: AlpacaReplay
+ * Created: October 19, 2026 23:55
+ */
+
+#include <cstdio>
+#include <random>
+#include <fstream>
+#include <algorithm>
+#include <stdexcept>
+
+#include "Frames.hpp"
+
+namespace replay {
+
+// sends [{"T":"success","msg":"connected"}], accepts any auth, acknowledges the first subscribe
+ou::ReplayServer::vStep_t Frames::Handshake() {
+  return ou::ReplayServer::vStep_t {
+    { false, "", "[{\"T\":\"success\",\"msg\":\"connected\"}]" },
+    { true, "\"action\":\"auth\"", "[{\"T\":\"success\",\"msg\":\"authenticated\"}]",
+                                 "[{\"T\":\"error\",\"code\":401,\"msg\":\"not authenticated\"}]" },
+    { true, "", "[{\"T\":\"subscription\",\"trades\":[\"*\"],\"quotes\":[\"*\"],\"bars\":[\"*\"]}]" },
+  };
+}
+
+Frames::Frames( const std::string& sFileName )
+: m_nBytes {}
+{
+  std::ifstream ifs( sFileName );
+  if ( !ifs.is_open() ) {
+    throw std::runtime_error( "can not open " + sFileName );
+  }
+  std::string sLine;
+  while ( std::getline( ifs, sLine ) ) {
+    if ( !sLine.empty() && ( '\r' == sLine.back() ) ) sLine.pop_back();
+    if ( sLine.empty() ) continue;
+    m_nBytes += sLine.size();
+    m_vFrame.emplace_back( std::move( sLine ) );
+  }
+  if ( m_vFrame.empty() ) {
+    throw std::runtime_error( sFileName + " has no frames" );
+  }
+}
+
+// message shapes as sent by the v2 stock stream
+Frames::Frames( std::size_t nFrames, std::size_t nSymbols, std::size_t nPerFrame )
+: m_nBytes {}
+{
+  std::mt19937 rng( 19 );
+  std::uniform_int_distribution<int> distKind( 0, 99 );
+  std::uniform_int_distribution<int> distSize( 1, 500 );
+  std::uniform_int_distribution<int> distTick( -3, 3 );
+  std::uniform_int_distribution<std::size_t> distCount( 1, nPerFrame );
+  std::uniform_int_distribution<std::size_t> distSymbol( 0, nSymbols - 1 );
+
+  std::vector<std::string> vSymbol;
+  std::vector<double> vPrice;
+  for ( std::size_t ix = 0; ix < nSymbols; ix++ ) {
+    std::string sSymbol;
+    std::size_t n( ix );
+    do {
+      sSymbol += (char)( 'A' + ( n % 26 ) );
+      n /= 26;
+    } while ( 0 < n );
+    vSymbol.emplace_back( std::move( sSymbol ) );
+    vPrice.push_back( 20.0 + (double)( ix % 400 ) );
+  }
+
+  std::uint64_t ns( 13ull * 3600 * 1000000000ull + 30ull * 60 * 1000000000ull ); // 13:30 utc
+  char szTime[ 40 ];
+  char szMessage[ 320 ];
+
+  m_vFrame.reserve( nFrames );
+  for ( std::size_t ixFrame = 0; ixFrame < nFrames; ixFrame++ ) {
+    std::string sFrame( "[" );
+    const std::size_t nMessages( distCount( rng ) );
+    for ( std::size_t ixMessage = 0; ixMessage < nMessages; ixMessage++ ) {
+
+      ns += 1 + ( rng() % 200000 );
+      const std::uint64_t seconds( ns / 1000000000ull );
+      std::snprintf(
+        szTime, sizeof( szTime ), "2026-10-19T%02u:%02u:%02u.%09uZ",
+        (unsigned)( seconds / 3600 ), (unsigned)( ( seconds / 60 ) % 60 ), (unsigned)( seconds % 60 ),
+        (unsigned)( ns % 1000000000ull ) );
+
+      const std::size_t ixSymbol( distSymbol( rng ) );
+      const char* szSymbol( vSymbol[ ixSymbol ].c_str() );
+      double& price( vPrice[ ixSymbol ] );
+      price = std::max( 1.0, price + 0.01 * distTick( rng ) );
+
+      const int kind( distKind( rng ) );
+      if ( 45 > kind ) {
+        std::snprintf(
+          szMessage, sizeof( szMessage ),
+          "{\"T\":\"t\",\"S\":\"%s\",\"i\":%zu,\"x\":\"V\",\"p\":%.2f,\"s\":%d,\"c\":[\"@\",\"I\"],\"z\":\"C\",\"t\":\"%s\"}",
+          szSymbol, ixFrame * nPerFrame + ixMessage, price, distSize( rng ), szTime );
+      }
+      else {
+        if ( 95 > kind ) {
+          std::snprintf(
+            szMessage, sizeof( szMessage ),
+            "{\"T\":\"q\",\"S\":\"%s\",\"bx\":\"V\",\"bp\":%.2f,\"bs\":%d,\"ax\":\"V\",\"ap\":%.2f,\"as\":%d,\"c\":[\"R\"],\"z\":\"C\",\"t\":\"%s\"}",
+            szSymbol, price - 0.01, distSize( rng ), price + 0.01, distSize( rng ), szTime );
+        }
+        else {
+          std::snprintf(
+            szMessage, sizeof( szMessage ),
+            "{\"T\":\"b\",\"S\":\"%s\",\"o\":%.2f,\"h\":%.2f,\"l\":%.2f,\"c\":%.2f,\"v\":%d,\"n\":%d,\"vw\":%.4f,\"t\":\"%.17s00Z\"}",
+            szSymbol, price, price + 0.05, price - 0.05, price, 100 * distSize( rng ), distSize( rng ), price, szTime );
+        }
+      }
+      if ( 0 < ixMessage ) sFrame += ',';
+      sFrame += szMessage;
+    }
+    sFrame += ']';
+    m_nBytes += sFrame.size();
+    m_vFrame.emplace_back( std::move( sFrame ) );
+  }
+}
+
+void Frames::Save( const std::string& sFileName ) const {
+  std::ofstream ofs( sFileName, std::ios::out | std::ios::trunc );
+  if ( !ofs.is_open() ) {
+    throw std::runtime_error( "can not write " + sFileName );
+  }
+  for ( const std::string& sFrame: m_vFrame ) ofs << sFrame << '\n';
+}
+
+} // namespace replay
@@ -0,0 +1,56 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Frames.hpp
+ * Author:  raymond@burkholder.net
+ * Project: AlpacaReplay
+ * Created: October 19, 2026 23:55
+ */
+
+#pragma once
+
+// market data stream frames, one per line, as written by alpaca::session::data_stream::record
+//   or synthesized: trades, quotes and minute bars across a set of symbols
+
+#include <string>
+#include <vector>
+#include <cstddef>
+
+#include <OUCommon/ReplayServer.h>
+
+namespace replay {
+
+class Frames {
+public:
+
+  using vFrame_t = std::vector<std::string>;
+
+  Frames( const std::string& sFileName ); // throws std::runtime_error
+  Frames( std::size_t nFrames, std::size_t nSymbols, std::size_t nPerFrame ); // synthesized, deterministic
+
+  void Save( const std::string& sFileName ) const; // throws std::runtime_error
+
+  static ou::ReplayServer::vStep_t Handshake(); // what the stand in plays ahead of the frames
+
+  const vFrame_t& Frame() const { return m_vFrame; }
+  std::size_t Bytes() const { return m_nBytes; }
+
+protected:
+private:
+  vFrame_t m_vFrame;
+  std::size_t m_nBytes;
+};
+
+} // namespace replay
@@ -0,0 +1,108 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    main.cpp
+ * Author:  raymond@burkholder.net
+ * Project: AlpacaReplay
+ * Created: October 19, 2026 23:55
+ */
+
+// usage:
+//   AlpacaReplay synth <frames> [count] [symbols] [per frame]  write synthesized frames
+//   AlpacaReplay serve <frames> [rate] [port]                  stand in for the market data stream until ctrl-c
+//   AlpacaReplay bench <frames|synth> [rate]                   decode, then server and data_stream in process
+// rate: frames per second, or max (the default)
+// frames are recorded with alpaca::session::data_stream::record, one frame per line
+
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+#include "Bench.hpp"
+
+namespace {
+
+void Usage() {
+  std::cout
+    << "usage:" << std::endl
+    << "  AlpacaReplay synth <frames> [count] [symbols] [per frame]" << std::endl
+    << "  AlpacaReplay serve <frames> [rate] [port]" << std::endl
+    << "  AlpacaReplay bench <frames|synth> [rate]" << std::endl
+    << "  rate: frames per second, or max (default)" << std::endl;
+}
+
+std::size_t Count( int argc, char* argv[], int ix, std::size_t nDefault ) {
+  return ( ix < argc ) ? std::stoul( argv[ ix ] ) : nDefault;
+}
+
+} // namespace anonymous
+
+int main( int argc, char* argv[] ) {
+
+  if ( 3 > argc ) {
+    Usage();
+    return EXIT_FAILURE;
+  }
+
+  const std::string sMode( argv[ 1 ] );
+  const std::string sFileName( argv[ 2 ] );
+
+  try {
+
+    if ( "synth" == sMode ) {
+      const replay::Frames frames( Count( argc, argv, 3, 200000 ), Count( argc, argv, 4, 500 ), Count( argc, argv, 5, 8 ) );
+      frames.Save( sFileName );
+      std::cout << frames.Frame().size() << " frames, " << frames.Bytes() << " bytes, written to " << sFileName << std::endl;
+      return EXIT_SUCCESS;
+    }
+
+    ou::ReplayServer::Options options;
+    options.vStep = replay::Frames::Handshake();
+    if ( 4 <= argc ) {
+      const std::string sRate( argv[ 3 ] );
+      if ( "max" != sRate ) {
+        options.dblRate = std::stod( sRate );
+        if ( 0.0 >= options.dblRate ) {
+          std::cout << "rate needs to be positive, or max" << std::endl;
+          return EXIT_FAILURE;
+        }
+      }
+    }
+
+    if ( "serve" == sMode ) {
+      options.nPort = Count( argc, argv, 4, options.nPort );
+      const replay::Frames frames( sFileName );
+      ou::ReplayServer server( frames.Frame(), options );
+      std::cout << "serving " << frames.Frame().size() << " frames on ws://127.0.0.1:" << server.Port() << "/v2/iex" << std::endl;
+      server.Run();
+      return EXIT_SUCCESS;
+    }
+
+    if ( "bench" == sMode ) {
+      if ( "synth" == sFileName ) {
+        return replay::Bench( replay::Frames( 200000, 500, 8 ), options );
+      }
+      return replay::Bench( replay::Frames( sFileName ), options );
+    }
+
+    Usage();
+    return EXIT_FAILURE;
+  }
+  catch ( const std::exception& e ) {
+    std::cout << "AlpacaReplay: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+}
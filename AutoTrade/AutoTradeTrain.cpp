@@ -0,0 +1,376 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    AutoTradeTrain.cpp
+ * Author:  raymond@burkholder.net
+ * Project: AutoTrade
+ * Created: October 19, 2026 14:40
+ */
+
+// offline training of the AutoTrade NeuralNet from sessions saved by AutoTrade (Strategy::SaveWatch)
+//   patterns are built as Strategy builds them live: Input on each tick indicator trade,
+//   labelled by the zigzag of the stochastic on 1 second quote bars
+//   the resulting weights file is loaded by AutoTrade at startup with nn_weights= in AutoTrade.cfg
+
+// AutoTradeTrain --config x64/debug/AutoTrade.cfg --output autotrade.nn
+//   [--group "/app/AutoTrade/20230707 13:30:01.123456-1" ...]  (default: each session under --root /app/AutoTrade)
+//   [--file tradeframe.hdf5] [--epochs 20] [--batch 256] [--threads 0] [--rate 0.5] [--resume autotrade.nn]
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <stdexcept>
+
+#include <boost/program_options.hpp>
+namespace po = boost::program_options;
+
+#include <TFTimeSeries/TimeSeries.h>
+#include <TFTimeSeries/BarFactory.h>
+
+#include <TFIndicators/TSSWStochastic.h>
+
+#include <TFHDF5TimeSeries/HDF5DataManager.h>
+#include <TFHDF5TimeSeries/HDF5TimeSeriesContainer.h>
+
+#include "Config.hpp"
+#include "NeuralNet.hpp"
+#include "NeuralNetTrainer.hpp"
+
+namespace {
+
+  // as in Strategy.cpp
+  static const double c_zigzag_hi = 96.0;
+  static const double c_zigzag_lo =  4.0;
+
+  template<typename TS>
+  bool Load( ou::tf::HDF5DataManager& dm, const std::string& sPath, TS& series ) {
+    using datum_t = typename TS::datum_t;
+    try {
+      ou::tf::HDF5TimeSeriesContainer<datum_t> repository( dm, sPath );
+      typename ou::tf::HDF5TimeSeriesContainer<datum_t>::iterator begin, end;
+      begin = repository.begin();
+      end = repository.end();
+      series.Resize( end - begin );
+      repository.Read( begin, end, &series );
+      return true;
+    }
+    catch ( const std::runtime_error& e ) {
+      return false;
+    }
+  }
+
+  // replays a session through the indicators and zigzag of Strategy, and accumulates the labelled patterns
+  class Patterns {
+  public:
+
+    Patterns( const config::Options& options )
+    : m_options( options ), m_pStochastic( nullptr )
+    {}
+
+    void Session( const ou::tf::Quotes& quotesSession, const ou::tf::Trades& ticks ) {
+
+      ou::tf::Quotes quotes; // the stochastic attaches to a growing series, as with the watch live
+      ou::tf::TSSWStochastic stochastic(
+        quotes, m_options.nStochasticPeriods, boost::posix_time::seconds( m_options.nPeriodWidth ),
+        []( ptime, double, double, double ){} );
+
+      m_pStochastic = &stochastic;
+
+      ou::tf::BarFactory bfQuotes01Sec( 1 );
+      bfQuotes01Sec.SetOnBarComplete( MakeDelegate( this, &Patterns::HandleBarQuotes01Sec ) );
+
+      m_eZigZag = EZigZag::EndPoint1;
+      m_dblStochastic = 0.0;
+      m_dblEndPoint2 = 0.0;
+      m_quote = ou::tf::Quote();
+      m_nSteps = 0;
+      m_vecInputLayer.setZero();
+      m_vPending.clear();
+
+      // merge by time, quotes ahead of ticks with the same time stamp
+      ou::tf::Quotes::const_iterator iterQuote = quotesSession.begin();
+      ou::tf::Trades::const_iterator iterTick = ticks.begin();
+      while ( ( quotesSession.end() != iterQuote ) || ( ticks.end() != iterTick ) ) {
+        const bool bQuote
+          = ( quotesSession.end() != iterQuote )
+          && ( ( ticks.end() == iterTick ) || ( iterQuote->DateTime() <= iterTick->DateTime() ) );
+        if ( bQuote ) {
+          const ou::tf::Quote& quote( *iterQuote );
+          if ( quote.IsNonZero() ) {
+            quotes.Append( quote );
+            m_quote = quote;
+            bfQuotes01Sec.Add( quote.DateTime(), quote.Midpoint(), 1 );
+          }
+          ++iterQuote;
+        }
+        else {
+          Queue( NeuralNet::Input::Scale( m_dblStochastic, iterTick->Price() ) );
+          ++iterTick;
+        }
+      }
+      // patterns still pending at the end of the session have no direction, as live, they are dropped
+
+      m_pStochastic = nullptr;
+    }
+
+    std::size_t Rows() const { return m_vOutput.size() / NeuralNet::c_nOutputLayerNodes; }
+
+    void Matrices( NeuralNetTrainer::matInput_t& matInput, NeuralNetTrainer::matOutput_t& matOutput ) const {
+      const std::size_t nRows = Rows();
+      matInput = Eigen::Map<const NeuralNetTrainer::matInput_t>( m_vInput.data(), nRows, NeuralNet::c_nInputLayerNodes );
+      matOutput = Eigen::Map<const NeuralNetTrainer::matOutput_t>( m_vOutput.data(), nRows, NeuralNet::c_nOutputLayerNodes );
+    }
+
+  private:
+
+    enum class EZigZag { EndPoint1, EndPoint2, HighFound, LowFound };
+
+    const config::Options& m_options;
+
+    const ou::tf::TSSWStochastic* m_pStochastic;
+
+    EZigZag m_eZigZag;
+    double m_dblStochastic;
+    double m_dblEndPoint2;
+    ou::tf::Quote m_quote;
+
+    std::size_t m_nSteps;
+    NeuralNet::vecInputLayer_t m_vecInputLayer;
+    std::vector<NeuralNet::vecInputLayer_t> m_vPending; // windows awaiting a direction
+
+    std::vector<double> m_vInput;  // row major patterns
+    std::vector<double> m_vOutput;
+
+    // NeuralNet::TrainingStepPattern trains once the window is full
+    void Queue( const NeuralNet::Input& input ) {
+      NeuralNet::Shift( m_vecInputLayer, input );
+      m_nSteps++;
+      if ( NeuralNet::c_nTimeSteps <= m_nSteps ) {
+        m_vPending.emplace_back( m_vecInputLayer );
+      }
+    }
+
+    void Submit( const NeuralNet::Output& output ) {
+      for ( const NeuralNet::vecInputLayer_t& window: m_vPending ) {
+        m_vInput.insert( m_vInput.end(), window.data(), window.data() + window.size() );
+        m_vOutput.push_back( output.buy );
+        m_vOutput.push_back( output.neutral );
+        m_vOutput.push_back( output.sell );
+      }
+      m_vPending.clear();
+    }
+
+    // the labelling of Strategy::HandleBarQuotes01Sec, without the charting
+    void HandleBarQuotes01Sec( const ou::tf::Bar& ) {
+      m_dblStochastic = m_pStochastic->K();
+      switch ( m_eZigZag ) {
+        case EZigZag::EndPoint1:
+          m_eZigZag = EZigZag::EndPoint2;
+          break;
+        case EZigZag::EndPoint2:
+          if ( c_zigzag_hi < m_dblStochastic ) {
+            m_dblEndPoint2 = m_quote.Bid();
+            Submit( NeuralNet::Output( 1.0, 0.0, 0.0 ) );
+            m_eZigZag = EZigZag::HighFound;
+          }
+          else {
+            if ( c_zigzag_lo > m_dblStochastic ) {
+              m_dblEndPoint2 = m_quote.Ask();
+              Submit( NeuralNet::Output( 0.0, 0.0, 1.0 ) );
+              m_eZigZag = EZigZag::LowFound;
+            }
+          }
+          break;
+        case EZigZag::HighFound:
+          if ( c_zigzag_hi < m_dblStochastic ) {
+            const double bid = m_quote.Bid();
+            if ( m_dblEndPoint2 < bid ) {
+              m_dblEndPoint2 = bid;
+              Submit( NeuralNet::Output( 1.0, 0.0, 0.0 ) );
+            }
+          }
+          else {
+            if ( c_zigzag_lo > m_dblStochastic ) {
+              m_dblEndPoint2 = m_quote.Bid();
+              Submit( NeuralNet::Output( 0.0, 0.0, 1.0 ) );
+              m_eZigZag = EZigZag::LowFound;
+            }
+          }
+          break;
+        case EZigZag::LowFound:
+          if ( c_zigzag_lo > m_dblStochastic ) {
+            const double ask = m_quote.Ask();
+            if ( m_dblEndPoint2 > ask ) {
+              m_dblEndPoint2 = ask;
+              Submit( NeuralNet::Output( 0.0, 0.0, 1.0 ) );
+            }
+          }
+          else {
+            if ( c_zigzag_hi < m_dblStochastic ) {
+              m_dblEndPoint2 = m_quote.Ask();
+              Submit( NeuralNet::Output( 1.0, 0.0, 0.0 ) );
+              m_eZigZag = EZigZag::HighFound;
+            }
+          }
+          break;
+      }
+    }
+  };
+
+  // each session group directly under the root, as named by AppAutoTrade
+  void Sessions( ou::tf::HDF5DataManager& dm, const std::string& sRoot, std::vector<std::string>& vGroup ) {
+    try {
+      H5::Group group( dm.GetH5File()->openGroup( sRoot ) );
+      for ( hsize_t ix = 0; ix < group.getNumObjs(); ix++ ) {
+        if ( H5G_GROUP == group.getObjTypeByIdx( ix ) ) {
+          vGroup.push_back( sRoot + "/" + group.getObjnameByIdx( ix ) );
+        }
+      }
+    }
+    catch ( const H5::Exception& e ) {
+      std::cout << "no sessions found under " << sRoot << std::endl;
+    }
+  }
+
+} // namespace anonymous
+
+int main( int argc, char* argv[] ) {
+
+  std::string sConfig;
+  std::string sFile;
+  std::string sRoot;
+  std::vector<std::string> vGroup;
+  std::string sOutput;
+  std::string sResume;
+
+  NeuralNetTrainer::Options options;
+
+  po::options_description description( "AutoTradeTrain" );
+  description.add_options()
+    ( "help", "this text" )
+    ( "config", po::value<std::string>( &sConfig )->default_value( "x64/debug/AutoTrade.cfg" ), "AutoTrade config, for symbols and indicator periods" )
+    ( "file", po::value<std::string>( &sFile ), "hdf5 data file, default data file when not supplied" )
+    ( "root", po::value<std::string>( &sRoot )->default_value( "/app/AutoTrade" ), "sessions to train on, when no --group" )
+    ( "group", po::value<std::vector<std::string> >( &vGroup ), "session group, repeatable" )
+    ( "output", po::value<std::string>( &sOutput )->required(), "weights file, written as a checkpoint during training" )
+    ( "resume", po::value<std::string>( &sResume ), "weights file to start from" )
+    ( "epochs", po::value<std::size_t>( &options.nEpochs )->default_value( options.nEpochs ), "passes over the patterns" )
+    ( "batch", po::value<std::size_t>( &options.nBatchSize )->default_value( options.nBatchSize ), "patterns per weight update" )
+    ( "threads", po::value<std::size_t>( &options.nThreads )->default_value( options.nThreads ), "0 for hardware concurrency" )
+    ( "rate", po::value<double>( &options.dblLearningRate )->default_value( options.dblLearningRate ), "learning rate" )
+    ( "seed", po::value<unsigned int>( &options.nSeed )->default_value( options.nSeed ), "shuffle seed" )
+    ( "checkpoint", po::value<std::size_t>( &options.nCheckpointEpochs )->default_value( options.nCheckpointEpochs ), "epochs per checkpoint" )
+    ;
+
+  try {
+    po::variables_map vm;
+    po::store( po::parse_command_line( argc, argv, description ), vm );
+    if ( 0 < vm.count( "help" ) ) {
+      std::cout << description << std::endl;
+      return EXIT_SUCCESS;
+    }
+    po::notify( vm );
+  }
+  catch ( const std::exception& e ) {
+    std::cout << e.what() << std::endl << description << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  config::Options choices;
+  if ( !config::Load( sConfig, choices ) ) {
+    return EXIT_FAILURE;
+  }
+  if ( choices.sSymbol_Tick.empty() ) {
+    std::cout << sConfig << " needs symbol_tick= for the network input" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  options.sCheckpoint = sOutput;
+
+  Patterns patterns( choices );
+
+  {
+    const auto tpBegin = std::chrono::steady_clock::now();
+
+    std::unique_ptr<ou::tf::HDF5DataManager> pdm;
+    if ( sFile.empty() ) pdm = std::make_unique<ou::tf::HDF5DataManager>( ou::tf::HDF5DataManager::RO );
+    else pdm = std::make_unique<ou::tf::HDF5DataManager>( ou::tf::HDF5DataManager::RO, sFile );
+
+    if ( vGroup.empty() ) Sessions( *pdm, sRoot, vGroup );
+
+    for ( const std::string& sGroup: vGroup ) {
+      ou::tf::Quotes quotes;
+      ou::tf::Trades ticks;
+      if ( !Load( *pdm, sGroup + ou::tf::Quotes::Directory() + choices.sSymbol_Trade, quotes ) ) {
+        std::cout << sGroup << " has no quotes for " << choices.sSymbol_Trade << ", skipped" << std::endl;
+        continue;
+      }
+      if ( !Load( *pdm, sGroup + ou::tf::Trades::Directory() + choices.sSymbol_Tick, ticks ) ) {
+        std::cout << sGroup << " has no ticks for " << choices.sSymbol_Tick << ", skipped" << std::endl;
+        continue;
+      }
+      const std::size_t nRows = patterns.Rows();
+      patterns.Session( quotes, ticks );
+      std::cout
+        << sGroup
+        << ": quotes=" << quotes.Size()
+        << ",ticks=" << ticks.Size()
+        << ",patterns=" << patterns.Rows() - nRows
+        << std::endl;
+    }
+
+    const std::chrono::duration<double> duration( std::chrono::steady_clock::now() - tpBegin );
+    std::cout << "patterns=" << patterns.Rows() << " built in " << duration.count() << "s" << std::endl;
+  }
+
+  if ( 0 == patterns.Rows() ) {
+    std::cout << "no patterns to train on" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  NeuralNetTrainer::matInput_t matInput;
+  NeuralNetTrainer::matOutput_t matOutput;
+  patterns.Matrices( matInput, matOutput );
+
+  try {
+    NeuralNetTrainer trainer( options );
+
+    if ( !sResume.empty() ) {
+      NeuralNet::Weights weights;
+      weights.Load( sResume );
+      trainer.Set( weights );
+    }
+
+    const double mse = trainer.Train(
+      matInput, matOutput,
+      [nRows=matInput.rows()]( const NeuralNetTrainer::Epoch& epoch ){
+        std::cout
+          << "epoch " << epoch.nEpoch
+          << ": mse=" << epoch.mse
+          << ",seconds=" << epoch.duration.count()
+          << ",patterns/sec=" << nRows / epoch.duration.count()
+          << std::endl;
+      } );
+
+    std::cout << sOutput << " written, mse=" << mse << std::endl;
+  }
+  catch ( const std::exception& e ) {
+    std::cout << "training failed: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -39,6 +39,7 @@ namespace {
   static const std::string sOption_MA2Periods( "ma2_periods" );
   static const std::string sOption_MA3Periods( "ma3_periods" );
   static const std::string sOption_StochasticPeriods( "stochastic_periods" );
+  static const std::string sOption_NeuralNetWeights( "nn_weights" );
   static const std::string sOption_SimStart( "sim_start" );
   static const std::string sOption_GroupDirectory( "group_directory" );
 
@@ -81,6 +82,8 @@ bool Load( const std::string& sFileName, Options& options ) {
 
       ( sOption_StochasticPeriods.c_str(),  po::value<int>( &options.nStochasticPeriods), "stochastic (#periods)" )
 
+      ( sOption_NeuralNetWeights.c_str(), po::value<std::string>( &options.sNeuralNetWeights)->default_value( "" ), "neural net weights file" )
+
       ( sOption_GroupDirectory.c_str(), po::value<std::string>( &options.sGroupDirectory)->default_value( "" ), "hdf5 group directory, no trailing /" )
 
       ( sOption_SimStart.c_str(), po::value<bool>( &options.bSimStart)->default_value( false ), "auto start simulation" )
@@ -113,6 +116,7 @@ bool Load( const std::string& sFileName, Options& options ) {
       bOk &= parse<int>( sFileName, vm, sOption_MA3Periods,  options.nMA3Periods );
 
       bOk &= parse<int>( sFileName, vm, sOption_StochasticPeriods,  options.nStochasticPeriods );
+      bOk &= parse<std::string>( sFileName, vm, sOption_NeuralNetWeights, options.sNeuralNetWeights );
 
       bOk &= parse<bool>( sFileName, vm, sOption_SimStart, options.bSimStart );
       bOk &= parse<std::string>( sFileName, vm, sOption_GroupDirectory, options.sGroupDirectory );
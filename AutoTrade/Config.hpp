@@ -47,6 +47,9 @@ struct Options {
 
   int nStochasticPeriods;
 
+  // NeuralNet weights from AutoTradeTrain, empty for random initial state
+  std::string sNeuralNetWeights;
+
   // force a simulation run
   bool bSimStart;
 
@@ -19,45 +19,131 @@
  * Created: 2023/07/03 16:49:40
  */
 
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+#include <algorithm>
+#include <stdexcept>
+
 #include "NeuralNet.hpp"
 
 namespace {
   double c_LearningRate( 0.1 );
+
+  // tick indicator (eg JT6T.Z) is open ended, +/- 1000 covers most of a session
+  const double c_TickScale( 1000.0 );
+
+  // checkpoint layout: magic, version, layer sizes, then each of the weights in eigen (column major) order
+  const char c_szMagic[] = "ou.tf.nn";
+  const uint32_t c_nVersion( 1 );
+
+  template<typename Matrix>
+  void Write( std::ofstream& ofs, const Matrix& matrix ) {
+    ofs.write( reinterpret_cast<const char*>( matrix.data() ), sizeof( double ) * matrix.size() );
+  }
+
+  template<typename Matrix>
+  void Read( std::ifstream& ifs, Matrix& matrix ) {
+    ifs.read( reinterpret_cast<char*>( matrix.data() ), sizeof( double ) * matrix.size() );
+  }
+}
+
+NeuralNet::Input NeuralNet::Input::Scale( double stochastic, double tick ) {
+  return Input(
+    ( stochastic / 50.0 ) - 1.0,
+    std::clamp( tick / c_TickScale, -1.0, +1.0 )
+  );
+}
+
+void NeuralNet::Weights::Random() {
+  // 0.5 to cut -1.0 .. +1.0 down to -0.5 .. +0.5
+  matHidden     = 0.5 * matHiddenLayerWeights_t::Random();
+  vecHiddenBias = 0.5 * vecHiddenLayer_t::Random();
+  matOutput     = 0.5 * matOutputLayerWeights_t::Random();
+  vecOutputBias = 0.5 * vecOutputLayer_t::Random();
+}
+
+void NeuralNet::Weights::Save( const std::string& sFileName ) const {
+  const std::string sTemp( sFileName + ".tmp" );
+  {
+    std::ofstream ofs( sTemp, std::ios::binary | std::ios::trunc );
+    if ( !ofs ) throw std::runtime_error( "NeuralNet::Weights::Save can not open " + sTemp );
+    const uint32_t rSize[] = {
+      (uint32_t) c_nTimeSteps, (uint32_t) c_nInputLayerNodes, (uint32_t) c_nHiddenLayerNodes, (uint32_t) c_nOutputLayerNodes
+    };
+    ofs.write( c_szMagic, sizeof( c_szMagic ) );
+    ofs.write( reinterpret_cast<const char*>( &c_nVersion ), sizeof( c_nVersion ) );
+    ofs.write( reinterpret_cast<const char*>( rSize ), sizeof( rSize ) );
+    Write( ofs, matHidden );
+    Write( ofs, vecHiddenBias );
+    Write( ofs, matOutput );
+    Write( ofs, vecOutputBias );
+    if ( !ofs ) throw std::runtime_error( "NeuralNet::Weights::Save failed writing " + sTemp );
+  }
+  if ( 0 != std::rename( sTemp.c_str(), sFileName.c_str() ) ) { // a reader never sees a partial checkpoint
+    throw std::runtime_error( "NeuralNet::Weights::Save can not rename to " + sFileName );
+  }
+}
+
+void NeuralNet::Weights::Load( const std::string& sFileName ) {
+  std::ifstream ifs( sFileName, std::ios::binary );
+  if ( !ifs ) throw std::runtime_error( "NeuralNet::Weights::Load can not open " + sFileName );
+  char szMagic[ sizeof( c_szMagic ) ];
+  uint32_t nVersion {};
+  uint32_t rSize[ 4 ];
+  ifs.read( szMagic, sizeof( szMagic ) );
+  ifs.read( reinterpret_cast<char*>( &nVersion ), sizeof( nVersion ) );
+  ifs.read( reinterpret_cast<char*>( rSize ), sizeof( rSize ) );
+  if ( !ifs || !std::equal( szMagic, szMagic + sizeof( szMagic ), c_szMagic ) || ( c_nVersion != nVersion ) ) {
+    throw std::runtime_error( "NeuralNet::Weights::Load " + sFileName + " is not a weights file" );
+  }
+  if ( ( c_nTimeSteps != rSize[ 0 ] ) || ( c_nInputLayerNodes != rSize[ 1 ] )
+    || ( c_nHiddenLayerNodes != rSize[ 2 ] ) || ( c_nOutputLayerNodes != rSize[ 3 ] ) ) {
+    throw std::runtime_error( "NeuralNet::Weights::Load " + sFileName + " has different layer sizes" );
+  }
+  Weights weights;
+  Read( ifs, weights.matHidden );
+  Read( ifs, weights.vecHiddenBias );
+  Read( ifs, weights.matOutput );
+  Read( ifs, weights.vecOutputBias );
+  if ( !ifs ) throw std::runtime_error( "NeuralNet::Weights::Load " + sFileName + " is truncated" );
+  *this = weights;
 }
 
 NeuralNet::NeuralNet()
 : m_nTrainingSteps {}
 {
+  m_vecInputLayer.setZero();
   SetInitialState();
 }
 
 NeuralNet::~NeuralNet() {}
 
 void NeuralNet::SetInitialState() {
-  // 0.5 to cut -1.0 .. +1.0 down to -0.5 .. +0.5
-  m_matHiddenLayerWeights     = 0.5 * matHiddenLayerWeights_t::Random();
-  m_vecHiddenLayerBiasWeights = 0.5 * vecHiddenLayer_t::Random();
-  m_matOutputLayerWeights     = 0.5 * matOutputLayerWeights_t::Random();
-  m_vecOutputLayerBiasWeights = 0.5 * vecOutputLayer_t::Random();
+  m_weights.Random();
 }
 
-void NeuralNet::TrainingStepPattern( const Input& input, const Output& expected ) {
+void NeuralNet::Set( const Weights& weights ) {
+  m_weights = weights;
+}
 
-  m_outputExpected = expected;
+void NeuralNet::Load( const std::string& sFileName ) {
+  m_weights.Load( sFileName );
+}
 
-  std::size_t nCountDown = c_nTimeSteps - 1;
-  vecInputLayer_t::iterator iter;
-  for ( iter = m_vecInputLayer.begin(); iter != m_vecInputLayer.end(); iter++ ) {
-    for ( std::size_t nStride = c_nStrideSize; 0 != nStride; nStride-- ) {
-      *iter = *(iter + c_nStrideSize );
-      iter++;
-    }
-    nCountDown--;
-    if ( 0 == nCountDown ) break;
+void NeuralNet::Shift( vecInputLayer_t& vecInputLayer, const Input& input ) {
+  for ( std::size_t ix = 0; ix < ( c_nInputLayerNodes - c_nStrideSize ); ix++ ) {
+    vecInputLayer[ ix ] = vecInputLayer[ ix + c_nStrideSize ];
   }
+  vecInputLayer[ c_nInputLayerNodes - 2 ] = input.stochastic;
+  vecInputLayer[ c_nInputLayerNodes - 1 ] = input.tick;
+}
+
+void NeuralNet::TrainingStepPattern( const Input& input, const Output& expected ) {
+
+  m_outputExpected = expected;
 
-  *iter++ = input.stochastic;
-  *iter++ = input.tick;
+  Shift( m_vecInputLayer, input );
 
   m_nTrainingSteps++;
 
@@ -111,13 +197,12 @@ void NeuralNet::TrainingStep() {
 
   // Feed Forward
 
-  vecHiddenLayer_t vecHiddenLayerIn = m_vecHiddenLayerBiasWeights + ( m_vecInputLayer * m_matHiddenLayerWeights );
-  m_vecHiddenLayer = vecHiddenLayerIn;
+  m_vecHiddenLayer = m_weights.vecHiddenBias + ( m_vecInputLayer * m_weights.matHidden );
   for ( vecHiddenLayer_t::value_type& hidden: m_vecHiddenLayer ) {
     hidden = bipolar_sigmoid( hidden );
   }
 
-  m_vecOutputLayer = m_vecOutputLayerBiasWeights + ( m_vecHiddenLayer * m_matOutputLayerWeights );
+  m_vecOutputLayer = m_weights.vecOutputBias + ( m_vecHiddenLayer * m_weights.matOutput );
   for ( vecOutputLayer_t::value_type& output: m_vecOutputLayer ) {
     output = binary_sigmoid( output );
   }
@@ -154,16 +239,17 @@ void NeuralNet::TrainingStep() {
 
   const vecOutputLayer_t vecOutputBiasCorrection = c_LearningRate * vecOutputLayerDelta;
 
-  vecHiddenLayer_t vecHiddenLayerDelta = vecOutputLayerDelta * matOutputWeightCorrection;
+  // propagate through the weights prior to their update
+  vecHiddenLayer_t vecHiddenLayerDelta = vecOutputLayerDelta * m_weights.matOutput.transpose();
 
   // https://iamfaisalkhan.com/matrix-manipulations-using-eigen-cplusplus/
   // Array class may help with this
   vecHiddenLayer_t::iterator iterDelta = vecHiddenLayerDelta.begin();
-  vecHiddenLayer_t::const_iterator iterHiddenIn = vecHiddenLayerIn.begin();
+  vecHiddenLayer_t::const_iterator iterHidden = m_vecHiddenLayer.begin();
   while ( vecHiddenLayerDelta.end() != iterDelta ) {
-    *iterDelta *= bipolar_sigmoid_pd2( *iterHiddenIn );
+    *iterDelta *= bipolar_sigmoid_pd2( *iterHidden ); // pd2 is in terms of the activation output
     iterDelta++;
-    iterHiddenIn++;
+    iterHidden++;
   }
 
   matHiddenLayerWeights_t matHiddenLayerCorrection
@@ -173,11 +259,11 @@ void NeuralNet::TrainingStep() {
 
   // Update weights and biases
 
-  m_matHiddenLayerWeights += matHiddenLayerCorrection;
-  m_vecHiddenLayerBiasWeights += vecHiddenLayerBiasWeightsCorrection;
+  m_weights.matHidden += matHiddenLayerCorrection;
+  m_weights.vecHiddenBias += vecHiddenLayerBiasWeightsCorrection;
 
-  m_matOutputLayerWeights += matOutputWeightCorrection.transpose();
-  m_vecOutputLayerBiasWeights += vecOutputBiasCorrection;
+  m_weights.matOutput += matOutputWeightCorrection.transpose();
+  m_weights.vecOutputBias += vecOutputBiasCorrection;
 
 }
 
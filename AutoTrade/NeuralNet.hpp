@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <string>
+
 #include <eigen3/Eigen/Core>
 
 class NeuralNet {
@@ -34,6 +36,8 @@ public:
     double tick;  // range -1.0 .. +1.0
     Input(): stochastic {}, tick {} {}
     Input( double stochastic_, double tick_ ): stochastic( stochastic_ ), tick( tick_ ) {}
+    // from raw stochastic 0 .. 100, and raw tick indicator, as used by Strategy and AutoTradeTrain
+    static Input Scale( double stochastic, double tick );
   };
 
   struct Output {
@@ -45,12 +49,6 @@ public:
     : buy( buy_ ), neutral( neutral_ ), sell( sell_ ) {}
   };
 
-  void SetInitialState();
-  void TrainingStepPattern( const Input&, const Output& );
-
-protected:
-private:
-
   static const std::size_t c_nTimeSteps = 4;
   static const std::size_t c_nStrideSize = 2; // based upon #elements in struct Input
   static const std::size_t c_nInputLayerNodes = c_nTimeSteps * c_nStrideSize;
@@ -64,14 +62,37 @@ private:
   using matOutputLayerWeights_t = Eigen::Matrix<double, c_nHiddenLayerNodes, c_nOutputLayerNodes>;
   using vecOutputLayer_t =        Eigen::Matrix<double, 1, c_nOutputLayerNodes>;
 
+  struct Weights {
+    matHiddenLayerWeights_t matHidden;
+    vecHiddenLayer_t vecHiddenBias;
+    matOutputLayerWeights_t matOutput;
+    vecOutputLayer_t vecOutputBias;
+
+    void Random(); // -0.5 .. +0.5
+
+    // checkpoint file, throws std::runtime_error on failure or on a layer size mismatch
+    void Save( const std::string& sFileName ) const; // written to a temporary, then renamed
+    void Load( const std::string& sFileName );
+  };
+
+  // the input layer is a sliding window of c_nTimeSteps Input, oldest first
+  static void Shift( vecInputLayer_t&, const Input& );
+
+  void SetInitialState();
+  void Set( const Weights& );
+  const Weights& Get() const { return m_weights; }
+  void Load( const std::string& sFileName ); // weights from AutoTradeTrain
+
+  void TrainingStepPattern( const Input&, const Output& );
+
+protected:
+private:
+
   vecInputLayer_t m_vecInputLayer;
 
-  matHiddenLayerWeights_t m_matHiddenLayerWeights;
-  vecHiddenLayer_t m_vecHiddenLayerBiasWeights;
-  vecHiddenLayer_t m_vecHiddenLayer;
+  Weights m_weights;
 
-  matOutputLayerWeights_t m_matOutputLayerWeights;
-  vecOutputLayer_t m_vecOutputLayerBiasWeights;
+  vecHiddenLayer_t m_vecHiddenLayer;
   vecOutputLayer_t m_vecOutputLayer;
 
   Output m_outputExpected;
@@ -0,0 +1,242 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    NeuralNetTrainer.cpp
+ * Author:  raymond@burkholder.net
+ * Project: AutoTrade
+ * Created: October 19, 2026 14:05
+ */
+
+#include <random>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
+
+#include "NeuralNetTrainer.hpp"
+
+namespace {
+
+  // batch forms of the activations in NeuralNet.cpp
+  using matHidden_t = Eigen::Matrix<double, Eigen::Dynamic, NeuralNet::c_nHiddenLayerNodes, Eigen::RowMajor>;
+  using matOutput_t = Eigen::Matrix<double, Eigen::Dynamic, NeuralNet::c_nOutputLayerNodes, Eigen::RowMajor>;
+
+  template<typename Matrix>
+  void bipolar_sigmoid( Matrix& m ) { // -1.0 .. +1.0
+    m = ( ( 2.0 / ( 1.0 + ( -m.array() ).exp() ) ) - 1.0 ).matrix();
+  }
+
+  template<typename Matrix>
+  void binary_sigmoid( Matrix& m ) { // 0.0 .. 1.0
+    m = ( 1.0 / ( 1.0 + ( -m.array() ).exp() ) ).matrix();
+  }
+}
+
+void NeuralNetTrainer::Gradient::Zero() {
+  matHidden.setZero();
+  vecHiddenBias.setZero();
+  matOutput.setZero();
+  vecOutputBias.setZero();
+  sse = 0.0;
+}
+
+NeuralNetTrainer::NeuralNetTrainer( const Options& options )
+: m_options( options )
+, m_nGeneration {}, m_nPending {}
+, m_ixBatchBegin {}, m_nBatchRows {}
+, m_bStop( false )
+{
+  if ( 0 == m_options.nBatchSize ) {
+    throw std::runtime_error( "NeuralNetTrainer: batch size needs to be at least 1" );
+  }
+
+  m_weights.Random();
+
+  std::size_t nThreads = m_options.nThreads;
+  if ( 0 == nThreads ) nThreads = std::max<std::size_t>( 1, std::thread::hardware_concurrency() );
+  nThreads = std::min( nThreads, m_options.nBatchSize ); // at least a row each
+
+  m_vGradient.resize( nThreads );
+  for ( std::size_t ix = 0; ix < nThreads; ix++ ) {
+    m_vThread.emplace_back( [this,ix](){ Worker( ix ); } );
+  }
+}
+
+NeuralNetTrainer::~NeuralNetTrainer() {
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_bStop = true;
+  }
+  m_cvWork.notify_all();
+  for ( std::thread& thread: m_vThread ) {
+    thread.join();
+  }
+}
+
+void NeuralNetTrainer::Set( const NeuralNet::Weights& weights ) {
+  m_weights = weights;
+}
+
+void NeuralNetTrainer::Worker( std::size_t ixWorker ) {
+  std::size_t nGeneration {};
+  while ( true ) {
+    std::size_t ixBegin;
+    std::size_t nRows;
+    {
+      std::unique_lock<std::mutex> lock( m_mutex );
+      m_cvWork.wait( lock, [this,nGeneration](){ return m_bStop || ( nGeneration != m_nGeneration ); } );
+      if ( m_bStop ) break;
+      nGeneration = m_nGeneration;
+      ixBegin = m_ixBatchBegin;
+      nRows = m_nBatchRows;
+    }
+
+    // contiguous slice of the batch, the shuffle has already randomized the rows
+    const std::size_t nWorkers = m_vGradient.size();
+    const std::size_t ixSliceBegin = ( nRows * ixWorker ) / nWorkers;
+    const std::size_t ixSliceEnd = ( nRows * ( ixWorker + 1 ) ) / nWorkers;
+    Gradient& gradient( m_vGradient[ ixWorker ] );
+    gradient.Zero();
+    if ( ixSliceEnd > ixSliceBegin ) {
+      Slice( ixBegin + ixSliceBegin, ixSliceEnd - ixSliceBegin, gradient );
+    }
+
+    {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      m_nPending--;
+      if ( 0 == m_nPending ) m_cvDone.notify_one();
+    }
+  }
+}
+
+// feed forward and back propagation of a slice of rows, as in NeuralNet::TrainingStep,
+//   with the per pattern vectors replaced by a matrix of rows
+void NeuralNetTrainer::Slice( std::size_t ixBegin, std::size_t nRows, Gradient& gradient ) const {
+
+  const auto input( m_matInputShuffled.middleRows( ixBegin, nRows ) );
+  const auto expected( m_matOutputShuffled.middleRows( ixBegin, nRows ) );
+
+  // Feed Forward
+
+  matHidden_t matHidden = input * m_weights.matHidden;
+  matHidden.rowwise() += m_weights.vecHiddenBias;
+  bipolar_sigmoid( matHidden );
+
+  matOutput_t matOutput = matHidden * m_weights.matOutput;
+  matOutput.rowwise() += m_weights.vecOutputBias;
+  binary_sigmoid( matOutput );
+
+  // Expectation
+
+  const matOutput_t matError = expected - matOutput;
+  gradient.sse = matError.squaredNorm();
+
+  // Backward Propogation, pd2 forms of the sigmoid derivatives, in terms of the activation outputs
+
+  const matOutput_t matOutputDelta
+    = ( matError.array() * matOutput.array() * ( 1.0 - matOutput.array() ) ).matrix();
+
+  const matHidden_t matHiddenDelta
+    = ( ( matOutputDelta * m_weights.matOutput.transpose() ).array()
+      * 0.5 * ( 1.0 + matHidden.array() ) * ( 1.0 - matHidden.array() ) ).matrix();
+
+  gradient.matOutput.noalias() = matHidden.transpose() * matOutputDelta;
+  gradient.vecOutputBias = matOutputDelta.colwise().sum();
+
+  gradient.matHidden.noalias() = input.transpose() * matHiddenDelta;
+  gradient.vecHiddenBias = matHiddenDelta.colwise().sum();
+}
+
+void NeuralNetTrainer::Batch( std::size_t ixBegin, std::size_t nRows ) {
+  {
+    std::unique_lock<std::mutex> lock( m_mutex );
+    m_ixBatchBegin = ixBegin;
+    m_nBatchRows = nRows;
+    m_nPending = m_vGradient.size();
+    m_nGeneration++;
+    m_cvWork.notify_all();
+    m_cvDone.wait( lock, [this](){ return 0 == m_nPending; } );
+  }
+}
+
+double NeuralNetTrainer::Train( const matInput_t& matInput, const matOutput_t& matOutput, fEpoch_t&& fEpoch ) {
+
+  const std::size_t nRows = matInput.rows();
+  if ( nRows != (std::size_t) matOutput.rows() ) {
+    throw std::runtime_error( "NeuralNetTrainer::Train input and output row counts differ" );
+  }
+  if ( 0 == nRows ) {
+    throw std::runtime_error( "NeuralNetTrainer::Train has no patterns" );
+  }
+
+  m_matInputShuffled.resize( nRows, Eigen::NoChange );
+  m_matOutputShuffled.resize( nRows, Eigen::NoChange );
+
+  std::vector<std::size_t> vIndex( nRows );
+  std::iota( vIndex.begin(), vIndex.end(), 0 );
+  std::mt19937_64 generator( m_options.nSeed );
+
+  double mse {};
+
+  for ( std::size_t nEpoch = 1; nEpoch <= m_options.nEpochs; nEpoch++ ) {
+
+    const auto tpBegin = std::chrono::steady_clock::now();
+
+    std::shuffle( vIndex.begin(), vIndex.end(), generator );
+    for ( std::size_t ix = 0; ix < nRows; ix++ ) {
+      m_matInputShuffled.row( ix ) = matInput.row( vIndex[ ix ] );
+      m_matOutputShuffled.row( ix ) = matOutput.row( vIndex[ ix ] );
+    }
+
+    double sse {};
+    for ( std::size_t ixBegin = 0; ixBegin < nRows; ixBegin += m_options.nBatchSize ) {
+
+      const std::size_t nBatchRows = std::min( m_options.nBatchSize, nRows - ixBegin );
+      Batch( ixBegin, nBatchRows );
+
+      Gradient& sum( m_vGradient[ 0 ] );
+      for ( std::size_t ix = 1; ix < m_vGradient.size(); ix++ ) {
+        const Gradient& gradient( m_vGradient[ ix ] );
+        sum.matHidden += gradient.matHidden;
+        sum.vecHiddenBias += gradient.vecHiddenBias;
+        sum.matOutput += gradient.matOutput;
+        sum.vecOutputBias += gradient.vecOutputBias;
+        sum.sse += gradient.sse;
+      }
+      sse += sum.sse;
+
+      // error is expected - actual, so the correction is added, as in NeuralNet::TrainingStep
+      const double rate = m_options.dblLearningRate / nBatchRows;
+      m_weights.matHidden += rate * sum.matHidden;
+      m_weights.vecHiddenBias += rate * sum.vecHiddenBias;
+      m_weights.matOutput += rate * sum.matOutput;
+      m_weights.vecOutputBias += rate * sum.vecOutputBias;
+    }
+
+    mse = sse / ( nRows * NeuralNet::c_nOutputLayerNodes );
+
+    const bool bLast( m_options.nEpochs == nEpoch );
+    if ( !m_options.sCheckpoint.empty() ) {
+      if ( bLast || ( ( 0 < m_options.nCheckpointEpochs ) && ( 0 == ( nEpoch % m_options.nCheckpointEpochs ) ) ) ) {
+        m_weights.Save( m_options.sCheckpoint );
+      }
+    }
+
+    if ( fEpoch ) {
+      fEpoch( Epoch{ nEpoch, mse, std::chrono::steady_clock::now() - tpBegin } );
+    }
+  }
+
+  return mse;
+}
@@ -0,0 +1,113 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    NeuralNetTrainer.hpp
+ * Author:  raymond@burkholder.net
+ * Project: AutoTrade
+ * Created: October 19, 2026 14:05
+ */
+
+// offline mini-batch training of the NeuralNet weights
+//   patterns are rows of a matrix: input layer window in, expected output out
+//   each epoch shuffles the rows, each mini-batch is split across worker threads,
+//   each worker runs feed forward / back propagation on its slice as matrix-matrix products,
+//   and the summed gradients are applied once per mini-batch
+
+#pragma once
+
+#include <mutex>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <condition_variable>
+
+#include "NeuralNet.hpp"
+
+class NeuralNetTrainer {
+public:
+
+  using matInput_t  = Eigen::Matrix<double, Eigen::Dynamic, NeuralNet::c_nInputLayerNodes,  Eigen::RowMajor>;
+  using matOutput_t = Eigen::Matrix<double, Eigen::Dynamic, NeuralNet::c_nOutputLayerNodes, Eigen::RowMajor>;
+
+  struct Options {
+    std::size_t nEpochs;
+    std::size_t nBatchSize;    // rows per weight update
+    std::size_t nThreads;      // 0 for std::thread::hardware_concurrency
+    double dblLearningRate;    // applied to the batch mean gradient
+    unsigned int nSeed;        // epoch shuffle
+    std::string sCheckpoint;   // weights file, written per nCheckpointEpochs and at completion, empty for none
+    std::size_t nCheckpointEpochs;
+    Options()
+    : nEpochs( 20 ), nBatchSize( 256 ), nThreads {}
+    , dblLearningRate( 0.5 ), nSeed( 1 )
+    , nCheckpointEpochs( 1 )
+    {}
+  };
+
+  struct Epoch {
+    std::size_t nEpoch;
+    double mse;  // mean squared error, pre-update, over the epoch
+    std::chrono::duration<double> duration;
+  };
+
+  using fEpoch_t = std::function<void( const Epoch& )>;
+
+  NeuralNetTrainer( const Options& );
+  ~NeuralNetTrainer();
+
+  void Set( const NeuralNet::Weights& ); // resume from a checkpoint, otherwise random
+  const NeuralNet::Weights& Get() const { return m_weights; }
+
+  // rows of input and output are paired, returns final epoch mse
+  double Train( const matInput_t&, const matOutput_t&, fEpoch_t&& );
+
+protected:
+private:
+
+  struct Gradient {
+    NeuralNet::matHiddenLayerWeights_t matHidden;
+    NeuralNet::vecHiddenLayer_t vecHiddenBias;
+    NeuralNet::matOutputLayerWeights_t matOutput;
+    NeuralNet::vecOutputLayer_t vecOutputBias;
+    double sse; // sum of squared error
+    void Zero();
+  };
+
+  const Options m_options;
+
+  NeuralNet::Weights m_weights;
+
+  matInput_t m_matInputShuffled;
+  matOutput_t m_matOutputShuffled;
+
+  // batch hand-off to the workers
+  std::mutex m_mutex;
+  std::condition_variable m_cvWork;
+  std::condition_variable m_cvDone;
+  std::size_t m_nGeneration;   // incremented per batch
+  std::size_t m_nPending;      // workers still on the current batch
+  std::size_t m_ixBatchBegin;
+  std::size_t m_nBatchRows;
+  bool m_bStop;
+
+  std::vector<Gradient> m_vGradient; // one per worker
+  std::vector<std::thread> m_vThread;
+
+  void Worker( std::size_t ixWorker );
+  void Slice( std::size_t ixBegin, std::size_t nRows, Gradient& ) const;
+  void Batch( std::size_t ixBegin, std::size_t nRows );
+
+};
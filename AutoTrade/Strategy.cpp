@@ -94,7 +94,7 @@ Strategy::Strategy( ou::ChartDataView& cdv, const config::Options& options )
 
   m_bfQuotes01Sec.SetOnBarComplete( MakeDelegate( this, &Strategy::HandleBarQuotes01Sec ) );
 
-  m_pStrategy_impl = std::make_unique<Strategy_impl>();
+  m_pStrategy_impl = std::make_unique<Strategy_impl>( options.sNeuralNetWeights );
 }
 
 Strategy::~Strategy() {
@@ -240,7 +240,7 @@ void Strategy::HandleTick( const ou::tf::Trade& trade ) {
   const ou::tf::Price::price_t tick = trade.Price();
   m_ceTick.Append( trade.DateTime(), tick );
 
-  m_pStrategy_impl->Queue( NeuralNet::Input( m_dblStochastic, tick ) );
+  m_pStrategy_impl->Queue( NeuralNet::Input::Scale( m_dblStochastic, tick ) );
 
   if ( false ) {
     switch ( m_stateTrade ) {
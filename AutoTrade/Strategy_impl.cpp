@@ -19,8 +19,17 @@
  * Created: 2023/07/05 21:18:28
  */
 
+#include <iostream>
+
 #include "Strategy_impl.hpp"
 
+Strategy_impl::Strategy_impl( const std::string& sWeights ) {
+  if ( !sWeights.empty() ) {
+    m_net.Load( sWeights ); // throws on a missing or mismatched file
+    std::cout << "NeuralNet weights loaded from " << sWeights << std::endl;
+  }
+}
+
 void Strategy_impl::Queue( const NeuralNet::Input& input ) {
   m_vInput.emplace_back( input );
 }
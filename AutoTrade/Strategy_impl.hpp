@@ -21,12 +21,14 @@
 
 #pragma once
 
+#include <string>
 #include <vector>
 
 #include "NeuralNet.hpp"
 
 class Strategy_impl {
 public:
+  Strategy_impl( const std::string& sWeights ); // empty for the random initial state
   void Queue( const NeuralNet::Input& );
   void Submit( const NeuralNet::Output& );
 protected:
@@ -21,7 +21,7 @@
 #include <vector>
 #include <iostream>
 
-#include <TFBitsNPieces/InstrumentFilter.h>
+#include <TFBitsNPieces/InstrumentScanner.h>
 #include <TFBitsNPieces/ReadCboeWeeklyOptionsCsv.h>
 
 #include <TFIndicators/Darvas.h>
@@ -75,39 +75,34 @@ public:
 template<typename Scenario, typename Function>
 void Process( ptime dtBegin, ptime dtEnd, size_t nMinBars, const setSymbols_t& setSymbols, Function fCheck ) {
 
-  struct data_t {
+  // filter and volatility on the worker pool, scenarios are checked in hdf5 order on this thread
+  struct result_t {
     ou::tf::Bar::volume_t volumeEma;
-    size_t nEnteredFilter;
-    size_t nPassedFilter;
-    data_t()
-      : volumeEma {}, nEnteredFilter {}, nPassedFilter {}
-      {}
+    double hv;
+    result_t(): volumeEma {}, hv {} {}
   };
 
-  data_t data;
-
   try {
-    ou::tf::InstrumentFilter<data_t,ou::tf::Bars> filter(
+    ou::tf::InstrumentScanner<ou::tf::Bars,result_t> scanner(
       "/bar/86400/",
       dtBegin, dtEnd,
-      200, data, //  need to figure out where 200 comes from, and the relation to nMinBars (=> 200sma)
-      []( data_t&, const std::string& sPath, const std::string& sGroup )->bool{ // Use Group
+      200 //  need to figure out where 200 comes from, and the relation to nMinBars (=> 200sma)
+      );
+    scanner.Scan(
+      []( const std::string& sPath, const std::string& sGroup )->bool{ // Use Group
         return true;
       },
-      [nMinBars, dtEnd, &setSymbols]( data_t& data, const std::string& sObject, const ou::tf::Bars& bars )->bool{ // Filter
-        //  std::cout << sObjectName << std::endl;
-        data.nEnteredFilter++;
+      [nMinBars, dtEnd, &setSymbols]( const std::string& sObject, const ou::tf::Bars& bars, result_t& result )->bool{ // Filter
         bool bReturn( false );
         if ( nMinBars <= bars.Size() ) {
             ou::tf::Bars::const_iterator iterVolume = bars.end() - nMinBars;
-            data.volumeEma = std::for_each( iterVolume, bars.end(), VolumeEma() );
-            if ( ( 1000000 < data.volumeEma )
+            result.volumeEma = std::for_each( iterVolume, bars.end(), VolumeEma() );
+            if ( ( 1000000 < result.volumeEma )
               && ( 30.0 <=  bars.last().Close() )
               && ( 500.0 >= bars.last().Close() )  // provides SPY at 4xx
               && ( dtEnd.date() == bars.last().DateTime().date() )
               && ( 120 < bars.Size() )
               ) {
-              data.nPassedFilter++;
               bReturn = true;
             }
         }
@@ -117,12 +112,13 @@ void Process( ptime dtBegin, ptime dtEnd, size_t nMinBars, const setSymbols_t& s
             bReturn = true;
           }
         }
+        if ( bReturn ) {
+          result.hv = std::for_each( bars.at( bars.Size() - 20 ), bars.end(), ou::HistoricalVolatility() );
+        }
         return bReturn;
       },
-      [&fCheck]( data_t& data, const std::string& sPath, const std::string& sObjectName, const ou::tf::Bars& bars ){ // Result
-
-        double hv = std::for_each( bars.at( bars.Size() - 20 ), bars.end(), ou::HistoricalVolatility() );
-        Scenario ii( sObjectName, sPath, bars.last(), data.volumeEma, hv );
+      [&fCheck]( const std::string& sPath, const std::string& sObjectName, const ou::tf::Bars& bars, result_t& result ){ // Result
+        Scenario ii( sObjectName, sPath, bars.last(), result.volumeEma, result.hv );
         //CheckForDarvas( bars.begin(), bars.end(), ii, fSelected );
         //if ( "GLD" == sObjectName ) {
           fCheck( bars, ii );
@@ -132,11 +128,9 @@ void Process( ptime dtBegin, ptime dtEnd, size_t nMinBars, const setSymbols_t& s
         //          CheckForRange( ii, bars.end() - m_nMinPivotBars, bars.end() );
       }
       );
-
-    std::cout << "Items Checked: " << data.nEnteredFilter << ", Items passed: " << data.nPassedFilter << std::endl;
   }
   catch ( std::runtime_error& e ) {
-    std::cout << "SymbolSelection - InstrumentFilter - " << e.what() << std::endl;
+    std::cout << "SymbolSelection - InstrumentScanner - " << e.what() << std::endl;
   }
   catch (... ) {
     std::cout << "SymbolSelection - Unknown Error - " << std::endl;
@@ -161,7 +155,7 @@ SymbolSelection::SymbolSelection( const ptime dtLast, const setSymbols_t& setSym
 {
   std::cout << "Darvas: AT=Aggressive Trigger, CT=Conservative Trigger, BO=Break Out Alert, stop=recommended stop" << std::endl;
 
-  m_dtDarvasTrigger = m_dtLast - gregorian::date_duration( 8 );
+  m_dtDarvasTrigger = m_dtLast - boost::gregorian::date_duration( 8 );
 
   namespace ph = std::placeholders;
   Process<IIDarvas>(
@@ -0,0 +1,186 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    American.cpp
+ * Author:  raymond@burkholder.net
+ * Project: Benchmark
+ * Created: October 19, 2026 16:05
+ */
+
+// closed form american approximations against the CRR tree:
+//   accuracy: over a grid of side, moneyness, expiry, volatility, and rate, prices are compared with
+//     a 1000 step CRR as reference, then the reference price is inverted back to volatility with each model
+//   timing: implied volatility plus greeks per option, as option::Engine does on each scan
+
+#include <cmath>
+#include <vector>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+
+#include <TFOptions/American.h>
+
+#include "Cases.hpp"
+
+namespace {
+
+using Input = ou::tf::option::binomial::structInput;
+using Output = ou::tf::option::binomial::structOutput;
+using PricingModel = ou::tf::option::PricingModel;
+
+struct Point {
+  Input input;
+  double dblReference; // CRR 1000 step price at input.v
+  double dblVega;      // CRR 1000 step price change for one vol point
+};
+
+std::vector<Point> Grid() {
+  std::vector<Point> vPoint;
+  for ( ou::tf::OptionSide::EOptionSide side: { ou::tf::OptionSide::Call, ou::tf::OptionSide::Put } ) {
+    for ( double moneyness: { 0.8, 0.9, 0.95, 1.0, 1.05, 1.1, 1.2 } ) {
+      for ( double days: { 7.0, 30.0, 90.0, 180.0, 365.0 } ) {
+        for ( double vol: { 0.15, 0.30, 0.60 } ) {
+          for ( double rate: { 0.01, 0.05 } ) {
+            Point point;
+            point.input.optionSide = side;
+            point.input.S = 100.0;
+            point.input.X = 100.0 * moneyness;
+            point.input.T = days / 365.0;
+            point.input.r = point.input.b = rate; // as Option::CalcRate
+            point.input.v = vol;
+            Input reference( point.input );
+            reference.n = 1000;
+            Output output;
+            ou::tf::option::binomial::CRR( reference, output );
+            point.dblReference = output.option;
+            reference.v += 0.01;
+            ou::tf::option::binomial::CRR( reference, output );
+            point.dblVega = output.option - point.dblReference;
+            vPoint.emplace_back( point );
+          }
+        }
+      }
+    }
+  }
+  return vPoint;
+}
+
+double Price( PricingModel model, const Input& input ) {
+  switch ( model ) {
+    case PricingModel::BjerksundStensland:
+      return ou::tf::option::american::BjerksundStensland2002( input );
+    case PricingModel::BaroneAdesiWhaley:
+      return ou::tf::option::american::BaroneAdesiWhaley( input );
+    case PricingModel::CRR:
+    default:
+      {
+        Output output;
+        ou::tf::option::binomial::CRR( input, output );
+        return output.option;
+      }
+  }
+}
+
+// volatility is only defined where it moves the price by more than the penny an option is quoted in,
+//   deep in the money the time value is mostly carry and any volatility fits
+bool Solvable( const Point& point ) {
+  const Input& input( point.input );
+  const double intrinsic = std::max( 0.0,
+    ou::tf::OptionSide::Call == input.optionSide ? ( input.S - input.X ) : ( input.X - input.S ) );
+  return ( 0.01 < ( point.dblReference - intrinsic ) ) && ( 0.01 < point.dblVega );
+}
+
+} // namespace anonymous
+
+namespace bench {
+
+void American( Report& report ) {
+
+  const std::vector<Point> vPoint( Grid() );
+
+  const std::vector<PricingModel> vModel = {
+    PricingModel::CRR, PricingModel::BjerksundStensland, PricingModel::BaroneAdesiWhaley
+  };
+
+  for ( PricingModel model: vModel ) {
+
+    double dblSumPrice {}, dblMaxPrice {};
+    double dblSumIv {}, dblMaxIv {};
+    std::size_t cntSolved {}, cntFailed {};
+
+    for ( const Point& point: vPoint ) {
+      const double dblPriceDiff( std::abs( Price( model, point.input ) - point.dblReference ) );
+      dblSumPrice += dblPriceDiff;
+      dblMaxPrice = std::max( dblMaxPrice, dblPriceDiff );
+
+      if ( !Solvable( point ) ) continue;
+      Input input( point.input );
+      input.v = 0.2; // engine style seed, the closed form models seed themselves
+      Output output;
+      try {
+        ou::tf::option::american::CalcImpliedVolatility( model, input, point.dblReference, output );
+        const double dblIvDiff( std::abs( output.iv - point.input.v ) );
+        dblSumIv += dblIvDiff;
+        dblMaxIv = std::max( dblMaxIv, dblIvDiff );
+        cntSolved++;
+      }
+      catch ( const std::runtime_error& ) {
+        cntFailed++;
+      }
+    }
+
+    std::cout
+      << "american accuracy " << ou::tf::option::Name( model ) << " vs crr1000"
+      << ": points=" << vPoint.size()
+      << std::setprecision( 4 )
+      << ", price_mean=" << dblSumPrice / vPoint.size()
+      << ", price_max=" << dblMaxPrice
+      << ", iv_solved=" << cntSolved
+      << ", iv_failed=" << cntFailed
+      << ", iv_mean=" << ( ( 0 < cntSolved ) ? ( dblSumIv / cntSolved ) : 0.0 )
+      << ", iv_max=" << dblMaxIv
+      << std::setprecision( 6 )
+      << std::endl;
+  }
+
+  // timing, solve every solvable point, repeated for a stable measurement
+  std::vector<Point> vSolvable;
+  for ( const Point& point: vPoint ) {
+    if ( Solvable( point ) ) vSolvable.emplace_back( point );
+  }
+
+  for ( PricingModel model: vModel ) {
+    const std::size_t nRepeat = ( PricingModel::CRR == model ) ? 2 : 50;
+    std::size_t cnt {};
+    const double dblSeconds = Time( [&](){
+      for ( std::size_t n = 0; n < nRepeat; ++n ) {
+        for ( const Point& point: vSolvable ) {
+          Input input( point.input );
+          input.v = 0.2;
+          Output output;
+          try {
+            ou::tf::option::american::CalcImpliedVolatility( model, input, point.dblReference, output );
+          }
+          catch ( const std::runtime_error& ) {}
+          DoNotOptimize( output.iv );
+          cnt++;
+        }
+      }
+    } );
+    report.Add( Result { "american", std::string( "iv_greeks/" ) + ou::tf::option::Name( model ), "grid", cnt, dblSeconds } );
+  }
+}
+
+} // namespace bench
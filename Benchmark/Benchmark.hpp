@@ -0,0 +1,120 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Benchmark.hpp
+ * Author:  raymond@burkholder.net
+ * Project: Benchmark
+ * Created: October 19, 2026 10:05
+ */
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <iostream>
+#include <functional>
+
+// synthetic, in-memory data only, so runs are comparable across machines and commits
+// results are also written as csv, one row per result, keyed by case/variant/param, for diffing between commits
+
+namespace bench {
+
+struct Result {
+  std::string sCase;   // eg merge
+  std::string sVariant; // eg loser_tree/batch
+  std::string sParam;  // eg carriers=100
+  std::size_t nItems;  // items processed in the timed section
+  double dblSeconds;
+  double ItemsPerSecond() const { return ( 0.0 < dblSeconds ) ? ( (double)nItems / dblSeconds ) : 0.0; }
+  double NanosPerItem() const { return ( 0 < nItems ) ? ( 1e9 * dblSeconds / (double)nItems ) : 0.0; }
+};
+
+class Report {
+public:
+
+  void Add( const Result& result ) {
+    m_vResult.emplace_back( result );
+    Emit( std::cout, result );
+  }
+
+  static void Emit( std::ostream& stream, const Result& result ) {
+    stream
+      << result.sCase << " " << result.sVariant << " " << result.sParam
+      << ": " << result.nItems << " items"
+      << " in " << result.dblSeconds << " s"
+      << ", " << (std::size_t)result.ItemsPerSecond() << "/s"
+      << ", " << result.NanosPerItem() << " ns/item"
+      << std::endl;
+  }
+
+  const std::vector<Result>& Results() const { return m_vResult; }
+
+  // case,variant,param,items,seconds,items_per_second,ns_per_item
+  //   names carry no commas
+  static void WriteCsv( std::ostream& stream, const std::vector<Result>& vResult ) {
+    const std::streamsize precision = stream.precision( 9 );
+    stream << "case,variant,param,items,seconds,items_per_second,ns_per_item" << std::endl;
+    for ( const Result& result: vResult ) {
+      stream
+        << result.sCase << "," << result.sVariant << "," << result.sParam
+        << "," << result.nItems << "," << result.dblSeconds
+        << "," << result.ItemsPerSecond() << "," << result.NanosPerItem()
+        << std::endl;
+    }
+    stream.precision( precision );
+  }
+
+  static std::vector<Result> ReadCsv( std::istream& stream ) { // the derived columns are recomputed
+    std::vector<Result> vResult;
+    std::string sLine;
+    std::getline( stream, sLine ); // header
+    while ( std::getline( stream, sLine ) ) {
+      std::istringstream ss( sLine );
+      std::string sItems, sSeconds;
+      Result result;
+      if ( std::getline( ss, result.sCase, ',' ) && std::getline( ss, result.sVariant, ',' ) && std::getline( ss, result.sParam, ',' )
+        && std::getline( ss, sItems, ',' ) && std::getline( ss, sSeconds, ',' )
+      ) {
+        result.nItems = std::stoull( sItems );
+        result.dblSeconds = std::stod( sSeconds );
+        vResult.emplace_back( result );
+      }
+    }
+    return vResult;
+  }
+
+private:
+  std::vector<Result> m_vResult;
+};
+
+// wall clock for the supplied function, in seconds
+inline double Time( const std::function<void()>& f ) {
+  const auto start = std::chrono::steady_clock::now();
+  f();
+  const auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>( stop - start ).count();
+}
+
+// keeps the optimizer from discarding results
+template<typename T>
+inline void DoNotOptimize( const T& value ) {
+  asm volatile( "" : : "r,m"( value ) : "memory" );
+}
+
+} // namespace bench
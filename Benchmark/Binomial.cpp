@@ -0,0 +1,85 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Binomial.cpp
+ * Author:  raymond@burkholder.net
+ * Project: Benchmark
+ * Created: October 20, 2026 02:40
+ */
+
+// the CRR tree on its own, price plus greeks, as the pricing step of the implied volatility solver:
+//   over calls and puts around the money, at the step counts in use: 91 (default), 250, 1000 (reference)
+// the solver itself is timed by the american case, iv_greeks/crr
+
+#include <string>
+#include <vector>
+
+#include <TFOptions/Binomial.h>
+
+#include "Cases.hpp"
+
+namespace {
+
+using Input = ou::tf::option::binomial::structInput;
+using Output = ou::tf::option::binomial::structOutput;
+
+std::vector<Input> Inputs() {
+  std::vector<Input> vInput;
+  for ( ou::tf::OptionSide::EOptionSide side: { ou::tf::OptionSide::Call, ou::tf::OptionSide::Put } ) {
+    for ( double moneyness: { 0.9, 0.95, 1.0, 1.05, 1.1 } ) {
+      for ( double days: { 7.0, 30.0, 90.0 } ) {
+        Input input;
+        input.optionSide = side;
+        input.S = 100.0;
+        input.X = 100.0 * moneyness;
+        input.T = days / 365.0;
+        input.r = input.b = 0.05;
+        input.v = 0.25;
+        vInput.emplace_back( input );
+      }
+    }
+  }
+  return vInput;
+}
+
+} // namespace anonymous
+
+namespace bench {
+
+void Binomial( Report& report ) {
+
+  const std::vector<Input> vInput( Inputs() );
+
+  for ( int n: { 91, 250, 1000 } ) {
+    const std::size_t nRepeat = 20'000'000 / ( n * n * vInput.size() ) + 1; // tree nodes are n^2/2, keep the work per step count similar
+    std::size_t cnt {};
+    double dblSum {};
+    const double dblSeconds = Time( [&](){
+      for ( std::size_t repeat = 0; repeat < nRepeat; ++repeat ) {
+        for ( Input input: vInput ) {
+          input.n = n;
+          Output output;
+          ou::tf::option::binomial::CRR( input, output );
+          dblSum += output.option + output.delta;
+          cnt++;
+        }
+      }
+    } );
+    DoNotOptimize( dblSum );
+    report.Add( Result { "binomial", "crr", "steps=" + std::to_string( n ), cnt, dblSeconds } );
+  }
+}
+
+} // namespace bench
@@ -0,0 +1,46 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Cases.hpp
+ * Author:  raymond@burkholder.net
+ * Project: Benchmark
+ * Created: October 19, 2026 10:05
+ */
+
+#pragma once
+
+#include "Benchmark.hpp"
+
+namespace bench {
+
+void American( Report& ); // American.cpp
+void Binomial( Report& ); // Binomial.cpp
+void Delegate( Report& ); // Delegate.cpp
+void Garch( Report& ); // Garch.cpp
+void HDF5( Report& ); // HDF5.cpp
+void IBDepthBook( Report& ); // IBDepthBook.cpp
+void IQFeedMessages( Report& ); // IQFeedMessages.cpp
+void Level2Book( Report& ); // Level2Book.cpp
+void MergeDatedDatums( Report& ); // MergeDatedDatums.cpp
+void MktSymbols( Report& ); // MktSymbols.cpp
+void MultiBarFactory( Report& ); // MultiBarFactory.cpp
+void NetworkFraming( Report& ); // NetworkFraming.cpp
+void RunningMinMax( Report& ); // RunningMinMax.cpp
+void SlicedReplay( Report& ); // SlicedReplay.cpp
+void TimeSeriesAppend( Report& ); // TimeSeriesAppend.cpp
+void TimeSeriesSearch( Report& ); // TimeSeriesSearch.cpp
+void VolSurface( Report& ); // VolSurface.cpp
+
+} // namespace bench
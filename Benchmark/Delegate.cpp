@@ -0,0 +1,108 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Delegate.cpp
+ * Author:  raymond@burkholder.net
+ * Project: Benchmark
+ * Created: October 20, 2026 02:40
+ */
+
+// an event fanned out to its handlers, as Watch and the providers publish quotes and trades:
+//   delegate:      ou::Delegate<const Quote&>, the library's dispatch
+//   fastdelegate:  a std::vector of FastDelegate1, the dispatch without the add/remove locking
+//   function:      a std::vector of std::function
+// with 1, 4 and 16 handlers, each accumulates a field of the quote
+
+#include <string>
+#include <vector>
+#include <functional>
+
+#include <OUCommon/Delegate.h>
+
+#include <TFTimeSeries/DatedDatum.h>
+
+#include "Cases.hpp"
+
+namespace {
+
+using Quote = ou::tf::Quote;
+
+class Handler {
+public:
+  Handler(): m_dblSum {} {}
+  void HandleQuote( const Quote& quote ) { m_dblSum += quote.Bid(); }
+  double Sum() const { return m_dblSum; }
+private:
+  double m_dblSum;
+};
+
+using vHandler_t = std::vector<Handler>;
+
+double Sum( const vHandler_t& vHandler ) {
+  double dblSum {};
+  for ( const Handler& handler: vHandler ) dblSum += handler.Sum();
+  return dblSum;
+}
+
+} // namespace anonymous
+
+namespace bench {
+
+void Delegate( Report& report ) {
+
+  const std::size_t nEvents( 10'000'000 );
+  const Quote::dt_t dt( boost::gregorian::date( 2026, 10, 19 ), boost::posix_time::time_duration( 9, 30, 0 ) );
+
+  for ( std::size_t nHandlers: { 1ul, 4ul, 16ul } ) {
+
+    const std::string sParam( "handlers=" + std::to_string( nHandlers ) );
+    const std::size_t nItems( nEvents * nHandlers ); // handler invocations
+
+    auto run = [&]( const std::string& sVariant, vHandler_t& vHandler, auto&& fEmit ){
+      const double dblSeconds = Time( [&](){
+        for ( std::size_t ix = 0; ix < nEvents; ix++ ) {
+          fEmit( Quote( dt, 100.0 + ( ix & 0xff ), 100, 100.01, 100 ) );
+        }
+      } );
+      DoNotOptimize( Sum( vHandler ) );
+      report.Add( Result { "delegate", sVariant, sParam, nItems, dblSeconds } );
+    };
+
+    {
+      vHandler_t vHandler( nHandlers );
+      ou::Delegate<const Quote&> delegate;
+      for ( Handler& handler: vHandler ) delegate.Add( MakeDelegate( &handler, &Handler::HandleQuote ) );
+      run( "delegate", vHandler, [&delegate]( const Quote& quote ){ delegate( quote ); } );
+    }
+
+    {
+      vHandler_t vHandler( nHandlers );
+      using fd_t = fastdelegate::FastDelegate1<const Quote&>;
+      std::vector<fd_t> vfd;
+      for ( Handler& handler: vHandler ) vfd.emplace_back( MakeDelegate( &handler, &Handler::HandleQuote ) );
+      run( "fastdelegate", vHandler, [&vfd]( const Quote& quote ){ for ( fd_t& fd: vfd ) fd( quote ); } );
+    }
+
+    {
+      vHandler_t vHandler( nHandlers );
+      using f_t = std::function<void(const Quote&)>;
+      std::vector<f_t> vf;
+      for ( Handler& handler: vHandler ) vf.emplace_back( [&handler]( const Quote& quote ){ handler.HandleQuote( quote ); } );
+      run( "function", vHandler, [&vf]( const Quote& quote ){ for ( f_t& f: vf ) f( quote ); } );
+    }
+  }
+}
+
+} // namespace bench
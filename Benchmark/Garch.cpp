@@ -0,0 +1,314 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Garch.cpp
+ * Author:  raymond@burkholder.net
+ * Project: Benchmark
+ * Created: October 20, 2026 05:00
+ */
+
+// GARCH(1,1) and EGARCH(1,1) maximum likelihood fits on simulated daily returns, ten years (2520) per series:
+//   fit: one series at a time, items are fits
+//   universe: 200 series fitted across the hardware threads, as a nightly refit
+//   forecast: the live one step update, items are returns
+// checked, a std::runtime_error on failure:
+//   each fit converges, reaches a likelihood no lower than at the simulation parameters,
+//     and its likelihood matches the recursion evaluated directly
+//   the mean of each parameter over the serial fits is within four standard errors of the simulation parameter,
+//     over all 200 the finite sample bias of the estimator, near four standard errors for omega and beta, would dominate
+//   the universe fits match the serial fits of the same series
+//   published: GARCH(1,1) on the Bollerslev & Ghysels (1996) DEM/GBP daily returns, against the
+//     Fiorentini, Calzolari & Panattoni (1996) estimates as tabled by Brooks, Burke & Persand (2001)
+//     the series is not carried in the tree, $TF_GARCH_DMBP names a copy (such as the dmbp data of R's rugarch),
+//     one observation per line, the return first
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+
+#include <TFStatistics/Garch.h>
+
+#include "Cases.hpp"
+
+namespace {
+
+namespace garch = ou::tf::statistics::garch;
+
+const std::size_t nReturns( 2520 );
+
+// Box-Muller on the raw mt19937 output, which the standard fixes, unlike std::normal_distribution,
+//   so the simulated series are the same on every platform
+class Normal {
+public:
+  Normal( std::mt19937::result_type seed ): m_rng( seed ), m_bSpare( false ), m_dblSpare {} {}
+  double operator()() {
+    if ( m_bSpare ) {
+      m_bSpare = false;
+      return m_dblSpare;
+    }
+    const double r( std::sqrt( -2.0 * std::log( Uniform() ) ) );
+    const double theta( 2.0 * M_PI * Uniform() );
+    m_dblSpare = r * std::sin( theta );
+    m_bSpare = true;
+    return r * std::cos( theta );
+  }
+private:
+  std::mt19937 m_rng;
+  bool m_bSpare;
+  double m_dblSpare;
+  double Uniform() { return ( m_rng() + 0.5 ) / 4294967296.0; } // ( 0, 1 )
+};
+
+garch::vReturn_t Simulate( Normal& normal, garch::EModel eModel, const garch::Parameters& p ) {
+  garch::vReturn_t vReturn;
+  vReturn.reserve( nReturns );
+  double dblVariance = ( garch::EModel::Garch == eModel )
+    ? p.omega / ( 1.0 - p.alpha - p.beta )
+    : std::exp( p.omega / ( 1.0 - p.beta ) );
+  for ( std::size_t ix = 0; ix < nReturns; ++ix ) {
+    const double z( normal() );
+    const double e( std::sqrt( dblVariance ) * z );
+    vReturn.push_back( p.mu + e );
+    if ( garch::EModel::Garch == eModel ) {
+      dblVariance = p.omega + p.alpha * e * e + p.beta * dblVariance;
+    }
+    else {
+      dblVariance = std::exp( p.omega + p.alpha * ( std::abs( z ) - std::sqrt( 2.0 / M_PI ) ) + p.gamma * z + p.beta * std::log( dblVariance ) );
+    }
+  }
+  return vReturn;
+}
+
+garch::Parameters Truth( garch::EModel eModel ) {
+  garch::Parameters p;
+  p.mu = 0.0003;
+  if ( garch::EModel::Garch == eModel ) {
+    p.omega = 0.000003;
+    p.alpha = 0.08;
+    p.beta = 0.90;
+  }
+  else {
+    p.omega = -0.3;
+    p.alpha = 0.15;
+    p.gamma = -0.08;
+    p.beta = 0.97;
+  }
+  return p;
+}
+
+// the gaussian log likelihood, evaluated as Garch.h states the recursion, the first variance the sample variance
+double Reference( const garch::vReturn_t& vReturn, garch::EModel eModel, const garch::Parameters& p ) {
+  double dblMean {};
+  for ( const double r: vReturn ) dblMean += r;
+  dblMean /= vReturn.size();
+  double dblVariance {};
+  for ( const double r: vReturn ) dblVariance += ( r - dblMean ) * ( r - dblMean );
+  dblVariance /= vReturn.size();
+  double dblLogLikelihood {};
+  for ( const double r: vReturn ) {
+    const double e( r - p.mu );
+    dblLogLikelihood -= 0.5 * ( std::log( 2.0 * M_PI ) + std::log( dblVariance ) + e * e / dblVariance );
+    if ( garch::EModel::Garch == eModel ) {
+      dblVariance = p.omega + p.alpha * e * e + p.beta * dblVariance;
+    }
+    else {
+      const double z( e / std::sqrt( dblVariance ) );
+      dblVariance = std::exp( p.omega + p.alpha * ( std::abs( z ) - std::sqrt( 2.0 / M_PI ) ) + p.gamma * z + p.beta * std::log( dblVariance ) );
+    }
+  }
+  return dblLogLikelihood;
+}
+
+// the parameters in a fixed order, for the checks
+std::vector<double> Values( garch::EModel eModel, const garch::Parameters& p ) {
+  if ( garch::EModel::Garch == eModel ) return { p.mu, p.omega, p.alpha, p.beta };
+  else return { p.mu, p.omega, p.alpha, p.gamma, p.beta };
+}
+
+std::vector<std::string> Names( garch::EModel eModel ) {
+  if ( garch::EModel::Garch == eModel ) return { "mu", "omega", "alpha", "beta" };
+  else return { "mu", "omega", "alpha", "gamma", "beta" };
+}
+
+void Check( const std::string& sModel, const garch::vReturn_t& vReturn, garch::EModel eModel, const garch::Parameters& truth, const garch::Result& result ) {
+  if ( !result.bConverged ) {
+    throw std::runtime_error( "garch: " + sModel + " fit did not converge" );
+  }
+  const double dblTruth( garch::LogLikelihood( vReturn, eModel, truth ) );
+  if ( result.dblLogLikelihood < dblTruth - 1e-6 * std::abs( dblTruth ) ) {
+    throw std::runtime_error( "garch: " + sModel + " fit likelihood below that of the simulation parameters" );
+  }
+  const double dblReference( Reference( vReturn, eModel, result.parameters ) );
+  if ( 1e-9 * std::abs( dblReference ) < std::abs( result.dblLogLikelihood - dblReference ) ) {
+    throw std::runtime_error( "garch: " + sModel + " likelihood differs from the direct evaluation" );
+  }
+}
+
+// the mean of each parameter over the fits, within four standard errors of the simulation parameter
+void Recovery( const std::string& sModel, garch::EModel eModel, const garch::Parameters& truth, const garch::vResult_t& vResult ) {
+  const std::vector<double> vTruth( Values( eModel, truth ) );
+  const std::vector<std::string> vName( Names( eModel ) );
+  const double n( vResult.size() );
+  for ( std::size_t ix = 0; ix < vTruth.size(); ++ix ) {
+    double dblSum {};
+    double dblSum2 {};
+    for ( const garch::Result& result: vResult ) {
+      const double x( Values( eModel, result.parameters )[ ix ] );
+      dblSum += x;
+      dblSum2 += x * x;
+    }
+    const double dblMean( dblSum / n );
+    const double dblError( std::sqrt( std::max( 0.0, dblSum2 / n - dblMean * dblMean ) / ( n - 1.0 ) ) );
+    if ( !( 4.0 * dblError >= std::abs( dblMean - vTruth[ ix ] ) ) ) {
+      std::stringstream ss;
+      ss << "garch: " << sModel << " " << vName[ ix ] << " mean " << dblMean << " against " << vTruth[ ix ] << ", standard error " << dblError;
+      throw std::runtime_error( ss.str() );
+    }
+  }
+}
+
+// Fiorentini, Calzolari & Panattoni (1996), GARCH(1,1) with a constant mean on the 1974 DEM/GBP returns,
+//   estimates with their standard errors, and the log likelihood
+struct Published {
+  const char* szName;
+  double dblEstimate;
+  double dblError;
+};
+const Published c_rPublished[] = {
+  { "mu",    -0.00619041, 0.00846212 },
+  { "omega",  0.0107613,  0.00285271 },
+  { "alpha",  0.153134,   0.0265228 },
+  { "beta",   0.805974,   0.0335527 },
+};
+const double c_dblPublishedLogLikelihood( -1106.607 );
+const std::size_t c_nPublishedObservations( 1974 );
+
+void DemGbp( bench::Report& report ) {
+
+  const char* szFileName = std::getenv( "TF_GARCH_DMBP" );
+  if ( nullptr == szFileName ) {
+    std::cout << "garch: TF_GARCH_DMBP not set, the published DEM/GBP check is skipped" << std::endl;
+    return;
+  }
+
+  std::ifstream file( szFileName );
+  if ( !file ) throw std::runtime_error( std::string( "garch: can't read " ) + szFileName );
+  garch::vReturn_t vReturn;
+  std::string sLine;
+  while ( std::getline( file, sLine ) ) {
+    std::istringstream ss( sLine );
+    double dblReturn;
+    if ( ss >> dblReturn ) vReturn.push_back( dblReturn ); // a header line is passed over
+  }
+  if ( c_nPublishedObservations != vReturn.size() ) {
+    throw std::runtime_error( "garch: " + std::to_string( vReturn.size() ) + " DEM/GBP returns, expected " + std::to_string( c_nPublishedObservations ) );
+  }
+
+  garch::Result result;
+  const double dblSeconds = bench::Time( [&](){ result = garch::Fit( vReturn, garch::EModel::Garch ); } );
+  if ( !result.bConverged ) throw std::runtime_error( "garch: DEM/GBP fit did not converge" );
+
+  // a tenth of a standard error, the published fit starts its variance recursion a little differently
+  const std::vector<double> vFit( Values( garch::EModel::Garch, result.parameters ) );
+  for ( std::size_t ix = 0; ix < vFit.size(); ++ix ) {
+    const Published& published( c_rPublished[ ix ] );
+    if ( !( 0.1 * published.dblError >= std::abs( vFit[ ix ] - published.dblEstimate ) ) ) {
+      std::stringstream ss;
+      ss << "garch: DEM/GBP " << published.szName << " " << vFit[ ix ] << " against the published " << published.dblEstimate;
+      throw std::runtime_error( ss.str() );
+    }
+  }
+  if ( !( 0.05 >= std::abs( result.dblLogLikelihood - c_dblPublishedLogLikelihood ) ) ) {
+    std::stringstream ss;
+    ss << "garch: DEM/GBP log likelihood " << result.dblLogLikelihood << " against the published " << c_dblPublishedLogLikelihood;
+    throw std::runtime_error( ss.str() );
+  }
+
+  report.Add( bench::Result { "garch", "garch/dem_gbp", "returns=" + std::to_string( vReturn.size() ) + " evaluations=" + std::to_string( result.nEvaluations ), 1, dblSeconds } );
+}
+
+} // namespace anonymous
+
+namespace bench {
+
+void Garch( Report& report ) {
+
+  Normal normal( 20261020 );
+
+  for ( garch::EModel eModel: { garch::EModel::Garch, garch::EModel::EGarch } ) {
+
+    const std::string sModel( ( garch::EModel::Garch == eModel ) ? "garch" : "egarch" );
+    const garch::Parameters truth( Truth( eModel ) );
+
+    std::vector<garch::vReturn_t> vSeries;
+    for ( std::size_t ix = 0; ix < 200; ++ix ) vSeries.emplace_back( Simulate( normal, eModel, truth ) );
+
+    const std::size_t nFit( 20 );
+    garch::vResult_t vResultSerial;
+
+    {
+      std::size_t nEvaluations {};
+      const double dblSeconds = Time( [&](){
+        for ( std::size_t ix = 0; ix < nFit; ++ix ) {
+          vResultSerial.emplace_back( garch::Fit( vSeries[ ix ], eModel ) );
+          nEvaluations += vResultSerial.back().nEvaluations;
+        }
+      } );
+      for ( std::size_t ix = 0; ix < nFit; ++ix ) Check( sModel, vSeries[ ix ], eModel, truth, vResultSerial[ ix ] );
+      Recovery( sModel, eModel, truth, vResultSerial );
+      report.Add( Result { "garch", sModel + "/fit", "returns=" + std::to_string( nReturns ) + " evaluations=" + std::to_string( nEvaluations / nFit ), nFit, dblSeconds } );
+    }
+
+    {
+      const std::size_t nThreads( std::max<std::size_t>( 1, std::thread::hardware_concurrency() ) );
+      garch::vResult_t vResult;
+      const double dblSeconds = Time( [&](){
+        vResult = garch::Fit( vSeries, eModel, nThreads );
+      } );
+      for ( std::size_t ix = 0; ix < vSeries.size(); ++ix ) Check( sModel, vSeries[ ix ], eModel, truth, vResult[ ix ] );
+      for ( std::size_t ix = 0; ix < nFit; ++ix ) {
+        if ( Values( eModel, vResultSerial[ ix ].parameters ) != Values( eModel, vResult[ ix ].parameters ) ) {
+          throw std::runtime_error( "garch: " + sModel + " universe fit differs from the serial fit of series " + std::to_string( ix ) );
+        }
+      }
+      report.Add( Result { "garch", sModel + "/universe", "series=" + std::to_string( vSeries.size() ) + " threads=" + std::to_string( nThreads ), vResult.size(), dblSeconds } );
+
+      garch::Forecast forecast( vResult.front() );
+      std::size_t cnt {};
+      const double dblSecondsForecast = Time( [&](){
+        for ( const garch::vReturn_t& vReturn: vSeries ) {
+          for ( const double dblReturn: vReturn ) {
+            forecast.Update( dblReturn );
+            ++cnt;
+          }
+        }
+      } );
+      DoNotOptimize( forecast.Variance() );
+      report.Add( Result { "garch", sModel + "/forecast", "series=" + std::to_string( vSeries.size() ), cnt, dblSecondsForecast } );
+    }
+  }
+
+  DemGbp( report );
+}
+
+} // namespace bench
@@ -0,0 +1,100 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    HDF5.cpp
+ * Author:  raymond@burkholder.net
+ * Project: Benchmark
+ * Created: October 20, 2026 02:40
+ */
+
+// a session of quotes through the HDF5 file, as recorded by Watch and loaded for simulation:
+//   write: HDF5WriteTimeSeries, chunked and deflated as the recorders configure it
+//   read:  HDF5TimeSeriesContainer into a Quotes series
+// the file is in the temporary directory, removed afterwards, the read back must match what was written
+
+#include <memory>
+#include <string>
+#include <stdexcept>
+
+#include <boost/filesystem.hpp>
+
+#include <TFTimeSeries/TimeSeries.h>
+
+#include <TFHDF5TimeSeries/HDF5DataManager.h>
+#include <TFHDF5TimeSeries/HDF5WriteTimeSeries.h>
+#include <TFHDF5TimeSeries/HDF5TimeSeriesContainer.h>
+
+#include "Cases.hpp"
+
+namespace bench {
+
+void HDF5( Report& report ) {
+
+  const std::size_t nQuotes( 2'000'000 );
+  const std::string sParam( "quotes=" + std::to_string( nQuotes ) );
+  const std::string sPath( "/bench/quotes" );
+
+  const boost::filesystem::path pathFile(
+    boost::filesystem::temp_directory_path() / boost::filesystem::unique_path( "bench-%%%%-%%%%.hdf5" ) );
+
+  ou::tf::Quotes quotes;
+  const ou::tf::Quote::dt_t dtStart( boost::gregorian::date( 2026, 10, 19 ), boost::posix_time::time_duration( 9, 30, 0 ) );
+  for ( std::size_t ix = 0; ix < nQuotes; ix++ ) {
+    const double bid( 100.0 + 0.01 * ( ix % 97 ) );
+    quotes.Append( ou::tf::Quote( dtStart + boost::posix_time::microseconds( 50 * ix ), bid, 100 + ix % 7, bid + 0.01, 100 + ix % 11 ) );
+  }
+
+  {
+    std::unique_ptr<ou::tf::HDF5DataManager> pdm
+      = std::make_unique<ou::tf::HDF5DataManager>( ou::tf::HDF5DataManager::RDWR, pathFile.string() );
+
+    {
+      const double dblSeconds = Time( [&](){
+        ou::tf::HDF5WriteTimeSeries<ou::tf::Quotes> wts( *pdm, true, true, 5, 256 );
+        wts.Write( sPath, &quotes );
+        pdm->GetH5File()->flush( H5F_SCOPE_GLOBAL );
+      } );
+      report.Add( Result { "hdf5", "write/quotes", sParam, nQuotes, dblSeconds } );
+    }
+
+    {
+      ou::tf::Quotes read;
+      const double dblSeconds = Time( [&](){
+        ou::tf::HDF5TimeSeriesContainer<ou::tf::Quote> container( *pdm, sPath );
+        ou::tf::HDF5TimeSeriesContainer<ou::tf::Quote>::iterator begin = container.begin();
+        ou::tf::HDF5TimeSeriesContainer<ou::tf::Quote>::iterator end = container.end();
+        read.Resize( end - begin );
+        container.Read( begin, end, &read );
+      } );
+      report.Add( Result { "hdf5", "read/quotes", sParam, nQuotes, dblSeconds } );
+
+      bool bMatch( read.Size() == quotes.Size() );
+      for ( std::size_t ix = 0; bMatch && ( ix < nQuotes ); ix += 997 ) {
+        const ou::tf::Quote& lhs( read.At( ix ) );
+        const ou::tf::Quote& rhs( quotes.At( ix ) );
+        bMatch = ( lhs.DateTime() == rhs.DateTime() ) && ( lhs.Bid() == rhs.Bid() ) && ( lhs.AskSize() == rhs.AskSize() );
+      }
+      if ( !bMatch ) {
+        pdm.reset();
+        boost::filesystem::remove( pathFile );
+        throw std::runtime_error( "hdf5: quotes read back do not match" );
+      }
+    }
+  }
+
+  boost::filesystem::remove( pathFile );
+}
+
+} // namespace bench
@@ -0,0 +1,148 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    IBDepthBook.cpp
+ * Author:  raymond@burkholder.net
+ * Project: Benchmark
+ * Created: October 20, 2026 09:40
+ */
+
+// position indexed market depth, as the IB provider maintains it from the tws depth callbacks:
+//   ou::tf::ib::DepthBook, with the DepthByOrder, DepthByMM and Quote callbacks set, as IBSymbol does
+//   the stream inserts, updates, and deletes rows at random positions, holding 5 to 'rows' rows per side
+// the stream is built beforehand, with a plain vector book as the reference for the final rows
+
+#include <random>
+#include <string>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+
+#include <TFInteractiveBrokers/IBDepthBook.h>
+
+#include "Cases.hpp"
+
+namespace {
+
+using DepthBook = ou::tf::ib::DepthBook;
+
+struct Message { // arguments of updateMktDepth / updateMktDepthL2
+  int position;
+  int operation;
+  int side;
+  double price;
+  DepthBook::volume_t size;
+  std::string sMarketMaker;
+};
+
+using vMessage_t = std::vector<Message>;
+using vRow_t = std::vector<std::pair<double,DepthBook::volume_t> >;
+
+vMessage_t Stream( std::size_t nMessages, std::size_t nRows, vRow_t rvRow[ 2 ] ) {
+
+  static const char* rszMarketMaker[] = { "NSDQ", "ARCA", "BATS", "EDGX", "IEX", "ISLAND" };
+
+  std::mt19937_64 generator( 43 );
+  std::uniform_int_distribution<int> operation( DepthBook::Insert, DepthBook::Delete );
+  std::uniform_int_distribution<int> lots( 1, 20 );
+  std::uniform_int_distribution<int> mm( 0, 5 );
+
+  vMessage_t vMessage;
+  vMessage.reserve( nMessages );
+  for ( std::size_t ix = 0; ix < nMessages; ix++ ) {
+    const int side( ix & 1 );
+    vRow_t& vRow( rvRow[ side ] );
+    int op( operation( generator ) );
+    if ( 5 > vRow.size() ) op = DepthBook::Insert;
+    else if ( nRows <= vRow.size() ) op = DepthBook::Delete;
+    Message message { 0, op, side, 0.0, 0, rszMarketMaker[ mm( generator ) ] };
+    const double dblPrice( ( DepthBook::Bid == side ) ? 99.99 - 0.01 * ( ix % 50 ) : 100.01 + 0.01 * ( ix % 50 ) );
+    switch ( op ) {
+      case DepthBook::Insert:
+        message.position = std::uniform_int_distribution<int>( 0, vRow.size() )( generator );
+        message.price = dblPrice;
+        message.size = 100 * lots( generator );
+        vRow.emplace( vRow.begin() + message.position, message.price, message.size );
+        break;
+      case DepthBook::Update:
+        message.position = std::uniform_int_distribution<int>( 0, vRow.size() - 1 )( generator );
+        message.price = ( 0 == ( ix % 4 ) ) ? dblPrice : vRow[ message.position ].first; // mostly a size change
+        message.size = 100 * lots( generator );
+        vRow[ message.position ] = std::make_pair( message.price, message.size );
+        break;
+      case DepthBook::Delete:
+        message.position = std::uniform_int_distribution<int>( 0, vRow.size() - 1 )( generator );
+        vRow.erase( vRow.begin() + message.position );
+        break;
+    }
+    vMessage.emplace_back( std::move( message ) );
+  }
+  return vMessage;
+}
+
+} // namespace anonymous
+
+namespace bench {
+
+void IBDepthBook( Report& report ) {
+
+  const std::size_t nMessages( 2'000'000 );
+  const std::size_t nRows( 20 ); // TWS::c_nDepthRows
+
+  vRow_t rvRow[ 2 ];
+  const vMessage_t vMessage( Stream( nMessages, nRows, rvRow ) );
+
+  for ( const bool bMarketMaker: { false, true } ) {
+
+    DepthBook book;
+    std::size_t nDepth {}, nQuote {};
+    book.Set(
+      [&nDepth]( const ou::tf::DepthByMM& ){ ++nDepth; },
+      [&nDepth]( const ou::tf::DepthByOrder& ){ ++nDepth; },
+      [&nQuote]( const ou::tf::Quote& ){ ++nQuote; }
+    );
+
+    const DepthBook::dt_t dt( boost::gregorian::date( 2026, 10, 20 ), boost::posix_time::time_duration( 9, 30, 0 ) );
+
+    const double dblSeconds = Time( [&](){
+      if ( bMarketMaker ) {
+        for ( const Message& message: vMessage ) {
+          book.MarketDepth( dt, message.operation, message.side, message.position, message.sMarketMaker, message.price, message.size );
+        }
+      }
+      else {
+        for ( const Message& message: vMessage ) {
+          book.MarketDepth( dt, message.operation, message.side, message.position, message.price, message.size );
+        }
+      }
+    } );
+
+    if ( ( 0 != book.Rejected() ) || ( 0 == nDepth ) || ( 0 == nQuote ) ) {
+      throw std::runtime_error( "ib_depth_book: messages rejected, or nothing published" );
+    }
+    for ( const DepthBook::ESide side: { DepthBook::Ask, DepthBook::Bid } ) {
+      const vRow_t& vRow( rvRow[ side ] );
+      bool bMatch( book.Rows( side ) == vRow.size() );
+      for ( std::size_t ix = 0; bMatch && ( ix < vRow.size() ); ix++ ) {
+        bMatch = ( book.Row( side, ix ).dblPrice == vRow[ ix ].first ) && ( book.Row( side, ix ).nSize == vRow[ ix ].second );
+      }
+      if ( !bMatch ) throw std::runtime_error( "ib_depth_book: final rows differ from the reference" );
+    }
+
+    report.Add( Result { "ib_depth_book", bMarketMaker ? "market_maker" : "aggregated", "rows=" + std::to_string( nRows ), nMessages, dblSeconds } );
+  }
+}
+
+} // namespace bench
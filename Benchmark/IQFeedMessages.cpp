@@ -0,0 +1,163 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    IQFeedMessages.cpp
+ * Author:  raymond@burkholder.net
+ * Project: Benchmark
+ * Created: October 20, 2026 02:40
+ */
+
+// level 1 dynamic fieldset 'Q' updates, as the lines arrive from the Network framing:
+//   tokenise: IQFDynamicFeedUpdateMessage::Assign, the ',' scan only
+//   decode:   tokenise, then the fields IQFeedSymbol::DecodeDynamicFeedMessage reads for the message contents
+// lines are built once, from a random walk over a handful of symbols, with a mix of trade and quote contents
+
+#include <random>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#include <TFIQFeed/Messages.h>
+
+#include "Cases.hpp"
+
+namespace {
+
+using Message = ou::tf::iqfeed::IQFDynamicFeedUpdateMessage;
+using linebuffer_t = Message::linebuffer_t;
+using vLine_t = std::vector<linebuffer_t>;
+
+// Q,Symbol,TotalVolume,Bid,Ask,BidSize,AskSize,NumTrades,Last,LastSize,LastTime,Conditions,MarketCenter,Contents,Aggressor,OpenInterest
+vLine_t Lines( std::size_t nLines ) {
+
+  static const std::vector<std::string> vSymbol = { "SPY", "QQQ", "@ESZ26", "@NQZ26", "GLD", "TLT", "IWM", "AAPL" };
+  static const std::vector<std::string> vContents = { "C", "ba", "b", "a", "Cba", "Cv", "o" };
+
+  std::mt19937_64 generator( 29 );
+  std::uniform_int_distribution<std::size_t> symbol( 0, vSymbol.size() - 1 );
+  std::uniform_int_distribution<std::size_t> contents( 0, vContents.size() - 1 );
+  std::uniform_int_distribution<int> step( -2, 2 );
+  std::uniform_int_distribution<int> size( 1, 50 );
+
+  std::vector<long> vCents( vSymbol.size(), 45000 );
+  std::vector<long> vVolume( vSymbol.size(), 0 );
+
+  vLine_t vLine;
+  vLine.reserve( nLines );
+  char sz[ 256 ];
+  for ( std::size_t ix = 0; ix < nLines; ix++ ) {
+    const std::size_t ixSymbol = symbol( generator );
+    long& cents( vCents[ ixSymbol ] );
+    cents += step( generator );
+    const int nSize = 100 * size( generator );
+    vVolume[ ixSymbol ] += nSize;
+    const long us = ix * 1000;
+    const int n = std::snprintf(
+      sz, sizeof( sz ),
+      "Q,%s,%ld,%ld.%02ld,%ld.%02ld,%d,%d,%zu,%ld.%02ld,%d,%02ld:%02ld:%02ld.%06ld,3D,11,%s,1,%zu,",
+      vSymbol[ ixSymbol ].c_str(), vVolume[ ixSymbol ],
+      ( cents - 1 ) / 100, ( cents - 1 ) % 100, ( cents + 1 ) / 100, ( cents + 1 ) % 100,
+      100 * size( generator ), 100 * size( generator ), ix,
+      cents / 100, cents % 100, nSize,
+      9 + us / 3600'000'000, ( us / 60'000'000 ) % 60, ( us / 1'000'000 ) % 60, us % 1'000'000,
+      vContents[ contents( generator ) ].c_str(), ix % 1000
+      );
+    vLine.emplace_back( linebuffer_t( sz, sz + n ) );
+  }
+  return vLine;
+}
+
+// the fields kept by IQFeedSymbol::Summary
+struct Summary {
+  double dblTrade, dblBid, dblAsk, dblOpen;
+  int nTradeSize, nBidSize, nAskSize, cntTrades, nTotalVolume, nOpenInterest;
+  Summary(): dblTrade {}, dblBid {}, dblAsk {}, dblOpen {}, nTradeSize {}, nBidSize {}, nAskSize {}, cntTrades {}, nTotalVolume {}, nOpenInterest {} {}
+};
+
+void Decode( const Message& msg, Summary& summary ) {
+  Message::iterator_t iter = msg.FieldBegin( Message::DFMessageContents );
+  const Message::iterator_t end = msg.FieldEnd( Message::DFMessageContents );
+  for ( ; iter != end; ++iter ) {
+    switch ( *iter ) {
+      case 'C':
+        summary.dblTrade = msg.Double( Message::DFMostRecentTrade );
+        summary.nTradeSize = msg.Integer( Message::DFMostRecentTradeSize );
+        summary.cntTrades = msg.Integer( Message::DFNumTrades );
+        summary.nTotalVolume = msg.Integer( Message::DFTtlVol );
+        break;
+      case 'a':
+        summary.dblAsk = msg.Double( Message::DFAsk );
+        summary.nAskSize = msg.Integer( Message::DFAskSize );
+        break;
+      case 'b':
+        summary.dblBid = msg.Double( Message::DFBid );
+        summary.nBidSize = msg.Integer( Message::DFBidSize );
+        break;
+      case 'o':
+        summary.dblOpen = msg.Double( Message::DFMostRecentTrade );
+        break;
+      case 'v':
+        summary.nOpenInterest = msg.Integer( Message::DFOpenInterest );
+        break;
+    }
+  }
+}
+
+} // namespace anonymous
+
+namespace bench {
+
+void IQFeedMessages( Report& report ) {
+
+  const std::size_t nLines( 2'000'000 );
+  const std::string sParam( "lines=" + std::to_string( nLines ) );
+
+  vLine_t vLine( Lines( nLines ) );
+
+  Message msg;
+
+  {
+    std::size_t nFields {};
+    const double dblSeconds = Time( [&](){
+      for ( linebuffer_t& line: vLine ) {
+        Message::iterator_t begin = line.begin();
+        Message::iterator_t end = line.end();
+        msg.Assign( begin, end );
+        nFields += msg.FieldEnd( Message::DFOpenInterest ) - msg.FieldBegin( Message::DFSymbol );
+      }
+    } );
+    DoNotOptimize( nFields );
+    report.Add( Result { "iqfeed_messages", "tokenise", sParam, nLines, dblSeconds } );
+  }
+
+  {
+    Summary summary;
+    double dblCheck {};
+    const double dblSeconds = Time( [&](){
+      for ( linebuffer_t& line: vLine ) {
+        Message::iterator_t begin = line.begin();
+        Message::iterator_t end = line.end();
+        msg.Assign( begin, end );
+        Decode( msg, summary );
+        dblCheck += summary.dblTrade + summary.dblBid + summary.nAskSize;
+      }
+    } );
+    DoNotOptimize( dblCheck );
+    if ( 0 == summary.nTotalVolume ) throw std::runtime_error( "iqfeed_messages: no trades decoded" );
+    report.Add( Result { "iqfeed_messages", "decode", sParam, nLines, dblSeconds } );
+  }
+}
+
+} // namespace bench
@@ -0,0 +1,127 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Level2Book.cpp
+ * Author:  raymond@burkholder.net
+ * Project: Benchmark
+ * Created: October 20, 2026 02:40
+ */
+
+// order based market depth, as the futures books are maintained from the IQFeed level 2 feed:
+//   ou::tf::iqfeed::l2::OrderBased, with the bid and ask level change callbacks set, as DepthOfMarket does
+//   the stream adds, updates, and deletes orders within 20 ticks of a drifting mid, holding about 'orders' live
+// the stream is built beforehand, every update and delete refers to a live order
+
+#include <random>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <TFIQFeed/Level2/Symbols.hpp>
+
+#include "Cases.hpp"
+
+namespace {
+
+using Depth = ou::tf::DepthByOrder;
+using vDepth_t = std::vector<Depth>;
+
+vDepth_t Stream( std::size_t nEvents, std::size_t nLive ) {
+
+  std::mt19937_64 generator( 41 );
+  std::uniform_int_distribution<int> ticks( 1, 20 );
+  std::uniform_int_distribution<int> step( -1, 1 );
+  std::uniform_int_distribution<int> lots( 1, 20 );
+  std::uniform_int_distribution<int> action( 0, 9 );
+
+  struct Live {
+    char chSide;
+    double dblPrice;
+  };
+  std::vector<Depth::idorder_t> vId; // live order ids, for picking one at random
+  std::unordered_map<Depth::idorder_t,Live> mapLive;
+
+  const Depth::dt_t dtStart( boost::gregorian::date( 2026, 10, 19 ), boost::posix_time::time_duration( 9, 30, 0 ) );
+  long mid = 400000; // in quarter ticks of 4000.00
+  Depth::idorder_t idNext( 1 );
+  uint64_t nPriority {};
+
+  vDepth_t vDepth;
+  vDepth.reserve( nEvents );
+  for ( std::size_t ix = 0; ix < nEvents; ix++ ) {
+    const Depth::dt_t dt( dtStart + boost::posix_time::microseconds( 20 * ix ) );
+    if ( 0 == ( ix % 64 ) ) mid += step( generator );
+    const int choice( action( generator ) );
+    if ( ( vId.size() < nLive / 2 ) || ( ( vId.size() < 2 * nLive ) && ( choice < 4 ) ) ) { // add
+      const char chSide( ( ix & 1 ) ? 'B' : 'A' );
+      const long price( ( 'B' == chSide ) ? ( mid - ticks( generator ) ) : ( mid + ticks( generator ) ) );
+      const Live live { chSide, price / 100.0 };
+      mapLive.emplace( idNext, live );
+      vId.push_back( idNext );
+      vDepth.emplace_back( Depth( dt, dt, idNext, ++nPriority, '3', chSide, live.dblPrice, 100 * lots( generator ) ) );
+      ++idNext;
+    }
+    else {
+      std::uniform_int_distribution<std::size_t> pick( 0, vId.size() - 1 );
+      const std::size_t ixId( pick( generator ) );
+      const Depth::idorder_t id( vId[ ixId ] );
+      const Live& live( mapLive[ id ] );
+      if ( choice < 7 ) { // update the quantity
+        vDepth.emplace_back( Depth( dt, dt, id, ++nPriority, '4', live.chSide, live.dblPrice, 100 * lots( generator ) ) );
+      }
+      else { // delete
+        vDepth.emplace_back( Depth( dt, dt, id, 0, '5', live.chSide, live.dblPrice, 0 ) );
+        mapLive.erase( id );
+        vId[ ixId ] = vId.back();
+        vId.pop_back();
+      }
+    }
+  }
+  return vDepth;
+}
+
+} // namespace anonymous
+
+namespace bench {
+
+void Level2Book( Report& report ) {
+
+  const std::size_t nEvents( 2'000'000 );
+
+  for ( std::size_t nLive: { 100ul, 2'000ul } ) {
+
+    const vDepth_t vDepth( Stream( nEvents, nLive ) );
+
+    ou::tf::iqfeed::l2::OrderBased book;
+    std::size_t nBid {}, nAsk {};
+    book.Set(
+      ou::tf::iqfeed::l2::fBookChanges_t( [&nBid]( ou::tf::iqfeed::l2::EOp, unsigned int, const ou::tf::Depth& ){ ++nBid; } ),
+      ou::tf::iqfeed::l2::fBookChanges_t( [&nAsk]( ou::tf::iqfeed::l2::EOp, unsigned int, const ou::tf::Depth& ){ ++nAsk; } )
+    );
+
+    const double dblSeconds = Time( [&](){
+      for ( const Depth& depth: vDepth ) {
+        book.MarketDepth( depth );
+      }
+    } );
+
+    if ( ( 0 == nBid ) || ( 0 == nAsk ) ) throw std::runtime_error( "level2_book: no level changes published" );
+
+    report.Add( Result { "level2_book", "order_based", "orders=" + std::to_string( nLive ), nEvents, dblSeconds } );
+  }
+}
+
+} // namespace bench
@@ -0,0 +1,211 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    MergeDatedDatums.cpp
+ * Author:  raymond@burkholder.net
+ * Project: Benchmark
+ * Created: October 19, 2026 10:05
+ */
+
+// datums/sec through the simulation merge for 10, 100, 1000 carriers
+//   heap: the previous CMinHeap arrangement, ptime compare, one virtual call per datum
+//   datum: loser tree, one FastDelegate call per datum
+//   batch: loser tree, one FastDelegate call per run of datums
+// blocks=many: each series spread over about 16 blocks, so batch runs meet block ends,
+//   the batch volume is checked against the datum volume
+
+#include <random>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <OUCommon/MinHeap.h>
+
+#include <TFSimulation/MergeDatedDatums.h>
+
+#include "Cases.hpp"
+
+namespace {
+
+using Trades = ou::tf::Trades;
+using Trade = ou::tf::Trade;
+
+static const std::size_t nTotalDatums( 2'000'000 );
+
+// a few busy series (underlyings) amongst many sparse ones (options),
+//   nBurst > 1 arrives in bursts of about that many datums a microsecond apart, as depth updates do
+// bBlocks: the block size from the series length, rather than a single block reserved for the whole series
+void Build( std::size_t nCarriers, std::size_t nBurst, bool bBlocks, std::vector<std::unique_ptr<Trades> >& vSeries ) {
+  std::mt19937_64 rng( 42 );
+  std::vector<double> vWeight( nCarriers );
+  double sum {};
+  for ( std::size_t ix = 0; ix < nCarriers; ++ix ) {
+    vWeight[ ix ] = ( 0 == ix % 10 ) ? 20.0 : 1.0;
+    sum += vWeight[ ix ];
+  }
+  const ptime dtStart( boost::gregorian::date( 2026, 10, 19 ), time_duration( 9, 30, 0 ) );
+  const double dblSessionMicros( 6.5 * 3600.0 * 1e6 );
+  vSeries.clear();
+  for ( std::size_t ix = 0; ix < nCarriers; ++ix ) {
+    const std::size_t n = std::max<std::size_t>( 1, (std::size_t)( nTotalDatums * vWeight[ ix ] / sum ) );
+    std::exponential_distribution<double> gap( (double)n / ( nBurst * dblSessionMicros ) );
+    std::geometric_distribution<std::size_t> burst( 1.0 / nBurst );
+    if ( bBlocks ) {
+      vSeries.emplace_back( std::make_unique<Trades>() );
+      vSeries.back()->BlockSizeHint( n );
+    }
+    else {
+      vSeries.emplace_back( std::make_unique<Trades>( n ) );
+    }
+    Trades& trades( *vSeries.back() );
+    double dblMicros {};
+    std::size_t nRemaining {};
+    for ( std::size_t cnt = 0; cnt < n; ++cnt ) {
+      if ( 0 == nRemaining ) {
+        dblMicros += gap( rng );
+        nRemaining = 1 + burst( rng );
+      }
+      else {
+        dblMicros += 1.0;
+      }
+      --nRemaining;
+      trades.Append( Trade( dtStart + microseconds( (int64_t)dblMicros ), 100.0 + ix, 1 + cnt % 7 ) );
+    }
+  }
+}
+
+struct Sink {
+  std::size_t nDatums;
+  unsigned long nVolume;
+  Sink(): nDatums {}, nVolume {} {}
+  void HandleDatum( const ou::tf::DatedDatum& datum ) {
+    ++nDatums;
+    nVolume += static_cast<const Trade&>( datum ).Volume();
+  }
+  void HandleBatch( const Trade* pTrade, std::size_t n ) {
+    nDatums += n;
+    for ( const Trade* p = pTrade; p != pTrade + n; ++p ) nVolume += p->Volume();
+  }
+};
+
+// reference: the merge as it was prior to the loser tree
+class HeapCarrier {
+public:
+  HeapCarrier( Trades& trades, Sink& sink ): m_trades( trades ), m_sink( sink ) {
+    m_pDatum = m_trades.First();
+    m_dt = m_pDatum->DateTime();
+  }
+  virtual ~HeapCarrier() {}
+  virtual void ProcessDatum() {
+    if ( ou::TimeSource::LocalCommonInstance().GetSimulationMode() ) {
+      ou::TimeSource::LocalCommonInstance().SetSimulationTime( m_pDatum->DateTime() );
+    }
+    m_sink.HandleDatum( *m_pDatum );
+    m_pDatum = m_trades.Next();
+    m_dt = ( nullptr == m_pDatum ) ? ptime( boost::date_time::not_a_date_time ) : m_pDatum->DateTime();
+  }
+  const ou::tf::DatedDatum* GetDatedDatum() const { return m_pDatum; }
+  static bool lt( HeapCarrier* plhs, HeapCarrier* prhs ) { return plhs->m_dt < prhs->m_dt; };
+private:
+  ptime m_dt;
+  const Trade* m_pDatum;
+  Trades& m_trades;
+  Sink& m_sink;
+};
+
+std::size_t RunHeap( std::vector<std::unique_ptr<Trades> >& vSeries, Sink& sink ) {
+  std::vector<std::unique_ptr<HeapCarrier> > vCarrier;
+  ou::CMinHeap<HeapCarrier*, HeapCarrier> heap( vSeries.size() );
+  for ( std::unique_ptr<Trades>& p: vSeries ) {
+    vCarrier.emplace_back( std::make_unique<HeapCarrier>( *p, sink ) );
+    heap.Append( vCarrier.back().get() );
+  }
+  std::size_t cntCarriers( vSeries.size() );
+  std::size_t cntDatums {};
+  while ( 0 != cntCarriers ) {
+    HeapCarrier* pCarrier = heap.GetRoot();
+    pCarrier->ProcessDatum();
+    ++cntDatums;
+    if ( nullptr == pCarrier->GetDatedDatum() ) {
+      heap.ArchiveRoot();
+      --cntCarriers;
+    }
+    else {
+      heap.SiftDown();
+    }
+  }
+  return cntDatums;
+}
+
+} // namespace anonymous
+
+namespace bench {
+
+void MergeDatedDatums( Report& report ) {
+
+  for ( const bool bBlocks: { false, true } ) {
+  for ( const std::size_t nBurst: { 1, 8 } ) {
+  for ( const std::size_t nCarriers: { 10, 100, 1000 } ) {
+
+    if ( bBlocks && ( 1 == nBurst ) ) continue; // bursts make the longer runs
+
+    std::vector<std::unique_ptr<Trades> > vSeries;
+    Build( nCarriers, nBurst, bBlocks, vSeries );
+
+    const std::string sParam(
+      "carriers=" + std::to_string( nCarriers ) + ",burst=" + std::to_string( nBurst )
+      + ( bBlocks ? ",blocks=many" : "" ) );
+
+    unsigned long nVolume {};
+
+    {
+      Sink sink;
+      std::size_t nDatums {};
+      const double dblSeconds = Time( [&vSeries,&sink,&nDatums](){ nDatums = RunHeap( vSeries, sink ); } );
+      DoNotOptimize( sink.nVolume );
+      report.Add( Result{ "merge", "heap", sParam, nDatums, dblSeconds } );
+    }
+
+    {
+      Sink sink;
+      ou::tf::MergeDatedDatums merge;
+      for ( std::unique_ptr<Trades>& p: vSeries ) {
+        merge.Add( *p, MakeDelegate( &sink, &Sink::HandleDatum ) );
+      }
+      const double dblSeconds = Time( [&merge](){ merge.Run(); } );
+      DoNotOptimize( sink.nVolume );
+      nVolume = sink.nVolume;
+      report.Add( Result{ "merge", "loser_tree/datum", sParam, merge.GetCountProcessedDatums(), dblSeconds } );
+    }
+
+    {
+      Sink sink;
+      ou::tf::MergeDatedDatums merge;
+      for ( std::unique_ptr<Trades>& p: vSeries ) {
+        merge.AddBatch<Trade>( *p, MakeDelegate( &sink, &Sink::HandleBatch ) );
+      }
+      const double dblSeconds = Time( [&merge](){ merge.Run(); } );
+      DoNotOptimize( sink.nVolume );
+      report.Add( Result{ "merge", "loser_tree/batch", sParam, merge.GetCountProcessedDatums(), dblSeconds } );
+      if ( nVolume != sink.nVolume ) {
+        std::cout << "merge: " << sParam << " batch volume " << sink.nVolume << " differs from datum volume " << nVolume << std::endl;
+      }
+    }
+  }
+  }
+  }
+}
+
+} // namespace bench
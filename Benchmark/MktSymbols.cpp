@@ -0,0 +1,183 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    MktSymbols.cpp
+ * Author:  raymond@burkholder.net
+ * Project: Benchmark
+ * Created: October 20, 2026 02:10
+ */
+
+// loading a synthetic mktsymbols_v2.txt into InMemoryMktSymbolList:
+//   getline: ParseMktSymbolDiskFile::Run line by line into a single ValidateMktSymbolLine, the previous load
+//   mmap:    LoadMktSymbolsParallel, memory mapped, a chunk per thread, merged in file order
+// equities with an option chain each, plus futures and indexes, written to the temp directory
+// each list must match the getline load field for field
+
+#include <random>
+#include <thread>
+#include <string>
+#include <functional>
+#include <fstream>
+#include <algorithm>
+#include <stdexcept>
+#include <filesystem>
+
+#include <TFIQFeed/ValidateMktSymbolLine.h>
+#include <TFIQFeed/ParseMktSymbolDiskFile.h>
+#include <TFIQFeed/InMemoryMktSymbolList.h>
+#include <TFIQFeed/LoadMktSymbolsParallel.h>
+
+#include "Cases.hpp"
+
+namespace {
+
+using list_t = ou::tf::iqfeed::InMemoryMktSymbolList;
+using trd_t = list_t::trd_t;
+
+std::string Name( size_t ix ) { // distinct, letters only, as the option symbol parser requires
+  std::string s( "A" );
+  for ( size_t n = 0; n < 4; n++ ) {
+    s += (char)( 'A' + ix % 26 );
+    ix /= 26;
+  }
+  return s;
+}
+
+size_t Write( const std::string& sFileName, size_t nEquities, size_t nOptions ) {
+
+  static const char* rMonth[] = { "JAN", "FEB", "MAR" };
+  static const char* rDay[] = { "15", "19", "19" }; // fridays in 2027
+  static const char* rExchange[] = { "NASDAQ", "NYSE", "NYSE_AMERICAN" };
+
+  std::mt19937_64 generator( 29 );
+  std::uniform_int_distribution<int> price( 5, 500 );
+
+  std::ofstream file( sFileName, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary );
+  if ( !file ) {
+    throw std::runtime_error( "mktsymbols: can't write " + sFileName );
+  }
+
+  size_t cntLines {};
+  file << "symbol\tdescription\texchange\tlisted_market\tsecurity_type\tsic\tfrontmonth\tnaics\n";
+
+  for ( size_t ixEquity = 0; ixEquity < nEquities; ixEquity++ ) {
+    const std::string sName( Name( ixEquity ) );
+    const char* szExchange = rExchange[ ixEquity % 3 ];
+    file << sName << "\t" << sName << " INC COMMON STOCK\t" << szExchange << "\t" << szExchange << "\tEQUITY\t3571\t\t334111\n";
+    cntLines++;
+    const int base = price( generator );
+    for ( size_t ixOption = 0; ixOption < nOptions; ixOption++ ) {
+      const size_t ixMonth = ixOption % 3;
+      const bool bCall = 0 == ( ixOption / 3 ) % 2;
+      const int strike = base + (int)( ixOption / 6 ) * 5;
+      const char code = (char)( ( bCall ? 'A' : 'M' ) + ixMonth );
+      file
+        << sName << "27" << rDay[ ixMonth ] << code << strike
+        << "\t" << sName << " " << rMonth[ ixMonth ] << " 2027 " << ( bCall ? "C" : "P" ) << " " << strike
+        << "\tOPRA\tOPRA\tIEOPTION\t\t\t\n";
+      cntLines++;
+    }
+  }
+
+  static const char rFuture[] = { 'H', 'M', 'U', 'Z' };
+  for ( size_t ix = 0; ix < nEquities / 100; ix++ ) {
+    const std::string sName( "@" + Name( ix ).substr( 1, 2 ) );
+    for ( char month: rFuture ) {
+      file << sName << month << "27\t" << sName << " FUTURE " << month << "\tCME\tCME_GBX\tFUTURE\t\t\t\n";
+      cntLines++;
+    }
+    file << sName << "#\t" << sName << " FRONT MONTH\tCME\tCME_GBX\tFUTURE\t\tY\t\n";
+    file << Name( ix ) << ".X\t" << Name( ix ) << " INDEX\tDTN\tDTN\tINDEX\t\t\t\n";
+    cntLines += 2;
+  }
+
+  return cntLines;
+}
+
+// order dependent digest over every field, so a list need not be held for comparison
+size_t Digest( list_t& list ) {
+  size_t digest( list.Size() );
+  auto mix = [&digest]( size_t value ){ digest = digest * 1099511628211ul ^ value; };
+  std::hash<std::string> hs;
+  for ( const trd_t& trd: list ) {
+    mix( hs( trd.sSymbol ) ); mix( hs( trd.sDescription ) );
+    mix( hs( trd.sExchange ) ); mix( hs( trd.sListedMarket ) );
+    mix( (size_t)trd.sc ); mix( trd.nMultiplier );
+    mix( trd.nSIC ); mix( trd.nNAICS );
+    mix( hs( trd.sUnderlying ) ); mix( (size_t)trd.eOptionSide );
+    mix( std::hash<double>()( trd.dblStrike ) );
+    mix( trd.nYear ); mix( trd.nMonth ); mix( trd.nDay );
+    mix( trd.bFrontMonth ); mix( trd.bHasOptions );
+  }
+  return digest;
+}
+
+void GetLine( const std::string& sFileName, list_t& list ) {
+  using namespace ou::tf::iqfeed;
+  list.Clear();
+  ValidateMktSymbolLine validator;
+  validator.SetOnProcessLine( MakeDelegate( &list, &InMemoryMktSymbolList::InsertParsedStructure ) );
+  ParseMktSymbolDiskFile diskfile;
+  diskfile.SetOnProcessLine( MakeDelegate( &validator, &ValidateMktSymbolLine::Parse<ParseMktSymbolDiskFile::iterator_t> ) );
+  diskfile.Run( sFileName );
+  validator.SetOnProcessHasOption( MakeDelegate( &list, &InMemoryMktSymbolList::HandleSymbolHasOption ) );
+  validator.SetOnUpdateOptionUnderlying( MakeDelegate( &list, &InMemoryMktSymbolList::HandleUpdateOptionUnderlying ) );
+  validator.PostProcess();
+}
+
+} // namespace anonymous
+
+namespace bench {
+
+void MktSymbols( Report& report ) {
+
+  const std::string sFileName( ( std::filesystem::temp_directory_path() / "bench_mktsymbols_v2.txt" ).string() );
+  const size_t nLines = Write( sFileName, 50'000, 40 );
+  const std::string sParam( "lines=" + std::to_string( nLines ) );
+
+  size_t digest {};
+  { // untimed, settles the heap, and is the reference
+    list_t list;
+    GetLine( sFileName, list );
+    digest = Digest( list );
+  }
+
+  auto check = [&sFileName,digest]( list_t& list, const std::string& sVariant ){
+    if ( digest != Digest( list ) ) {
+      std::filesystem::remove( sFileName );
+      throw std::runtime_error( "mktsymbols: " + sVariant + " differs from the getline load" );
+    }
+  };
+
+  {
+    list_t list;
+    report.Add( Result { "mktsymbols", "getline", sParam, nLines, Time( [&](){ GetLine( sFileName, list ); } ) } );
+    check( list, "getline" );
+  }
+
+  const size_t nHardware = std::max<size_t>( 1, std::thread::hardware_concurrency() );
+  for ( size_t nThreads: { 1ul, 2ul, 4ul, nHardware } ) {
+    const std::string sVariant( "mmap/threads=" + std::to_string( nThreads ) );
+    list_t list;
+    report.Add( Result { "mktsymbols", sVariant, sParam, nLines, Time( [&](){
+      ou::tf::iqfeed::LoadMktSymbolsParallel( list, sFileName, nThreads, false );
+    } ) } );
+    check( list, sVariant );
+  }
+
+  std::filesystem::remove( sFileName );
+}
+
+} // namespace bench
@@ -0,0 +1,158 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    MultiBarFactory.cpp
+ * Author:  raymond@burkholder.net
+ * Project: Benchmark
+ * Created: October 20, 2026 01:30
+ */
+
+// one trade stream into bars of several widths:
+//   separate: a BarFactory per width, each trade is handed to each factory
+//   multi:    one MultiBarFactory with the same widths, the boundary test is shared
+//   mixed:    MultiBarFactory with tick and volume widths added to the time widths (no separate equivalent)
+// trades are a random walk in cents, 0 to 500ms apart, so the session runs over several midnights
+// the completed time bars of separate and multi must match
+
+#include <random>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#include <TFTimeSeries/BarFactory.h>
+#include <TFTimeSeries/MultiBarFactory.h>
+
+#include "Cases.hpp"
+
+namespace {
+
+using vTrade_t = std::vector<ou::tf::Trade>;
+
+vTrade_t Trades( std::size_t nTrades ) {
+  vTrade_t vTrade;
+  vTrade.reserve( nTrades );
+  std::mt19937_64 generator( 23 );
+  std::uniform_int_distribution<int> step( -2, 2 );
+  std::uniform_int_distribution<int> gap( 0, 500 ); // ms
+  std::uniform_int_distribution<int> size( 1, 10 ); // lots of 100
+  long cents = 400000; // 4000.00
+  ou::tf::Trade::dt_t dt( boost::gregorian::date( 2026, 10, 19 ), boost::posix_time::time_duration( 9, 30, 0 ) );
+  for ( std::size_t ix = 0; ix < nTrades; ix++ ) {
+    cents += step( generator );
+    dt += boost::posix_time::milliseconds( gap( generator ) );
+    vTrade.emplace_back( ou::tf::Trade( dt, cents / 100.0, 100 * size( generator ) ) );
+  }
+  return vTrade;
+}
+
+// per width: completed bars and a sum over their fields
+struct Check {
+  std::size_t nBars;
+  double sum;
+  Check(): nBars {}, sum {} {}
+  void Add( const ou::tf::Bar& bar ) {
+    nBars++;
+    sum += bar.Open() + bar.High() + bar.Low() + bar.Close() + bar.Volume()
+         + bar.DateTime().time_of_day().total_seconds();
+  }
+  bool operator==( const Check& rhs ) const { return ( nBars == rhs.nBars ) && ( sum == rhs.sum ); }
+};
+
+using vCheck_t = std::vector<Check>;
+
+struct Sink { // target for a BarFactory's FastDelegate
+  Check* pCheck;
+  void HandleBarComplete( const ou::tf::Bar& bar ) { pCheck->Add( bar ); }
+};
+
+struct MultiSink {
+  vCheck_t* pvCheck;
+  void HandleBarComplete( size_t ix, const ou::tf::Bar& bar ) { ( *pvCheck )[ ix ].Add( bar ); }
+};
+
+double Separate( const vTrade_t& vTrade, const std::vector<unsigned long>& vSeconds, vCheck_t& vCheck ) {
+  vCheck.assign( vSeconds.size(), Check() );
+  std::vector<Sink> vSink( vSeconds.size() );
+  std::vector<ou::tf::BarFactory> vFactory;
+  vFactory.reserve( vSeconds.size() );
+  for ( size_t ix = 0; ix < vSeconds.size(); ix++ ) {
+    vSink[ ix ].pCheck = &vCheck[ ix ];
+    vFactory.emplace_back( ou::tf::BarFactory( vSeconds[ ix ] ) );
+    vFactory.back().SetOnBarComplete( MakeDelegate( &vSink[ ix ], &Sink::HandleBarComplete ) );
+  }
+  return bench::Time( [&](){
+    for ( const ou::tf::Trade& trade: vTrade ) {
+      for ( ou::tf::BarFactory& factory: vFactory ) factory.Add( trade );
+    }
+  } );
+}
+
+double Multi( const vTrade_t& vTrade, const ou::tf::MultiBarFactory::vWidth_t& vWidth, vCheck_t& vCheck ) {
+  vCheck.assign( vWidth.size(), Check() );
+  MultiSink sink { &vCheck };
+  ou::tf::MultiBarFactory factory( vWidth );
+  factory.SetOnBarComplete( fastdelegate::MakeDelegate( &sink, &MultiSink::HandleBarComplete ) );
+  return bench::Time( [&](){
+    for ( const ou::tf::Trade& trade: vTrade ) factory.Add( trade );
+  } );
+}
+
+} // namespace anonymous
+
+namespace bench {
+
+void MultiBarFactory( Report& report ) {
+
+  using Width = ou::tf::MultiBarFactory::Width;
+
+  const std::size_t nTrades = 4'000'000;
+  const vTrade_t vTrade( Trades( nTrades ) );
+
+  const std::vector<unsigned long> vSeconds = { 1, 5, 60, 300, 900, 3600 };
+  ou::tf::MultiBarFactory::vWidth_t vWidth;
+  for ( unsigned long n: vSeconds ) vWidth.emplace_back( Width::Seconds( n ) );
+
+  for ( std::size_t nWidths: { 1ul, 3ul, vSeconds.size() } ) {
+
+    const std::string sParam( "widths=" + std::to_string( nWidths ) );
+    const std::vector<unsigned long> vSeconds_( vSeconds.begin(), vSeconds.begin() + nWidths );
+    const ou::tf::MultiBarFactory::vWidth_t vWidth_( vWidth.begin(), vWidth.begin() + nWidths );
+
+    vCheck_t vCheckSeparate;
+    vCheck_t vCheckMulti;
+
+    report.Add( Result { "multi_bar", "separate", sParam, nTrades, Separate( vTrade, vSeconds_, vCheckSeparate ) } );
+    report.Add( Result { "multi_bar", "multi", sParam, nTrades, Multi( vTrade, vWidth_, vCheckMulti ) } );
+
+    if ( vCheckSeparate != vCheckMulti ) {
+      throw std::runtime_error( "multi_bar: separate and multi disagree at " + sParam );
+    }
+  }
+
+  {
+    ou::tf::MultiBarFactory::vWidth_t vMixed( vWidth );
+    vMixed.emplace_back( Width::Ticks( 100 ) );
+    vMixed.emplace_back( Width::Ticks( 1000 ) );
+    vMixed.emplace_back( Width::Volume( 50'000 ) );
+    vMixed.emplace_back( Width::Volume( 500'000 ) );
+    vCheck_t vCheck;
+    report.Add( Result { "multi_bar", "mixed", "widths=" + std::to_string( vMixed.size() ), nTrades, Multi( vTrade, vMixed, vCheck ) } );
+    if ( ( nTrades / 1000 ) != vCheck[ vSeconds.size() + 1 ].nBars ) {
+      throw std::runtime_error( "multi_bar: tick bar count" );
+    }
+  }
+}
+
+} // namespace bench
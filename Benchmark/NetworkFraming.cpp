@@ -0,0 +1,114 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    NetworkFraming.cpp
+ * Author:  raymond@burkholder.net
+ * Project: Benchmark
+ * Created: October 20, 2026 02:40
+ */
+
+// bytes from the socket into lines, as Network<>::OnReadDone hands them to the line buffer handlers:
+//   lines are 100 to 200 byte IQFeed style records ending in \r\n, presented in reads of 'read' bytes
+//   each line buffer is given back to the repository, as IQFeed's message dispatch does once parsed
+// no socket, FrameLines is called directly with each block
+
+#include <random>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#include <OUCommon/Network.h>
+
+#include "Cases.hpp"
+
+namespace {
+
+class Framer: public ou::Network<Framer> {
+  friend ou::Network<Framer>;
+public:
+
+  using inherited_t = ou::Network<Framer>;
+
+  Framer(): m_nLines {}, m_nBytes {} {}
+
+  using inherited_t::FrameLines;
+
+  std::size_t Lines() const { return m_nLines; }
+  std::size_t Bytes() const { return m_nBytes; }
+
+protected:
+private:
+
+  std::size_t m_nLines;
+  std::size_t m_nBytes;
+
+  void OnNetworkLineBuffer( linebuffer_t* pBuffer ) {
+    ++m_nLines;
+    m_nBytes += pBuffer->size();
+    GiveBackBuffer( pBuffer );
+  }
+};
+
+using vByte_t = std::vector<Framer::bufferelement_t>;
+
+vByte_t Stream( std::size_t nLines, std::size_t& nBytesInLines ) {
+  std::mt19937_64 generator( 31 );
+  std::uniform_int_distribution<int> length( 100, 200 );
+  std::uniform_int_distribution<int> digit( '0', '9' );
+  vByte_t vByte;
+  nBytesInLines = 0;
+  for ( std::size_t ix = 0; ix < nLines; ix++ ) {
+    const int n = length( generator );
+    vByte.push_back( 'Q' );
+    for ( int ch = 1; ch < n; ch++ ) {
+      vByte.push_back( ( 0 == ( ch % 8 ) ) ? ',' : digit( generator ) );
+    }
+    vByte.push_back( 0x0d );
+    vByte.push_back( 0x0a );
+    nBytesInLines += n;
+  }
+  return vByte;
+}
+
+} // namespace anonymous
+
+namespace bench {
+
+void NetworkFraming( Report& report ) {
+
+  const std::size_t nLines( 2'000'000 );
+  std::size_t nBytesInLines;
+  const vByte_t vByte( Stream( nLines, nBytesInLines ) );
+
+  for ( std::size_t nRead: { 512ul, 2048ul } ) { // 2048 is NETWORK_INPUT_BUF_SIZE
+
+    Framer framer;
+
+    const double dblSeconds = Time( [&](){
+      for ( std::size_t ix = 0; ix < vByte.size(); ix += nRead ) {
+        framer.FrameLines( vByte.data() + ix, std::min( nRead, vByte.size() - ix ) );
+      }
+    } );
+
+    if ( ( nLines != framer.Lines() ) || ( nBytesInLines != framer.Bytes() ) ) {
+      throw std::runtime_error( "network_framing: lines do not match the stream" );
+    }
+
+    report.Add( Result { "network_framing", "lines", "read=" + std::to_string( nRead ), nLines, dblSeconds } );
+  }
+}
+
+} // namespace bench
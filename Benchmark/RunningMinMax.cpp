@@ -0,0 +1,116 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    RunningMinMax.cpp
+ * Author:  raymond@burkholder.net
+ * Project: Benchmark
+ * Created: October 19, 2026 15:20
+ */
+
+// sliding window min/max per tick, as TSSWStochastic and TSSWDonchianChannel drive it:
+//   each tick is an Add, plus a Remove of the oldest once the window is full, then Min/Max are read
+//   monotonic: RunningMinMax, paired monotonic deques over a ring buffer
+//   map:       the previous std::map<value,count> implementation, kept here as the reference
+//   prices are a random walk in cents, so the window holds many duplicates as a quote midpoint does
+
+#include <map>
+#include <deque>
+#include <random>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#include <TFIndicators/RunningMinMax.h>
+
+#include "Cases.hpp"
+
+namespace {
+
+class MapMinMax {
+public:
+  void Add( double value ) { m_mapValueCount[ value ]++; }
+  void Remove( double value ) {
+    mapValueCount_t::iterator iter = m_mapValueCount.find( value );
+    if ( m_mapValueCount.end() != iter ) {
+      if ( 0 == --( iter->second ) ) m_mapValueCount.erase( iter );
+    }
+  }
+  double Min() const { return m_mapValueCount.begin()->first; }
+  double Max() const { return m_mapValueCount.rbegin()->first; }
+private:
+  using mapValueCount_t = std::map<double,unsigned int>;
+  mapValueCount_t m_mapValueCount;
+};
+
+class MonotonicMinMax: public ou::tf::RunningMinMax<MonotonicMinMax,double> {
+  friend ou::tf::RunningMinMax<MonotonicMinMax,double>;
+};
+
+std::vector<double> Walk( std::size_t nTicks ) {
+  std::vector<double> vPrice( nTicks );
+  std::mt19937_64 generator( 17 );
+  std::uniform_int_distribution<int> step( -2, 2 );
+  long cents = 400000; // 4000.00
+  for ( double& price: vPrice ) {
+    cents += step( generator );
+    price = cents / 100.0;
+  }
+  return vPrice;
+}
+
+template<typename MinMax>
+double Run( const std::vector<double>& vPrice, std::size_t nWindow, double& check ) {
+  MinMax mm;
+  std::size_t ix = 0;
+  for ( ; ix < nWindow; ix++ ) mm.Add( vPrice[ ix ] ); // warm up, untimed
+  double sum {};
+  const double dblSeconds = bench::Time( [&](){
+    for ( std::size_t ixTick = nWindow; ixTick < vPrice.size(); ixTick++ ) {
+      mm.Remove( vPrice[ ixTick - nWindow ] );
+      mm.Add( vPrice[ ixTick ] );
+      sum += mm.Max() - mm.Min();
+    }
+  } );
+  bench::DoNotOptimize( sum );
+  check = sum;
+  return dblSeconds;
+}
+
+} // namespace anonymous
+
+namespace bench {
+
+void RunningMinMax( Report& report ) {
+
+  const std::size_t nTimed = 4'000'000;
+
+  for ( std::size_t nWindow: { 100ul, 10'000ul, 1'000'000ul } ) {
+
+    const std::vector<double> vPrice( Walk( nWindow + nTimed ) );
+    const std::string sParam( "window=" + std::to_string( nWindow ) );
+
+    double checkMonotonic {};
+    double checkMap {};
+
+    report.Add( Result { "running_minmax", "monotonic", sParam, nTimed, Run<MonotonicMinMax>( vPrice, nWindow, checkMonotonic ) } );
+    report.Add( Result { "running_minmax", "map", sParam, nTimed, Run<MapMinMax>( vPrice, nWindow, checkMap ) } );
+
+    if ( checkMonotonic != checkMap ) {
+      throw std::runtime_error( "running_minmax: monotonic and map disagree at " + sParam );
+    }
+  }
+}
+
+} // namespace bench
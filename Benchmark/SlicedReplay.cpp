@@ -0,0 +1,125 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    SlicedReplay.cpp
+ * Author:  raymond@burkholder.net
+ * Project: Benchmark
+ * Created: October 19, 2026 14:25
+ */
+
+// one day of quotes through TSSWStatsMidQuote and TSEMA, sequential vs one slice per core,
+//   reports the largest difference between the two result series as a sanity check
+
+#include <cmath>
+#include <random>
+#include <thread>
+#include <memory>
+
+#include <TFIndicators/TSEMA.h>
+#include <TFIndicators/TSSWStats.h>
+
+#include <TFSimulation/SlicedReplay.hpp>
+
+#include "Cases.hpp"
+
+namespace {
+
+using Quotes = ou::tf::Quotes;
+using Quote = ou::tf::Quote;
+using Prices = ou::tf::Prices;
+using Price = ou::tf::Price;
+
+using Replay = ou::tf::SlicedReplay<Quotes, Prices>;
+
+void Build( std::size_t nQuotes, Quotes& quotes ) {
+  std::mt19937_64 rng( 42 );
+  std::normal_distribution<double> step( 0.0, 0.01 );
+  std::exponential_distribution<double> gap( (double)nQuotes / ( 6.5 * 3600.0 * 1e6 ) );
+  const ptime dtStart( boost::gregorian::date( 2026, 10, 19 ), time_duration( 9, 30, 0 ) );
+  double dblMicros {};
+  double mid( 100.0 );
+  for ( std::size_t cnt = 0; cnt < nQuotes; ++cnt ) {
+    dblMicros += gap( rng );
+    mid += step( rng );
+    quotes.Append( Quote( dtStart + microseconds( (int64_t)dblMicros ), mid - 0.01, 100, mid + 0.01, 100 ) );
+  }
+}
+
+// indicators for one slice, output is the sum of the window mean and the ema
+struct Indicators {
+  ou::tf::TSSWStatsMidQuote stats;
+  ou::tf::hf::TSEMA<Quote> ema;
+  Prices& output;
+  Indicators( Quotes& input, Prices& output_ )
+  : stats( input, seconds( 60 ) ), ema( input, seconds( 30 ) ), output( output_ )
+  {
+    stats.OnUpdate.Add( MakeDelegate( this, &Indicators::HandleStats ) );
+  }
+  ~Indicators() {
+    stats.OnUpdate.Remove( MakeDelegate( this, &Indicators::HandleStats ) );
+  }
+  void HandleStats( const ou::tf::TSSWStatsMidQuote::Results& results ) {
+    output.Append( Price( results.dt, results.stats.meanY + ema.GetEMA() ) );
+  }
+};
+
+} // namespace anonymous
+
+namespace bench {
+
+void SlicedReplay( Report& report ) {
+
+  Quotes quotes;
+  Build( 4'000'000, quotes );
+
+  auto fBuild = []( Replay::Slice& slice, Quotes& input, Prices& output )->std::shared_ptr<void> {
+    std::shared_ptr<Indicators> p = std::make_shared<Indicators>( input, output );
+    slice.Require( p->stats );
+    slice.Require( p->ema );
+    return p;
+  };
+
+  Prices sequential;
+  {
+    Replay replay;
+    const double dblSeconds = Time( [&](){ replay.Run( quotes, sequential, fBuild, 1 ); } );
+    report.Add( Result{ "sliced_replay", "sequential", "slices=1", quotes.Size(), dblSeconds } );
+  }
+
+  const std::size_t nCores = std::max<unsigned int>( 1, std::thread::hardware_concurrency() );
+  for ( const std::size_t nSlices: { nCores, 4 * nCores } ) {
+    Prices sliced;
+    Replay replay;
+    const double dblSeconds = Time( [&](){ replay.Run( quotes, sliced, fBuild, nSlices ); } );
+    double dblMaxDiff {};
+    if ( sliced.Size() == sequential.Size() ) {
+      for ( std::size_t ix = 0; ix < sliced.Size(); ++ix ) {
+        dblMaxDiff = std::max( dblMaxDiff, std::abs( sliced.at( ix )->Value() - sequential.at( ix )->Value() ) );
+      }
+    }
+    else {
+      dblMaxDiff = NAN;
+    }
+    report.Add( Result{
+      "sliced_replay", "sliced",
+      "slices=" + std::to_string( replay.Slices().size() )
+        + ",cores=" + std::to_string( nCores )
+        + ",replayed=" + std::to_string( replay.GetCountReplayed() )
+        + ",max_diff=" + std::to_string( dblMaxDiff ),
+      quotes.Size(), dblSeconds } );
+  }
+}
+
+} // namespace bench
@@ -0,0 +1,95 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    TimeSeriesAppend.cpp
+ * Author:  raymond@burkholder.net
+ * Project: Benchmark
+ * Created: October 19, 2026 17:20
+ */
+
+// a session of quotes appended to a series, as Watch records them:
+//   chunked: ou::tf::Quotes, blocks from TSArena, with and without a block size hint
+//   vector:  std::vector<Quote>, the previous storage, which copies the history on each growth
+// each is reported twice: total throughput, and the single slowest append (max_append, nItems=1)
+// a second pass of the chunked series re-uses the arena blocks released by the first
+
+#include <vector>
+#include <chrono>
+#include <string>
+#include <algorithm>
+
+#include <TFTimeSeries/TimeSeries.h>
+
+#include "Cases.hpp"
+
+namespace {
+
+using Quote = ou::tf::Quote;
+using steady_t = std::chrono::steady_clock;
+
+template<typename Append>
+void Run( bench::Report& report, const std::string& sVariant, const std::string& sParam, std::size_t nQuotes, Append&& append ) {
+  const ou::tf::Quote::dt_t dtStart( boost::gregorian::date( 2026, 10, 19 ), boost::posix_time::time_duration( 9, 30, 0 ) );
+  double dblMax {};
+  const double dblSeconds = bench::Time( [&](){
+    for ( std::size_t ix = 0; ix < nQuotes; ix++ ) {
+      const Quote quote( dtStart + boost::posix_time::microseconds( ix ), 100.0, 100, 100.01, 100 );
+      const steady_t::time_point tp = steady_t::now();
+      append( quote );
+      dblMax = std::max( dblMax, std::chrono::duration<double>( steady_t::now() - tp ).count() );
+    }
+  } );
+  report.Add( bench::Result { "timeseries_append", sVariant, sParam, nQuotes, dblSeconds } );
+  report.Add( bench::Result { "timeseries_append", sVariant + "/max_append", sParam, 1, dblMax } );
+}
+
+} // namespace anonymous
+
+namespace bench {
+
+void TimeSeriesAppend( Report& report ) {
+
+  for ( std::size_t nQuotes: { 1'000'000ul, 4'000'000ul } ) {
+
+    const std::string sParam( "quotes=" + std::to_string( nQuotes ) );
+
+    {
+      std::vector<Quote> vQuote;
+      Run( report, "vector", sParam, nQuotes, [&vQuote]( const Quote& quote ){ vQuote.push_back( quote ); } );
+    }
+
+    for ( std::size_t pass = 1; pass <= 2; pass++ ) { // second pass draws from the arena free list
+      ou::tf::Quotes quotes;
+      Run( report, "chunked/pass" + std::to_string( pass ), sParam, nQuotes, [&quotes]( const Quote& quote ){ quotes.Append( quote ); } );
+    }
+
+    {
+      ou::tf::Quotes quotes;
+      quotes.BlockSizeHint( nQuotes );
+      Run( report, "chunked/hint", sParam, nQuotes, [&quotes]( const Quote& quote ){ quotes.Append( quote ); } );
+    }
+
+    ou::tf::TSArena::Instance().Trim();
+  }
+
+  const ou::tf::TSArena::Stats stats( ou::tf::TSArena::Instance().GetStats() );
+  std::cout
+    << "timeseries_append arena: blocks in use=" << stats.nBlocksInUse
+    << ",free=" << stats.nBlocksFree
+    << ",from system=" << stats.nBlocksSystem
+    << std::endl;
+}
+
+} // namespace bench
@@ -0,0 +1,114 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    TimeSeriesSearch.cpp
+ * Author:  raymond@burkholder.net
+ * Project: Benchmark
+ * Created: October 20, 2026 02:40
+ */
+
+// locating a time in a recorded series, as the simulation and charting position themselves:
+//   AtOrAfter and After, from times drawn at random over the session, and in ascending order, as a replay steps
+// the series is ou::tf::Quotes, one quote every 50us, lookup times fall between quotes as often as on them
+
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+#include <TFTimeSeries/TimeSeries.h>
+
+#include "Cases.hpp"
+
+namespace {
+
+using Quote = ou::tf::Quote;
+using dt_t = Quote::dt_t;
+using vdt_t = std::vector<dt_t>;
+
+const dt_t c_dtStart( boost::gregorian::date( 2026, 10, 19 ), boost::posix_time::time_duration( 9, 30, 0 ) );
+
+vdt_t Lookups( std::size_t nQuotes, std::size_t nLookups, bool bSorted ) {
+  std::mt19937_64 generator( 37 );
+  std::uniform_int_distribution<long> offset( 0, 50 * nQuotes - 1 ); // us
+  vdt_t vdt;
+  vdt.reserve( nLookups );
+  for ( std::size_t ix = 0; ix < nLookups; ix++ ) {
+    vdt.emplace_back( c_dtStart + boost::posix_time::microseconds( offset( generator ) ) );
+  }
+  if ( bSorted ) std::sort( vdt.begin(), vdt.end() );
+  return vdt;
+}
+
+} // namespace anonymous
+
+namespace bench {
+
+void TimeSeriesSearch( Report& report ) {
+
+  const std::size_t nLookups( 2'000'000 );
+
+  for ( std::size_t nQuotes: { 100'000ul, 4'000'000ul } ) {
+
+    ou::tf::Quotes quotes;
+    quotes.BlockSizeHint( nQuotes );
+    for ( std::size_t ix = 0; ix < nQuotes; ix++ ) {
+      quotes.Append( Quote( c_dtStart + boost::posix_time::microseconds( 50 * ix ), 100.0, 100, 100.01, 100 ) );
+    }
+
+    const std::string sParam( "quotes=" + std::to_string( nQuotes ) );
+
+    for ( bool bSorted: { false, true } ) {
+
+      const vdt_t vdt( Lookups( nQuotes, nLookups, bSorted ) );
+      const std::string sOrder( bSorted ? "ascending" : "random" );
+
+      {
+        std::size_t nCheck {};
+        const double dblSeconds = Time( [&](){
+          for ( const dt_t& dt: vdt ) {
+            ou::tf::Quotes::const_iterator iter = quotes.AtOrAfter( dt );
+            nCheck += iter - quotes.begin();
+          }
+        } );
+        DoNotOptimize( nCheck );
+        report.Add( Result { "timeseries_search", "at_or_after/" + sOrder, sParam, nLookups, dblSeconds } );
+      }
+
+      {
+        std::size_t nCheck {};
+        const double dblSeconds = Time( [&](){
+          for ( const dt_t& dt: vdt ) {
+            ou::tf::Quotes::const_iterator iter = quotes.After( dt );
+            nCheck += iter - quotes.begin();
+          }
+        } );
+        DoNotOptimize( nCheck );
+        report.Add( Result { "timeseries_search", "after/" + sOrder, sParam, nLookups, dblSeconds } );
+      }
+    }
+
+    // spot check against the construction: the quote at or after a time is the next 50us multiple
+    const dt_t dt( c_dtStart + boost::posix_time::microseconds( 50 * ( nQuotes / 2 ) + 1 ) );
+    if ( ( nQuotes / 2 + 1 ) != (std::size_t)( quotes.AtOrAfter( dt ) - quotes.begin() ) ) {
+      throw std::runtime_error( "timeseries_search: AtOrAfter out of place" );
+    }
+  }
+
+  ou::tf::TSArena::Instance().Trim();
+}
+
+} // namespace bench
@@ -0,0 +1,133 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    VolSurface.cpp
+ * Author:  raymond@burkholder.net
+ * Project: Benchmark
+ * Created: October 20, 2026 04:20
+ */
+
+// the implied volatility surface over an SPY sized chain:
+//   40 expiries, strikes $1 apart within 15% of the money and $5 apart out to 50%, a call and a put at each
+//   update: one option's iv changes, as the engine publishes after a quote, the cells around its strike follow
+//   rebase: the underlying moves beyond half a cell, every cell is recomputed, the cost of a full pass
+//   lookup: interpolated iv at random expiry and moneyness
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <TFOptions/VolSurface.h>
+
+#include "Cases.hpp"
+
+namespace {
+
+using Surface = ou::tf::option::VolSurface;
+
+struct Option {
+  Surface::handle_t handle;
+  double dblIV;
+};
+
+double Smile( double dblMoneyness, double dblYears ) {
+  const double dblSkew( dblMoneyness - 1.0 );
+  return 0.18 + 0.05 / ( 1.0 + 10.0 * dblYears ) - 0.25 * dblSkew + 0.6 * dblSkew * dblSkew;
+}
+
+} // namespace anonymous
+
+namespace bench {
+
+void VolSurface( Report& report ) {
+
+  const double dblSpot( 450.0 );
+  const boost::gregorian::date dateToday( 2026, 10, 20 );
+
+  Surface surface( dateToday );
+
+  std::vector<Option> vOption;
+  std::vector<double> vYears;
+  for ( int ixExpiry = 0; ixExpiry < 40; ++ixExpiry ) {
+    const int nDays = ( ixExpiry < 20 ) ? ( ixExpiry + 1 ) : ( 20 + ( ixExpiry - 19 ) * 30 ); // dailies, then monthlies
+    const boost::gregorian::date expiry( dateToday + boost::gregorian::days( nDays ) );
+    const double dblYears( nDays / 365.0 );
+    vYears.push_back( dblYears );
+    for ( double dblStrike = 0.5 * dblSpot; dblStrike <= 1.5 * dblSpot; ) {
+      const double dblIV( Smile( dblStrike / dblSpot, dblYears ) );
+      for ( ou::tf::OptionSide::EOptionSide side: { ou::tf::OptionSide::Call, ou::tf::OptionSide::Put } ) {
+        vOption.emplace_back( Option { surface.Add( expiry, dblStrike, side ), dblIV } );
+      }
+      dblStrike += ( std::abs( dblStrike / dblSpot - 1.0 ) < 0.15 ) ? 1.0 : 5.0;
+    }
+  }
+
+  surface.SetUnderlying( dblSpot );
+  for ( const Option& option: vOption ) surface.Update( option.handle, option.dblIV );
+
+  const std::string sChain( "options=" + std::to_string( vOption.size() ) );
+
+  std::mt19937 rng( 20261020 );
+
+  {
+    // quotes, as they arrive: random options, iv moves a little
+    const std::size_t nQuote( 2'000'000 );
+    std::uniform_int_distribution<std::size_t> ix( 0, vOption.size() - 1 );
+    std::uniform_real_distribution<double> noise( -0.002, 0.002 );
+    std::vector<std::pair<Surface::handle_t,double> > vQuote;
+    vQuote.reserve( nQuote );
+    for ( std::size_t n = 0; n < nQuote; ++n ) {
+      const Option& option( vOption[ ix( rng ) ] );
+      vQuote.emplace_back( option.handle, option.dblIV + noise( rng ) );
+    }
+    const std::size_t nCells( surface.GetStats().nCells );
+    const double dblSeconds = Time( [&](){
+      for ( const auto& quote: vQuote ) surface.Update( quote.first, quote.second );
+    } );
+    const std::size_t nCellsPer( ( surface.GetStats().nCells - nCells + vQuote.size() / 2 ) / vQuote.size() );
+    report.Add( Result { "vol_surface", "update", sChain + " cells/update=" + std::to_string( nCellsPer ), vQuote.size(), dblSeconds } );
+  }
+
+  {
+    // the underlying steps back and forth by a cell, each step a full recompute
+    const std::size_t nRebase( 200 );
+    const std::size_t nBefore( surface.GetStats().nRebases );
+    const double dblSeconds = Time( [&](){
+      for ( std::size_t n = 0; n < nRebase; ++n ) {
+        surface.SetUnderlying( ( 0 == ( n & 1 ) ) ? dblSpot * 1.005 : dblSpot );
+      }
+    } );
+    const std::size_t nRebases( surface.GetStats().nRebases - nBefore );
+    report.Add( Result { "vol_surface", "rebase", sChain + " cells=" + std::to_string( surface.Expiries() * surface.Cells() ), nRebases, dblSeconds } );
+  }
+
+  {
+    const std::size_t nLookup( 2'000'000 );
+    std::uniform_real_distribution<double> years( 0.0, vYears.back() * 1.1 );
+    std::uniform_real_distribution<double> moneyness( 0.6, 1.4 );
+    std::vector<std::pair<double,double> > vLookup;
+    vLookup.reserve( nLookup );
+    for ( std::size_t n = 0; n < nLookup; ++n ) vLookup.emplace_back( years( rng ), moneyness( rng ) );
+    double dblSum {};
+    const double dblSeconds = Time( [&](){
+      for ( const auto& lookup: vLookup ) dblSum += surface.IV( lookup.first, lookup.second );
+    } );
+    DoNotOptimize( dblSum );
+    report.Add( Result { "vol_surface", "lookup", sChain, vLookup.size(), dblSeconds } );
+  }
+}
+
+} // namespace bench
@@ -0,0 +1,151 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    main.cpp
+ * Author:  raymond@burkholder.net
+ * Project: Benchmark
+ * Created: October 19, 2026 10:05
+ */
+
+// usage: Benchmark [--csv results.csv] [--compare baseline.csv] [--threshold percent] [case ...]
+//   no cases runs all cases
+//   --csv: the results as csv, for keeping with a commit
+//   --compare: ns/item against a previous --csv, fails when a result is slower by more than the threshold (default 10%)
+
+#include <map>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include "Cases.hpp"
+
+namespace {
+
+// returns the number of results slower than the baseline by more than dblThreshold percent
+std::size_t Compare( const std::vector<bench::Result>& vBaseline, const std::vector<bench::Result>& vResult, double dblThreshold ) {
+
+  using key_t = std::string;
+  auto key = []( const bench::Result& result )->key_t { return result.sCase + " " + result.sVariant + " " + result.sParam; };
+
+  std::map<key_t,const bench::Result*> mapBaseline;
+  for ( const bench::Result& result: vBaseline ) mapBaseline[ key( result ) ] = &result;
+
+  std::size_t cntSlower {};
+  std::cout << "== compare ns/item, baseline -> now ==" << std::endl;
+  for ( const bench::Result& result: vResult ) {
+    const key_t k( key( result ) );
+    auto iter = mapBaseline.find( k );
+    if ( mapBaseline.end() == iter ) {
+      std::cout << k << ": new" << std::endl;
+      continue;
+    }
+    const double dblBase = iter->second->NanosPerItem();
+    const double dblNow = result.NanosPerItem();
+    const double dblChange = ( 0.0 < dblBase ) ? ( 100.0 * ( dblNow - dblBase ) / dblBase ) : 0.0;
+    const bool bSlower = dblThreshold < dblChange;
+    if ( bSlower ) cntSlower++;
+    std::cout
+      << k << ": " << dblBase << " -> " << dblNow
+      << " (" << std::showpos << std::fixed << std::setprecision( 1 ) << dblChange << "%)" << std::noshowpos << std::defaultfloat << std::setprecision( 6 )
+      << ( bSlower ? " slower" : "" )
+      << std::endl;
+  }
+  return cntSlower;
+}
+
+} // namespace anonymous
+
+int main( int argc, char* argv[] ) {
+
+  using fCase_t = void(*)( bench::Report& );
+  using mapCase_t = std::map<std::string, fCase_t>;
+
+  const mapCase_t mapCase = {
+    { "american", &bench::American }
+  , { "binomial", &bench::Binomial }
+  , { "delegate", &bench::Delegate }
+  , { "garch", &bench::Garch }
+  , { "hdf5", &bench::HDF5 }
+  , { "ib_depth_book", &bench::IBDepthBook }
+  , { "iqfeed_messages", &bench::IQFeedMessages }
+  , { "level2_book", &bench::Level2Book }
+  , { "merge", &bench::MergeDatedDatums }
+  , { "mktsymbols", &bench::MktSymbols }
+  , { "multi_bar", &bench::MultiBarFactory }
+  , { "network_framing", &bench::NetworkFraming }
+  , { "running_minmax", &bench::RunningMinMax }
+  , { "sliced_replay", &bench::SlicedReplay }
+  , { "timeseries_append", &bench::TimeSeriesAppend }
+  , { "timeseries_search", &bench::TimeSeriesSearch }
+  , { "vol_surface", &bench::VolSurface }
+  };
+
+  std::string sCsv;
+  std::string sBaseline;
+  double dblThreshold( 10.0 );
+  std::vector<fCase_t> vCase;
+
+  for ( int ix = 1; ix < argc; ++ix ) {
+    const std::string sArg( argv[ ix ] );
+    if ( ( "--csv" == sArg ) && ( ix + 1 < argc ) ) sCsv = argv[ ++ix ];
+    else if ( ( "--compare" == sArg ) && ( ix + 1 < argc ) ) sBaseline = argv[ ++ix ];
+    else if ( ( "--threshold" == sArg ) && ( ix + 1 < argc ) ) dblThreshold = std::stod( argv[ ++ix ] );
+    else {
+      mapCase_t::const_iterator iter = mapCase.find( sArg );
+      if ( mapCase.end() == iter ) {
+        std::cerr << "unknown case '" << sArg << "', available:";
+        for ( const mapCase_t::value_type& vt: mapCase ) std::cerr << " " << vt.first;
+        std::cerr << std::endl;
+        return EXIT_FAILURE;
+      }
+      vCase.emplace_back( iter->second );
+    }
+  }
+
+  if ( vCase.empty() ) {
+    for ( const mapCase_t::value_type& vt: mapCase ) vCase.emplace_back( vt.second );
+  }
+
+  std::vector<bench::Result> vBaseline;
+  if ( !sBaseline.empty() ) { // read before the run, so a missing file fails early
+    std::ifstream file( sBaseline );
+    if ( !file ) {
+      std::cerr << "can't read baseline " << sBaseline << std::endl;
+      return EXIT_FAILURE;
+    }
+    vBaseline = bench::Report::ReadCsv( file );
+  }
+
+  bench::Report report;
+  for ( fCase_t fCase: vCase ) fCase( report );
+
+  if ( !sCsv.empty() ) {
+    std::ofstream file( sCsv, std::ios_base::out | std::ios_base::trunc );
+    if ( !file ) {
+      std::cerr << "can't write " << sCsv << std::endl;
+      return EXIT_FAILURE;
+    }
+    bench::Report::WriteCsv( file, report.Results() );
+  }
+
+  if ( !sBaseline.empty() ) {
+    if ( 0 < Compare( vBaseline, report.Results(), dblThreshold ) ) return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -164,7 +164,22 @@ void Process::Write() {
     if ( 0 != m_rDepthsByOrder[m_ixDepthsByOrder_Writing].Size() ) {
       ou::tf::HDF5DataManager dm( ou::tf::HDF5DataManager::RDWR );
       ou::tf::HDF5WriteTimeSeries<ou::tf::DepthsByOrder> wtsDepths( dm, true, true, 5, 256 );
-      wtsDepths.Write( m_sPathName_Depth, &m_rDepthsByOrder[m_ixDepthsByOrder_Writing] );
+      const std::optional<hsize_t> ixFirst = wtsDepths.Write( m_sPathName_Depth, &m_rDepthsByOrder[m_ixDepthsByOrder_Writing] );
+
+      if ( ixFirst ) {
+        // the write lands after an earlier session's rows, or over stored rows sharing its first time
+        if ( m_snapshots.Rows() != *ixFirst ) {
+          m_snapshots.Resume( dm, m_sPathName_Depth, *ixFirst );
+        }
+        m_rDepthsByOrder[m_ixDepthsByOrder_Writing].ForEachBlock(
+          [this]( const ou::tf::DepthByOrder* pDepth, ou::tf::DepthsByOrder::size_type n ){
+            for ( ou::tf::DepthsByOrder::size_type ix = 0; ix < n; ix++ ) m_snapshots.Append( pDepth[ ix ] );
+          } );
+        m_snapshots.Write( dm, m_sPathName_Depth );
+      }
+      else { // the rows are lost, a partial write is picked up by the Resume following the next write
+        std::cout << "Collector: depth write failed, " << m_rDepthsByOrder[m_ixDepthsByOrder_Writing].Size() << " rows" << std::endl;
+      }
 
       if ( !m_bHdf5AttributesSet ) {
         m_bHdf5AttributesSet= true;
@@ -29,6 +29,7 @@
 #include <TFIQFeed/Provider.h>
 
 #include <TFIQFeed/Level2/Symbols.hpp>
+#include <TFIQFeed/Level2/BookReplay.hpp>
 
 #include <TFTrading/Watch.h>
 #include <TFTrading/Instrument.h>
@@ -84,6 +85,7 @@ private:
 
   //ou::tf::DepthsByOrder m_depths_byorder; // time series for persistence
   ou::tf::iqfeed::l2::OrderBased m_OrderBased; // direct access
+  ou::tf::iqfeed::l2::Snapshots m_snapshots; // book snapshots beside the depths, for BookReplay seeks, writer thread only
   std::unique_ptr<ou::tf::iqfeed::l2::Symbols> m_pDispatch;
 
   void StartIQFeed();
@@ -0,0 +1,208 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Cache.cpp
+ * Author:  raymond@burkholder.net
+ * Project: Dividend
+ * Created: October 20, 2026 03:30
+ */
+
+#include <vector>
+#include <charconv>
+#include <algorithm>
+#include <stdexcept>
+
+#include <boost/filesystem.hpp>
+#include <boost/date_time/gregorian/gregorian.hpp>
+
+#include "Cache.hpp"
+
+namespace {
+  const std::string c_sComplete( "#complete" );
+  const std::size_t c_nFields( 10 ); // symbol,exchange,trade,yield,rate,amount,volume,exdiv,payed,option
+
+  std::string Date( boost::gregorian::date date ) {
+    return date.is_special() ? std::string() : boost::gregorian::to_iso_string( date );
+  }
+
+  boost::gregorian::date Date( const std::string& s ) {
+    return s.empty() ? boost::gregorian::date() : boost::gregorian::from_undelimited_string( s );
+  }
+
+  // shortest text which reads back as the same double
+  std::string Number( double value ) {
+    char rch[ 32 ];
+    const std::to_chars_result result( std::to_chars( rch, rch + sizeof( rch ), value ) );
+    return std::string( rch, result.ptr );
+  }
+
+  // rfc 4180: a field holding a comma, quote, or line break is quoted, with its quotes doubled
+  std::string Quote( const std::string& s ) {
+    if ( std::string::npos == s.find_first_of( ",\"\r\n" ) ) return s;
+    std::string sQuoted( 1, '"' );
+    for ( const char ch: s ) {
+      if ( '"' == ch ) sQuoted += '"';
+      sQuoted += ch;
+    }
+    sQuoted += '"';
+    return sQuoted;
+  }
+
+  // false on a quote out of place, or a quoted field left open
+  bool Split( const std::string& sRow, std::vector<std::string>& vField ) {
+    vField.clear();
+    std::string sField;
+    bool bQuoted( false );
+    for ( std::string::size_type ix = 0; ix < sRow.size(); ++ix ) {
+      const char ch( sRow[ ix ] );
+      if ( bQuoted ) {
+        if ( '"' == ch ) {
+          if ( ( ix + 1 < sRow.size() ) && ( '"' == sRow[ ix + 1 ] ) ) {
+            sField += '"';
+            ++ix;
+          }
+          else bQuoted = false;
+        }
+        else sField += ch;
+      }
+      else {
+        switch ( ch ) {
+          case ',':
+            vField.emplace_back( std::move( sField ) );
+            sField.clear();
+            break;
+          case '"':
+            if ( !sField.empty() ) return false;
+            bQuoted = true;
+            break;
+          default:
+            sField += ch;
+            break;
+        }
+      }
+    }
+    if ( bQuoted ) return false;
+    vField.emplace_back( std::move( sField ) );
+    return true;
+  }
+}
+
+Cache::Cache( const std::string& sDirectory, boost::gregorian::date date )
+: m_sFileName(
+    ( boost::filesystem::path( sDirectory.empty() ? "." : sDirectory )
+      / ( "dividend_" + boost::gregorian::to_iso_string( date ) + ".csv" ) ).string() )
+, m_bComplete( false )
+{
+  {
+    std::ifstream ifs( m_sFileName );
+    std::string sRow;
+    std::string sLine;
+    std::vector<std::string> vField;
+    while ( std::getline( ifs, sRow ) ) {
+      if ( sRow.empty() ) continue;
+      if ( c_sComplete == sRow ) {
+        m_bComplete = true;
+        continue;
+      }
+      // a quoted field may hold a line break, the row continues until its quotes pair up
+      while ( ( 1 == ( std::count( sRow.begin(), sRow.end(), '"' ) % 2 ) ) && std::getline( ifs, sLine ) ) {
+        sRow += '\n';
+        sRow += sLine;
+      }
+      if ( !Split( sRow, vField ) ) continue;
+      const std::string& sSymbol( vField[ 0 ] );
+      dividend_t dividend( sSymbol );
+      if ( Parse( sRow, dividend ) ) { // a row cut short by an interrupted run is skipped
+        std::pair<mapRow_t::iterator, bool> pair = m_mapRow.emplace( sSymbol, sRow );
+        if ( pair.second ) m_vOrder.push_back( sSymbol );
+        else pair.first->second = sRow;
+      }
+    }
+  }
+
+  if ( !m_bComplete ) {
+    m_ofs.open( m_sFileName, std::ios_base::out | std::ios_base::app );
+    if ( !m_ofs ) throw std::runtime_error( "cache " + m_sFileName + " can not be written" );
+  }
+}
+
+bool Cache::Find( dividend_t& dividend ) const {
+  mapRow_t::const_iterator iter = m_mapRow.find( dividend.sSymbol );
+  if ( m_mapRow.end() == iter ) return false;
+  return Parse( iter->second, dividend );
+}
+
+void Cache::Load( vSymbols_t& vSymbols ) const {
+  vSymbols.reserve( vSymbols.size() + m_vOrder.size() );
+  for ( const std::string& sSymbol: m_vOrder ) {
+    vSymbols.emplace_back( dividend_t( sSymbol ) );
+    Parse( m_mapRow.find( sSymbol )->second, vSymbols.back() );
+  }
+}
+
+void Cache::Append( const dividend_t& dividend ) {
+  const std::string sRow( Row( dividend ) );
+  std::lock_guard<std::mutex> lock( m_mutex );
+  if ( m_ofs.is_open() ) {
+    m_ofs << sRow << '\n';
+    m_ofs.flush(); // a run cut short keeps what it has
+  }
+}
+
+void Cache::MarkComplete() {
+  std::lock_guard<std::mutex> lock( m_mutex );
+  if ( m_ofs.is_open() ) {
+    m_ofs << c_sComplete << std::endl;
+    m_ofs.close();
+  }
+  m_bComplete = true;
+}
+
+std::string Cache::Row( const dividend_t& dividend ) {
+  // fields are quoted as needed, and doubles written in full, so Parse restores the values fetched
+  return
+           Quote( dividend.sSymbol )
+    + "," + Quote( dividend.sExchange )
+    + "," + Number( dividend.trade )
+    + "," + Number( dividend.yield )
+    + "," + Number( dividend.rate )
+    + "," + Number( dividend.amount )
+    + "," + std::to_string( dividend.nAverageVolume )
+    + "," + Date( dividend.dateExDividend )
+    + "," + Date( dividend.datePayed )
+    + "," + Quote( dividend.sOptionRoots )
+    ;
+}
+
+bool Cache::Parse( const std::string& sRow, dividend_t& dividend ) {
+  std::vector<std::string> vField;
+  if ( !Split( sRow, vField ) ) return false;
+  if ( c_nFields != vField.size() ) return false;
+  try {
+    dividend.sExchange = vField[ 1 ];
+    dividend.trade = std::stod( vField[ 2 ] );
+    dividend.yield = std::stod( vField[ 3 ] );
+    dividend.rate = std::stod( vField[ 4 ] );
+    dividend.amount = std::stod( vField[ 5 ] );
+    dividend.nAverageVolume = std::stoi( vField[ 6 ] );
+    dividend.dateExDividend = Date( vField[ 7 ] );
+    dividend.datePayed = Date( vField[ 8 ] );
+    dividend.sOptionRoots = vField[ 9 ];
+  }
+  catch ( const std::exception& ) {
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,71 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Cache.hpp
+ * Author:  raymond@burkholder.net
+ * Project: Dividend
+ * Created: October 20, 2026 03:30
+ */
+
+#pragma once
+
+// fundamentals retrieved on a day, so a rerun on the same day does not ask iqfeed again
+//   <directory>/dividend_YYYYMMDD.csv, one row per symbol, written as each arrives
+//   a run in which every symbol answered ends the file with '#complete',
+//     the next run takes the symbol list from the file as well, and does not connect
+//   symbols which timed out have no row, a rerun asks for those only
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <fstream>
+
+#include <boost/date_time/gregorian/gregorian_types.hpp>
+
+#include "Dividend.hpp"
+
+class Cache {
+public:
+
+  Cache( const std::string& sDirectory, boost::gregorian::date );
+
+  const std::string& FileName() const { return m_sFileName; }
+
+  bool Complete() const { return m_bComplete; }
+  std::size_t Size() const { return m_mapRow.size(); }
+
+  bool Find( dividend_t& ) const; // fills the fields when the symbol has a row
+  void Load( vSymbols_t& ) const; // every row, in the order first written
+
+  void Append( const dividend_t& ); // thread safe
+  void MarkComplete();
+
+protected:
+private:
+
+  const std::string m_sFileName;
+
+  bool m_bComplete;
+
+  using mapRow_t = std::map<std::string, std::string>; // symbol, row
+  mapRow_t m_mapRow;
+  std::vector<std::string> m_vOrder;
+
+  std::mutex m_mutex;
+  std::ofstream m_ofs;
+
+  static std::string Row( const dividend_t& );
+  static bool Parse( const std::string& sRow, dividend_t& );
+};
@@ -37,6 +37,8 @@ namespace {
   static const std::string sChoice_MinimumYield( "minimum_yield" );
   static const std::string sChoice_MinimumVolume( "minimum_volume" );
   static const std::string sChoice_MaxInTransit( "max_in_transit" );
+  static const std::string sChoice_Timeout( "timeout" );
+  static const std::string sChoice_CacheDirectory( "cache_directory" );
   //static const std::string sChoice_NumberOfRetrievals( "number_of_retrievals" );
 
   template<typename T>
@@ -72,6 +74,8 @@ bool Load( const std::string& sFileName, Choices& choices ) {
       ( sChoice_MinimumYield.c_str(), po::value<double>( &choices.m_dblMinimumYield ), "minimum yield" )
       ( sChoice_MinimumVolume.c_str(), po::value<uint32_t>( &choices.m_nMinimumVolume ), "minimum volume" )
       ( sChoice_MaxInTransit.c_str(), po::value<uint32_t>( &choices.m_nMaxInTransit ), "maximum in transit" )
+      ( sChoice_Timeout.c_str(), po::value<uint32_t>( &choices.m_nTimeout ), "seconds to wait for a symbol's fundamentals" )
+      ( sChoice_CacheDirectory.c_str(), po::value<std::string>( &choices.m_sCacheDirectory ), "directory for the daily cache" )
       //( sChoice_NumberOfRetrievals.c_str(), po::value<unsigned int>( &choices.m_nSimultaneousRetrievals ), "number of simultaneous retrievals" );
       ;
     po::variables_map vm;
@@ -91,6 +95,13 @@ bool Load( const std::string& sFileName, Choices& choices ) {
       bOk &= parse<double>( sFileName, vm, sChoice_MinimumYield, false, choices.m_dblMinimumYield );
       bOk &= parse<uint32_t>( sFileName, vm, sChoice_MinimumVolume, false, choices.m_nMinimumVolume );
       bOk &= parse<uint32_t>( sFileName, vm, sChoice_MaxInTransit, false, choices.m_nMaxInTransit );
+      bOk &= parse<uint32_t>( sFileName, vm, sChoice_Timeout, true, choices.m_nTimeout );
+      bOk &= parse<std::string>( sFileName, vm, sChoice_CacheDirectory, true, choices.m_sCacheDirectory );
+
+      if ( 0 == choices.m_nTimeout ) {
+        BOOST_LOG_TRIVIAL(error) << sFileName << " " << sChoice_Timeout << " needs to be 1 or more";
+        bOk = false;
+      }
       //bOk &= parse<unsigned int>( sFileName, vm, sChoice_NumberOfRetrievals, false, choices.m_nSimultaneousRetrievals );
 
       //if ( 10 < choices.m_nSimultaneousRetrievals ) {
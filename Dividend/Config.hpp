@@ -40,6 +40,11 @@ struct Choices {
 
   //unsigned int m_nSimultaneousRetrievals;
   uint32_t m_nMaxInTransit;
+  uint32_t m_nTimeout; // seconds for a symbol's fundamentals, optional
+
+  std::string m_sCacheDirectory; // optional, the current directory by default
+
+  Choices(): m_dblMinimumYield {}, m_nMinimumVolume {}, m_nMaxInTransit {}, m_nTimeout( 20 ) {}
 
 };
 
@@ -0,0 +1,47 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Dividend.hpp
+ * Author:  raymond@burkholder.net
+ * Project: Dividend
+ * Created: October 20, 2026 03:30
+ */
+
+#pragma once
+
+// the fundamentals kept per symbol, shared by Process and Cache
+
+#include <string>
+#include <vector>
+
+#include <boost/date_time/gregorian/greg_date.hpp>
+
+struct dividend_t {
+  const std::string sSymbol;
+  std::string sExchange;
+  double yield;
+  double rate;
+  double amount;
+  double trade; // last trade
+  int nAverageVolume;
+  boost::gregorian::date datePayed;
+  boost::gregorian::date dateExDividend;
+  std::string sOptionRoots;
+
+  dividend_t( const std::string& sSymbol_ )
+  : sSymbol( sSymbol_ ), yield {}, rate {}, amount {}, trade {}, nAverageVolume {} {}
+};
+
+using vSymbols_t = std::vector<dividend_t>;
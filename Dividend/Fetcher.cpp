@@ -0,0 +1,125 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Fetcher.cpp
+ * Author:  raymond@burkholder.net
+ * Project: Dividend
+ * Created: October 20, 2026 03:30
+ */
+
+#include <algorithm>
+
+#include "Fetcher.hpp"
+
+Fetcher::Fetcher( std::size_t nMaxInFlight, std::chrono::milliseconds msTimeout )
+: m_nMaxInFlight( std::max<std::size_t>( 1, nMaxInFlight ) )
+, m_msTimeout( msTimeout )
+, m_guard( boost::asio::make_work_guard( m_context ) )
+, m_nOutstanding {}
+{
+  m_thread = std::thread( [this](){ m_context.run(); } );
+}
+
+Fetcher::~Fetcher() {
+  m_guard.reset();
+  m_context.stop();
+  m_thread.join();
+}
+
+Fetcher::Stats Fetcher::Run( const vix_t& vix, fRequest_t&& fRequest, fCancel_t&& fCancel ) {
+
+  const steady_t::time_point tpStart( steady_t::now() );
+
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_fRequest = std::move( fRequest );
+    m_fCancel = std::move( fCancel );
+    m_vix = vix;
+    m_iterNext = m_vix.begin();
+    m_nOutstanding = 0;
+    m_stats = Stats();
+  }
+
+  Issue();
+
+  Stats stats;
+  {
+    std::unique_lock<std::mutex> lock( m_mutex );
+    m_cvDone.wait( lock, [this]{ return ( m_vix.end() == m_iterNext ) && ( 0 == m_nOutstanding ); } );
+    stats = std::move( m_stats );
+    m_fRequest = nullptr;
+    m_fCancel = nullptr;
+  }
+
+  stats.dblSeconds = std::chrono::duration<double>( steady_t::now() - tpStart ).count();
+  return stats;
+}
+
+bool Fetcher::Claim( ix_t ix ) {
+  std::lock_guard<std::mutex> lock( m_mutex );
+  mapInFlight_t::iterator iter = m_mapInFlight.find( ix );
+  if ( m_mapInFlight.end() == iter ) return false; // timed out, or not requested
+  iter->second->cancel();
+  m_mapInFlight.erase( iter ); // the timer's handler runs with operation_aborted, and finds nothing
+  return true;
+}
+
+void Fetcher::Done( bool bCompleted ) {
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    if ( bCompleted ) m_stats.nCompleted++;
+    else m_stats.nTimedOut++;
+    m_nOutstanding--;
+  }
+  Issue();
+  m_cvDone.notify_one();
+}
+
+void Fetcher::Issue() {
+  for ( ;; ) {
+    ix_t ix;
+    fRequest_t* pfRequest;
+    {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      if ( ( m_vix.end() == m_iterNext ) || ( m_nMaxInFlight <= m_nOutstanding ) ) break;
+      ix = *m_iterNext;
+      ++m_iterNext;
+      m_nOutstanding++;
+      m_stats.nRequested++;
+      m_stats.nMaxInFlight = std::max( m_stats.nMaxInFlight, m_nOutstanding );
+      pTimer_t pTimer = std::make_unique<boost::asio::steady_timer>( m_context, m_msTimeout );
+      pTimer->async_wait(
+        [this,ix]( const boost::system::error_code& ec ){
+          HandleTimeout( ix, ec );
+        } );
+      m_mapInFlight.emplace( ix, std::move( pTimer ) ); // registered before the request, which may complete immediately
+      pfRequest = &m_fRequest;
+    }
+    (*pfRequest)( ix ); // outside the lock, the source may call Complete from within
+  }
+}
+
+void Fetcher::HandleTimeout( ix_t ix, const boost::system::error_code& ec ) {
+  if ( ec ) return; // cancelled by Claim
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    mapInFlight_t::iterator iter = m_mapInFlight.find( ix );
+    if ( m_mapInFlight.end() == iter ) return; // claimed as the timer expired
+    m_mapInFlight.erase( iter );
+    m_stats.vTimedOut.push_back( ix );
+  }
+  m_fCancel( ix );
+  Done( false );
+}
@@ -0,0 +1,110 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Fetcher.hpp
+ * Author:  raymond@burkholder.net
+ * Project: Dividend
+ * Created: October 20, 2026 03:30
+ */
+
+#pragma once
+
+// keeps up to nMaxInFlight requests outstanding, each with its own time limit:
+//   fRequest( ix ) starts a request, the source answers with Complete( ix, fFill ) from any thread
+//   a request not completed within the timeout is abandoned with fCancel( ix ), on the timer thread,
+//     a Complete arriving after that is ignored, fFill is not called
+// requests are issued in index order, the next as soon as one completes or times out
+
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <condition_variable>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/executor_work_guard.hpp>
+
+class Fetcher {
+public:
+
+  using ix_t = std::size_t;
+  using vix_t = std::vector<ix_t>;
+
+  using fRequest_t = std::function<void(ix_t)>;
+  using fCancel_t = std::function<void(ix_t)>;
+
+  struct Stats {
+    std::size_t nRequested;
+    std::size_t nCompleted;
+    std::size_t nTimedOut;
+    std::size_t nMaxInFlight; // reached
+    double dblSeconds;
+    vix_t vTimedOut;
+    Stats(): nRequested {}, nCompleted {}, nTimedOut {}, nMaxInFlight {}, dblSeconds {} {}
+  };
+
+  Fetcher( std::size_t nMaxInFlight, std::chrono::milliseconds msTimeout );
+  ~Fetcher();
+
+  // blocks until each of vix has completed or timed out
+  Stats Run( const vix_t& vix, fRequest_t&&, fCancel_t&& );
+
+  // true when fFill was called: the request was still outstanding
+  template<typename F>
+  bool Complete( ix_t ix, F&& fFill ) {
+    if ( Claim( ix ) ) {
+      fFill();
+      Done( true );
+      return true;
+    }
+    return false;
+  }
+
+protected:
+private:
+
+  using steady_t = std::chrono::steady_clock;
+  using pTimer_t = std::unique_ptr<boost::asio::steady_timer>;
+  using mapInFlight_t = std::map<ix_t, pTimer_t>;
+
+  const std::size_t m_nMaxInFlight;
+  const std::chrono::milliseconds m_msTimeout;
+
+  boost::asio::io_context m_context; // timers
+  boost::asio::executor_work_guard<boost::asio::io_context::executor_type> m_guard;
+  std::thread m_thread;
+
+  std::mutex m_mutex;
+  std::condition_variable m_cvDone;
+
+  fRequest_t m_fRequest;
+  fCancel_t m_fCancel;
+
+  vix_t m_vix;
+  vix_t::const_iterator m_iterNext;
+  mapInFlight_t m_mapInFlight;
+  std::size_t m_nOutstanding; // in flight, or claimed and filling
+
+  Stats m_stats;
+
+  bool Claim( ix_t );
+  void Done( bool bCompleted );
+  void Issue(); // requests up to the limit, called without the lock
+  void HandleTimeout( ix_t, const boost::system::error_code& );
+};
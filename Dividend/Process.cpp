@@ -23,8 +23,8 @@
 
 #include "Process.hpp"
 
-Process::Process( const config::Choices& choices, vSymbols_t& vSymbols )
-: m_choices( choices ), m_vSymbols( vSymbols ), m_bDone( false )
+Process::Process( const config::Choices& choices, Cache& cache, vSymbols_t& vSymbols )
+: m_choices( choices ), m_cache( cache ), m_vSymbols( vSymbols ), m_bSymbolList( false )
 {
 
   m_piqfeed = ou::tf::iqfeed::Provider::Factory();
@@ -72,85 +72,122 @@ void Process::HandleConnected( int ) {
     },
     [this](){
       std::cout << "symbol retrieval done" << std::endl;
-      m_iterSymbols = m_vSymbols.begin();
-      while ( ( m_choices.m_nMaxInTransit > m_mapInProgress.size() ) && ( m_vSymbols.end() != m_iterSymbols ) ) {
-        Lookup();
+      {
+        std::lock_guard<std::mutex> lock( m_mutexWait );
+        m_bSymbolList = true;
       }
+      m_cvWait.notify_one();
     }
   );
 
 }
 
-void Process::Lookup() {
+void Process::Wait() {
+
+  {
+    std::unique_lock<std::mutex> lock( m_mutexWait );
+    m_cvWait.wait( lock, [this]{ return m_bSymbolList; } );
+  }
+
+  Fetcher::vix_t vix;
+  for ( Fetcher::ix_t ix = 0; ix < m_vSymbols.size(); ix++ ) {
+    if ( !m_cache.Find( m_vSymbols[ ix ] ) ) vix.push_back( ix );
+  }
+
+  std::cout
+    << m_vSymbols.size() << " symbols, "
+    << ( m_vSymbols.size() - vix.size() ) << " from " << m_cache.FileName()
+    << ", " << vix.size() << " to request, " << m_choices.m_nMaxInTransit << " at a time"
+    << std::endl;
+
+  m_pFetcher = std::make_unique<Fetcher>( m_choices.m_nMaxInTransit, std::chrono::seconds( m_choices.m_nTimeout ) );
+  const Fetcher::Stats stats = m_pFetcher->Run(
+    vix,
+    [this]( Fetcher::ix_t ix ){ Lookup( ix ); },
+    [this]( Fetcher::ix_t ix ){ Cancel( ix ); }
+  );
+
+  std::cout
+    << "fundamentals: " << stats.nCompleted << " received, "
+    << stats.nTimedOut << " timed out after " << m_choices.m_nTimeout << "s, "
+    << "in " << stats.dblSeconds << "s"
+    << ", " << ( ( 0.0 < stats.dblSeconds ) ? ( stats.nCompleted / stats.dblSeconds ) : 0.0 ) << "/s"
+    << ", max in flight " << stats.nMaxInFlight
+    << std::endl;
+
+  if ( 0 == stats.nTimedOut ) {
+    m_cache.MarkComplete();
+  }
+  else {
+    std::cout << "timed out (re-run to retry): ";
+    for ( const Fetcher::ix_t ix: stats.vTimedOut ) {
+      std::cout << m_vSymbols[ ix ].sSymbol << ",";
+    }
+    std::cout << std::endl;
+  }
+}
+
+void Process::Lookup( Fetcher::ix_t ix ) {
 
   using pWatch_t = ou::tf::Watch::pWatch_t;
   using Summary = ou::tf::Watch::Summary;
   using Fundamentals = ou::tf::Watch::Fundamentals;
   using pInstrument_t = ou::tf::Instrument::pInstrument_t;
 
-  const std::string sSymbol( m_iterSymbols->sSymbol );
+  const std::string& sSymbol( m_vSymbols[ ix ].sSymbol );
   //std::cout << "lookup " << sSymbol << std::endl;
 
   pInstrument_t pInstrument = std::make_shared<ou::tf::Instrument>( sSymbol );
   pInstrument->SetAlternateName( ou::tf::Instrument::eidProvider_t::EProviderIQF, sSymbol );
   pWatch_t pWatch = std::make_shared<ou::tf::Watch>( pInstrument, m_piqfeed );
 
-  mapInProgress_t::iterator iterInProgress
-    = m_mapInProgress.insert(
-        m_mapInProgress.begin(),
-        mapInProgress_t::value_type( sSymbol, InProgress() ) );
-
-  iterInProgress->second.iterSymbols = m_iterSymbols;
-
-  iterInProgress->second.pAcquireFundamentals
+  pAcquireFundamentals_t pAcquireFundamentals
     = ou::tf::AcquireFundamentals::Factory (
       std::move( pWatch ),
-      [this,iterInProgress,iterSymbols=m_iterSymbols]( pWatch_t pWatch ){
-        dividend_t& dividend( *iterSymbols );
-        const Summary& summary( pWatch->GetSummary() );
-        dividend.trade = summary.dblTrade;
-        const Fundamentals& fundamentals( pWatch->GetFundamentals() );
-        dividend.sExchange = fundamentals.sExchange;
-        dividend.rate = fundamentals.dblDividendRate;
-        dividend.yield = fundamentals.dblDividendYield;
-        dividend.amount = fundamentals.dblDividendAmount;
-        dividend.nAverageVolume = fundamentals.nAverageVolume;
-        dividend.datePayed = fundamentals.datePayed;
-        dividend.dateExDividend = fundamentals.dateExDividend;
-        dividend.sOptionRoots = fundamentals.sOptionRoots;
-        //if ( 10.0 < fundamentals.dblDividendYield ) {
-        //  std::cout
-        //    << fundamentals.sExchange
-        //    << " " << fundamentals.sSymbolName
-        //    << " div.yield=" << fundamentals.dblDividendYield
-        //    << std::endl;
-        //}
-        m_pAcquireFundamentals_burial = std::move( iterInProgress->second.pAcquireFundamentals );
-        m_mapInProgress.erase( iterInProgress ); // needs to come before the lookup
-        if ( m_vSymbols.end() == m_iterSymbols ) {
-          if  ( 0 == m_mapInProgress.size() ) {
-            m_bDone = true;
-            m_cvWait.notify_one();
-          }
-          else {
-            std::cout << "waiting on: ";
-            for ( mapInProgress_t::value_type& vt: m_mapInProgress ) {
-              std::cout << vt.first << ",";
-            }
-            std::cout << std::endl;
-          }
-        }
-        else {
-          Lookup();
+      [this,ix]( pWatch_t pWatch ){
+        dividend_t& dividend( m_vSymbols[ ix ] );
+        m_pFetcher->Complete( // ignored once timed out, the next request may be issued from within
+          ix,
+          [this,&dividend,&pWatch](){
+            const Summary& summary( pWatch->GetSummary() );
+            dividend.trade = summary.dblTrade;
+            const Fundamentals& fundamentals( pWatch->GetFundamentals() );
+            dividend.sExchange = fundamentals.sExchange;
+            dividend.rate = fundamentals.dblDividendRate;
+            dividend.yield = fundamentals.dblDividendYield;
+            dividend.amount = fundamentals.dblDividendAmount;
+            dividend.nAverageVolume = fundamentals.nAverageVolume;
+            dividend.datePayed = fundamentals.datePayed;
+            dividend.dateExDividend = fundamentals.dateExDividend;
+            dividend.sOptionRoots = fundamentals.sOptionRoots;
+            m_cache.Append( dividend );
+          } );
+        std::lock_guard<std::mutex> lock( m_mutexInProgress );
+        mapInProgress_t::iterator iter = m_mapInProgress.find( ix );
+        if ( m_mapInProgress.end() != iter ) {
+          m_pAcquireFundamentals_burial = std::move( iter->second ); // this callback is running in it
+          m_mapInProgress.erase( iter );
         }
       }
       );
-  iterInProgress->second.pAcquireFundamentals->Start();
-  m_iterSymbols++;
-}
 
-void Process::Wait() {
-  std::unique_lock<std::mutex> lock( m_mutexWait );
-  m_cvWait.wait( lock, [this]{ return m_bDone; } );
+  {
+    std::lock_guard<std::mutex> lock( m_mutexInProgress );
+    m_mapInProgress.emplace( ix, pAcquireFundamentals );
+  }
+  pAcquireFundamentals->Start(); // outside the lock, the answer may arrive before Start returns
 }
 
+void Process::Cancel( Fetcher::ix_t ix ) {
+  pAcquireFundamentals_t pAcquireFundamentals;
+  {
+    std::lock_guard<std::mutex> lock( m_mutexInProgress );
+    mapInProgress_t::iterator iter = m_mapInProgress.find( ix );
+    if ( m_mapInProgress.end() == iter ) return;
+    pAcquireFundamentals = std::move( iter->second );
+    m_mapInProgress.erase( iter );
+  }
+  pAcquireFundamentals->Cancel();
+  std::lock_guard<std::mutex> lock( m_mutexInProgress );
+  m_vCancelled.emplace_back( std::move( pAcquireFundamentals ) );
+}
@@ -19,14 +19,21 @@
  * Created: April 1, 2022  21:48
  */
 
+#pragma once
+
 #include <map>
+#include <mutex>
 #include <vector>
 #include <memory>
 #include <thread>
+#include <condition_variable>
 
 #include <TFIQFeed/Provider.h>
 
+#include "Cache.hpp"
 #include "Config.hpp"
+#include "Fetcher.hpp"
+#include "Dividend.hpp"
 
 namespace ou {
 namespace tf {
@@ -37,59 +44,41 @@ namespace tf {
 class Process {
 public:
 
-  struct dividend_t {
-    const std::string sSymbol;
-    std::string sExchange;
-    double yield;
-    double rate;
-    double amount;
-    double trade; // last trade
-    int nAverageVolume;
-    boost::gregorian::date datePayed;
-    boost::gregorian::date dateExDividend;
-    std::string sOptionRoots;
-
-    dividend_t( const std::string& sSymbol_ )
-    : sSymbol( sSymbol_ ), yield {}, rate {}, trade {} {}
-  };
-  using vSymbols_t = std::vector<dividend_t>;
+  using dividend_t = ::dividend_t;
+  using vSymbols_t = ::vSymbols_t;
 
-  Process( const config::Choices& choices, vSymbols_t& );
+  Process( const config::Choices& choices, Cache&, vSymbols_t& );
 
-  void Wait();
+  void Wait(); // symbol list, then the fundamentals of symbols not in the cache
 
 protected:
 private:
 
   const config::Choices& m_choices;
+  Cache& m_cache;
 
   using pIQFeed_t = ou::tf::iqfeed::Provider::pProvider_t;
 
   pIQFeed_t m_piqfeed;
 
-  using vSymbols_iter = vSymbols_t::iterator;
   vSymbols_t& m_vSymbols;
-  vSymbols_iter m_iterSymbols;
 
-  using pAcquireFundamentals_t = std::shared_ptr<ou::tf::AcquireFundamentals>;
+  std::unique_ptr<Fetcher> m_pFetcher; // outlives Wait, for callbacks arriving late
 
-  struct InProgress {
-    vSymbols_iter iterSymbols;
-    pAcquireFundamentals_t pAcquireFundamentals;
-  };
+  using pAcquireFundamentals_t = std::shared_ptr<ou::tf::AcquireFundamentals>;
+  using mapInProgress_t = std::map<Fetcher::ix_t,pAcquireFundamentals_t>;
 
-  using mapInProgress_t = std::map<std::string,InProgress>;
+  std::mutex m_mutexInProgress; // completions arrive on the iqfeed thread, time outs on the fetcher's
   mapInProgress_t m_mapInProgress;
+  pAcquireFundamentals_t m_pAcquireFundamentals_burial; // completions arrive on a single thread
+  std::vector<pAcquireFundamentals_t> m_vCancelled; // a late callback may still be running, held to the end
 
-  // assumes single thread
-  pAcquireFundamentals_t m_pAcquireFundamentals_burial;
-
-  bool m_bDone;
+  bool m_bSymbolList;
   std::mutex m_mutexWait;
   std::condition_variable m_cvWait;
 
   void HandleConnected( int );
-  void Lookup();
+  void Lookup( Fetcher::ix_t );
+  void Cancel( Fetcher::ix_t );
 
 };
-
@@ -21,6 +21,9 @@
 
 #include <TFTrading/TradingEnumerations.h>
 
+#include <boost/date_time/gregorian/gregorian.hpp>
+
+#include "Cache.hpp"
 #include "Config.hpp"
 #include "Process.hpp"
 
@@ -40,8 +43,17 @@ int main( int argc, char* argv[] ) {
   using vSymbols_t = Process::vSymbols_t;
   vSymbols_t vSymbols;
 
-  Process process( choices, vSymbols );
-  process.Wait();
+  Cache cache( choices.m_sCacheDirectory, boost::gregorian::day_clock::local_day() );
+
+  std::unique_ptr<Process> pProcess;
+  if ( cache.Complete() ) {
+    cache.Load( vSymbols );
+    std::cout << vSymbols.size() << " symbols from " << cache.FileName() << std::endl;
+  }
+  else {
+    pProcess = std::make_unique<Process>( choices, cache, vSymbols );
+    pProcess->Wait();
+  }
 
   std::cout
     << "symbol,exchange,last($),yield(%),rate,amount,vol,exdiv,payed,option"
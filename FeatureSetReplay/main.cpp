@@ -0,0 +1,213 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    main.cpp
+ * Author:  raymond@burkholder.net
+ * Project: FeatureSetReplay
+ * Created: October 19, 2026 18:50
+ */
+
+// regenerates iqfeed::l2::FeatureSet rows from DepthsByOrder (and Trades, when present) saved by Collector,
+//   and records them with FeatureSet_Recorder, for building training sets without re-running a live session
+
+// FeatureSetReplay --path /app/collector/20261019-18:00:00.000000 --symbol @ESZ26 --output es.features.hdf5
+//   --triggers book,interval,trade --interval 100 (ms) --levels 10 --chunk 4096 --deflate 0
+//   --file tradeframe.hdf5 (default data file when not supplied)
+
+#include <chrono>
+#include <string>
+#include <iostream>
+#include <stdexcept>
+
+#include <boost/program_options.hpp>
+namespace po = boost::program_options;
+
+#include <TFTimeSeries/TimeSeries.h>
+
+#include <TFHDF5TimeSeries/HDF5DataManager.h>
+#include <TFHDF5TimeSeries/HDF5TimeSeriesContainer.h>
+
+#include <TFIQFeed/Level2/FeatureSet_Feed.hpp>
+#include <TFIQFeed/Level2/FeatureSet_Recorder.hpp>
+
+namespace {
+
+  using Recorder = ou::tf::iqfeed::l2::FeatureSet_Recorder;
+
+  template<typename TS>
+  bool Load( ou::tf::HDF5DataManager& dm, const std::string& sPath, TS& series ) {
+    using datum_t = typename TS::datum_t;
+    try {
+      ou::tf::HDF5TimeSeriesContainer<datum_t> repository( dm, sPath );
+      typename ou::tf::HDF5TimeSeriesContainer<datum_t>::iterator begin, end;
+      begin = repository.begin();
+      end = repository.end();
+      series.Resize( end - begin );
+      repository.Read( begin, end, &series );
+      return true;
+    }
+    catch ( const std::runtime_error& e ) {
+      return false;
+    }
+  }
+
+  uint8_t Triggers( const std::string& sTriggers ) {
+    uint8_t triggers {};
+    std::string::size_type ix = 0;
+    while ( ix <= sTriggers.size() ) {
+      std::string::size_type ixComma = sTriggers.find( ',', ix );
+      if ( std::string::npos == ixComma ) ixComma = sTriggers.size();
+      const std::string sTrigger( sTriggers.substr( ix, ixComma - ix ) );
+      if ( "book" == sTrigger ) triggers |= Recorder::TriggerBookChange;
+      else if ( "interval" == sTrigger ) triggers |= Recorder::TriggerInterval;
+      else if ( "trade" == sTrigger ) triggers |= Recorder::TriggerTrade;
+      else throw std::runtime_error( "unknown trigger '" + sTrigger + "', use book, interval, trade" );
+      ix = ixComma + 1;
+    }
+    return triggers;
+  }
+
+} // namespace anonymous
+
+int main( int argc, char* argv[] ) {
+
+  std::string sFile;
+  std::string sPath;
+  std::string sSymbol;
+  std::string sOutput;
+  std::string sGroup;
+  std::string sTriggers;
+  unsigned int nLevels;
+  unsigned int nIntervalMs;
+  size_t nChunk;
+  unsigned int nDeflate;
+
+  po::options_description options( "FeatureSetReplay" );
+  options.add_options()
+    ( "help", "this text" )
+    ( "file", po::value<std::string>( &sFile ), "hdf5 data file, default data file when not supplied" )
+    ( "path", po::value<std::string>( &sPath )->required(), "series root, eg /app/collector/<timestamp>" )
+    ( "symbol", po::value<std::string>( &sSymbol )->required(), "instrument name" )
+    ( "output", po::value<std::string>( &sOutput )->required(), "hdf5 file for the feature rows" )
+    ( "group", po::value<std::string>( &sGroup ), "group in output, default /featureset/<symbol><path leaf>" )
+    ( "triggers", po::value<std::string>( &sTriggers )->default_value( "book" ), "book,interval,trade" )
+    ( "interval", po::value<unsigned int>( &nIntervalMs )->default_value( 100 ), "interval trigger, ms" )
+    ( "levels", po::value<unsigned int>( &nLevels )->default_value( 10 ), "book levels in the feature set, 3 - 10" )
+    ( "chunk", po::value<size_t>( &nChunk )->default_value( 4096 ), "rows per hdf5 chunk" )
+    ( "deflate", po::value<unsigned int>( &nDeflate )->default_value( 0 ), "gzip level, 0 for none" )
+    ;
+
+  try {
+    po::variables_map vm;
+    po::store( po::parse_command_line( argc, argv, options ), vm );
+    if ( 0 < vm.count( "help" ) ) {
+      std::cout << options << std::endl;
+      return EXIT_SUCCESS;
+    }
+    po::notify( vm );
+  }
+  catch ( const std::exception& e ) {
+    std::cout << e.what() << std::endl << options << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if ( ( 3 > nLevels ) || ( 10 < nLevels ) ) {
+    std::cout << "levels needs to be 3 - 10" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if ( sGroup.empty() ) {
+    sGroup = "/featureset/" + sSymbol + sPath.substr( sPath.rfind( '/' ) );
+  }
+
+  ou::tf::DepthsByOrder depths;
+  ou::tf::Trades trades;
+
+  {
+    std::unique_ptr<ou::tf::HDF5DataManager> pdm;
+    if ( sFile.empty() ) pdm = std::make_unique<ou::tf::HDF5DataManager>( ou::tf::HDF5DataManager::RO );
+    else pdm = std::make_unique<ou::tf::HDF5DataManager>( ou::tf::HDF5DataManager::RO, sFile );
+
+    if ( !Load( *pdm, sPath + ou::tf::DepthsByOrder::Directory() + sSymbol, depths ) ) {
+      std::cout << "no depths found at " << sPath + ou::tf::DepthsByOrder::Directory() + sSymbol << std::endl;
+      return EXIT_FAILURE;
+    }
+    if ( !Load( *pdm, sPath + ou::tf::Trades::Directory() + sSymbol, trades ) ) {
+      std::cout << "no trades found, market orders are counted as cancels" << std::endl;
+    }
+  }
+
+  std::cout
+    << "depths=" << depths.Size()
+    << ",trades=" << trades.Size()
+    << std::endl;
+
+  try {
+
+    ou::tf::iqfeed::l2::FeatureSet_Feed feed;
+    feed.Set( nLevels );
+
+    Recorder recorder(
+      feed.Features(), sOutput, sGroup,
+      Triggers( sTriggers ), boost::posix_time::milliseconds( nIntervalMs ),
+      nChunk, nDeflate );
+
+    feed.Set( [&recorder]( const ou::tf::DepthByOrder& depth ){
+      recorder.BookChange( depth.DateTime() );
+    } );
+
+    const auto tpBegin = std::chrono::steady_clock::now();
+
+    // merge by time, a trade goes ahead of depth with the same time stamp,
+    //   as the trade is what removes the volume at level 1
+    ou::tf::DepthsByOrder::const_iterator iterDepth = depths.begin();
+    ou::tf::Trades::const_iterator iterTrade = trades.begin();
+    while ( ( depths.end() != iterDepth ) || ( trades.end() != iterTrade ) ) {
+      const bool bTrade
+        = ( trades.end() != iterTrade )
+        && ( ( depths.end() == iterDepth ) || ( iterTrade->DateTime() <= iterDepth->DateTime() ) );
+      if ( bTrade ) {
+        recorder.Time( iterTrade->DateTime() );
+        feed.Trade( *iterTrade );
+        recorder.Trade( iterTrade->DateTime() );
+        ++iterTrade;
+      }
+      else {
+        recorder.Time( iterDepth->DateTime() );
+        feed.MarketDepth( *iterDepth );
+        ++iterDepth;
+      }
+    }
+
+    recorder.Flush();
+
+    const std::chrono::duration<double> seconds( std::chrono::steady_clock::now() - tpBegin );
+    const size_t nMessages( depths.Size() + trades.Size() );
+
+    std::cout
+      << sOutput << ":" << sGroup
+      << " rows=" << recorder.Rows()
+      << ",columns=" << feed.Features().Columns() + 2
+      << ",seconds=" << seconds.count()
+      << ",messages/sec=" << ( ( 0.0 < seconds.count() ) ? ( nMessages / seconds.count() ) : 0.0 )
+      << std::endl;
+  }
+  catch ( const std::exception& e ) {
+    std::cout << "replay failed: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -18,7 +18,6 @@
 #include <TFIQFeed/LoadMktSymbols.h>
 
 #include <TFHDF5TimeSeries/HDF5DataManager.h>
-#include <TFHDF5TimeSeries/HDF5WriteTimeSeries.h>
 
 #include "Process.h"
 
@@ -40,6 +39,12 @@ Process::Process(
   //m_cntBars( 25 )
 //  m_cntBars( 0 ) // 2013/09/17
 {
+  ou::tf::HDF5WriteQueue::Options options;
+  options.nDeflate = 0; // uncompressed, as the series were written before the queue
+  options.nChunkMin = 64; // a daily bar series is typically several hundred to several thousand bars
+  options.nChunkMax = 1024;
+  m_pWriteQueue = std::make_unique<ou::tf::HDF5WriteQueue>( options );
+
   m_vExchanges.insert( "NYSE" );
   m_vExchanges.insert( "NYSE_AMERICAN" );
   m_vExchanges.insert( "NYSE,NYSE_ARCA" );
@@ -97,6 +102,7 @@ void Process::Start() {
   SetSymbols( setSelected.begin(), setSelected.end() );
   DailyBars( m_nDatums );
   Block();
+  m_pWriteQueue->Drain();
 
   std::cout << "Process complete." << std::endl;
 
@@ -106,13 +112,10 @@ void Process::OnBars( inherited_t::structResultBar* bars ) {
 
   // warning:  this section is re-entrant from multiple threads
 
-  // save the data
-
-  boost::mutex::scoped_lock lock( m_mutexProcessResults );
-
   assert( bars->sSymbol.length() > 0 );
 
-  std::cout << bars->sSymbol << ": " << bars->bars.Size();
+  const std::string sLine( bars->sSymbol + ": " + std::to_string( bars->bars.Size() ) + ".\n" );
+  std::cout << sLine;
 
   if ( 0 != bars->bars.Size() ) {
 
@@ -120,35 +123,23 @@ void Process::OnBars( inherited_t::structResultBar* bars ) {
 
     ou::tf::HDF5DataManager::DailyBarPath( bars->sSymbol, sPath );  // build hierarchical path based upon symbol name
 
-    ou::tf::HDF5DataManager dm( ou::tf::HDF5DataManager::RDWR );
-    ou::tf::HDF5WriteTimeSeries<ou::tf::Bars> wts( dm, false, true, 0, 64 );
-    wts.Write( sPath, &bars->bars );
+    m_pWriteQueue->Write( sPath, bars->bars ); // takes the bars, waits only when the queue is full
   }
 
   ReQueueBars( bars );
 
-  std::cout << "." << std::endl;
-
 }
 
 void Process::OnTicks( inherited_t::structResultTicks* ticks ) {
 
-  boost::mutex::scoped_lock lock( m_mutexProcessResults );
-
   assert( ticks->sSymbol.length() > 0 );
 
-  ou::tf::HDF5DataManager dm( ou::tf::HDF5DataManager::RDWR );
-
   if ( 0 != ticks->trades.Size() ) {
-    std::string sPath( "/optionables/trade/" + ticks->sSymbol );
-    ou::tf::HDF5WriteTimeSeries<ou::tf::Trades> wtst( dm );
-    wtst.Write( sPath, &ticks->trades );
+    m_pWriteQueue->Write( "/optionables/trade/" + ticks->sSymbol, ticks->trades );
   }
 
   if ( 0 != ticks->quotes.Size() ) {
-    std::string sPath( "/optionables/quote/" + ticks->sSymbol );
-    ou::tf::HDF5WriteTimeSeries<ou::tf::Quotes> wtsq( dm );
-    wtsq.Write( sPath, &ticks->quotes );
+    m_pWriteQueue->Write( "/optionables/quote/" + ticks->sSymbol, ticks->quotes );
   }
 
   ReQueueTicks( ticks );
@@ -22,10 +22,10 @@
 */
 
 #include <set>
+#include <memory>
 #include <string>
 
-#include <boost/thread/mutex.hpp>
-#include <boost/thread/locks.hpp>
+#include <TFHDF5TimeSeries/HDF5WriteQueue.h>
 
 #include <TFIQFeed/HistoryBulkQuery.h>
 #include <TFIQFeed/InMemoryMktSymbolList.h>
@@ -69,7 +69,8 @@ private:
 
   ou::tf::iqfeed::InMemoryMktSymbolList& m_list;
 
-  boost::mutex m_mutexProcessResults;
+  // OnBars/OnTicks arrive on the query threads, the writes are serialized on this one thread
+  std::unique_ptr<ou::tf::HDF5WriteQueue> m_pWriteQueue;
 
   std::string m_sPrefixPath;
   const size_t m_nDatums;
@@ -0,0 +1,305 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Bench.cpp
+ * Author:  raymond@burkholder.net
+ * Project: IQFeedReplay
+ * Created: October 19, 2026 19:05
+ */
+
+#include <set>
+#include <atomic>
+#include <thread>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+
+#include <boost/asio/executor_work_guard.hpp>
+
+#include <OUCommon/LatencyTrace.h>
+
+#include <TFTrading/Watch.h>
+#include <TFTrading/Instrument.h>
+
+#include <TFIQFeed/Provider.h>
+
+#include "Bench.hpp"
+
+namespace replay {
+
+namespace {
+
+using steady_t = std::chrono::steady_clock;
+using vNanos_t = std::vector<std::int64_t>;
+
+std::int64_t Nanos( steady_t::duration duration ) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>( duration ).count();
+}
+
+void Emit( const std::string& sStage, vNanos_t& vNanos ) {
+  std::cout << "iqfeed_replay stage=" << sStage << " n=" << vNanos.size();
+  if ( !vNanos.empty() ) {
+    std::sort( vNanos.begin(), vNanos.end() );
+    auto at = [&vNanos]( double q ){ return vNanos[ std::min( vNanos.size() - 1, (std::size_t)( q * vNanos.size() ) ) ]; };
+    std::cout
+      << " p50=" << at( 0.50 ) << "ns"
+      << " p90=" << at( 0.90 ) << "ns"
+      << " p99=" << at( 0.99 ) << "ns"
+      << " p99.9=" << at( 0.999 ) << "ns"
+      << " max=" << vNanos.back() << "ns";
+  }
+  std::cout << std::endl;
+}
+
+// handlers run on the client's network thread
+class Recorder {
+public:
+
+  using pWatch_t = ou::tf::Watch::pWatch_t;
+  using pSummary_t = ou::tf::iqfeed::IQFeedSymbol::pSummary_t;
+
+  Recorder( pWatch_t pWatch, std::atomic<std::size_t>& nUpdates )
+  : m_pWatch( pWatch ), m_nUpdates( nUpdates ), m_bFromUpdate( false )
+  {
+    m_pWatch->OnQuote.Add( MakeDelegate( this, &Recorder::HandleQuote ) );
+    m_pWatch->OnTrade.Add( MakeDelegate( this, &Recorder::HandleTrade ) );
+  }
+
+  ~Recorder() {
+    m_pWatch->OnQuote.Remove( MakeDelegate( this, &Recorder::HandleQuote ) );
+    m_pWatch->OnTrade.Remove( MakeDelegate( this, &Recorder::HandleTrade ) );
+  }
+
+  void Attach( ou::tf::iqfeed::IQFeedSymbol& symbol ) {
+    symbol.OnUpdateMessage.Add( MakeDelegate( this, &Recorder::HandleUpdate ) );
+    symbol.OnSummaryMessage.Add( MakeDelegate( this, &Recorder::HandleSummary ) );
+  }
+
+  void Detach( ou::tf::iqfeed::IQFeedSymbol& symbol ) {
+    symbol.OnUpdateMessage.Remove( MakeDelegate( this, &Recorder::HandleUpdate ) );
+    symbol.OnSummaryMessage.Remove( MakeDelegate( this, &Recorder::HandleSummary ) );
+  }
+
+  pWatch_t Watch() { return m_pWatch; }
+
+  const std::vector<steady_t::time_point>& Updates() const { return m_vUpdate; }
+  vNanos_t& Dispatch() { return m_vDispatch; }
+
+private:
+
+  pWatch_t m_pWatch;
+  std::atomic<std::size_t>& m_nUpdates;
+
+  bool m_bFromUpdate; // quotes and trades emitted by a summary are not timed
+  steady_t::time_point m_tpUpdate;
+
+  std::vector<steady_t::time_point> m_vUpdate;
+  vNanos_t m_vDispatch;
+
+  void HandleUpdate( pSummary_t ) {
+    m_tpUpdate = steady_t::now();
+    m_vUpdate.push_back( m_tpUpdate );
+    m_bFromUpdate = true;
+    m_nUpdates++;
+  }
+
+  void HandleSummary( pSummary_t ) {
+    m_bFromUpdate = false;
+  }
+
+  void HandleQuote( const ou::tf::Quote& ) {
+    if ( m_bFromUpdate ) m_vDispatch.push_back( Nanos( steady_t::now() - m_tpUpdate ) );
+  }
+
+  void HandleTrade( const ou::tf::Trade& ) {
+    if ( m_bFromUpdate ) m_vDispatch.push_back( Nanos( steady_t::now() - m_tpUpdate ) );
+  }
+
+};
+
+class Connection {
+public:
+  Connection( ou::tf::iqfeed::Provider& provider ): m_provider( provider ), m_bConnected( false ) {
+    m_provider.OnConnected.Add( MakeDelegate( this, &Connection::HandleConnected ) );
+    m_provider.OnDisconnected.Add( MakeDelegate( this, &Connection::HandleDisconnected ) );
+  }
+  ~Connection() {
+    m_provider.OnConnected.Remove( MakeDelegate( this, &Connection::HandleConnected ) );
+    m_provider.OnDisconnected.Remove( MakeDelegate( this, &Connection::HandleDisconnected ) );
+  }
+  bool Wait( bool bState, std::chrono::seconds timeout ) {
+    const steady_t::time_point tpLimit( steady_t::now() + timeout );
+    while ( ( bState != m_bConnected ) && ( steady_t::now() < tpLimit ) ) {
+      std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+    }
+    return bState == m_bConnected;
+  }
+private:
+  ou::tf::iqfeed::Provider& m_provider;
+  std::atomic<bool> m_bConnected;
+  void HandleConnected( int ) { m_bConnected = true; }
+  void HandleDisconnected( int ) { m_bConnected = false; }
+};
+
+} // namespace anonymous
+
+int Bench( const Capture& capture, const Server::Options& options, const std::vector<std::string>& vSymbol_ ) {
+
+  const Capture::vLine_t& vLine( capture.Lines( Capture::c_portLevel1 ) );
+  if ( vLine.empty() ) {
+    std::cout << "capture has no level 1 (5009) data" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::vector<std::string> vSymbol( vSymbol_ );
+  if ( vSymbol.empty() ) {
+    std::set<Capture::idKey_t> setKey;
+    for ( const Capture::Line& line: vLine ) {
+      if ( ( Capture::c_idNone != line.idKey ) && ( 'Q' == capture.Text( line )[ 0 ] ) ) setKey.insert( line.idKey );
+    }
+    for ( const Capture::idKey_t idKey: setKey ) vSymbol.push_back( capture.KeyName( idKey ) );
+  }
+
+  // server side, written on the server thread, read once the replay is done
+  std::vector<steady_t::time_point> vDue( vLine.size() );
+  std::vector<steady_t::time_point> vSent( vLine.size() );
+  std::atomic<bool> bReplayDone( false );
+
+  boost::asio::io_context context;
+  auto work = boost::asio::make_work_guard( context );
+
+  Server server( context, capture, options );
+  server.Set( [&vDue,&vSent]( Capture::port_t port, std::size_t ixLine, steady_t::time_point tpDue, steady_t::time_point tpSent ){
+    if ( Capture::c_portLevel1 == port ) {
+      vDue[ ixLine ] = tpDue;
+      vSent[ ixLine ] = tpSent;
+    }
+  } );
+  server.Set( [&bReplayDone]( Capture::port_t port, std::size_t ){
+    if ( Capture::c_portLevel1 == port ) bReplayDone = true;
+  } );
+
+  std::thread threadServer( [&context](){ context.run(); } );
+
+  // client side, the real stack
+  std::atomic<std::size_t> nUpdates {};
+  std::vector<std::unique_ptr<Recorder> > vRecorder;
+
+  ou::tf::iqfeed::Provider::pProvider_t pProvider = ou::tf::iqfeed::Provider::Factory();
+  Connection connection( *pProvider );
+
+  int result( EXIT_SUCCESS );
+
+  pProvider->Connect();
+  if ( !connection.Wait( true, std::chrono::seconds( 30 ) ) ) {
+    std::cout << "provider did not connect, is the lookup (9100) session in the capture?" << std::endl;
+    result = EXIT_FAILURE;
+  }
+  else {
+
+    for ( const std::string& sSymbol: vSymbol ) {
+      ou::tf::Instrument::pInstrument_t pInstrument
+        = std::make_shared<ou::tf::Instrument>( sSymbol, ou::tf::InstrumentType::Stock, "SMART" );
+      ou::tf::Watch::pWatch_t pWatch = std::make_shared<ou::tf::Watch>( pInstrument, pProvider );
+      vRecorder.emplace_back( std::make_unique<Recorder>( pWatch, nUpdates ) );
+      pWatch->StartWatch();
+      vRecorder.back()->Attach( *pProvider->GetSymbol( sSymbol ) ); // before the replay starts, watches settle first
+    }
+
+    // wait for the replay, then for the client to drain
+    while ( !bReplayDone ) std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+    std::size_t nLast {};
+    do {
+      nLast = nUpdates;
+      std::this_thread::sleep_for( std::chrono::milliseconds( 200 ) );
+    } while ( nLast != nUpdates );
+
+    for ( std::unique_ptr<Recorder>& pRecorder: vRecorder ) {
+      pRecorder->Watch()->StopWatch();
+      pRecorder->Detach( *pProvider->GetSymbol( pRecorder->Watch()->GetInstrumentName() ) );
+    }
+  }
+
+  pProvider->Disconnect();
+  connection.Wait( false, std::chrono::seconds( 5 ) );
+
+  work.reset();
+  context.stop();
+  threadServer.join();
+
+  if ( EXIT_SUCCESS != result ) return result;
+
+  // match the k'th replayed Q line of a symbol with the k'th update of that symbol
+
+  vNanos_t vPace;
+  vNanos_t vWire;
+  vNanos_t vDispatch;
+  std::size_t nSent {};
+  std::size_t nMatched {};
+  steady_t::time_point tpFirst( steady_t::time_point::max() );
+  steady_t::time_point tpLast( steady_t::time_point::min() );
+
+  std::vector<std::vector<std::size_t> > vQ( capture.Keys() );
+  for ( std::size_t ix = 0; ix < vLine.size(); ix++ ) {
+    const Capture::Line& line( vLine[ ix ] );
+    if ( ( steady_t::time_point() != vSent[ ix ] ) && ( Capture::c_idNone != line.idKey ) && ( 'Q' == capture.Text( line )[ 0 ] ) ) {
+      vQ[ line.idKey ].push_back( ix );
+      nSent++;
+      if ( 0.0 < options.dblSpeed ) vPace.push_back( Nanos( vSent[ ix ] - vDue[ ix ] ) );
+      tpFirst = std::min( tpFirst, vSent[ ix ] );
+    }
+  }
+
+  for ( std::unique_ptr<Recorder>& pRecorder: vRecorder ) {
+    const Capture::idKey_t idKey = capture.Key( pRecorder->Watch()->GetInstrumentName() );
+    if ( Capture::c_idNone == idKey ) continue;
+    const std::vector<std::size_t>& vIx( vQ[ idKey ] );
+    const std::vector<steady_t::time_point>& vUpdate( pRecorder->Updates() );
+    const std::size_t n = std::min( vIx.size(), vUpdate.size() );
+    for ( std::size_t k = 0; k < n; k++ ) {
+      vWire.push_back( Nanos( vUpdate[ k ] - vSent[ vIx[ k ] ] ) );
+    }
+    if ( 0 < n ) tpLast = std::max( tpLast, vUpdate[ n - 1 ] );
+    nMatched += n;
+    vDispatch.insert( vDispatch.end(), pRecorder->Dispatch().begin(), pRecorder->Dispatch().end() );
+  }
+
+  const double dblSeconds = ( 0 < nMatched ) ? std::chrono::duration<double>( tpLast - tpFirst ).count() : 0.0;
+  const std::string sSpeed( ( 0.0 < options.dblSpeed ) ? std::to_string( options.dblSpeed ) : std::string( "max" ) );
+
+  // same layout as the Benchmark results
+  std::cout
+    << "iqfeed_replay e2e speed=" << sSpeed << ",symbols=" << vSymbol.size()
+    << ": " << nMatched << " items"
+    << " in " << dblSeconds << " s"
+    << ", " << (std::size_t)( ( 0.0 < dblSeconds ) ? ( nMatched / dblSeconds ) : 0.0 ) << "/s"
+    << ", " << ( ( 0 < nMatched ) ? ( 1e9 * dblSeconds / nMatched ) : 0.0 ) << " ns/item"
+    << std::endl;
+  if ( nMatched != nSent ) {
+    std::cout << "iqfeed_replay " << nSent << " Q lines sent, " << nMatched << " updates matched" << std::endl;
+  }
+
+  if ( !vPace.empty() ) Emit( "pace", vPace );
+  Emit( "wire", vWire );
+  Emit( "dispatch", vDispatch );
+
+#if defined( TF_LATENCY_TRACE )
+  ou::latency::Dump( std::cout, ou::latency::EFormat::Text ); // the client hops within wire and dispatch
+#endif
+
+  return EXIT_SUCCESS;
+}
+
+} // namespace replay
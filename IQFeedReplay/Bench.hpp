@@ -0,0 +1,41 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Bench.hpp
+ * Author:  raymond@burkholder.net
+ * Project: IQFeedReplay
+ * Created: October 19, 2026 19:05
+ */
+
+#pragma once
+
+// end to end: the replay server and the real client stack in one process,
+//   Network<> -> IQFeed<T> -> iqfeed::Provider -> IQFeedSymbol -> Watch
+// a captured Q line is matched to its IQFeedSymbol::OnUpdateMessage by per symbol order
+// stages:
+//   pace:     replay schedule to socket hand off (server lag, 0 at max speed)
+//   wire:     socket hand off to IQFeedSymbol::OnUpdateMessage (kernel, framing, tokenising, decode)
+//   dispatch: OnUpdateMessage to Watch::OnQuote / Watch::OnTrade
+
+#include <string>
+#include <vector>
+
+#include "Server.hpp"
+
+namespace replay {
+
+int Bench( const Capture&, const Server::Options&, const std::vector<std::string>& vSymbol ); // empty: all captured level 1 symbols
+
+} // namespace replay
@@ -0,0 +1,125 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Capture.cpp
+ * Author:  raymond@burkholder.net
+ * Project: IQFeedReplay
+ * Created: October 19, 2026 18:30
+ */
+
+#include <iostream>
+#include <stdexcept>
+
+#include <OUCommon/NetworkCapture.h>
+
+#include "Capture.hpp"
+
+namespace replay {
+
+Capture::Capture( const std::string& sFileName )
+: m_nsFirst {}, m_nsLast {}
+{
+  ou::NetworkCapture::Reader reader( sFileName );
+
+  using mapPartial_t = std::map<ou::NetworkCapture::stream_t, std::string>; // per stream, text following the last line feed
+  mapPartial_t mapPartial;
+
+  ou::NetworkCapture::Record record;
+  std::vector<char> vData;
+  std::size_t nRecords {};
+
+  while ( reader.Next( record, vData ) ) {
+    nRecords++;
+    if ( 0 == m_nsFirst ) m_nsFirst = record.nsReceived;
+    m_nsLast = record.nsReceived;
+
+    std::string& sPartial( mapPartial[ record.nStream ] );
+    vLine_t& vLine( m_mapLines[ record.nPort ] );
+
+    for ( const char ch: vData ) {
+      if ( 0x0a == ch ) {
+        if ( !sPartial.empty() ) {
+          const idKey_t idKey = KeyFor( record.nPort, sPartial );
+          vLine.emplace_back( Line { record.nsReceived, m_sText.size(), (std::uint32_t)sPartial.size(), record.nStream, idKey } );
+          m_sText += sPartial;
+          sPartial.clear();
+        }
+      }
+      else {
+        if ( 0x0d != ch ) sPartial.push_back( ch );
+      }
+    }
+  }
+
+  std::cout << sFileName << ": " << nRecords << " records";
+  for ( const mapLines_t::value_type& vt: m_mapLines ) {
+    std::cout << ", port " << vt.first << "=" << vt.second.size() << " lines";
+  }
+  std::cout << ", " << m_vKeyName.size() << " keys" << std::endl;
+}
+
+const Capture::vLine_t& Capture::Lines( port_t port ) const {
+  static const vLine_t vEmpty;
+  mapLines_t::const_iterator iter = m_mapLines.find( port );
+  return ( m_mapLines.end() == iter ) ? vEmpty : iter->second;
+}
+
+std::string_view Capture::Field( std::string_view sv, std::size_t ix ) {
+  std::size_t begin {};
+  while ( 1 < ix ) {
+    const std::size_t comma = sv.find( ',', begin );
+    if ( std::string_view::npos == comma ) return std::string_view();
+    begin = comma + 1;
+    ix--;
+  }
+  const std::size_t end = sv.find( ',', begin );
+  return sv.substr( begin, ( std::string_view::npos == end ) ? std::string_view::npos : end - begin );
+}
+
+Capture::idKey_t Capture::Key( std::string_view sv ) const {
+  mapKey_t::const_iterator iter = m_mapKey.find( std::string( sv ) );
+  return ( m_mapKey.end() == iter ) ? c_idNone : iter->second;
+}
+
+Capture::idKey_t Capture::Intern( std::string_view sv ) {
+  if ( sv.empty() ) return c_idNone;
+  std::pair<mapKey_t::iterator, bool> pair = m_mapKey.emplace( std::string( sv ), (idKey_t)m_vKeyName.size() );
+  if ( pair.second ) {
+    m_vKeyName.emplace_back( sv );
+  }
+  return pair.first->second;
+}
+
+Capture::idKey_t Capture::KeyFor( port_t port, std::string_view sv ) {
+  switch ( port ) {
+    case c_portLookup:
+      if ( ( 0 == sv.find( "S," ) ) || ( 0 == sv.find( "E," ) ) ) return c_idNone;
+      return Intern( Field( sv, 1 ) );
+    default:
+      switch ( sv[ 0 ] ) {
+        case 'S':
+          // S,CLEAR DEPTH,@ESZ22,B,
+          return ( 0 == sv.find( "S,CLEAR DEPTH," ) ) ? Intern( Field( sv, 3 ) ) : c_idNone;
+        case 'T': // time
+        case 'N': // news
+        case 'E': // error
+          return c_idNone;
+        default: // Q, P, F, n, q, level 2 digits
+          return Intern( Field( sv, 2 ) );
+      }
+  }
+}
+
+} // namespace replay
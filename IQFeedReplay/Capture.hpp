@@ -0,0 +1,94 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Capture.hpp
+ * Author:  raymond@burkholder.net
+ * Project: IQFeedReplay
+ * Created: October 19, 2026 18:30
+ */
+
+#pragma once
+
+// a file from ou::NetworkCapture, re-framed into lines per port, held in memory for replay
+//   each line carries a key:
+//     5009, 9200: the symbol, none for time and system messages (except S,CLEAR DEPTH)
+//     9100: the request id which prefixes each response line
+
+#include <map>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+
+namespace replay {
+
+class Capture {
+public:
+
+  using ns_t = std::uint64_t;
+  using port_t = std::uint16_t;
+  using idKey_t = std::uint32_t;
+
+  static constexpr idKey_t c_idNone = ~idKey_t( 0 );
+
+  static constexpr port_t c_portLevel1 = 5009;
+  static constexpr port_t c_portLookup = 9100;
+  static constexpr port_t c_portLevel2 = 9200;
+
+  struct Line {
+    ns_t nsReceived;
+    std::size_t offset;   // into the text buffer
+    std::uint32_t length; // without cr/lf
+    std::uint32_t nStream; // ou::NetworkCapture::stream_t
+    idKey_t idKey;
+  };
+
+  using vLine_t = std::vector<Line>; // in order of receipt
+
+  Capture( const std::string& sFileName ); // throws std::runtime_error
+
+  const vLine_t& Lines( port_t ) const; // empty if the port was not captured
+  std::string_view Text( const Line& line ) const { return std::string_view( m_sText.data() + line.offset, line.length ); }
+
+  idKey_t Key( std::string_view ) const; // c_idNone if not in the capture
+  const std::string& KeyName( idKey_t id ) const { return m_vKeyName[ id ]; }
+  std::size_t Keys() const { return m_vKeyName.size(); }
+
+  ns_t First() const { return m_nsFirst; }
+  ns_t Last() const { return m_nsLast; }
+
+  static std::string_view Field( std::string_view, std::size_t ix ); // ix is 1 based, as in IQFeed message Field()
+
+protected:
+private:
+
+  using mapLines_t = std::map<port_t, vLine_t>;
+  using mapKey_t = std::unordered_map<std::string, idKey_t>;
+
+  std::string m_sText;
+  mapLines_t m_mapLines;
+
+  mapKey_t m_mapKey;
+  std::vector<std::string> m_vKeyName;
+
+  ns_t m_nsFirst;
+  ns_t m_nsLast;
+
+  idKey_t Intern( std::string_view );
+  idKey_t KeyFor( port_t, std::string_view );
+};
+
+} // namespace replay
@@ -0,0 +1,533 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Server.cpp
+ * Author:  raymond@burkholder.net
+ * Project: IQFeedReplay
+ * Created: October 19, 2026 18:30
+ */
+
+#include <map>
+#include <string>
+#include <istream>
+#include <iostream>
+#include <unordered_set>
+
+#include <boost/asio/write.hpp>
+#include <boost/asio/streambuf.hpp>
+#include <boost/asio/read_until.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+#include "Server.hpp"
+
+namespace replay {
+
+namespace {
+  const std::size_t c_nWriteChunk = 64 * 1024; // replayed bytes per socket write
+  const std::size_t npos = ~std::size_t( 0 );
+}
+
+// ==== Session: line oriented connection with a single write in flight
+
+class Session: public std::enable_shared_from_this<Session> {
+public:
+
+  Session( Server& server, boost::asio::ip::tcp::socket&& socket, Capture::port_t port )
+  : m_server( server ), m_capture( server.m_capture )
+  , m_socket( std::move( socket ) ), m_port( port )
+  , m_bClosed( false ), m_bWriting( false )
+  {
+    m_socket.set_option( boost::asio::ip::tcp::no_delay( true ) );
+  }
+
+  virtual ~Session() {}
+
+  void Start() {
+    std::cout << "port " << m_port << ": connected" << std::endl;
+    OnConnect();
+    Read();
+  }
+
+protected:
+
+  Server& m_server;
+  const Capture& m_capture;
+  boost::asio::ip::tcp::socket m_socket;
+  const Capture::port_t m_port;
+  bool m_bClosed;
+
+  void Queue( std::string_view sv ) {
+    m_sPending.append( sv.data(), sv.size() );
+    m_sPending.append( "\r\n" );
+  }
+
+  void Flush() {
+    if ( !m_bWriting && !m_sPending.empty() && !m_bClosed ) {
+      m_bWriting = true;
+      m_sWriting.swap( m_sPending );
+      boost::asio::async_write(
+        m_socket, boost::asio::buffer( m_sWriting ),
+        [this,self=shared_from_this()]( const boost::system::error_code& ec, std::size_t ){
+          m_bWriting = false;
+          m_sWriting.clear();
+          if ( ec ) {
+            Close( ec );
+          }
+          else {
+            Flush();
+            OnWriteDone();
+          }
+        } );
+    }
+  }
+
+  bool Writing() const { return m_bWriting; }
+  std::size_t Pending() const { return m_sPending.size(); }
+
+  virtual void OnConnect() {}
+  virtual void OnCommand( std::string_view ) = 0;
+  virtual void OnWriteDone() {}
+  virtual void OnClose() {}
+
+private:
+
+  boost::asio::streambuf m_bufRead;
+  std::string m_sWriting;
+  std::string m_sPending;
+  bool m_bWriting;
+
+  void Read() {
+    boost::asio::async_read_until(
+      m_socket, m_bufRead, '\n',
+      [this,self=shared_from_this()]( const boost::system::error_code& ec, std::size_t ){
+        if ( ec ) {
+          Close( ec );
+        }
+        else {
+          std::istream is( &m_bufRead );
+          std::string sLine;
+          std::getline( is, sLine );
+          if ( !sLine.empty() && ( '\r' == sLine.back() ) ) sLine.pop_back();
+          if ( !sLine.empty() ) OnCommand( sLine );
+          Read();
+        }
+      } );
+  }
+
+  void Close( const boost::system::error_code& ec ) {
+    if ( !m_bClosed ) {
+      m_bClosed = true;
+      std::cout << "port " << m_port << ": closed (" << ec.message() << ")" << std::endl;
+      boost::system::error_code ecClose;
+      m_socket.close( ecClose );
+      OnClose();
+    }
+  }
+
+};
+
+// ==== 9100: request id based lookups, answered with the captured responses
+
+class SessionLookup: public Session {
+public:
+
+  SessionLookup( Server& server, boost::asio::ip::tcp::socket&& socket, Capture::port_t port )
+  : Session( server, std::move( socket ), port )
+  {}
+
+protected:
+
+  void OnCommand( std::string_view sv ) override {
+    if ( 0 == sv.find( "S," ) ) {
+      if ( "SET PROTOCOL" == Capture::Field( sv, 2 ) ) {
+        Queue( "S,CURRENT PROTOCOL," + std::string( Capture::Field( sv, 3 ) ) );
+      }
+    }
+    else {
+      // request id is usually the last field, try each from the right
+      std::vector<std::string_view> vField;
+      for ( std::size_t begin {}; ; ) {
+        const std::size_t comma = sv.find( ',', begin );
+        std::string_view field( sv.substr( begin, ( std::string_view::npos == comma ) ? std::string_view::npos : comma - begin ) );
+        if ( !field.empty() ) vField.push_back( field );
+        if ( std::string_view::npos == comma ) break;
+        begin = comma + 1;
+      }
+      bool bFound( false );
+      for ( std::vector<std::string_view>::const_reverse_iterator iter = vField.rbegin(); vField.rend() != iter; ++iter ) {
+        const Capture::idKey_t idKey = m_capture.Key( *iter );
+        if ( ( Capture::c_idNone != idKey ) && !m_server.m_vResponse[ idKey ].empty() ) {
+          const Server::vSegment_t& vSegment( m_server.m_vResponse[ idKey ] );
+          std::size_t& ix( m_mapRequestCount[ idKey ] );
+          for ( const std::size_t ixLine: vSegment[ ix % vSegment.size() ] ) {
+            Queue( m_capture.Text( m_capture.Lines( m_port )[ ixLine ] ) );
+          }
+          ix++;
+          bFound = true;
+          break;
+        }
+      }
+      if ( !bFound ) {
+        std::cout << "port " << m_port << ": no captured response for '" << sv << "'" << std::endl;
+        if ( !vField.empty() ) {
+          Queue( std::string( vField.back() ) + ",E,!NO_DATA!," );
+        }
+        else {
+          Queue( "E,!NO_DATA!," );
+        }
+      }
+    }
+    Flush();
+  }
+
+private:
+  std::map<Capture::idKey_t, std::size_t> m_mapRequestCount;
+};
+
+// ==== 5009 and 9200: handshake, watches, paced replay
+
+class SessionStream: public Session {
+public:
+
+  SessionStream( Server& server, boost::asio::ip::tcp::socket&& socket, Capture::port_t port )
+  : Session( server, std::move( socket ), port )
+  , m_vLine( server.m_capture.Lines( port ) )
+  , m_vWatched( server.m_capture.Keys(), false )
+  , m_timerSettle( server.m_context ), m_timerPace( server.m_context )
+  , m_bNews( false ), m_bReplaying( false ), m_bPaceWaiting( false ), m_bDone( false )
+  , m_ixNext {}, m_nSent {}, m_nWatches {}
+  {}
+
+protected:
+
+  void OnConnect() override {
+    if ( Capture::c_portLevel1 == m_port ) {
+      Queue( "S,KEY,REPLAY" );
+      Queue( "S,SERVER CONNECTED" );
+      Queue( "S,CUST,real_time,127.0.0.1,60002,REPLAY,6.2.0.25,0,,," );
+    }
+    else {
+      Queue( "S,SERVER CONNECTED" );
+    }
+    Flush();
+  }
+
+  void OnCommand( std::string_view sv ) override {
+    if ( 0 == sv.find( "S," ) ) {
+      const std::string_view cmd( Capture::Field( sv, 2 ) );
+      if ( "SET PROTOCOL" == cmd ) {
+        Queue( "S,CURRENT PROTOCOL," + std::string( Capture::Field( sv, 3 ) ) );
+      }
+      else if ( "SELECT UPDATE FIELDS" == cmd ) {
+        Queue( "S,CURRENT UPDATE FIELDNAMES," + std::string( sv.substr( std::string_view( "S,SELECT UPDATE FIELDS," ).size() ) ) );
+      }
+      else if ( "KEY" == cmd ) {
+        Queue( "S,KEYOK" );
+      }
+      else if ( "NEWSON" == cmd ) m_bNews = true;
+      else if ( "NEWSOFF" == cmd ) m_bNews = false;
+      // TIMESTAMPSOFF and others need no answer
+    }
+    else {
+      if ( Capture::c_portLevel1 == m_port ) {
+        switch ( sv[ 0 ] ) {
+          case 'w': // quotes and trades
+          case 't': // trades only, replayed the same
+            Watch( sv.substr( 1 ) );
+            break;
+          case 'r':
+            Unwatch( sv.substr( 1 ) );
+            break;
+          default:
+            std::cout << "port " << m_port << ": unhandled command '" << sv << "'" << std::endl;
+        }
+      }
+      else {
+        const std::string_view cmd( Capture::Field( sv, 1 ) );
+        if ( ( "WOR" == cmd ) || ( "WPL" == cmd ) ) Watch( Capture::Field( sv, 2 ) );
+        else if ( ( "ROR" == cmd ) || ( "RPL" == cmd ) ) Unwatch( Capture::Field( sv, 2 ) );
+        else std::cout << "port " << m_port << ": unhandled command '" << sv << "'" << std::endl;
+      }
+    }
+    Flush();
+  }
+
+  void OnWriteDone() override {
+    Pump();
+  }
+
+  void OnClose() override {
+    m_timerSettle.cancel();
+    m_timerPace.cancel();
+  }
+
+private:
+
+  using steady_t = Server::steady_t;
+
+  const Capture::vLine_t& m_vLine;
+  std::vector<bool> m_vWatched; // by key
+  std::unordered_set<std::size_t> m_setSentOnWatch; // lines not to be repeated by the replay
+
+  boost::asio::steady_timer m_timerSettle;
+  boost::asio::steady_timer m_timerPace;
+
+  bool m_bNews;
+  bool m_bReplaying;
+  bool m_bPaceWaiting;
+  bool m_bDone;
+
+  std::size_t m_ixNext;
+  std::size_t m_nSent;
+  std::size_t m_nWatches; // level 1, counted for nWatchDrop
+
+  void Watch( std::string_view sName ) {
+    const Capture::idKey_t idKey = m_capture.Key( sName );
+    if ( Capture::c_idNone == idKey ) {
+      std::cout << "port " << m_port << ": " << sName << " not in capture" << std::endl;
+      Queue( "n," + std::string( sName ) );
+    }
+    else {
+      if ( Capture::c_portLevel1 == m_port ) {
+        const Server::Options& options( m_server.m_options );
+        m_nWatches++;
+        if ( ( 0 < options.nWatchDrop ) && ( 0 == ( m_nWatches % options.nWatchDrop ) ) ) {
+          // not answered, nor replayed
+          const std::pair<std::size_t,std::size_t>& pair( m_server.m_vFirstFP[ idKey ] );
+          if ( npos != pair.first ) m_setSentOnWatch.insert( pair.first );
+          if ( npos != pair.second ) m_setSentOnWatch.insert( pair.second );
+        }
+        else {
+          if ( std::chrono::milliseconds::zero() == options.msWatchDelay ) {
+            AnswerWatch( idKey );
+          }
+          else {
+            std::shared_ptr<boost::asio::steady_timer> pTimer
+              = std::make_shared<boost::asio::steady_timer>( m_server.m_context, options.msWatchDelay );
+            pTimer->async_wait(
+              [this,self=shared_from_this(),pTimer,idKey]( const boost::system::error_code& ec ){
+                if ( !ec && !m_bClosed ) {
+                  AnswerWatch( idKey );
+                  Flush();
+                }
+              } );
+          }
+        }
+      }
+      else {
+        m_vWatched[ idKey ] = true;
+      }
+    }
+    if ( !m_bReplaying ) {
+      m_timerSettle.expires_after( m_server.m_options.msSettle ); // each watch restarts the wait
+      m_timerSettle.async_wait(
+        [this,self=shared_from_this()]( const boost::system::error_code& ec ){
+          if ( !ec && !m_bReplaying && !m_bClosed ) {
+            m_bReplaying = true;
+            m_server.StartClock();
+            std::cout << "port " << m_port << ": replay started" << std::endl;
+            Pump();
+          }
+        } );
+    }
+  }
+
+  void Unwatch( std::string_view sName ) {
+    const Capture::idKey_t idKey = m_capture.Key( sName );
+    if ( Capture::c_idNone != idKey ) {
+      m_vWatched[ idKey ] = false;
+    }
+  }
+
+  // iqconnect answers a watch with fundamentals and a summary, the replay follows
+  void AnswerWatch( Capture::idKey_t idKey ) {
+    m_vWatched[ idKey ] = true;
+    const std::pair<std::size_t,std::size_t>& pair( m_server.m_vFirstFP[ idKey ] );
+    if ( npos != pair.first ) SendOnWatch( pair.first );
+    if ( npos != pair.second ) SendOnWatch( pair.second );
+  }
+
+  void SendOnWatch( std::size_t ixLine ) {
+    if ( m_setSentOnWatch.insert( ixLine ).second ) {
+      Queue( m_capture.Text( m_vLine[ ixLine ] ) );
+    }
+  }
+
+  bool Replayable( std::size_t ixLine ) const {
+    const Capture::Line& line( m_vLine[ ixLine ] );
+    if ( Capture::c_idNone == line.idKey ) {
+      switch ( m_capture.Text( line )[ 0 ] ) {
+        case 'T': return true;
+        case 'N': return m_bNews;
+        default: return false; // system and error messages are the server's own
+      }
+    }
+    return m_vWatched[ line.idKey ] && ( 0 == m_setSentOnWatch.count( ixLine ) );
+  }
+
+  void Pump() {
+    if ( m_bClosed || !m_bReplaying || m_bPaceWaiting || Writing() || m_bDone ) return;
+
+    const steady_t::time_point now( steady_t::now() );
+    while ( ( m_ixNext < m_vLine.size() ) && ( c_nWriteChunk > Pending() ) ) {
+      if ( Replayable( m_ixNext ) ) {
+        const Capture::Line& line( m_vLine[ m_ixNext ] );
+        const steady_t::time_point due( m_server.Due( line.nsReceived ) );
+        if ( now < due ) {
+          if ( 0 == Pending() ) {
+            m_bPaceWaiting = true;
+            m_timerPace.expires_at( due );
+            m_timerPace.async_wait(
+              [this,self=shared_from_this()]( const boost::system::error_code& ec ){
+                m_bPaceWaiting = false;
+                if ( !ec ) Pump();
+              } );
+          }
+          break;
+        }
+        Queue( m_capture.Text( line ) );
+        m_nSent++;
+        if ( m_server.m_fLineSent ) m_server.m_fLineSent( m_port, m_ixNext, due, now );
+      }
+      m_ixNext++;
+    }
+
+    if ( 0 < Pending() ) {
+      Flush(); // completion pumps again
+    }
+    else {
+      if ( ( m_vLine.size() == m_ixNext ) && !Writing() ) {
+        m_bDone = true;
+        std::cout << "port " << m_port << ": replay done, " << m_nSent << " lines" << std::endl;
+        if ( m_server.m_fReplayDone ) m_server.m_fReplayDone( m_port, m_nSent );
+      }
+    }
+  }
+
+};
+
+// ==== Server
+
+Server::Server( boost::asio::io_context& context, const Capture& capture, const Options& options )
+: m_context( context ), m_capture( capture ), m_options( options )
+, m_bClockStarted( false ), m_nsStart {}
+{
+  BuildIndex();
+
+  for ( const Capture::port_t port: { Capture::c_portLevel1, Capture::c_portLookup, Capture::c_portLevel2 } ) {
+    m_vAcceptor.emplace_back( std::make_unique<acceptor_t>( m_context ) );
+    acceptor_t& acceptor( *m_vAcceptor.back() );
+    const boost::asio::ip::tcp::endpoint endpoint( boost::asio::ip::make_address( "127.0.0.1" ), port );
+    acceptor.open( endpoint.protocol() );
+    acceptor.set_option( acceptor_t::reuse_address( true ) );
+    acceptor.bind( endpoint ); // throws if iqconnect, or another replay, has the port
+    acceptor.listen();
+    Accept( acceptor, port );
+  }
+}
+
+Server::~Server() {
+  for ( std::unique_ptr<acceptor_t>& pAcceptor: m_vAcceptor ) {
+    boost::system::error_code ec;
+    pAcceptor->close( ec );
+  }
+}
+
+void Server::Accept( acceptor_t& acceptor, Capture::port_t port ) {
+  acceptor.async_accept(
+    [this,&acceptor,port]( const boost::system::error_code& ec, boost::asio::ip::tcp::socket socket ){
+      if ( !ec ) {
+        std::shared_ptr<Session> pSession;
+        if ( Capture::c_portLookup == port ) {
+          pSession = std::make_shared<SessionLookup>( *this, std::move( socket ), port );
+        }
+        else {
+          pSession = std::make_shared<SessionStream>( *this, std::move( socket ), port );
+        }
+        pSession->Start();
+        Accept( acceptor, port );
+      }
+    } );
+}
+
+void Server::BuildIndex() {
+
+  m_vResponse.resize( m_capture.Keys() );
+  {
+    // responses are grouped per connection and request id, and end with !ENDMSG! or an error
+    using key_t = std::pair<std::uint32_t, Capture::idKey_t>; // stream, key
+    std::map<key_t, std::size_t> mapOpen;
+    const Capture::vLine_t& vLine( m_capture.Lines( Capture::c_portLookup ) );
+    for ( std::size_t ix = 0; ix < vLine.size(); ix++ ) {
+      const Capture::Line& line( vLine[ ix ] );
+      if ( Capture::c_idNone != line.idKey ) {
+        vSegment_t& vSegment( m_vResponse[ line.idKey ] );
+        const key_t key( line.nStream, line.idKey );
+        std::map<key_t, std::size_t>::iterator iter = mapOpen.find( key );
+        if ( mapOpen.end() == iter ) {
+          vSegment.emplace_back();
+          iter = mapOpen.emplace( key, vSegment.size() - 1 ).first;
+        }
+        vSegment[ iter->second ].push_back( ix );
+        const std::string_view status( Capture::Field( m_capture.Text( line ), 2 ) );
+        if ( ( "!ENDMSG!" == status ) || ( "E" == status ) ) {
+          mapOpen.erase( iter );
+        }
+      }
+    }
+  }
+
+  m_vFirstFP.assign( m_capture.Keys(), std::make_pair( npos, npos ) );
+  {
+    const Capture::vLine_t& vLine( m_capture.Lines( Capture::c_portLevel1 ) );
+    for ( std::size_t ix = 0; ix < vLine.size(); ix++ ) {
+      const Capture::Line& line( vLine[ ix ] );
+      if ( Capture::c_idNone != line.idKey ) {
+        std::pair<std::size_t,std::size_t>& pair( m_vFirstFP[ line.idKey ] );
+        switch ( m_capture.Text( line )[ 0 ] ) {
+          case 'F':
+            if ( npos == pair.first ) pair.first = ix;
+            break;
+          case 'P':
+            if ( npos == pair.second ) pair.second = ix;
+            break;
+        }
+      }
+    }
+  }
+
+  // the replay clock is relative to the first streamed line
+  m_nsStart = ~Capture::ns_t( 0 );
+  for ( const Capture::port_t port: { Capture::c_portLevel1, Capture::c_portLevel2 } ) {
+    const Capture::vLine_t& vLine( m_capture.Lines( port ) );
+    if ( !vLine.empty() ) m_nsStart = std::min( m_nsStart, vLine.front().nsReceived );
+  }
+}
+
+Server::steady_t::time_point Server::StartClock() {
+  if ( !m_bClockStarted ) {
+    m_bClockStarted = true;
+    m_tpStart = steady_t::now();
+  }
+  return m_tpStart;
+}
+
+Server::steady_t::time_point Server::Due( Capture::ns_t ns ) const {
+  if ( ( 0.0 >= m_options.dblSpeed ) || ( ns <= m_nsStart ) ) return m_tpStart;
+  const double dblOffset = (double)( ns - m_nsStart ) / m_options.dblSpeed;
+  return m_tpStart + std::chrono::duration_cast<steady_t::duration>( std::chrono::nanoseconds( (std::int64_t)dblOffset ) );
+}
+
+} // namespace replay
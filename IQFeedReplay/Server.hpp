@@ -0,0 +1,100 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Server.hpp
+ * Author:  raymond@burkholder.net
+ * Project: IQFeedReplay
+ * Created: October 19, 2026 18:30
+ */
+
+#pragma once
+
+// stands in for IQConnect on 127.0.0.1, enough of the protocol to drive the trade-frame client code:
+//   5009: S,KEY / S,CUST handshake, SET PROTOCOL, SELECT UPDATE FIELDS, w/t/r watch commands
+//   9100: SET PROTOCOL, request id based lookups answered from the captured responses (SLM, SST, STC, ...)
+//   9200: SERVER CONNECTED, SET PROTOCOL, WOR/WPL/ROR/RPL
+// a watch answers with the symbol's first captured F and P lines, immediately or after msWatchDelay,
+//   with nWatchDrop, every nth level 1 watch is not answered at all, as a symbol iqconnect never returns
+// the timed replay begins once watch commands have settled, and runs on one clock shared by 5009 and 9200
+//   speed 1 is as captured, N is N times faster, 0 is as fast as the socket will accept
+
+#include <memory>
+#include <chrono>
+#include <vector>
+#include <functional>
+
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/io_context.hpp>
+
+#include "Capture.hpp"
+
+namespace replay {
+
+class Server {
+public:
+
+  using steady_t = std::chrono::steady_clock;
+
+  struct Options {
+    double dblSpeed;  // 0 is as fast as possible
+    std::chrono::milliseconds msSettle; // after the last watch command, before the replay starts
+    std::chrono::milliseconds msWatchDelay; // before a watch is answered with F and P
+    std::size_t nWatchDrop; // 0 answers every watch
+    Options(): dblSpeed( 1.0 ), msSettle( 250 ), msWatchDelay( 0 ), nWatchDrop( 0 ) {}
+  };
+
+  // server thread, for each replayed line, with when it was due and when it was handed to the socket
+  using fLineSent_t = std::function<void( Capture::port_t, std::size_t ixLine, steady_t::time_point tpDue, steady_t::time_point tpSent )>;
+  using fReplayDone_t = std::function<void( Capture::port_t, std::size_t nLinesSent )>;
+
+  Server( boost::asio::io_context&, const Capture&, const Options& );
+  ~Server();
+
+  void Set( fLineSent_t&& f ) { m_fLineSent = std::move( f ); }
+  void Set( fReplayDone_t&& f ) { m_fReplayDone = std::move( f ); }
+
+protected:
+private:
+
+  friend class Session;
+  friend class SessionLookup;
+  friend class SessionStream;
+
+  using acceptor_t = boost::asio::ip::tcp::acceptor;
+  using vSegment_t = std::vector<std::vector<std::size_t> >; // captured responses to one request id, in order
+
+  boost::asio::io_context& m_context;
+  const Capture& m_capture;
+  const Options m_options;
+
+  std::vector<std::unique_ptr<acceptor_t> > m_vAcceptor;
+
+  std::vector<vSegment_t> m_vResponse; // 9100, indexed by request id key
+  std::vector<std::pair<std::size_t,std::size_t> > m_vFirstFP; // 5009, by symbol key, first F and P line
+
+  bool m_bClockStarted;
+  steady_t::time_point m_tpStart;
+  Capture::ns_t m_nsStart;
+
+  fLineSent_t m_fLineSent;
+  fReplayDone_t m_fReplayDone;
+
+  void Accept( acceptor_t&, Capture::port_t );
+  void BuildIndex();
+  steady_t::time_point StartClock(); // first replaying session sets the shared clock
+  steady_t::time_point Due( Capture::ns_t ) const;
+};
+
+} // namespace replay
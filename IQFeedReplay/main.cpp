@@ -0,0 +1,121 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    main.cpp
+ * Author:  raymond@burkholder.net
+ * Project: IQFeedReplay
+ * Created: October 19, 2026 18:30
+ */
+
+// usage:
+//   IQFeedReplay serve <capture> [speed] [watch_ms [watch_drop]]  stand in for iqconnect until ctrl-c
+//   IQFeedReplay bench <capture> [speed] [symbol ...]  server and client stack in process, reports throughput and latency
+// speed: 1 as captured (default), N times faster, or max
+// watch_ms: delay before a watch is answered with fundamentals and summary, watch_drop: every nth watch is not answered
+//   to exercise fundamentals retrieval, such as Dividend, with a latency and with time outs
+// a capture is made by running any trade-frame application with TF_NETWORK_CAPTURE=<file> in the environment
+
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+#include <boost/asio/signal_set.hpp>
+
+#include "Bench.hpp"
+#include "Server.hpp"
+
+namespace {
+
+void Usage() {
+  std::cout
+    << "usage:" << std::endl
+    << "  IQFeedReplay serve <capture> [speed] [watch_ms [watch_drop]]" << std::endl
+    << "  IQFeedReplay bench <capture> [speed] [symbol ...]" << std::endl
+    << "  speed: 1 (default), N, or max" << std::endl;
+}
+
+} // namespace anonymous
+
+int main( int argc, char* argv[] ) {
+
+  if ( 3 > argc ) {
+    Usage();
+    return EXIT_FAILURE;
+  }
+
+  const std::string sMode( argv[ 1 ] );
+  const std::string sFileName( argv[ 2 ] );
+
+  replay::Server::Options options;
+  if ( 4 <= argc ) {
+    const std::string sSpeed( argv[ 3 ] );
+    if ( "max" == sSpeed ) {
+      options.dblSpeed = 0.0;
+    }
+    else {
+      try {
+        options.dblSpeed = std::stod( sSpeed );
+      }
+      catch ( const std::logic_error& ) {
+        std::cout << "speed '" << sSpeed << "' is not a number or max" << std::endl;
+        return EXIT_FAILURE;
+      }
+      if ( 0.0 >= options.dblSpeed ) {
+        std::cout << "speed needs to be positive, or max" << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  try {
+
+    const replay::Capture capture( sFileName );
+
+    if ( "serve" == sMode ) {
+      try {
+        if ( 5 <= argc ) options.msWatchDelay = std::chrono::milliseconds( std::stoul( argv[ 4 ] ) );
+        if ( 6 <= argc ) options.nWatchDrop = std::stoul( argv[ 5 ] );
+      }
+      catch ( const std::logic_error& ) {
+        std::cout << "watch_ms and watch_drop are whole numbers" << std::endl;
+        return EXIT_FAILURE;
+      }
+      boost::asio::io_context context;
+      replay::Server server( context, capture, options );
+      boost::asio::signal_set signals( context, SIGINT );
+      signals.async_wait(
+        [&context]( const boost::system::error_code&, int ){
+          context.stop();
+        } );
+      context.run();
+      return EXIT_SUCCESS;
+    }
+
+    if ( "bench" == sMode ) {
+      std::vector<std::string> vSymbol;
+      for ( int ix = 4; ix < argc; ix++ ) vSymbol.emplace_back( argv[ ix ] );
+      return replay::Bench( capture, options, vSymbol );
+    }
+
+    Usage();
+    return EXIT_FAILURE;
+  }
+  catch ( const std::exception& e ) {
+    std::cout << "IQFeedReplay: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+}
@@ -0,0 +1,344 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Bench.cpp
+ * Author:  raymond@burkholder.net
+ * Project: PhemexReplay
+ * Created: October 20, 2026 00:45
+ */
+
+#include <map>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <cstdlib>
+#include <iostream>
+#include <functional>
+
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <TFPhemex/web_socket.hpp>
+
+#include "Bench.hpp"
+
+namespace replay {
+
+namespace {
+
+using steady_t = std::chrono::steady_clock;
+
+using OrderBook = ou::tf::phemex::OrderBook;
+namespace book = ou::tf::phemex::gateway::book;
+
+// the books for one pass, fed on one thread (the caller, or the web_socket strand)
+struct Books {
+
+  using mapBook_t = std::map<std::string, OrderBook>;
+  using fResync_t = std::function<void( const std::string& )>;
+
+  const OrderBook::ESequence eSequence;
+
+  mapBook_t mapBook;
+  book::message msg;
+  std::string sLookup;
+
+  std::size_t nQuotes;
+  std::size_t nDepths;
+  std::size_t nMalformed;
+  std::size_t nResync;
+  std::atomic<std::size_t> nFrames;
+  steady_t::time_point tpFirst;
+  steady_t::time_point tpLast;
+
+  fResync_t fResync;
+
+  Books( OrderBook::ESequence eSequence_ )
+  : eSequence( eSequence_ ), nQuotes {}, nDepths {}, nMalformed {}, nResync {}, nFrames {} {}
+
+  void Frame( std::string_view frame ) {
+
+    tpLast = steady_t::now();
+    if ( 0 == nFrames ) tpFirst = tpLast;
+
+    if ( !book::Decode( frame, msg ) ) {
+      nMalformed++;
+    }
+    else {
+      sLookup.assign( msg.symbol.data(), msg.symbol.size() );
+      mapBook_t::iterator iter = mapBook.find( sLookup );
+      if ( mapBook.end() == iter ) {
+        iter = mapBook.emplace( sLookup, eSequence ).first;
+        iter->second.Set(
+          [this]( const ou::tf::DepthByOrder& ){ nDepths++; },
+          [this]( const ou::tf::Quote& ){ nQuotes++; }
+        );
+      }
+      static const boost::posix_time::ptime epoch( boost::gregorian::date( 1970, 1, 1 ) );
+      const boost::posix_time::ptime dt( epoch + boost::posix_time::microseconds( msg.time_stamp / 1000 ) );
+      switch ( iter->second.Apply( dt, dt, msg ) ) {
+        case OrderBook::EResult::Gap:
+        case OrderBook::EResult::Crossed:
+          nResync++;
+          if ( fResync ) fResync( sLookup );
+          break;
+        default:
+          break;
+      }
+    }
+    nFrames++;
+  }
+
+  OrderBook::Stats Total() const {
+    OrderBook::Stats total;
+    for ( const mapBook_t::value_type& vt: mapBook ) {
+      const OrderBook::Stats& stats( vt.second.GetStats() );
+      total.nSnapshots += stats.nSnapshots;
+      total.nIncrementals += stats.nIncrementals;
+      total.nLevels += stats.nLevels;
+      total.nStale += stats.nStale;
+      total.nWaiting += stats.nWaiting;
+      total.nGaps += stats.nGaps;
+      total.nCrossed += stats.nCrossed;
+      total.nUnknown += stats.nUnknown;
+    }
+    return total;
+  }
+};
+
+std::ostream& operator<<( std::ostream& os, const Books& books ) {
+  const OrderBook::Stats stats( books.Total() );
+  os
+    << books.mapBook.size() << " books, "
+    << stats.nSnapshots << " snapshots, "
+    << stats.nIncrementals << " incrementals, "
+    << stats.nLevels << " level changes, "
+    << stats.nStale << " stale, "
+    << stats.nGaps << " gaps, "
+    << stats.nCrossed << " crossed, "
+    << stats.nWaiting << " dropped awaiting a snapshot, "
+    << stats.nUnknown << " unknown removals, "
+    << books.nResync << " re-subscriptions, "
+    << books.nDepths << " depths, "
+    << books.nQuotes << " quotes"
+    ;
+  if ( 0 < books.nMalformed ) os << ", " << books.nMalformed << " malformed";
+  return os;
+}
+
+bool Same( const OrderBook& lhs, const OrderBook& rhs ) {
+  for ( OrderBook::ESide side: { OrderBook::Bid, OrderBook::Ask } ) {
+    if ( lhs.Levels( side ) != rhs.Levels( side ) ) return false;
+    for ( std::size_t ix = 0; ix < lhs.Levels( side ); ix++ ) {
+      if ( !( lhs.Level( side, ix ) == rhs.Level( side, ix ) ) ) return false;
+    }
+  }
+  return lhs.Synchronized() == rhs.Synchronized();
+}
+
+bool Same( const Books& lhs, const Books& rhs ) {
+  if ( lhs.mapBook.size() != rhs.mapBook.size() ) return false;
+  for ( const Books::mapBook_t::value_type& vt: lhs.mapBook ) {
+    Books::mapBook_t::const_iterator iter = rhs.mapBook.find( vt.first );
+    if ( rhs.mapBook.end() == iter ) return false;
+    if ( !Same( vt.second, iter->second ) ) return false;
+  }
+  const OrderBook::Stats l( lhs.Total() );
+  const OrderBook::Stats r( rhs.Total() );
+  return
+       ( l.nSnapshots == r.nSnapshots ) && ( l.nIncrementals == r.nIncrementals ) && ( l.nLevels == r.nLevels )
+    && ( l.nStale == r.nStale ) && ( l.nGaps == r.nGaps ) && ( l.nCrossed == r.nCrossed ) && ( l.nWaiting == r.nWaiting )
+    && ( lhs.nDepths == rhs.nDepths ) && ( lhs.nQuotes == rhs.nQuotes ) && ( lhs.nResync == rhs.nResync );
+}
+
+// the same sequence rules, the simplest book, for checking the flat one
+class Reference {
+public:
+
+  Reference( OrderBook::ESequence eSequence ): m_eSequence( eSequence ) {}
+
+  void Frame( std::string_view frame ) {
+    if ( !book::Decode( frame, m_msg ) ) return;
+    Book& b( m_mapBook[ std::string( m_msg.symbol ) ] );
+    if ( m_msg.snapshot() ) {
+      b.mapBid.clear();
+      b.mapAsk.clear();
+      for ( const book::level& level: m_msg.bids ) if ( 0 < level.quantity ) b.mapBid[ level.price ] = level.quantity;
+      for ( const book::level& level: m_msg.asks ) if ( 0 < level.quantity ) b.mapAsk[ level.price ] = level.quantity;
+      b.sequence = m_msg.sequence;
+      b.bSynchronized = true;
+      return;
+    }
+    if ( !b.bSynchronized ) return;
+    if ( m_msg.sequence <= b.sequence ) return;
+    if ( ( OrderBook::ESequence::Contiguous == m_eSequence ) && ( ( b.sequence + 1 ) != m_msg.sequence ) ) {
+      b.bSynchronized = false;
+      return;
+    }
+    auto Change = []( mapLevel_t& map, const book::level& level ){
+      if ( 0 < level.quantity ) map[ level.price ] = level.quantity;
+      else map.erase( level.price );
+    };
+    for ( const book::level& level: m_msg.bids ) Change( b.mapBid, level );
+    for ( const book::level& level: m_msg.asks ) Change( b.mapAsk, level );
+    b.sequence = m_msg.sequence;
+    if ( !b.mapBid.empty() && !b.mapAsk.empty() && ( b.mapBid.rbegin()->first >= b.mapAsk.begin()->first ) ) {
+      b.bSynchronized = false;
+    }
+  }
+
+  bool Same( const Books& books ) const {
+    if ( books.mapBook.size() != m_mapBook.size() ) return false;
+    for ( const mapBook_t::value_type& vt: m_mapBook ) {
+      Books::mapBook_t::const_iterator iter = books.mapBook.find( vt.first );
+      if ( books.mapBook.end() == iter ) return false;
+      const OrderBook& ob( iter->second );
+      const Book& b( vt.second );
+      if ( ob.Synchronized() != b.bSynchronized ) return false;
+      if ( ob.Levels( OrderBook::Bid ) != b.mapBid.size() ) return false;
+      if ( ob.Levels( OrderBook::Ask ) != b.mapAsk.size() ) return false;
+      std::size_t ix {};
+      for ( mapLevel_t::const_reverse_iterator iterLevel = b.mapBid.rbegin(); b.mapBid.rend() != iterLevel; iterLevel++, ix++ ) {
+        const book::level& level( ob.Level( OrderBook::Bid, ix ) );
+        if ( ( level.price != iterLevel->first ) || ( level.quantity != iterLevel->second ) ) return false;
+      }
+      ix = 0;
+      for ( mapLevel_t::const_iterator iterLevel = b.mapAsk.begin(); b.mapAsk.end() != iterLevel; iterLevel++, ix++ ) {
+        const book::level& level( ob.Level( OrderBook::Ask, ix ) );
+        if ( ( level.price != iterLevel->first ) || ( level.quantity != iterLevel->second ) ) return false;
+      }
+    }
+    return true;
+  }
+
+private:
+
+  using mapLevel_t = std::map<std::int64_t,std::int64_t>;
+
+  struct Book {
+    bool bSynchronized;
+    std::uint64_t sequence;
+    mapLevel_t mapBid;
+    mapLevel_t mapAsk;
+    Book(): bSynchronized( false ), sequence {} {}
+  };
+
+  using mapBook_t = std::map<std::string,Book>;
+
+  const OrderBook::ESequence m_eSequence;
+  book::message m_msg;
+  mapBook_t m_mapBook;
+};
+
+void Emit( const std::string& sVariant, const std::string& sParam, std::size_t nItems, double dblSeconds ) {
+  // same layout as the Benchmark results
+  std::cout
+    << "phemex_book " << sVariant << " " << sParam
+    << ": " << nItems << " items"
+    << " in " << dblSeconds << " s"
+    << ", " << (std::size_t)( ( 0.0 < dblSeconds ) ? ( nItems / dblSeconds ) : 0.0 ) << "/s"
+    << ", " << ( ( 0 < nItems ) ? ( 1e9 * dblSeconds / nItems ) : 0.0 ) << " ns/item"
+    << std::endl;
+}
+
+} // namespace anonymous
+
+int Bench( const Frames& frames, const ou::ReplayServer::Options& options, OrderBook::ESequence eSequence ) {
+
+  const std::string sParam(
+    "frames=" + std::to_string( frames.Frame().size() ) + ",bytes=" + std::to_string( frames.Bytes() )
+    + ",sequence=" + ( ( OrderBook::ESequence::Contiguous == eSequence ) ? "contiguous" : "increasing" ) );
+
+  // 1. decode and apply, the items are level changes
+
+  Books direct( eSequence );
+  const steady_t::time_point tpBegin( steady_t::now() );
+  for ( const std::string& sFrame: frames.Frame() ) direct.Frame( sFrame );
+  Emit( "decode_apply", sParam, direct.Total().nLevels, std::chrono::duration<double>( steady_t::now() - tpBegin ).count() );
+
+  // the reference stepped alongside a second pass, compared along the way
+  Books checked( eSequence );
+  Reference reference( eSequence );
+  bool bReference( true );
+  std::size_t ixFrame {};
+  for ( const std::string& sFrame: frames.Frame() ) {
+    checked.Frame( sFrame );
+    reference.Frame( sFrame );
+    ixFrame++;
+    if ( ( 0 == ( ixFrame % 4096 ) ) || ( frames.Frame().size() == ixFrame ) ) {
+      bReference = bReference && reference.Same( checked );
+    }
+  }
+
+  // 2. through the stand in
+
+  ou::ReplayServer::Options optionsServer( options );
+  optionsServer.nPort = 0;
+  ou::ReplayServer server( frames.Frame(), optionsServer );
+  std::atomic<bool> bReplayDone( false );
+  server.Set( [&bReplayDone]( std::size_t ){ bReplayDone = true; } );
+  server.Start();
+
+  Books wire( eSequence );
+  boost::asio::io_context context;
+  auto pSocket = std::make_shared<ou::tf::phemex::session::web_socket>( context );
+  ou::tf::phemex::session::web_socket* pws( pSocket.get() ); // the session outlives the handlers
+  wire.fResync = [pws]( const std::string& sSymbol ){ pws->StartBookWatch( sSymbol ); };
+
+  std::atomic<bool> bConnected( false );
+  pSocket->connect(
+    "127.0.0.1", std::to_string( server.Port() ),
+    [&bConnected,pws]( bool bOk ){ // fConnected_t
+      bConnected = bOk;
+      pws->StartBookWatch( "*" );
+    },
+    [](){}, // fDisconnected_t
+    [&wire]( std::string&& sMessage ){ // fMessage_t
+      if ( book::IsBook( sMessage ) ) wire.Frame( sMessage );
+    }
+  );
+
+  std::thread threadClient( [&context](){ context.run(); } );
+
+  // the replay, then the client draining what remains
+  const steady_t::time_point tpGiveUp( steady_t::now() + std::chrono::seconds( 600 ) );
+  while ( !bReplayDone && ( steady_t::now() < tpGiveUp ) ) std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+  std::size_t nLast {};
+  do {
+    nLast = wire.nFrames;
+    std::this_thread::sleep_for( std::chrono::milliseconds( 200 ) );
+  } while ( ( wire.nFrames < direct.nFrames ) && ( nLast != wire.nFrames ) );
+
+  pSocket->disconnect();
+  threadClient.join();
+  server.Stop();
+
+  Emit(
+    ( 0.0 < options.dblRate ) ? "websocket_paced" : "websocket", sParam,
+    wire.Total().nLevels, std::chrono::duration<double>( wire.tpLast - wire.tpFirst ).count() );
+
+  if ( bConnected && bReference && Same( direct, wire ) ) {
+    std::cout << "phemex_book check ok: " << wire << std::endl;
+    return EXIT_SUCCESS;
+  }
+  else {
+    std::cout << "phemex_book check failed" << std::endl;
+    if ( !bReference ) std::cout << "  the books differ from the reference" << std::endl;
+    std::cout << "  decode:    " << direct << std::endl;
+    std::cout << "  websocket: " << wire << std::endl;
+    return EXIT_FAILURE;
+  }
+}
+
+} // namespace replay
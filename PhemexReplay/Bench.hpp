@@ -0,0 +1,41 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Bench.hpp
+ * Author:  raymond@burkholder.net
+ * Project: PhemexReplay
+ * Created: October 20, 2026 00:45
+ */
+
+#pragma once
+
+// the frames decoded and applied to phemex::OrderBook in memory, then the same frames through
+//   the stand in server and phemex::session::web_socket over a loopback websocket
+// the in memory books are checked against a std::map reference applying the same sequence rules,
+//   and both passes must agree on the books, sequence statistics and events published,
+//   which makes this the order book test as well
+
+#include <TFPhemex/OrderBook.hpp>
+
+#include <OUCommon/ReplayServer.h>
+
+#include "Frames.hpp"
+
+namespace replay {
+
+// EXIT_FAILURE when the passes, or the reference, disagree
+int Bench( const Frames&, const ou::ReplayServer::Options&, ou::tf::phemex::OrderBook::ESequence );
+
+} // namespace replay
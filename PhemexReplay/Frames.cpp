@@ -0,0 +1,229 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Frames.cpp
+ * Author:  raymond@burkholder.net
+ * Project: PhemexReplay
+ * Created: October 20, 2026 00:45
+ */
+
+#include <map>
+#include <random>
+#include <fstream>
+#include <cstdint>
+#include <stdexcept>
+
+#include "Frames.hpp"
+
+namespace replay {
+
+namespace {
+
+using mapLevel_t = std::map<std::int64_t,std::int64_t>; // price, quantity
+
+struct Symbol {
+  std::string sName;
+  std::int64_t mid; // Ep
+  std::uint64_t sequence;
+  std::size_t nResync; // incrementals until the snapshot for a re-subscription, 0 when none is due
+  mapLevel_t mapBid;
+  mapLevel_t mapAsk;
+};
+
+const std::int64_t c_tick( 50 );
+const std::int64_t c_nTicks( 40 ); // levels either side of the mid
+
+using vLevel_t = std::vector<std::pair<std::int64_t,std::int64_t> >;
+
+void Levels( std::string& s, const char* szSide, const vLevel_t& v ) {
+  s += '"';
+  s += szSide;
+  s += "\":[";
+  bool bComma( false );
+  for ( const auto& level: v ) {
+    if ( bComma ) s += ',';
+    else bComma = true;
+    s += '[';
+    s += std::to_string( level.first );
+    s += ',';
+    s += std::to_string( level.second );
+    s += ']';
+  }
+  s += ']';
+}
+
+std::string Message( const Symbol& symbol, const vLevel_t& vBid, const vLevel_t& vAsk, std::uint64_t ns, const char* szType ) {
+  std::string s( "{\"book\":{" );
+  Levels( s, "asks", vAsk );
+  s += ',';
+  Levels( s, "bids", vBid );
+  s += "},\"depth\":30,\"sequence\":";
+  s += std::to_string( symbol.sequence );
+  s += ",\"symbol\":\"";
+  s += symbol.sName;
+  s += "\",\"timestamp\":";
+  s += std::to_string( ns );
+  s += ",\"type\":\"";
+  s += szType;
+  s += "\"}";
+  return s;
+}
+
+std::string Snapshot( const Symbol& symbol, std::uint64_t ns ) {
+  vLevel_t vBid( symbol.mapBid.rbegin(), symbol.mapBid.rend() ); // best first, as sent
+  vLevel_t vAsk( symbol.mapAsk.begin(), symbol.mapAsk.end() );
+  return Message( symbol, vBid, vAsk, ns, "snapshot" );
+}
+
+} // namespace anonymous
+
+// acknowledges the first request (an orderbook.subscribe),
+//   re-subscriptions are acknowledged by the snapshots already in the frames
+ou::ReplayServer::vStep_t Frames::Handshake() {
+  return ou::ReplayServer::vStep_t {
+    { true, "", "{\"error\":null,\"id\":4,\"result\":{\"status\":\"success\"}}" },
+  };
+}
+
+Frames::Frames( const std::string& sFileName )
+: m_nBytes {}
+{
+  std::ifstream ifs( sFileName );
+  if ( !ifs.is_open() ) {
+    throw std::runtime_error( "can not open " + sFileName );
+  }
+  std::string sLine;
+  while ( std::getline( ifs, sLine ) ) {
+    if ( !sLine.empty() && ( '\r' == sLine.back() ) ) sLine.pop_back();
+    if ( sLine.empty() ) continue;
+    m_nBytes += sLine.size();
+    m_vFrame.emplace_back( std::move( sLine ) );
+  }
+  if ( m_vFrame.empty() ) {
+    throw std::runtime_error( sFileName + " has no frames" );
+  }
+}
+
+// message shapes as sent for orderbook.subscribe on the contract gateway
+Frames::Frames( const Synth& synth )
+: m_nBytes {}
+{
+  std::mt19937 rng( 23 );
+  std::uniform_int_distribution<int> distPercent( 0, 99 );
+  std::uniform_int_distribution<std::int64_t> distQuantity( 1, 5000 );
+  std::uniform_int_distribution<std::int64_t> distOffset( 1, c_nTicks );
+  std::uniform_int_distribution<std::size_t> distCount( 1, synth.nPerFrame );
+  std::uniform_int_distribution<std::size_t> distSymbol( 0, synth.nSymbols - 1 );
+
+  std::uint64_t ns( 1792368000ull * 1000000000ull ); // 2026-10-19 utc
+
+  std::vector<Symbol> vSymbol( synth.nSymbols );
+  for ( std::size_t ix = 0; ix < synth.nSymbols; ix++ ) {
+    Symbol& symbol( vSymbol[ ix ] );
+    std::size_t n( ix );
+    symbol.sName = "s";
+    do {
+      symbol.sName += (char)( 'A' + ( n % 26 ) );
+      n /= 26;
+    } while ( 0 < n );
+    symbol.sName += "USDT";
+    symbol.mid = 2000000 + (std::int64_t)ix * 1000 * c_tick;
+    symbol.sequence = 1000 + ix;
+    symbol.nResync = 0;
+    for ( std::int64_t offset = 1; offset <= 30; offset++ ) {
+      symbol.mapBid[ symbol.mid - offset * c_tick ] = distQuantity( rng );
+      symbol.mapAsk[ symbol.mid + offset * c_tick ] = distQuantity( rng );
+    }
+  }
+
+  m_vFrame.reserve( synth.nFrames + synth.nSymbols );
+
+  auto Append = [this]( std::string&& sFrame ){
+    m_nBytes += sFrame.size();
+    m_vFrame.emplace_back( std::move( sFrame ) );
+  };
+
+  for ( const Symbol& symbol: vSymbol ) Append( Snapshot( symbol, ns ) );
+
+  vLevel_t vBid;
+  vLevel_t vAsk;
+  for ( std::size_t ixFrame = 0; ixFrame < synth.nFrames; ixFrame++ ) {
+
+    ns += 1 + ( rng() % 2000000 );
+
+    Symbol& symbol( vSymbol[ distSymbol( rng ) ] );
+    vBid.clear();
+    vAsk.clear();
+
+    // the mid wanders, levels it would cross are removed
+    const int percent( distPercent( rng ) );
+    if ( 10 > percent ) {
+      symbol.mid += ( 5 > percent ) ? c_tick : -c_tick;
+      while ( !symbol.mapBid.empty() && ( symbol.mapBid.rbegin()->first >= symbol.mid ) ) {
+        vBid.emplace_back( symbol.mapBid.rbegin()->first, 0 );
+        symbol.mapBid.erase( std::prev( symbol.mapBid.end() ) );
+      }
+      while ( !symbol.mapAsk.empty() && ( symbol.mapAsk.begin()->first <= symbol.mid ) ) {
+        vAsk.emplace_back( symbol.mapAsk.begin()->first, 0 );
+        symbol.mapAsk.erase( symbol.mapAsk.begin() );
+      }
+    }
+
+    const std::size_t nChanges( distCount( rng ) );
+    for ( std::size_t ixChange = 0; ixChange < nChanges; ixChange++ ) {
+      const bool bBid( 0 == ( rng() & 1 ) );
+      const std::int64_t offset( distOffset( rng ) );
+      const std::int64_t price( bBid ? symbol.mid - offset * c_tick : symbol.mid + offset * c_tick );
+      mapLevel_t& map( bBid ? symbol.mapBid : symbol.mapAsk );
+      vLevel_t& v( bBid ? vBid : vAsk );
+      mapLevel_t::iterator iter( map.find( price ) );
+      if ( ( map.end() != iter ) && ( 25 > distPercent( rng ) ) ) {
+        map.erase( iter );
+        v.emplace_back( price, 0 );
+      }
+      else {
+        const std::int64_t quantity( distQuantity( rng ) );
+        map[ price ] = quantity;
+        v.emplace_back( price, quantity );
+      }
+    }
+
+    symbol.sequence++;
+
+    if ( ( 0 < synth.nGap ) && ( ( synth.nGap - 1 ) == ( ixFrame % synth.nGap ) ) ) {
+      // lost, the client finds the gap with the next incremental and re-subscribes
+      if ( 0 == symbol.nResync ) symbol.nResync = 3;
+      continue;
+    }
+
+    Append( Message( symbol, vBid, vAsk, ns, "incremental" ) );
+
+    // the re-subscription answered, incrementals in the meantime are dropped by the client
+    if ( 0 < symbol.nResync ) {
+      symbol.nResync--;
+      if ( 0 == symbol.nResync ) Append( Snapshot( symbol, ns ) );
+    }
+  }
+}
+
+void Frames::Save( const std::string& sFileName ) const {
+  std::ofstream ofs( sFileName, std::ios::out | std::ios::trunc );
+  if ( !ofs.is_open() ) {
+    throw std::runtime_error( "can not write " + sFileName );
+  }
+  for ( const std::string& sFrame: m_vFrame ) ofs << sFrame << '\n';
+}
+
+} // namespace replay
@@ -0,0 +1,65 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Frames.hpp
+ * Author:  raymond@burkholder.net
+ * Project: PhemexReplay
+ * Created: October 20, 2026 00:45
+ */
+
+#pragma once
+
+// orderbook frames, one per line, as written by phemex::session::web_socket::record
+//   or synthesized: a snapshot per symbol, then incrementals around a wandering mid price,
+//   with sequence gaps, each followed a few frames later by the snapshot a re-subscription returns
+
+#include <string>
+#include <vector>
+#include <cstddef>
+
+#include <OUCommon/ReplayServer.h>
+
+namespace replay {
+
+class Frames {
+public:
+
+  using vFrame_t = std::vector<std::string>;
+
+  struct Synth {
+    std::size_t nFrames;
+    std::size_t nSymbols;
+    std::size_t nPerFrame; // at most, level changes in an incremental
+    std::size_t nGap;      // an incremental is dropped every n frames, 0 for none
+    Synth(): nFrames( 500000 ), nSymbols( 20 ), nPerFrame( 6 ), nGap( 50000 ) {}
+  };
+
+  Frames( const std::string& sFileName ); // throws std::runtime_error
+  Frames( const Synth& ); // deterministic
+
+  void Save( const std::string& sFileName ) const; // throws std::runtime_error
+
+  static ou::ReplayServer::vStep_t Handshake(); // what the stand in plays ahead of the frames
+
+  const vFrame_t& Frame() const { return m_vFrame; }
+  std::size_t Bytes() const { return m_nBytes; }
+
+protected:
+private:
+  vFrame_t m_vFrame;
+  std::size_t m_nBytes;
+};
+
+} // namespace replay
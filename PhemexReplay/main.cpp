@@ -0,0 +1,128 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    main.cpp
+ * Author:  raymond@burkholder.net
+ * Project: PhemexReplay
+ * Created: October 20, 2026 00:45
+ */
+
+// usage:
+//   PhemexReplay synth <frames> [count] [symbols] [gap]   write synthesized frames
+//   PhemexReplay serve <frames> [rate] [port]             stand in for the data gateway until ctrl-c
+//   PhemexReplay bench <frames|synth> [rate] [sequence]   apply in memory, then server and web_socket in process
+// rate: frames per second, or max (the default)
+// sequence: increasing (the default for recorded frames) or contiguous (the default for synth)
+// frames are recorded with phemex::session::web_socket::record, one frame per line
+
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+#include "Bench.hpp"
+
+namespace {
+
+void Usage() {
+  std::cout
+    << "usage:" << std::endl
+    << "  PhemexReplay synth <frames> [count] [symbols] [gap]" << std::endl
+    << "  PhemexReplay serve <frames> [rate] [port]" << std::endl
+    << "  PhemexReplay bench <frames|synth> [rate] [increasing|contiguous]" << std::endl
+    << "  rate: frames per second, or max (default)" << std::endl;
+}
+
+std::size_t Count( int argc, char* argv[], int ix, std::size_t nDefault ) {
+  return ( ix < argc ) ? std::stoul( argv[ ix ] ) : nDefault;
+}
+
+} // namespace anonymous
+
+int main( int argc, char* argv[] ) {
+
+  using ESequence = ou::tf::phemex::OrderBook::ESequence;
+
+  if ( 3 > argc ) {
+    Usage();
+    return EXIT_FAILURE;
+  }
+
+  const std::string sMode( argv[ 1 ] );
+  const std::string sFileName( argv[ 2 ] );
+
+  try {
+
+    if ( "synth" == sMode ) {
+      replay::Frames::Synth synth;
+      synth.nFrames = Count( argc, argv, 3, synth.nFrames );
+      synth.nSymbols = Count( argc, argv, 4, synth.nSymbols );
+      synth.nGap = Count( argc, argv, 5, synth.nGap );
+      const replay::Frames frames( synth );
+      frames.Save( sFileName );
+      std::cout << frames.Frame().size() << " frames, " << frames.Bytes() << " bytes, written to " << sFileName << std::endl;
+      return EXIT_SUCCESS;
+    }
+
+    ou::ReplayServer::Options options;
+    options.vStep = replay::Frames::Handshake();
+    if ( 4 <= argc ) {
+      const std::string sRate( argv[ 3 ] );
+      if ( "max" != sRate ) {
+        options.dblRate = std::stod( sRate );
+        if ( 0.0 >= options.dblRate ) {
+          std::cout << "rate needs to be positive, or max" << std::endl;
+          return EXIT_FAILURE;
+        }
+      }
+    }
+
+    if ( "serve" == sMode ) {
+      options.nPort = Count( argc, argv, 4, options.nPort );
+      const replay::Frames frames( sFileName );
+      ou::ReplayServer server( frames.Frame(), options );
+      std::cout << "serving " << frames.Frame().size() << " frames on ws://127.0.0.1:" << server.Port() << "/ws" << std::endl;
+      server.Run();
+      return EXIT_SUCCESS;
+    }
+
+    if ( "bench" == sMode ) {
+      const bool bSynth( "synth" == sFileName );
+      ESequence eSequence( bSynth ? ESequence::Contiguous : ESequence::Increasing );
+      if ( 5 <= argc ) {
+        const std::string sSequence( argv[ 4 ] );
+        if ( "contiguous" == sSequence ) eSequence = ESequence::Contiguous;
+        else {
+          if ( "increasing" == sSequence ) eSequence = ESequence::Increasing;
+          else {
+            Usage();
+            return EXIT_FAILURE;
+          }
+        }
+      }
+      if ( bSynth ) {
+        return replay::Bench( replay::Frames( replay::Frames::Synth() ), options, eSequence );
+      }
+      return replay::Bench( replay::Frames( sFileName ), options, eSequence );
+    }
+
+    Usage();
+    return EXIT_FAILURE;
+  }
+  catch ( const std::exception& e ) {
+    std::cout << "PhemexReplay: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+}
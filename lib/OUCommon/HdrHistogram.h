@@ -0,0 +1,125 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    HdrHistogram.h
+ * Author:  raymond@burkholder.net
+ * Project: lib/OUCommon
+ * Created: October 19, 2026 20:10
+ */
+
+#pragma once
+
+// log-linear histogram of non-negative integers, in the style of HdrHistogram:
+//   values below 32 are exact, above that each power of two is split into 32 buckets,
+//   so a reported value is within about 3% of the recorded one, up to 2^40 (18 minutes of nanoseconds)
+// single writer: Record is a relaxed load and store, no read-modify-write,
+//   other threads may read (Merge, ValueAtQuantile) at any time and see a near current picture
+
+#include <atomic>
+#include <cstdint>
+#include <algorithm>
+
+namespace ou { // One Unified
+
+class HdrHistogram {
+public:
+
+  using value_t = std::uint64_t;
+  using count_t = std::uint64_t;
+
+  static constexpr unsigned c_nSubBits = 5;
+  static constexpr unsigned c_nSub = 1u << c_nSubBits;
+  static constexpr unsigned c_nMaxBits = 40;
+  static constexpr value_t c_nMaxValue = ( value_t( 1 ) << c_nMaxBits ) - 1;
+  static constexpr unsigned c_nBuckets = c_nSub + ( c_nMaxBits - c_nSubBits ) * c_nSub;
+
+  HdrHistogram() { Reset(); }
+  HdrHistogram( const HdrHistogram& ) = delete;
+  HdrHistogram& operator=( const HdrHistogram& ) = delete;
+
+  void Record( value_t value ) {
+    value = std::min( value, c_nMaxValue );
+    Bump( m_count[ Bucket( value ) ], 1 );
+    Bump( m_nTotal, 1 );
+    if ( value > m_nMax.load( std::memory_order_relaxed ) ) m_nMax.store( value, std::memory_order_relaxed );
+  }
+
+  // from other threads: accumulates a snapshot of rhs into this, which must not be shared at the time
+  void Merge( const HdrHistogram& rhs ) {
+    for ( unsigned ix = 0; ix < c_nBuckets; ix++ ) {
+      const count_t n = rhs.m_count[ ix ].load( std::memory_order_relaxed );
+      if ( 0 < n ) Bump( m_count[ ix ], n );
+    }
+    Bump( m_nTotal, rhs.m_nTotal.load( std::memory_order_relaxed ) );
+    m_nMax.store( std::max( m_nMax.load( std::memory_order_relaxed ), rhs.m_nMax.load( std::memory_order_relaxed ) ), std::memory_order_relaxed );
+  }
+
+  void Reset() {
+    for ( std::atomic<count_t>& count: m_count ) count.store( 0, std::memory_order_relaxed );
+    m_nTotal.store( 0, std::memory_order_relaxed );
+    m_nMax.store( 0, std::memory_order_relaxed );
+  }
+
+  count_t Count() const { return m_nTotal.load( std::memory_order_relaxed ); }
+  value_t Max() const { return m_nMax.load( std::memory_order_relaxed ); }
+
+  // highest value equivalent to the bucket holding the quantile, 0 <= quantile <= 1
+  value_t ValueAtQuantile( double quantile ) const {
+    count_t nTotal {};
+    for ( const std::atomic<count_t>& count: m_count ) nTotal += count.load( std::memory_order_relaxed );
+    if ( 0 == nTotal ) return 0;
+    const count_t nTarget = std::max<count_t>( 1, (count_t)( quantile * (double)nTotal + 0.5 ) );
+    count_t nSeen {};
+    for ( unsigned ix = 0; ix < c_nBuckets; ix++ ) {
+      nSeen += m_count[ ix ].load( std::memory_order_relaxed );
+      if ( nSeen >= nTarget ) {
+        return std::min( Max(), HighestEquivalent( ix ) );
+      }
+    }
+    return Max();
+  }
+
+  static unsigned Bucket( value_t value ) {
+    if ( value < c_nSub ) return (unsigned)value;
+    const unsigned msb = 63 - __builtin_clzll( value );
+    const unsigned shift = msb - c_nSubBits;
+    return c_nSub + shift * c_nSub + (unsigned)( ( value >> shift ) & ( c_nSub - 1 ) );
+  }
+
+  static value_t LowestEquivalent( unsigned ix ) {
+    if ( ix < c_nSub ) return ix;
+    const unsigned shift = ( ix - c_nSub ) / c_nSub;
+    const value_t sub = ( ix - c_nSub ) % c_nSub;
+    return ( c_nSub + sub ) << shift;
+  }
+
+  static value_t HighestEquivalent( unsigned ix ) {
+    if ( ix < c_nSub ) return ix;
+    const unsigned shift = ( ix - c_nSub ) / c_nSub;
+    return LowestEquivalent( ix ) + ( value_t( 1 ) << shift ) - 1;
+  }
+
+private:
+
+  std::atomic<count_t> m_count[ c_nBuckets ];
+  std::atomic<count_t> m_nTotal;
+  std::atomic<value_t> m_nMax;
+
+  static void Bump( std::atomic<count_t>& count, count_t n ) {
+    count.store( count.load( std::memory_order_relaxed ) + n, std::memory_order_relaxed );
+  }
+};
+
+} // namespace ou
@@ -0,0 +1,117 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    JsonScan.h
+ * Author:  raymond@burkholder.net
+ * Project: lib/OUCommon
+ * Created: October 21, 2026 10:05
+ */
+
+#pragma once
+
+// scanner primitives for decoding json frames in place, as used by the alpaca and phemex stream decoders
+//   p is the cursor, e is one past the end of the frame, each call advances p past what it consumed
+//   leading white space is passed over, nothing is allocated, strings are returned as views into the frame
+
+#include <charconv>
+#include <string_view>
+
+namespace ou { // One Unified
+namespace json_scan {
+
+inline void Space( const char*& p, const char* e ) {
+  while ( ( p < e ) && ( ( ' ' == *p ) || ( '\n' == *p ) || ( '\r' == *p ) || ( '\t' == *p ) ) ) ++p;
+}
+
+inline bool Expect( const char*& p, const char* e, char ch ) {
+  Space( p, e );
+  if ( ( p < e ) && ( ch == *p ) ) {
+    ++p;
+    return true;
+  }
+  return false;
+}
+
+// the view excludes the quotes, escapes are passed over but left in place
+inline bool String( const char*& p, const char* e, std::string_view& sv ) {
+  if ( !Expect( p, e, '"' ) ) return false;
+  const char* begin( p );
+  while ( p < e ) {
+    switch ( *p ) {
+      case '"':
+        sv = std::string_view( begin, p - begin );
+        ++p;
+        return true;
+      case '\\':
+        p += 2;
+        break;
+      default:
+        ++p;
+        break;
+    }
+  }
+  return false;
+}
+
+// integral or floating point, as std::from_chars parses it
+template<typename T>
+inline bool Number( const char*& p, const char* e, T& value ) {
+  Space( p, e );
+  const std::from_chars_result result( std::from_chars( p, e, value ) );
+  if ( std::errc() != result.ec ) return false;
+  p = result.ptr;
+  return true;
+}
+
+// any value: string, number, literal, or nested array / object
+//   stops ahead of the ',' , '}' or ']' which follows it
+inline bool Skip( const char*& p, const char* e ) {
+  size_t nDepth {};
+  std::string_view sv;
+  Space( p, e );
+  while ( p < e ) {
+    switch ( *p ) {
+      case '"':
+        if ( !String( p, e, sv ) ) return false;
+        break;
+      case '[':
+      case '{':
+        ++nDepth;
+        ++p;
+        break;
+      case ']':
+      case '}':
+        if ( 0 == nDepth ) return true; // belongs to the enclosing object
+        --nDepth;
+        ++p;
+        break;
+      case ',':
+        if ( 0 == nDepth ) return true;
+        ++p;
+        break;
+      default:
+        ++p;
+        break;
+    }
+    if ( 0 == nDepth ) {
+      Space( p, e );
+      if ( ( p < e ) && ( ( ',' == *p ) || ( '}' == *p ) || ( ']' == *p ) ) ) return true;
+    }
+  }
+  return false;
+}
+
+} // namespace json_scan
+} // namespace ou
@@ -0,0 +1,222 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    LatencyTrace.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/OUCommon
+ * Created: October 19, 2026 20:10
+ */
+
+#include <mutex>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <iomanip>
+#include <fstream>
+#include <iostream>
+#include <condition_variable>
+
+#include "LatencyTrace.h"
+
+namespace ou { // One Unified
+namespace latency {
+
+namespace {
+
+  // tables and histograms are never released, a thread may exit before its counts are dumped
+  struct Registry {
+    std::mutex mutex;
+    std::vector<std::string> vStage;
+    std::vector<std::string> vClass;
+    std::vector<detail::Table*> vTable;
+    Registry() {
+      vClass.push_back( "unknown" ); // c_classUnknown
+    }
+  };
+
+  Registry& Instance() {
+    static Registry* pRegistry = new Registry;
+    return *pRegistry;
+  }
+
+  std::size_t Register( std::vector<std::string>& vName, const std::string& sName, std::size_t nMax, const char* szKind ) {
+    for ( std::size_t ix = 0; ix < vName.size(); ix++ ) {
+      if ( sName == vName[ ix ] ) return ix;
+    }
+    if ( nMax == vName.size() ) {
+      std::cout << "latency: too many " << szKind << "s, " << sName << " shares " << vName.back() << std::endl;
+      return nMax - 1;
+    }
+    vName.push_back( sName );
+    return vName.size() - 1;
+  }
+
+  struct Periodic {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::thread thread;
+    bool bStop;
+    Periodic(): bStop( false ) {}
+  };
+
+  Periodic& PeriodicInstance() {
+    static Periodic* pPeriodic = new Periodic;
+    return *pPeriodic;
+  }
+
+  void Emit( std::ostream& stream, EFormat format, const std::string& sStage, const std::string& sClass, const HdrHistogram& histogram ) {
+    switch ( format ) {
+      case EFormat::Text:
+        stream
+          << std::left << std::setw( 24 ) << sStage
+          << std::setw( 12 ) << sClass
+          << std::right
+          << std::setw( 12 ) << histogram.Count()
+          << std::setw( 12 ) << histogram.ValueAtQuantile( 0.50 )
+          << std::setw( 12 ) << histogram.ValueAtQuantile( 0.99 )
+          << std::setw( 12 ) << histogram.ValueAtQuantile( 0.999 )
+          << std::setw( 12 ) << histogram.Max()
+          << '\n';
+        break;
+      case EFormat::Json:
+        stream
+          << "{\"stage\":\"" << sStage << "\""
+          << ",\"class\":\"" << sClass << "\""
+          << ",\"count\":" << histogram.Count()
+          << ",\"p50\":" << histogram.ValueAtQuantile( 0.50 )
+          << ",\"p99\":" << histogram.ValueAtQuantile( 0.99 )
+          << ",\"p999\":" << histogram.ValueAtQuantile( 0.999 )
+          << ",\"max\":" << histogram.Max()
+          << "}\n";
+        break;
+    }
+  }
+
+} // namespace anonymous
+
+stage_t Stage( const std::string& sName ) {
+  Registry& registry( Instance() );
+  std::lock_guard<std::mutex> lock( registry.mutex );
+  return (stage_t)Register( registry.vStage, sName, c_nStages, "stage" );
+}
+
+class_t Class( const std::string& sName ) {
+  Registry& registry( Instance() );
+  std::lock_guard<std::mutex> lock( registry.mutex );
+  return (class_t)Register( registry.vClass, sName, c_nClasses, "class" );
+}
+
+HdrHistogram& detail::Allocate( stage_t idStage, class_t idClass ) {
+  if ( nullptr == pTable ) {
+    pTable = new Table;
+    for ( auto& row: pTable->histogram ) {
+      for ( std::atomic<HdrHistogram*>& p: row ) p.store( nullptr, std::memory_order_relaxed );
+    }
+    Registry& registry( Instance() );
+    std::lock_guard<std::mutex> lock( registry.mutex );
+    registry.vTable.push_back( pTable );
+  }
+  HdrHistogram* pHistogram = new HdrHistogram;
+  pTable->histogram[ idStage ][ idClass ].store( pHistogram, std::memory_order_release );
+  return *pHistogram;
+}
+
+void Dump( std::ostream& stream, EFormat format ) {
+
+  Registry& registry( Instance() );
+  std::lock_guard<std::mutex> lock( registry.mutex );
+
+  if ( EFormat::Text == format ) {
+    stream
+      << std::left << std::setw( 24 ) << "latency (ns) stage"
+      << std::setw( 12 ) << "class"
+      << std::right
+      << std::setw( 12 ) << "count"
+      << std::setw( 12 ) << "p50"
+      << std::setw( 12 ) << "p99"
+      << std::setw( 12 ) << "p99.9"
+      << std::setw( 12 ) << "max"
+      << '\n';
+  }
+
+  for ( std::size_t ixStage = 0; ixStage < registry.vStage.size(); ixStage++ ) {
+    HdrHistogram all;
+    for ( std::size_t ixClass = 0; ixClass < registry.vClass.size(); ixClass++ ) {
+      HdrHistogram merged;
+      for ( const detail::Table* pTable: registry.vTable ) {
+        const HdrHistogram* pHistogram = pTable->histogram[ ixStage ][ ixClass ].load( std::memory_order_acquire );
+        if ( nullptr != pHistogram ) merged.Merge( *pHistogram );
+      }
+      if ( 0 < merged.Count() ) {
+        Emit( stream, format, registry.vStage[ ixStage ], registry.vClass[ ixClass ], merged );
+        all.Merge( merged );
+      }
+    }
+    if ( 0 < all.Count() ) {
+      Emit( stream, format, registry.vStage[ ixStage ], "all", all );
+    }
+  }
+  stream.flush();
+}
+
+void Reset() {
+  Registry& registry( Instance() );
+  std::lock_guard<std::mutex> lock( registry.mutex );
+  for ( detail::Table* pTable: registry.vTable ) {
+    for ( auto& row: pTable->histogram ) {
+      for ( std::atomic<HdrHistogram*>& p: row ) {
+        HdrHistogram* pHistogram = p.load( std::memory_order_acquire );
+        if ( nullptr != pHistogram ) pHistogram->Reset();
+      }
+    }
+  }
+}
+
+void StartPeriodicDump( std::chrono::seconds interval, const std::string& sJsonFileName, bool bResetAfterDump ) {
+  StopPeriodicDump();
+  Periodic& periodic( PeriodicInstance() );
+  periodic.bStop = false;
+  periodic.thread = std::thread(
+    [&periodic,interval,sJsonFileName,bResetAfterDump](){
+      std::ofstream ofs( sJsonFileName, std::ios::app );
+      std::unique_lock<std::mutex> lock( periodic.mutex );
+      while ( !periodic.cv.wait_for( lock, interval, [&periodic](){ return periodic.bStop; } ) ) {
+        Dump( std::cout, EFormat::Text );
+        if ( ofs.is_open() ) {
+          ofs
+            << "{\"dump\":" << std::chrono::duration_cast<std::chrono::seconds>(
+                 std::chrono::system_clock::now().time_since_epoch() ).count()
+            << "}\n";
+          Dump( ofs, EFormat::Json );
+        }
+        if ( bResetAfterDump ) Reset();
+      }
+    } );
+}
+
+void StopPeriodicDump() {
+  Periodic& periodic( PeriodicInstance() );
+  if ( periodic.thread.joinable() ) {
+    {
+      std::lock_guard<std::mutex> lock( periodic.mutex );
+      periodic.bStop = true;
+    }
+    periodic.cv.notify_one();
+    periodic.thread.join();
+  }
+}
+
+} // namespace latency
+} // namespace ou
@@ -0,0 +1,121 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    LatencyTrace.h
+ * Author:  raymond@burkholder.net
+ * Project: lib/OUCommon
+ * Created: October 19, 2026 20:10
+ */
+
+#pragma once
+
+// per stage latency of a message, from the socket read which delivered it
+//   Network<> marks the receive time, later hops record the elapsed time at their stage,
+//   into per thread HdrHistograms, by stage and by symbol class (instrument type, set at decode)
+//   the receive time travels with the thread, so hops posted to a strand are not traced
+// compiled in with -DTF_LATENCY_TRACE (cmake -DTF_LATENCY_TRACE=ON), otherwise the macros are empty
+// Dump writes p50/p99/p99.9/max per stage and class, as text or as json lines,
+//   StartPeriodicDump does so on an interval from its own thread
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <cstdint>
+#include <ostream>
+
+#include "HdrHistogram.h"
+
+namespace ou { // One Unified
+namespace latency {
+
+using stage_t = std::uint8_t;
+using class_t = std::uint8_t;
+
+static constexpr std::size_t c_nStages = 16;
+static constexpr std::size_t c_nClasses = 16;
+static constexpr class_t c_classUnknown = 0; // before the symbol is known
+
+stage_t Stage( const std::string& sName ); // registered once, by name
+class_t Class( const std::string& sName );
+
+enum class EFormat { Text, Json };
+void Dump( std::ostream&, EFormat );
+void Reset(); // approximate when threads are recording
+
+void StartPeriodicDump( std::chrono::seconds interval, const std::string& sJsonFileName, bool bResetAfterDump = false );
+void StopPeriodicDump();
+
+namespace detail {
+
+  using clock_t = std::chrono::steady_clock;
+
+  struct Context {
+    clock_t::time_point tpReceived;
+    class_t idClass;
+    bool bActive;
+  };
+
+  struct Table {
+    std::atomic<HdrHistogram*> histogram[ c_nStages ][ c_nClasses ];
+  };
+
+  inline thread_local Context context {};
+  inline thread_local Table* pTable = nullptr;
+
+  HdrHistogram& Allocate( stage_t, class_t ); // first record of a stage and class on this thread
+
+  inline void Received() {
+    context.tpReceived = clock_t::now();
+    context.idClass = c_classUnknown;
+    context.bActive = true;
+  }
+
+  inline void Done() {
+    context.bActive = false;
+  }
+
+  inline void SetClass( class_t idClass ) {
+    context.idClass = idClass;
+  }
+
+  inline void Record( stage_t idStage ) {
+    if ( context.bActive ) {
+      const std::int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>( clock_t::now() - context.tpReceived ).count();
+      HdrHistogram* pHistogram = ( nullptr == pTable ) ? nullptr : pTable->histogram[ idStage ][ context.idClass ].load( std::memory_order_relaxed );
+      if ( nullptr == pHistogram ) pHistogram = &Allocate( idStage, context.idClass );
+      pHistogram->Record( (HdrHistogram::value_t)ns );
+    }
+  }
+
+} // namespace detail
+
+} // namespace latency
+} // namespace ou
+
+#if defined( TF_LATENCY_TRACE )
+  #define TF_LATENCY_RECEIVED() ou::latency::detail::Received()
+  #define TF_LATENCY_DONE() ou::latency::detail::Done()
+  #define TF_LATENCY_CLASS( idClass ) ou::latency::detail::SetClass( idClass )
+  #define TF_LATENCY_STAGE( name ) \
+    do { \
+      static const ou::latency::stage_t idStage_ = ou::latency::Stage( name ); \
+      ou::latency::detail::Record( idStage_ ); \
+    } while ( false )
+#else
+  #define TF_LATENCY_RECEIVED() do {} while ( false )
+  #define TF_LATENCY_DONE() do {} while ( false )
+  #define TF_LATENCY_CLASS( idClass ) do {} while ( false )
+  #define TF_LATENCY_STAGE( name ) do {} while ( false )
+#endif
@@ -0,0 +1,153 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    LoserTree.h
+ * Author:  raymond@burkholder.net
+ * Project: lib/OUCommon
+ * Created: October 19, 2026 09:12
+ */
+
+#pragma once
+
+#include <limits>
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <cassert>
+
+// https://en.wikipedia.org/wiki/K-way_merge_algorithm#Tournament_Tree
+// Knuth, TAOCP Vol 3, 5.4.1 replacement selection, tree of losers
+
+// each internal node holds the index of the source which lost the match at that node,
+//   the overall winner is held separately.  After the winner's key changes, only the
+//   path from the winner's leaf to the root is replayed: log2(n) comparisons, no swaps.
+// keys are plain int64, ties are resolved by lower source index, so ordering is deterministic.
+// a source is retired by setting its key to KeyExhausted(), it then never wins again.
+
+namespace ou { // One Unified
+
+class LoserTree {
+public:
+
+  using key_t = std::int64_t;
+
+  static constexpr key_t KeyExhausted() { return std::numeric_limits<key_t>::max(); }
+
+  LoserTree(): m_nSources( 0 ), m_nLeaves( 0 ), m_bRunning( false ) {}
+
+  // all keys start exhausted, assign with SetKey, then Build
+  void Reset( std::size_t nSources ) {
+    m_nSources = nSources;
+    m_nLeaves = 1;
+    while ( m_nLeaves < nSources ) m_nLeaves <<= 1;
+    m_vKey.assign( m_nLeaves, KeyExhausted() );
+    m_vNode.assign( m_nLeaves, Entry() );
+    m_winner = Entry();
+    m_bRunning = false;
+  }
+
+  void SetKey( std::size_t ix, key_t key ) {
+    assert( ix < m_nSources );
+    m_vKey[ ix ] = key;
+  }
+
+  void Build() {
+    if ( 0 < m_nSources ) {
+      m_winner = Build( 1 );
+    }
+    m_bRunning = false;
+  }
+
+  std::size_t Size() const { return m_nSources; }
+  bool Empty() const { return KeyExhausted() == m_winner.key; }
+
+  std::size_t Winner() const { return m_winner.ix; }
+  key_t WinnerKey() const { return m_winner.key; }
+
+  // the second best source is the best of the losers on the winner's path,
+  //   the winner may keep supplying items ordering ahead of keyBound,
+  //   bTieWins indicates the winner also takes an equal key.
+  // Only worth the walk when the winner is running, ie, the last Replay left it in place
+  bool Running() const { return m_bRunning; }
+  void Bound( key_t& keyBound, bool& bTieWins ) const {
+    Entry best( KeyExhausted(), m_winner.ix ); // a lone source has no competition
+    for ( std::size_t node = ( m_nLeaves + m_winner.ix ) >> 1; 0 != node; node >>= 1 ) {
+      const Entry& entry( m_vNode[ node ] );
+      if ( Less( entry, best ) ) best = entry;
+    }
+    keyBound = best.key;
+    bTieWins = ( m_winner.ix < best.ix ) && ( KeyExhausted() != best.key );
+  }
+
+  // winner has a new key (possibly KeyExhausted()), replay its path to the root
+  void Replay( key_t key ) {
+    const std::size_t ixWinner( m_winner.ix );
+    Entry winner( key, ixWinner );
+    for ( std::size_t node = ( m_nLeaves + ixWinner ) >> 1; 0 != node; node >>= 1 ) {
+      Entry& loser( m_vNode[ node ] );
+      if ( Less( loser, winner ) ) {
+        std::swap( loser, winner );
+      }
+    }
+    m_winner = winner;
+    m_bRunning = ( ixWinner == winner.ix );
+  }
+
+protected:
+private:
+
+  // key is held with the index so a replay does not chase indices into a key vector
+  struct Entry {
+    key_t key;
+    std::size_t ix;
+    Entry(): key( KeyExhausted() ), ix( 0 ) {}
+    Entry( key_t key_, std::size_t ix_ ): key( key_ ), ix( ix_ ) {}
+  };
+
+  std::size_t m_nSources;
+  std::size_t m_nLeaves; // power of two, unused leaves remain exhausted
+
+  Entry m_winner;
+
+  bool m_bRunning; // last Replay retained the winner
+
+  std::vector<key_t> m_vKey;  // indexed by source, initial keys for Build
+  std::vector<Entry> m_vNode; // losers, indexed by internal node, [0] unused
+
+  static inline bool Less( const Entry& a, const Entry& b ) {
+    return ( a.key < b.key ) || ( ( a.key == b.key ) && ( a.ix < b.ix ) );
+  }
+
+  // returns winner of the sub-tree, records losers on the way back up
+  Entry Build( std::size_t node ) {
+    if ( node >= m_nLeaves ) {
+      const std::size_t ix( node - m_nLeaves );
+      return Entry( m_vKey[ ix ], ix );
+    }
+    const Entry left = Build( 2 * node );
+    const Entry right = Build( 2 * node + 1 );
+    if ( Less( left, right ) ) {
+      m_vNode[ node ] = right;
+      return left;
+    }
+    else {
+      m_vNode[ node ] = left;
+      return right;
+    }
+  }
+
+};
+
+} // namespace ou
@@ -27,6 +27,8 @@
 #include <OUCommon/Debug.h>
 
 #include "ReusableBuffers.h"
+#include "NetworkCapture.h"
+#include "LatencyTrace.h"
 
 // example timeout code
 // http://www.boost.org/doc/libs/1_43_0/doc/html/boost_asio/example/timeouts/connect_timeout.cpp
@@ -117,6 +119,10 @@ protected:
   void OnNetworkLineBuffer( linebuffer_t* ) {};  // new line available for processing
   void OnNetworkSendDone() {};
 
+  // splits received bytes into lines on 0x0a, 0x0d is dropped, each line goes to OnNetworkLineBuffer
+  //   called by OnReadDone, and directly to measure or replay the framing without a socket
+  void FrameLines( const bufferelement_t* input, std::size_t bytes_transferred );
+
 private:
 
   enum enumNetworkState {
@@ -155,6 +161,8 @@ private:
   size_t m_cntSends;
   size_t m_cntBytesTransferred_send;
 
+  NetworkCapture::stream_t m_nCaptureStream; // non-zero when inbound bytes are being recorded
+
   void OnConnectDone( const boost::system::error_code& error );
   void OnNetDisconnecting( void);
   void OnSendDoneCommon( const boost::system::error_code& error, std::size_t bytes_transferred, linebuffer_t* );
@@ -183,6 +191,7 @@ Network<ownerT,charT>::Network()
   m_cntSends( 0 ), m_cntBytesTransferred_send( 0 ),
   m_cntLinesProcessed( 0 ),
   m_cntActiveSends( 0 ), m_lReadProgress( 0 ),
+  m_nCaptureStream( 0 ),
   m_timer( m_io )
 {
   CommonConstruction();
@@ -202,6 +211,7 @@ Network<ownerT,charT>::Network( const structConnection& connection )
   m_cntSends( 0 ), m_cntBytesTransferred_send( 0 ),
   m_cntLinesProcessed( 0 ),
   m_cntActiveSends( 0 ), m_lReadProgress( 0 ),
+  m_nCaptureStream( 0 ),
   m_timer( m_io )
 
 {
@@ -222,6 +232,7 @@ Network<ownerT,charT>::Network( const ipaddress_t& sAddress, port_t nPort )
   m_cntSends( 0 ), m_cntBytesTransferred_send( 0 ),
   m_cntLinesProcessed( 0 ),
   m_cntActiveSends( 0 ), m_lReadProgress( 0 ),
+  m_nCaptureStream( 0 ),
   m_timer( m_io )
 {
   CommonConstruction();
@@ -371,6 +382,8 @@ void Network<ownerT,charT>::OnConnectDone( const boost::system::error_code& erro
 
     m_stateNetwork = NS_CONNECTED;
 
+    m_nCaptureStream = NetworkCapture::Attach( m_Connection.nPort );
+
     if ( &Network<ownerT, charT>::OnNetworkConnected != &ownerT::OnNetworkConnected ) {
       static_cast<ownerT*>( this )->OnNetworkConnected();
     }
@@ -478,57 +491,76 @@ void Network<ownerT,charT>::OnReadDone( const boost::system::error_code& error,
   else {
     assert( ( NS_CONNECTED == m_stateNetwork ) || ( NS_DISCONNECTING == m_stateNetwork) );
 
+    TF_LATENCY_RECEIVED(); // lines in this buffer are timed from here
+
     ++m_cntAsyncReads;
     m_cntBytesTransferred_input += bytes_transferred;
 
+    if ( 0 != m_nCaptureStream ) {
+      NetworkCapture::Write( m_nCaptureStream, m_Connection.nPort, pbuffer->data(), bytes_transferred );
+    }
+
     AsyncRead();  // set up for another read while processing existing buffer
 
-    // process the buffer:
-    // need current linebuffer, need stats on how often it waits for subsequent bulk data
-    bufferelement_t ch;
-    typename inputbuffer_t::const_iterator input = pbuffer->begin();
-    while ( 0 != bytes_transferred ) {
-      ch = *input;
-      ++input;
-      if ( 0 == ch ) {
-//        OutputDebugString( "Network::ReadHandler: have a 0x00 character.\n" );
-      }
-      if ( 0x0a == ch ) {
-        // send the buffer off
-        try {
-          if ( &Network<ownerT, charT>::OnNetworkLineBuffer != &ownerT::OnNetworkLineBuffer ) {
-            static_cast<ownerT*>( this )->OnNetworkLineBuffer( m_pline );
-          }
-        }
-        catch( const std::logic_error& e ) {
-          std::cerr << "Network<>::OnReadDone caught: " << e.what() << std::endl;
-        }
-        catch(...) {
-          std::cerr << "Network<>::OnReadDone default exception handler" << std::endl;
-        }
-        ++m_cntLinesProcessed;
-        // and allocate another buffer
-        m_pline = m_reposLineBuffers.CheckOutL();
-        m_pline->clear();
-      }
-      else {
-        if ( 0x0d == ch ) {
-          // ignore the character
-        }
-        else {
-          m_pline->push_back( ch );
-        }
-      }
-      --bytes_transferred;
-    } // end while
+    FrameLines( pbuffer->data(), bytes_transferred );
 
   }
   m_reposInputBuffers.CheckInL( pbuffer );
 
+  TF_LATENCY_DONE();
+
   //InterlockedDecrement( &m_lReadProgress );
   boost::interprocess::ipcdetail::atomic_dec32( &m_lReadProgress );
 }
 
+//
+// FrameLines
+//
+
+template <typename ownerT, typename charT>
+void Network<ownerT,charT>::FrameLines( const bufferelement_t* input, std::size_t bytes_transferred ) {
+
+  // process the buffer:
+  // need current linebuffer, need stats on how often it waits for subsequent bulk data
+  bufferelement_t ch;
+  while ( 0 != bytes_transferred ) {
+    ch = *input;
+    ++input;
+    if ( 0 == ch ) {
+//        OutputDebugString( "Network::ReadHandler: have a 0x00 character.\n" );
+    }
+    if ( 0x0a == ch ) {
+      // send the buffer off
+      try {
+        TF_LATENCY_STAGE( "network.line" );
+        if ( &Network<ownerT, charT>::OnNetworkLineBuffer != &ownerT::OnNetworkLineBuffer ) {
+          static_cast<ownerT*>( this )->OnNetworkLineBuffer( m_pline );
+        }
+      }
+      catch( const std::logic_error& e ) {
+        std::cerr << "Network<>::OnReadDone caught: " << e.what() << std::endl;
+      }
+      catch(...) {
+        std::cerr << "Network<>::OnReadDone default exception handler" << std::endl;
+      }
+      ++m_cntLinesProcessed;
+      // and allocate another buffer
+      m_pline = m_reposLineBuffers.CheckOutL();
+      m_pline->clear();
+    }
+    else {
+      if ( 0x0d == ch ) {
+        // ignore the character
+      }
+      else {
+        m_pline->push_back( ch );
+      }
+    }
+    --bytes_transferred;
+  } // end while
+
+}
+
 //
 // Send
 //
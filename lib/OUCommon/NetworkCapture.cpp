@@ -0,0 +1,170 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    NetworkCapture.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/OUCommon
+ * Created: October 19, 2026 18:10
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+#include "NetworkCapture.h"
+
+namespace ou { // One Unified
+
+const char NetworkCapture::c_szMagic[ 8 ] = { 'T', 'F', 'N', 'E', 'T', 'C', 'A', 'P' };
+const std::uint32_t NetworkCapture::c_nVersion = 2;
+
+static_assert( 24 == sizeof( NetworkCapture::Record ), "capture record header is written as is" );
+
+namespace {
+  struct RecordV1 { // 16 bit stream number, wrapped after 65535 connections
+    std::uint64_t nsReceived;
+    std::uint16_t nPort;
+    std::uint16_t nStream;
+    std::uint32_t nBytes;
+  };
+}
+
+NetworkCapture::NetworkCapture()
+: m_nStream {}, m_bEnvironmentChecked( false )
+{}
+
+// never destroyed, connections may still be closing during exit
+NetworkCapture& NetworkCapture::Instance() {
+  static NetworkCapture* pCapture = new NetworkCapture;
+  return *pCapture;
+}
+
+bool NetworkCapture::Open( const std::string& sFileName ) {
+  if ( m_ofs.is_open() ) m_ofs.close();
+  m_ofs.open( sFileName, std::ios::binary | std::ios::trunc );
+  if ( m_ofs.is_open() ) {
+    m_ofs.write( c_szMagic, sizeof( c_szMagic ) );
+    m_ofs.write( reinterpret_cast<const char*>( &c_nVersion ), sizeof( c_nVersion ) );
+    m_nStream = 0;
+    static bool bAtExit( false );
+    if ( !bAtExit ) { // the instance is not destroyed, so flush and close on the way out
+      bAtExit = true;
+      std::atexit( [](){ NetworkCapture::Stop(); } );
+    }
+    std::cout << "NetworkCapture: recording to " << sFileName << std::endl;
+    return true;
+  }
+  else {
+    std::cout << "NetworkCapture: could not open " << sFileName << std::endl;
+    return false;
+  }
+}
+
+bool NetworkCapture::Start( const std::string& sFileName ) {
+  NetworkCapture& capture( Instance() );
+  std::lock_guard<std::mutex> lock( capture.m_mutex );
+  capture.m_bEnvironmentChecked = true; // explicit start takes precedence
+  return capture.Open( sFileName );
+}
+
+void NetworkCapture::Stop() {
+  NetworkCapture& capture( Instance() );
+  std::lock_guard<std::mutex> lock( capture.m_mutex );
+  if ( capture.m_ofs.is_open() ) {
+    capture.m_ofs.close();
+  }
+}
+
+bool NetworkCapture::Active() {
+  NetworkCapture& capture( Instance() );
+  std::lock_guard<std::mutex> lock( capture.m_mutex );
+  return capture.m_ofs.is_open();
+}
+
+NetworkCapture::stream_t NetworkCapture::Attach( std::uint16_t nPort ) {
+  NetworkCapture& capture( Instance() );
+  std::lock_guard<std::mutex> lock( capture.m_mutex );
+  if ( !capture.m_bEnvironmentChecked ) {
+    capture.m_bEnvironmentChecked = true;
+    const char* szFileName = std::getenv( "TF_NETWORK_CAPTURE" );
+    if ( ( nullptr != szFileName ) && ( 0 != *szFileName ) ) {
+      capture.Open( szFileName );
+    }
+  }
+  if ( capture.m_ofs.is_open() ) {
+    if ( 0 == ++capture.m_nStream ) ++capture.m_nStream; // 0 is reserved for not captured
+    return capture.m_nStream;
+  }
+  return 0;
+}
+
+void NetworkCapture::Write( stream_t nStream, std::uint16_t nPort, const void* pData, std::size_t nBytes ) {
+  Record record {};
+  record.nsReceived = std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::system_clock::now().time_since_epoch() ).count();
+  record.nPort = nPort;
+  record.nStream = nStream;
+  record.nBytes = nBytes;
+  NetworkCapture& capture( Instance() );
+  std::lock_guard<std::mutex> lock( capture.m_mutex );
+  if ( capture.m_ofs.is_open() ) {
+    capture.m_ofs.write( reinterpret_cast<const char*>( &record ), sizeof( Record ) );
+    capture.m_ofs.write( reinterpret_cast<const char*>( pData ), nBytes );
+  }
+}
+
+NetworkCapture::Reader::Reader( const std::string& sFileName )
+: m_ifs( sFileName, std::ios::binary ), m_nVersion {}
+{
+  if ( !m_ifs.is_open() ) {
+    throw std::runtime_error( "NetworkCapture::Reader can not open " + sFileName );
+  }
+  char szMagic[ sizeof( c_szMagic ) ];
+  m_ifs.read( szMagic, sizeof( szMagic ) );
+  m_ifs.read( reinterpret_cast<char*>( &m_nVersion ), sizeof( m_nVersion ) );
+  if ( !m_ifs || ( 0 != std::memcmp( szMagic, c_szMagic, sizeof( c_szMagic ) ) ) || ( 1 > m_nVersion ) || ( c_nVersion < m_nVersion ) ) {
+    throw std::runtime_error( "NetworkCapture::Reader " + sFileName + " is not a capture file" );
+  }
+}
+
+bool NetworkCapture::Reader::Next( Record& record, std::vector<char>& vData ) {
+  bool bHeader( false );
+  if ( 1 == m_nVersion ) {
+    RecordV1 v1;
+    if ( m_ifs.read( reinterpret_cast<char*>( &v1 ), sizeof( RecordV1 ) ) ) {
+      record = Record {};
+      record.nsReceived = v1.nsReceived;
+      record.nStream = v1.nStream;
+      record.nBytes = v1.nBytes;
+      record.nPort = v1.nPort;
+      bHeader = true;
+    }
+  }
+  else {
+    bHeader = (bool)m_ifs.read( reinterpret_cast<char*>( &record ), sizeof( Record ) );
+  }
+  if ( bHeader ) {
+    vData.resize( record.nBytes );
+    if ( m_ifs.read( vData.data(), record.nBytes ) ) {
+      return true;
+    }
+    std::cout << "NetworkCapture::Reader truncated record, ignored" << std::endl;
+  }
+  return false;
+}
+
+} // namespace ou
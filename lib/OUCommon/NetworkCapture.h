@@ -0,0 +1,87 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    NetworkCapture.h
+ * Author:  raymond@burkholder.net
+ * Project: lib/OUCommon
+ * Created: October 19, 2026 18:10
+ */
+
+#pragma once
+
+// process wide capture of the raw bytes received by Network<>, with receive timestamps
+//   enabled with Start( file ), or by setting TF_NETWORK_CAPTURE=<file> in the environment,
+//   connections made after that are recorded, each as its own stream, tagged with the remote port
+//   used by IQFeedReplay to drive the real client code from a recorded session
+// file layout:
+//   "TFNETCAP", uint32 version, then records of: Record header followed by nBytes of data
+//   version 2 has a 32 bit stream number in a 24 byte header, Reader still accepts version 1 files
+
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <fstream>
+
+namespace ou { // One Unified
+
+class NetworkCapture {
+public:
+
+  using stream_t = std::uint32_t; // 0 is not captured
+
+  struct Record {
+    std::uint64_t nsReceived; // system clock, nanoseconds since the epoch
+    stream_t nStream;         // a connection, numbered in order of connect
+    std::uint32_t nBytes;
+    std::uint16_t nPort;      // remote port of the connection
+    std::uint16_t nReserved[ 3 ]; // zero
+  };
+
+  static bool Start( const std::string& sFileName );
+  static void Stop();
+  static bool Active();
+
+  // called by Network<> on connect, returns 0 when capture is not active
+  static stream_t Attach( std::uint16_t nPort );
+  static void Write( stream_t, std::uint16_t nPort, const void* pData, std::size_t nBytes );
+
+  class Reader {
+  public:
+    Reader( const std::string& sFileName ); // throws std::runtime_error on open or format failure
+    bool Next( Record&, std::vector<char>& ); // false at end of file
+  private:
+    std::ifstream m_ifs;
+    std::uint32_t m_nVersion;
+  };
+
+protected:
+private:
+
+  static const char c_szMagic[ 8 ];
+  static const std::uint32_t c_nVersion;
+
+  std::mutex m_mutex;
+  std::ofstream m_ofs;
+  stream_t m_nStream;
+  bool m_bEnvironmentChecked;
+
+  NetworkCapture();
+  static NetworkCapture& Instance();
+
+  bool Open( const std::string& sFileName ); // requires m_mutex
+};
+
+} // namespace ou
@@ -0,0 +1,131 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    ReplayServer.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/OUCommon
+ * Created: October 21, 2026 10:40
+ */
+
+#include <chrono>
+#include <iostream>
+
+#include <boost/beast/core.hpp>
+#include <boost/beast/websocket.hpp>
+
+#include "ReplayServer.h"
+
+namespace beast = boost::beast;
+namespace websocket = beast::websocket;
+using tcp = boost::asio::ip::tcp;
+
+namespace ou { // One Unified
+
+ReplayServer::ReplayServer( const vFrame_t& vFrame, const Options& options )
+: m_vFrame( vFrame ), m_options( options )
+, m_acceptor( m_context, tcp::endpoint( boost::asio::ip::make_address( "127.0.0.1" ), options.nPort ) )
+, m_bStop( false )
+{}
+
+ReplayServer::~ReplayServer() {
+  Stop();
+}
+
+std::uint16_t ReplayServer::Port() const {
+  return m_acceptor.local_endpoint().port();
+}
+
+void ReplayServer::Start() {
+  m_thread = std::thread( [this](){ Run(); } );
+}
+
+void ReplayServer::Stop() {
+  if ( !m_bStop.exchange( true ) ) {
+    // wake the blocking accept
+    boost::system::error_code ec;
+    tcp::socket socket( m_context );
+    socket.connect( m_acceptor.local_endpoint(), ec );
+  }
+  if ( m_thread.joinable() ) m_thread.join();
+}
+
+void ReplayServer::Run() {
+  while ( !m_bStop ) {
+    tcp::socket socket( m_context );
+    boost::system::error_code ec;
+    m_acceptor.accept( socket, ec );
+    if ( ec ) {
+      std::cout << "accept: " << ec.message() << std::endl;
+      break;
+    }
+    if ( m_bStop ) break;
+    Serve( std::move( socket ) );
+  }
+}
+
+void ReplayServer::Serve( tcp::socket&& socket ) {
+
+  using clock_t = std::chrono::steady_clock;
+
+  try {
+    socket.set_option( tcp::no_delay( true ) );
+    websocket::stream<tcp::socket> ws( std::move( socket ) );
+    ws.accept();
+    ws.text( true );
+
+    beast::flat_buffer buffer;
+    auto Request = [&ws,&buffer]()->std::string {
+      buffer.consume( buffer.size() );
+      ws.read( buffer );
+      return beast::buffers_to_string( buffer.data() );
+    };
+
+    for ( const Step& step: m_options.vStep ) {
+      if ( step.bRequest ) {
+        const std::string sRequest( Request() );
+        std::cout << "request: " << sRequest << std::endl;
+        if ( !step.sContains.empty() && ( std::string::npos == sRequest.find( step.sContains ) ) ) {
+          if ( !step.sRefused.empty() ) ws.write( boost::asio::buffer( step.sRefused ) );
+          ws.close( websocket::close_code::policy_error );
+          return;
+        }
+      }
+      ws.write( boost::asio::buffer( step.sReply ) );
+    }
+
+    const clock_t::time_point tpStart( clock_t::now() );
+    std::size_t nFrames {};
+    for ( const std::string& sFrame: m_vFrame ) {
+      if ( m_bStop ) break;
+      if ( 0.0 < m_options.dblRate ) {
+        std::this_thread::sleep_until(
+          tpStart + std::chrono::duration_cast<clock_t::duration>( std::chrono::duration<double>( nFrames / m_options.dblRate ) ) );
+      }
+      ws.write( boost::asio::buffer( sFrame ) );
+      nFrames++;
+    }
+    std::cout << "replayed " << nFrames << " frames" << std::endl;
+    if ( m_fReplayDone ) m_fReplayDone( nFrames );
+
+    while ( true ) Request(); // until the client closes, further requests are ignored
+  }
+  catch ( const beast::system_error& e ) {
+    if ( websocket::error::closed != e.code() ) {
+      std::cout << "session: " << e.code().message() << std::endl;
+    }
+  }
+}
+
+} // namespace ou
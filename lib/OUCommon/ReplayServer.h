@@ -0,0 +1,96 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    ReplayServer.h
+ * Author:  raymond@burkholder.net
+ * Project: lib/OUCommon
+ * Created: October 21, 2026 10:40
+ */
+
+#pragma once
+
+// stands in for a market data websocket on 127.0.0.1, plain websocket, one client at a time:
+//   plays the venue's handshake (greeting, authentication, subscription acknowledgement) as a list of steps,
+//   then writes every frame, in order, paced or as fast as the socket accepts,
+//   and holds the connection until the client closes, later requests are ignored
+// used by AlpacaReplay and PhemexReplay
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <functional>
+
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/io_context.hpp>
+
+namespace ou { // One Unified
+
+class ReplayServer {
+public:
+
+  using vFrame_t = std::vector<std::string>;
+
+  struct Step {
+    bool bRequest;         // read a request before the reply
+    std::string sContains; // the request needs to contain this, empty for any
+    std::string sReply;    // written after the request, or on its own
+    std::string sRefused;  // written, then the session closed, when the request does not match
+    Step( bool bRequest_, const std::string& sContains_, const std::string& sReply_, const std::string& sRefused_ = "" )
+    : bRequest( bRequest_ ), sContains( sContains_ ), sReply( sReply_ ), sRefused( sRefused_ ) {}
+  };
+  using vStep_t = std::vector<Step>;
+
+  struct Options {
+    std::uint16_t nPort; // 0 for any free port
+    double dblRate;      // frames per second, 0 is as fast as possible
+    vStep_t vStep;       // the handshake, ahead of the frames
+    Options(): nPort( 8765 ), dblRate( 0.0 ) {}
+  };
+
+  using fReplayDone_t = std::function<void( std::size_t nFrames )>; // server thread
+
+  ReplayServer( const vFrame_t&, const Options& ); // throws on bind
+  ~ReplayServer();
+
+  void Set( fReplayDone_t&& f ) { m_fReplayDone = std::move( f ); }
+
+  std::uint16_t Port() const;
+
+  void Run();   // serves on the calling thread, until Stop
+  void Start(); // serves on a thread
+  void Stop();
+
+protected:
+private:
+
+  using acceptor_t = boost::asio::ip::tcp::acceptor;
+
+  const vFrame_t& m_vFrame;
+  const Options m_options;
+
+  boost::asio::io_context m_context;
+  acceptor_t m_acceptor;
+
+  std::atomic<bool> m_bStop;
+  std::thread m_thread;
+
+  fReplayDone_t m_fReplayDone;
+
+  void Serve( boost::asio::ip::tcp::socket&& );
+};
+
+} // namespace ou
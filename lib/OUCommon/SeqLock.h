@@ -0,0 +1,97 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    SeqLock.h
+ * Author:  raymond@burkholder.net
+ * Project: lib/OUCommon
+ * Created: October 19, 2026 16:10
+ */
+
+#pragma once
+
+// https://en.wikipedia.org/wiki/Seqlock
+// Boehm, Can Seqlocks Get Along With Programming Language Memory Models? (2012)
+
+// single writer, any number of readers, neither side blocks the other:
+//   the writer makes the sequence odd, stores the value, then makes it even again
+//   a reader copies the value between two loads of the sequence, and retries on
+//   an odd or a changed sequence, so a copy which raced a store is discarded
+// the value type is copied while it may be changing, so needs to be a collection of plain fields
+//   with no owned pointers, such as the DatedDatum types.  A torn copy is never returned.
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace ou { // One Unified
+
+template<typename T>
+class SeqLock {
+public:
+
+  using version_t = std::uint64_t;
+
+  static_assert( std::is_nothrow_copy_assignable<T>::value, "SeqLock value needs a nothrow copy" );
+
+  SeqLock(): m_seq {} {}
+  explicit SeqLock( const T& value ): m_seq {}, m_value( value ) {}
+
+  SeqLock( const SeqLock& ) = delete;
+  SeqLock& operator=( const SeqLock& ) = delete;
+
+  // writer thread only
+  void Store( const T& value ) {
+    const version_t seq = m_seq.load( std::memory_order_relaxed );
+    m_seq.store( seq + 1, std::memory_order_relaxed );
+    std::atomic_thread_fence( std::memory_order_release );
+    m_value = value;
+    m_seq.store( seq + 2, std::memory_order_release );
+  }
+
+  // any thread, returns the version of the copy
+  version_t Load( T& value ) const {
+    version_t seq1;
+    version_t seq2;
+    do {
+      seq1 = m_seq.load( std::memory_order_acquire );
+      while ( 0 != ( seq1 & 1 ) ) { // store in progress
+        seq1 = m_seq.load( std::memory_order_acquire );
+      }
+      value = m_value;
+      std::atomic_thread_fence( std::memory_order_acquire );
+      seq2 = m_seq.load( std::memory_order_relaxed );
+    } while ( seq1 != seq2 );
+    return seq1 >> 1;
+  }
+
+  T Load() const {
+    T value;
+    Load( value );
+    return value;
+  }
+
+  // number of completed stores, without copying the value
+  version_t Version() const { return m_seq.load( std::memory_order_acquire ) >> 1; }
+
+  // writer thread only, or when otherwise synchronized with the writer
+  const T& Unsynchronized() const { return m_value; }
+
+protected:
+private:
+  std::atomic<version_t> m_seq; // odd while a store is in progress
+  T m_value;
+};
+
+} // namespace ou
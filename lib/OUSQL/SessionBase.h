@@ -69,6 +69,7 @@ template<class S, class T>
 void SessionBase<S,T>::Open( const std::string& sDbFileName, enumOpenFlags flags ) {
 
   if ( !m_bOpened ) {
+    m_sDbFileName = sDbFileName;
     if ( boost::filesystem::exists( sDbFileName ) ) {
       // open already created and loaded database
       dynamic_cast<S*>( this )->ImplOpen( sDbFileName, flags );
@@ -96,6 +97,7 @@ void SessionBase<S,T>::Close() {
     m_bOpened = false;
     static_cast<T*>( this )->DenitializeManagers();
     dynamic_cast<S*>( this )->ImplClose();
+    m_sDbFileName.clear();
   }
 }
 
@@ -43,6 +43,13 @@ void ISqlite3::SessionOpen( const std::string& sDbFileName, enumOpenFlags flags
     throw std::runtime_error( "Db open error" );
   }
 
+  // write ahead log: readers and the write-behind connection (WriteBehind.h) do not block each other,
+  //   a commit is an append to the log, synchronous=normal syncs at checkpoints rather than on each commit
+  //   https://sqlite.org/wal.html, https://sqlite.org/pragma.html#pragma_synchronous
+  sqlite3_busy_timeout( m_db, 5000 ); // ms, a second connection may hold the write lock for a group commit
+  Command( "pragma journal_mode=wal" );
+  Command( "pragma synchronous=normal" );
+
 }
 
 void ISqlite3::SessionClose( void ) {
@@ -60,6 +67,24 @@ void ISqlite3::SessionClose( void ) {
   }
 }
 
+void ISqlite3::Command( const std::string& sCommand ) {
+  char* szError( nullptr );
+  int rtn = sqlite3_exec( m_db, sCommand.c_str(), nullptr, nullptr, &szError );
+  if ( SQLITE_OK != rtn ) {
+    std::string sErr( "ISqlite3::Command: " );
+    sErr += sCommand;
+    sErr += " error(";
+    sErr += boost::lexical_cast<std::string>( rtn );
+    sErr += ")";
+    if ( nullptr != szError ) {
+      sErr += " ";
+      sErr += szError;
+      sqlite3_free( szError );
+    }
+    throw std::runtime_error( sErr );
+  }
+}
+
 void ISqlite3::PrepareStatement( structStatementState& statement, std::string& sStatement ) {
   sStatement += ";";
   int rtn = sqlite3_prepare_v2(
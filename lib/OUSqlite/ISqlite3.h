@@ -50,6 +50,8 @@ public:
   void SessionOpen( const std::string& sDbFileName, enumOpenFlags = EOpenFlagsZero );
   void SessionClose( void );
 
+  void Command( const std::string& sCommand ); // unprepared, no rows returned, eg pragma
+
   void PrepareStatement( structStatementState& statement, std::string& sStatement );
   bool ExecuteStatement( structStatementState& statement );  // true when row available
   void ResetStatement(   structStatementState& statement );
@@ -12,6 +12,9 @@
  * See the file LICENSE.txt for redistribution information.             *
  ************************************************************************/
 
+#include <iostream>
+#include <stdexcept>
+
 #include "Session.h"
 
 namespace ou {
@@ -23,6 +26,7 @@ Session::Session()
 }
 
 Session::~Session() {
+  DisableWriteBehind();
 }
 
 void Session::InitializeManagers() {
@@ -47,6 +51,48 @@ void Session::LoadTables() {
 
 void Session::DenitializeManagers() {
   OnDenitializeManagers( *this );
+  DisableWriteBehind(); // prior to the session's connection closing
+}
+
+void Session::EnableWriteBehind( std::chrono::milliseconds msInterval, std::size_t nRows ) {
+  if ( m_sDbFileName.empty() ) { // set as Open begins, the managers may enable from their load/populate handlers
+    throw std::runtime_error( "Session::EnableWriteBehind: session not open" );
+  }
+  if ( !m_pWriteBehind ) {
+    m_pWriteBehind = std::make_unique<WriteBehind>( m_sDbFileName, msInterval, nRows );
+  }
+}
+
+void Session::DisableWriteBehind() {
+  if ( m_pWriteBehind ) {
+    m_pWriteBehind->Stop();
+    const WriteBehind::Stats stats( m_pWriteBehind->GetStats() );
+    std::cout
+      << "Session write-behind: "
+      << stats.nWritten << " rows written, "
+      << stats.nFailed << " failed, "
+      << stats.nCommits << " commits, "
+      << stats.nDepthMax << " max depth, "
+      << stats.CommitMean().count() << "us mean commit, "
+      << stats.durCommitMax.count() << "us max commit"
+      << std::endl;
+    m_pWriteBehind.reset();
+  }
+}
+
+void Session::Flush() {
+  if ( m_pWriteBehind ) {
+    m_pWriteBehind->Flush();
+  }
+}
+
+WriteBehind::Stats Session::GetWriteBehindStats() const {
+  if ( m_pWriteBehind ) {
+    return m_pWriteBehind->GetStats();
+  }
+  else {
+    return WriteBehind::Stats();
+  }
 }
 
 } // db
@@ -14,12 +14,18 @@
 
 #pragma once
 
+#include <map>
+#include <chrono>
+#include <memory>
+#include <string>
+
 #include <OUCommon/Delegate.h>
 
 #include <OUSQL/SessionImpl.h>
 #include <OUSQL/SessionBase.h>
 
 #include "ISqlite3.h"
+#include "WriteBehind.h"
 
 // 2011/04/21
 // no in-session caching.  everything comes from the database.
@@ -56,8 +62,61 @@ public:
   void LoadTables();      // called by inherited SessionBase.h
   void DenitializeManagers();  // called by inherieted SessionBase.h
 
+  // write-behind persistence, see WriteBehind.h
+  //   call from an OnLoad/OnPopulate handler, or after Open, OrderManager enables it from its handlers,
+  //   rows are flushed and the worker stopped after OnDenitializeManagers on Close
+  void EnableWriteBehind(
+    std::chrono::milliseconds msInterval = std::chrono::milliseconds( 50 ),
+    std::size_t nRows = 256 );
+  void DisableWriteBehind();  // flushes
+  bool IsWriteBehind() const { return m_pWriteBehind ? true : false; }
+  void Flush();  // returns once queued rows are committed
+
+  // sSql is complete statement text, eg with the where clause
+  //   without write-behind, the statement is executed immediately, as with SQL<F>
+  template<class F>
+  void Queue( const std::string& sSql, const F& f ) {
+    if ( m_pWriteBehind ) {
+      m_pWriteBehind->Queue<F>( sSql, f );
+    }
+    else {
+      F row( f );
+      typename QueryFields<F>::pQueryFields_t pQuery = SQL<F>( sSql, row );
+    }
+  }
+
+  // as Insert<F>, requires MapRowDefToTableName<F>, supply any key, GetLastRowId is not available
+  template<class F>
+  void QueueInsert( const F& f ) {
+    Queue<F>( ComposeInsert<F>( f ), f );
+  }
+
+  WriteBehind::Stats GetWriteBehindStats() const;
+
 protected:
 private:
+
+  using pWriteBehind_t = std::unique_ptr<WriteBehind>;
+  pWriteBehind_t m_pWriteBehind;
+
+  using mapInsert_t = std::map<std::string, std::string>; // row type to composed insert statement
+  mapInsert_t m_mapInsert;
+
+  template<class F>
+  const std::string& ComposeInsert( const F& f ) {
+    const std::string sF( typeid( F ).name() );
+    mapInsert_t::iterator iter = m_mapInsert.find( sF );
+    if ( m_mapInsert.end() == iter ) {
+      F row( f );
+      ISqlite3::Action_Compose_Insert action( GetTableName<F>() );
+      row.Fields( action );
+      std::string sStatement;
+      action.ComposeStatement( sStatement );
+      iter = m_mapInsert.emplace( sF, sStatement ).first;
+    }
+    return iter->second;
+  }
+
 };
 
 
@@ -0,0 +1,168 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    WriteBehind.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/OUSqlite
+ * Created: October 19, 2026 17:20
+ */
+
+#include <vector>
+#include <iostream>
+#include <stdexcept>
+
+#include "WriteBehind.h"
+
+namespace ou {
+namespace db {
+
+WriteBehind::WriteBehind( const std::string& sDbFileName, std::chrono::milliseconds msInterval, std::size_t nRows )
+: m_msInterval( msInterval ), m_nRows( std::max<std::size_t>( 1, nRows ) )
+, m_bStop( false ), m_nFlushTarget( 0 )
+{
+  m_session.ImplOpen( sDbFileName ); // throws when the file is not present, tables are expected to exist
+  m_thread = std::thread( &WriteBehind::Worker, this );
+}
+
+WriteBehind::~WriteBehind() {
+  Stop();
+}
+
+void WriteBehind::Queue( fWrite_t&& fWrite ) {
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    if ( m_bStop ) {
+      m_stats.nFailed++;
+      std::cout << "WriteBehind::Queue: stopped, row discarded" << std::endl;
+      return;
+    }
+    m_dequeWrite.emplace_back( std::move( fWrite ) );
+    m_stats.nQueued++;
+    m_stats.nDepthMax = std::max( m_stats.nDepthMax, m_dequeWrite.size() );
+  }
+  m_cvQueued.notify_one();
+}
+
+void WriteBehind::Flush() {
+  std::unique_lock<std::mutex> lock( m_mutex );
+  const std::uint64_t nTarget( m_stats.nQueued );
+  m_nFlushTarget = std::max( m_nFlushTarget, nTarget );
+  m_cvQueued.notify_one();
+  m_cvWritten.wait( lock, [this,nTarget]{
+    return nTarget <= ( m_stats.nWritten + m_stats.nFailed );
+  } );
+}
+
+void WriteBehind::Stop() {
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    if ( m_bStop ) return;
+    m_bStop = true;
+  }
+  m_cvQueued.notify_one();
+  if ( m_thread.joinable() ) {
+    m_thread.join();  // worker drains the queue before exiting
+  }
+  m_mapStatement.clear(); // statements are finalized before the connection is closed
+  m_session.ImplClose();
+  m_cvWritten.notify_all();
+}
+
+WriteBehind::Stats WriteBehind::GetStats() const {
+  std::lock_guard<std::mutex> lock( m_mutex );
+  Stats stats( m_stats );
+  stats.nDepth = m_dequeWrite.size();
+  return stats;
+}
+
+void WriteBehind::Command( const std::string& sSql ) {
+  Write<NoBind>( sSql, NoBind() );
+}
+
+void WriteBehind::Worker() {
+
+  std::vector<fWrite_t> vBatch;
+  vBatch.reserve( m_nRows );
+
+  std::unique_lock<std::mutex> lock( m_mutex );
+
+  while ( true ) {
+
+    m_cvQueued.wait( lock, [this]{ return m_bStop || !m_dequeWrite.empty(); } );
+    if ( m_dequeWrite.empty() ) break; // stopped, and drained
+
+    // group commit: hold the batch open until it is full, the interval is up, or someone is waiting
+    const clock_t::time_point tpDeadline( clock_t::now() + m_msInterval );
+    m_cvQueued.wait_until( lock, tpDeadline, [this]{
+      return m_bStop
+        || ( m_nRows <= m_dequeWrite.size() )
+        || ( ( m_stats.nWritten + m_stats.nFailed ) < m_nFlushTarget );
+    } );
+
+    while ( !m_dequeWrite.empty() && ( vBatch.size() < m_nRows ) ) {
+      vBatch.emplace_back( std::move( m_dequeWrite.front() ) );
+      m_dequeWrite.pop_front();
+    }
+
+    lock.unlock();
+
+    const clock_t::time_point tpBegin( clock_t::now() );
+    std::uint64_t nWritten {};
+    std::uint64_t nFailed {};
+
+    try {
+      Command( "begin transaction" );
+      for ( fWrite_t& fWrite: vBatch ) {
+        try {
+          fWrite( *this );
+          nWritten++;
+        }
+        catch ( const std::exception& e ) {
+          nFailed++; // the row is dropped, the remainder of the batch is still committed
+          std::cout << "WriteBehind::Worker: row failed, " << e.what() << std::endl;
+        }
+      }
+      Command( "commit transaction" );
+    }
+    catch ( const std::exception& e ) {
+      std::cout << "WriteBehind::Worker: batch failed, " << e.what() << std::endl;
+      try {
+        Command( "rollback transaction" );
+      }
+      catch ( const std::exception& ) {}
+      nFailed += nWritten;
+      nWritten = 0;
+    }
+
+    const std::chrono::microseconds durCommit(
+      std::chrono::duration_cast<std::chrono::microseconds>( clock_t::now() - tpBegin ) );
+
+    vBatch.clear();
+
+    lock.lock();
+
+    m_stats.nWritten += nWritten;
+    m_stats.nFailed += nFailed;
+    m_stats.nCommits++;
+    m_stats.durCommitLast = durCommit;
+    m_stats.durCommitMax = std::max( m_stats.durCommitMax, durCommit );
+    m_stats.durCommitTotal += durCommit;
+
+    m_cvWritten.notify_all();
+  }
+}
+
+} // db
+} // ou
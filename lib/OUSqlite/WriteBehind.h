@@ -0,0 +1,168 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    WriteBehind.h
+ * Author:  raymond@burkholder.net
+ * Project: lib/OUSqlite
+ * Created: October 19, 2026 17:20
+ */
+
+// write-behind persistence for Session:
+//   callers queue a statement with a copy of its row, and return without touching the database
+//   a worker thread, on its own connection to the same file, drains the queue in group commits:
+//     one transaction per batch, closed after nRows rows or msInterval since the batch's first row
+//   statements are prepared once per statement text and row type, then reset and re-bound for each row
+//   Stop (and the destructor) drain whatever is queued, commit, then close the connection
+//   the database is in WAL mode (see ISqlite3::SessionOpen), so the session's own reads are not blocked
+
+// rows are applied in the order queued, but are not visible to the session's own queries until committed,
+//   Flush blocks until everything queued so far has been committed
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <deque>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <cstdint>
+#include <typeindex>
+#include <stdexcept>
+#include <functional>
+#include <condition_variable>
+
+#include <OUSQL/SessionImpl.h>
+
+#include "ISqlite3.h"
+
+namespace ou {
+namespace db {
+
+class WriteBehind {
+public:
+
+  using clock_t = std::chrono::steady_clock;
+
+  struct Stats {
+    std::size_t nDepth;         // rows queued, not yet written
+    std::size_t nDepthMax;
+    std::uint64_t nQueued;      // rows
+    std::uint64_t nWritten;     // rows committed
+    std::uint64_t nFailed;      // rows which could not be written
+    std::uint64_t nCommits;     // transactions
+    std::chrono::microseconds durCommitLast; // batch write through commit
+    std::chrono::microseconds durCommitMax;
+    std::chrono::microseconds durCommitTotal;
+    Stats()
+    : nDepth {}, nDepthMax {}, nQueued {}, nWritten {}, nFailed {}, nCommits {}
+    , durCommitLast {}, durCommitMax {}, durCommitTotal {}
+    {}
+    std::chrono::microseconds CommitMean() const {
+      return ( 0 == nCommits ) ? std::chrono::microseconds {} : std::chrono::microseconds( durCommitTotal.count() / (std::int64_t)nCommits );
+    }
+  };
+
+  WriteBehind(
+    const std::string& sDbFileName,
+    std::chrono::milliseconds msInterval = std::chrono::milliseconds( 50 ),
+    std::size_t nRows = 256
+    );
+  ~WriteBehind();
+
+  // sSql is complete statement text, with '?' for each field of F, in the order of F::Fields
+  template<class F>
+  void Queue( const std::string& sSql, const F& f ) {
+    Queue( [sSql, f]( WriteBehind& wb ){ wb.Write<F>( sSql, f ); } );
+  }
+
+  void Flush();  // returns once all rows queued prior to the call are committed
+  void Stop();   // flushes, then closes the connection, subsequent queues are refused
+
+  Stats GetStats() const;
+
+protected:
+private:
+
+  using fWrite_t = std::function<void( WriteBehind& )>;
+  using dequeWrite_t = std::deque<fWrite_t>;
+
+  // prepared statement, bound against its own copy of the row
+  struct StatementBase {
+    virtual ~StatementBase() {}
+  };
+
+  template<class F>
+  struct Statement: StatementBase {
+    F f;
+    typename QueryFields<F>::pQueryFields_t pQuery;
+    Statement( SessionImpl<ISqlite3>& session, const std::string& sSql, const F& f_ )
+    : f( f_ )
+    {
+      pQuery = session.SQL<F>( sSql, f ).NoExecute();
+    }
+    virtual ~Statement() {}
+  };
+
+  using pStatement_t = std::unique_ptr<StatementBase>;
+  using keyStatement_t = std::pair<std::string, std::type_index>;
+  using mapStatement_t = std::map<keyStatement_t, pStatement_t>; // keyed by statement text and row type
+
+  const std::chrono::milliseconds m_msInterval;
+  const std::size_t m_nRows;
+
+  SessionImpl<ISqlite3> m_session; // worker's connection
+  mapStatement_t m_mapStatement;   // used only by the worker
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_cvQueued;
+  std::condition_variable m_cvWritten;
+
+  dequeWrite_t m_dequeWrite;
+  bool m_bStop;
+  std::uint64_t m_nFlushTarget; // rows to be committed before the batch may wait out the interval
+
+  Stats m_stats;
+
+  std::thread m_thread;
+
+  void Queue( fWrite_t&& );
+  void Worker();
+  void Command( const std::string& sSql ); // begin, commit, rollback
+
+  template<class F>
+  void Write( const std::string& sSql, const F& f ) {
+    const keyStatement_t key( sSql, std::type_index( typeid( F ) ) );
+    mapStatement_t::iterator iter = m_mapStatement.find( key );
+    if ( m_mapStatement.end() == iter ) {
+      iter = m_mapStatement.emplace( key, std::make_unique<Statement<F> >( m_session, sSql, f ) ).first;
+    }
+    Statement<F>& statement( static_cast<Statement<F>&>( *iter->second ) ); // the key carries the type
+    statement.f = f;
+    try {
+      m_session.Reset( statement.pQuery );
+    }
+    catch ( const std::runtime_error& ) {} // reports the previous failed step, the statement is reset regardless
+    m_session.Bind( *statement.pQuery );
+    m_session.Execute( *statement.pQuery );
+  }
+
+};
+
+} // db
+} // ou
@@ -32,6 +32,7 @@
 
 #include "one_shot.hpp"
 #include "web_socket.hpp"
+#include "data_stream.hpp"
 // this needs to be factored out properly
 #include "root_certificates.hpp"
 
@@ -47,6 +48,9 @@ namespace tf {
 namespace alpaca {
 
 namespace {
+  const std::chrono::seconds c_secondsReconnectMin( 1 );
+  const std::chrono::seconds c_secondsReconnectMax( 60 );
+
   template<class T>
   void extract( json::object const& obj, T& t, json::string_view key ) {
     t = json::value_to<T>( obj.at( key ) );
@@ -59,10 +63,17 @@ Provider::Provider()
 , m_kwmEvent( EEvent::unknown, 20 )
 , m_state( EState::start )
 , m_ssl_context( ssl::context::tlsv12_client )
+, m_timerReconnect( m_srvc )
+, m_secondsReconnect( c_secondsReconnectMin )
 {
   m_sName = "alpaca"; // this needs to match provider used in the database
   m_nID = keytypes::EProviderAlpaca;
   m_bProvidesBrokerInterface = true;
+  m_bProvidesQuotes = true;
+  m_bProvidesTrades = true;
+
+  m_sDataHost = "stream.data.alpaca.markets";
+  m_sDataFeed = "iex";
 
   m_kwmEvent.AddPattern( "new", EEvent::new_ );
   m_kwmEvent.AddPattern( "fill", EEvent::fill );
@@ -99,6 +110,7 @@ Provider::~Provider() {
     Disconnect();
   }
   m_pTradeUpdates.reset();
+  m_pMarketData.reset();
   m_mapAssetId.clear();
   m_umapOrderLookup.clear();
 }
@@ -110,6 +122,14 @@ void Provider::Set( const std::string& sHost, const std::string& sKey, const std
   m_sAlpacaSecret = sSecret;
 }
 
+void Provider::SetDataFeed( const std::string& sFeed ) {
+  m_sDataFeed = sFeed;
+}
+
+void Provider::SetOnBar( fBar_t&& fBar ) {
+  m_fBar = std::move( fBar );
+}
+
 void Provider::Connect() {
 
   if ( !m_bConnected ) {
@@ -131,6 +151,7 @@ void Provider::Connect() {
       Assets();
       Positions();
       TradeUpdates();
+      MarketData();
     }
 
   }
@@ -142,6 +163,8 @@ void Provider::Disconnect() {
     m_state = EState::start;
     m_pTradeUpdates->trade_updates( false ); // may need some state refinement for calling this
     m_pTradeUpdates->disconnect();
+    m_timerReconnect.cancel();
+    m_pMarketData->disconnect();
     m_bConnected = false;
     ProviderInterfaceBase::OnDisconnected( 0 );
   }
@@ -287,6 +310,7 @@ void Provider::TradeUpdates() {
       m_pTradeUpdates->trade_updates( true );
       m_bConnected = true;
       ProviderInterfaceBase::OnConnected( 0 );
+      inherited_t::ConnectionComplete(); // start the watches added while disconnected
     },
     [this]( std::string&& sMessage){ // fMessage_t
       //std::cout << "order update message: " << sMessage << std::endl;
@@ -356,6 +380,86 @@ void Provider::TradeUpdates() {
   );
 }
 
+void Provider::MarketData() {
+  m_pMarketData = std::make_shared<ou::tf::alpaca::session::data_stream>(
+    m_srvc, m_ssl_context
+  );
+  m_pMarketData->set(
+    [this]( const std::string_view& sSymbol, const ou::tf::Trade& trade ){
+      Asset* pAsset( Lookup( sSymbol ) );
+      if ( nullptr != pAsset ) pAsset->m_OnTrade( trade );
+    },
+    [this]( const std::string_view& sSymbol, const ou::tf::Quote& quote ){
+      Asset* pAsset( Lookup( sSymbol ) );
+      if ( nullptr != pAsset ) pAsset->m_OnQuote( quote );
+    },
+    [this]( const std::string_view& sSymbol, const ou::tf::Bar& bar ){
+      if ( m_fBar ) {
+        m_sLookup.assign( sSymbol.data(), sSymbol.size() );
+        m_fBar( m_sLookup, bar );
+      }
+    }
+  );
+  m_pMarketData->connect(
+    m_sDataHost, m_sPort, "/v2/" + m_sDataFeed,
+    m_sAlpacaKeyId, m_sAlpacaSecret,
+    [this]( bool bAuthenticated ){ // on the stream's strand
+      if ( bAuthenticated ) {
+        BOOST_LOG_TRIVIAL(info) << "provider/alpaca market data authenticated";
+        m_secondsReconnect = c_secondsReconnectMin;
+      }
+      else {
+        MarketDataLost();
+      }
+    }
+  );
+}
+
+// the stream holds the subscriptions, and re-sends them once authenticated again
+void Provider::MarketDataLost() {
+  if ( EState::start == m_state ) return; // Disconnect()
+  BOOST_LOG_TRIVIAL(error)
+    << "provider/alpaca market data lost, reconnecting in "
+    << m_secondsReconnect.count() << "s";
+  m_timerReconnect.expires_after( m_secondsReconnect );
+  m_timerReconnect.async_wait(
+    [this, pMarketData = m_pMarketData]( const boost::system::error_code& ec ){
+      if ( !ec ) pMarketData->reconnect();
+    } );
+  m_secondsReconnect = std::min( 2 * m_secondsReconnect, c_secondsReconnectMax );
+}
+
+// stream handlers run on the one provider thread
+Asset* Provider::Lookup( const std::string_view& sSymbol ) {
+  m_sLookup.assign( sSymbol.data(), sSymbol.size() );
+  mapSymbols_t::iterator iter = m_mapSymbols.find( m_sLookup );
+  if ( m_mapSymbols.end() == iter ) return nullptr;
+  return iter->second.get();
+}
+
+void Provider::StartQuoteWatch( pSymbol_t pSymbol ) {
+  m_pMarketData->subscribe( session::data_stream::quotes, pSymbol->GetId() );
+}
+
+void Provider::StopQuoteWatch( pSymbol_t pSymbol ) {
+  m_pMarketData->unsubscribe( session::data_stream::quotes, pSymbol->GetId() );
+}
+
+void Provider::StartTradeWatch( pSymbol_t pSymbol ) {
+  m_pMarketData->subscribe( session::data_stream::trades, pSymbol->GetId() );
+}
+
+void Provider::StopTradeWatch( pSymbol_t pSymbol ) {
+  m_pMarketData->unsubscribe( session::data_stream::trades, pSymbol->GetId() );
+}
+
+void Provider::WatchBars( const std::string& sSymbol, bool bWatch ) {
+  if ( m_pMarketData ) {
+    if ( bWatch ) m_pMarketData->subscribe( session::data_stream::bars, sSymbol );
+    else        m_pMarketData->unsubscribe( session::data_stream::bars, sSymbol );
+  }
+}
+
 void Provider::TradeUpdate( const json::object& obj ) {
 
   struct Update {
@@ -23,10 +23,14 @@
 
 #include <map>
 #include <set>
+#include <chrono>
 #include <memory>
+#include <functional>
+#include <string_view>
 #include <unordered_map>
 
 #include <boost/asio/ssl.hpp>
+#include <boost/asio/steady_timer.hpp>
 
 #include <OUCommon/KeyWordMatch.h>
 
@@ -49,6 +53,7 @@ namespace alpaca {
 
 namespace session {
   class web_socket;
+  class data_stream;
 } // namespace session
 
 class Provider:
@@ -76,6 +81,12 @@ public:
   }
 
   void Set( const std::string& sHost, const std::string& sKey, const std::string& sSecret );
+  void SetDataFeed( const std::string& sFeed ); // iex (default), sip: market data is from stream.data.alpaca.markets/v2/<feed>
+
+  // minute bars are not carried by Symbol, so are delivered here
+  using fBar_t = std::function<void( const std::string& sSymbol, const ou::tf::Bar& )>;
+  void SetOnBar( fBar_t&& );
+  void WatchBars( const std::string& sSymbol, bool bWatch );
 
   // do these need to be virtual?  use crtp?
   virtual void Connect();
@@ -85,6 +96,13 @@ protected:
 
   pSymbol_t NewCSymbol( pInstrument_t pInstrument );  // used by Add/Remove x handlers in base class
 
+  // overridden from ProviderInterface
+  void StartQuoteWatch( pSymbol_t pSymbol );
+  void  StopQuoteWatch( pSymbol_t pSymbol );
+
+  void StartTradeWatch( pSymbol_t pSymbol );
+  void  StopTradeWatch( pSymbol_t pSymbol );
+
   // From ProviderInterface Execution Section
   virtual void PlaceOrder( pOrder_t );
   virtual void CancelOrder( pOrder_t );
@@ -112,6 +130,19 @@ private:
   using pTradeUpdates_t = std::shared_ptr<ou::tf::alpaca::session::web_socket>;
   pTradeUpdates_t m_pTradeUpdates;
 
+  std::string m_sDataHost;
+  std::string m_sDataFeed;
+
+  using pMarketData_t = std::shared_ptr<ou::tf::alpaca::session::data_stream>;
+  pMarketData_t m_pMarketData;
+
+  // a lost market data stream is reconnected, the delay doubles per failed attempt
+  asio::steady_timer m_timerReconnect;
+  std::chrono::seconds m_secondsReconnect;
+
+  std::string m_sLookup; // reused for symbol lookups from the stream
+  fBar_t m_fBar;
+
   struct AssetMatch {
     std::string sId;
     std::string sClass;
@@ -138,6 +169,10 @@ private:
   void LastOrderId();
   void Positions();
   void TradeUpdates();
+  void MarketData();
+  void MarketDataLost();
+
+  Asset* Lookup( const std::string_view& sSymbol );
 
   void TradeUpdate( const boost::json::object& obj );
 
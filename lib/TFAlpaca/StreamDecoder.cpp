@@ -0,0 +1,312 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    StreamDecoder.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFAlpaca
+ * Created: October 19, 2026 23:40
+ */
+
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+#include <OUCommon/JsonScan.h>
+
+#include "StreamDecoder.hpp"
+
+namespace ou {
+namespace tf {
+namespace alpaca {
+
+namespace {
+
+  using ou::json_scan::Space;
+  using ou::json_scan::Expect;
+  using ou::json_scan::String;
+  using ou::json_scan::Number;
+  using ou::json_scan::Skip;
+
+  inline bool Digits( const char* p, size_t n, int& value ) {
+    value = 0;
+    for ( size_t ix = 0; ix < n; ++ix ) {
+      const char ch( p[ ix ] );
+      if ( ( '0' > ch ) || ( '9' < ch ) ) return false;
+      value = value * 10 + ( ch - '0' );
+    }
+    return true;
+  }
+
+  inline ou::tf::DatedDatum::volume_t Size( double dblSize ) {
+    return ( 0.0 < dblSize ) ? (ou::tf::DatedDatum::volume_t)std::llround( dblSize ) : 0;
+  }
+
+} // namespace anonymous
+
+struct StreamDecoder::Fields {
+
+  enum EFound: unsigned {
+    T = 1 << 0, S = 1 << 1, t = 1 << 2,
+    p = 1 << 3, s = 1 << 4,
+    o = 1 << 5, h = 1 << 6, l = 1 << 7, c = 1 << 8, v = 1 << 9
+  };
+
+  unsigned nFound;
+
+  std::string_view sType;
+  std::string_view sSymbol;
+  std::string_view sTime;
+  std::string_view sMessage;
+
+  double dblPrice;
+  double dblSize;
+  double dblBid, dblBidSize;
+  double dblAsk, dblAskSize;
+  double dblOpen, dblHigh, dblLow, dblClose;
+  double dblVolume;
+  double dblCode;
+
+  Fields()
+  : nFound {}
+  , dblPrice {}, dblSize {}
+  , dblBid {}, dblBidSize {}, dblAsk {}, dblAskSize {}
+  , dblOpen {}, dblHigh {}, dblLow {}, dblClose {}, dblVolume {}
+  , dblCode {}
+  {}
+
+  bool Has( unsigned nRequired ) const { return nRequired == ( nFound & nRequired ); }
+};
+
+StreamDecoder::StreamDecoder() {
+  std::memset( m_rchDate, 0, sizeof( m_rchDate ) );
+}
+
+void StreamDecoder::Set( fTrade_t&& fTrade, fQuote_t&& fQuote, fBar_t&& fBar, fStatus_t&& fStatus ) {
+  m_fTrade = std::move( fTrade );
+  m_fQuote = std::move( fQuote );
+  m_fBar = std::move( fBar );
+  m_fStatus = std::move( fStatus );
+}
+
+bool StreamDecoder::Decode( const std::string_view& frame ) {
+
+  m_stats.nFrames++;
+
+  const char* p( frame.data() );
+  const char* e( p + frame.size() );
+
+  bool bOk( false );
+
+  Space( p, e );
+  if ( Expect( p, e, '[' ) ) {
+    Space( p, e );
+    if ( Expect( p, e, ']' ) ) bOk = true;
+    else {
+      while ( Message( p, e ) ) {
+        Space( p, e );
+        if ( Expect( p, e, ',' ) ) {
+          Space( p, e );
+          continue;
+        }
+        bOk = Expect( p, e, ']' );
+        break;
+      }
+    }
+  }
+  else {
+    bOk = Message( p, e ); // a single message, not in an array
+  }
+
+  if ( !bOk ) m_stats.nMalformed++;
+  return bOk;
+}
+
+bool StreamDecoder::Message( const char*& p, const char* e ) {
+
+  Fields fields;
+
+  if ( !Expect( p, e, '{' ) ) return false;
+  Space( p, e );
+  if ( !Expect( p, e, '}' ) ) {
+    while ( true ) {
+
+      std::string_view key;
+      if ( !String( p, e, key ) ) return false;
+      Space( p, e );
+      if ( !Expect( p, e, ':' ) ) return false;
+      Space( p, e );
+      if ( p == e ) return false;
+
+      bool bOk( true );
+      switch ( key.size() ) {
+        case 1:
+          switch ( key[ 0 ] ) {
+            case 'T': bOk = String( p, e, fields.sType );    fields.nFound |= Fields::T; break;
+            case 'S': bOk = String( p, e, fields.sSymbol );  fields.nFound |= Fields::S; break;
+            case 't': bOk = String( p, e, fields.sTime );    fields.nFound |= Fields::t; break;
+            case 'p': bOk = Number( p, e, fields.dblPrice ); fields.nFound |= Fields::p; break;
+            case 's': bOk = Number( p, e, fields.dblSize );  fields.nFound |= Fields::s; break;
+            case 'o': bOk = Number( p, e, fields.dblOpen );  fields.nFound |= Fields::o; break;
+            case 'h': bOk = Number( p, e, fields.dblHigh );  fields.nFound |= Fields::h; break;
+            case 'l': bOk = Number( p, e, fields.dblLow );   fields.nFound |= Fields::l; break;
+            case 'v': bOk = Number( p, e, fields.dblVolume ); fields.nFound |= Fields::v; break;
+            case 'c': // close on a bar, conditions on a trade or quote
+              if ( '[' == *p ) bOk = Skip( p, e );
+              else {
+                bOk = Number( p, e, fields.dblClose );
+                fields.nFound |= Fields::c;
+              }
+              break;
+            default:
+              bOk = Skip( p, e );
+              break;
+          }
+          break;
+        case 2:
+          if      ( "bp" == key ) bOk = Number( p, e, fields.dblBid );
+          else if ( "bs" == key ) bOk = Number( p, e, fields.dblBidSize );
+          else if ( "ap" == key ) bOk = Number( p, e, fields.dblAsk );
+          else if ( "as" == key ) bOk = Number( p, e, fields.dblAskSize );
+          else bOk = Skip( p, e );
+          break;
+        case 3:
+          if ( "msg" == key ) bOk = String( p, e, fields.sMessage );
+          else bOk = Skip( p, e );
+          break;
+        case 4:
+          if ( "code" == key ) bOk = Number( p, e, fields.dblCode );
+          else bOk = Skip( p, e );
+          break;
+        default:
+          bOk = Skip( p, e );
+          break;
+      }
+      if ( !bOk ) return false;
+
+      Space( p, e );
+      if ( Expect( p, e, ',' ) ) {
+        Space( p, e );
+        continue;
+      }
+      if ( Expect( p, e, '}' ) ) break;
+      return false;
+    }
+  }
+
+  Emit( fields );
+  return true;
+}
+
+void StreamDecoder::Emit( const Fields& fields ) {
+
+  if ( !fields.Has( Fields::T ) ) {
+    m_stats.nSkipped++;
+    return;
+  }
+
+  const std::string_view& sType( fields.sType );
+  ptime dt;
+
+  if ( 1 == sType.size() ) {
+    switch ( sType[ 0 ] ) {
+      case 't':
+        if ( fields.Has( Fields::S | Fields::t | Fields::p | Fields::s ) && Time( fields.sTime, dt ) ) {
+          m_stats.nTrades++;
+          if ( m_fTrade ) m_fTrade( fields.sSymbol, ou::tf::Trade( dt, fields.dblPrice, Size( fields.dblSize ) ) );
+          return;
+        }
+        break;
+      case 'q':
+        if ( fields.Has( Fields::S | Fields::t ) && Time( fields.sTime, dt ) ) {
+          m_stats.nQuotes++;
+          if ( m_fQuote ) m_fQuote(
+            fields.sSymbol,
+            ou::tf::Quote( dt, fields.dblBid, Size( fields.dblBidSize ), fields.dblAsk, Size( fields.dblAskSize ) ) );
+          return;
+        }
+        break;
+      case 'b':
+        if ( fields.Has( Fields::S | Fields::t | Fields::o | Fields::h | Fields::l | Fields::c | Fields::v ) && Time( fields.sTime, dt ) ) {
+          m_stats.nBars++;
+          if ( m_fBar ) m_fBar(
+            fields.sSymbol,
+            ou::tf::Bar( dt, fields.dblOpen, fields.dblHigh, fields.dblLow, fields.dblClose, Size( fields.dblVolume ) ) );
+          return;
+        }
+        break;
+      default:
+        m_stats.nSkipped++;
+        return;
+    }
+    m_stats.nMalformed++; // a known type without its fields
+    return;
+  }
+
+  if ( ( "success" == sType ) || ( "error" == sType ) || ( "subscription" == sType ) ) {
+    m_stats.nStatus++;
+    if ( m_fStatus ) m_fStatus( sType, fields.sMessage, (int)fields.dblCode );
+    return;
+  }
+
+  m_stats.nSkipped++;
+}
+
+// rfc3339, utc: 2021-02-22T15:51:45.335689322Z, fractions truncated to microseconds
+bool StreamDecoder::Time( const std::string_view& sv, ptime& dt ) {
+
+  if ( 19 > sv.size() ) return false;
+  const char* p( sv.data() );
+  if ( ( '-' != p[ 4 ] ) || ( '-' != p[ 7 ] ) || ( 'T' != p[ 10 ] ) || ( ':' != p[ 13 ] ) || ( ':' != p[ 16 ] ) ) return false;
+
+  if ( 0 != std::memcmp( m_rchDate, p, sizeof( m_rchDate ) ) ) {
+    int year, month, day;
+    if ( !Digits( p, 4, year ) || !Digits( p + 5, 2, month ) || !Digits( p + 8, 2, day ) ) return false;
+    try {
+      m_date = boost::gregorian::date( year, month, day );
+    }
+    catch ( const std::out_of_range& ) {
+      std::memset( m_rchDate, 0, sizeof( m_rchDate ) );
+      return false;
+    }
+    std::memcpy( m_rchDate, p, sizeof( m_rchDate ) );
+  }
+
+  int hours, minutes, seconds;
+  if ( !Digits( p + 11, 2, hours ) || !Digits( p + 14, 2, minutes ) || !Digits( p + 17, 2, seconds ) ) return false;
+
+  int micro {};
+  size_t ix( 19 );
+  if ( ( ix < sv.size() ) && ( '.' == p[ ix ] ) ) {
+    ++ix;
+    size_t nDigits {};
+    while ( ( ix < sv.size() ) && ( '0' <= p[ ix ] ) && ( '9' >= p[ ix ] ) ) {
+      if ( 6 > nDigits ) {
+        micro = micro * 10 + ( p[ ix ] - '0' );
+        ++nDigits;
+      }
+      ++ix;
+    }
+    for ( ; nDigits < 6; ++nDigits ) micro *= 10;
+  }
+
+  dt = ptime(
+    m_date,
+    boost::posix_time::time_duration( hours, minutes, seconds ) + boost::posix_time::microseconds( micro ) );
+  return true;
+}
+
+} // namespace alpaca
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,94 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    StreamDecoder.hpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFAlpaca
+ * Created: October 19, 2026 23:40
+ */
+
+#pragma once
+
+// https://docs.alpaca.markets/docs/real-time-stock-pricing-data
+// decodes market data stream frames, a json array of messages, directly into Trade / Quote / Bar
+//   a single pass over the frame with a fixed set of keys, no json tree, nothing allocated per message
+//   unknown keys and message types are skipped, strings are not unescaped (symbols and types have no escapes)
+//   sizes are rounded to whole units (volume_t)
+
+#include <string_view>
+#include <functional>
+
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <TFTimeSeries/DatedDatum.h>
+
+namespace ou {
+namespace tf {
+namespace alpaca {
+
+class StreamDecoder {
+public:
+
+  using fTrade_t = std::function<void( const std::string_view& sSymbol, const ou::tf::Trade& )>;
+  using fQuote_t = std::function<void( const std::string_view& sSymbol, const ou::tf::Quote& )>;
+  using fBar_t = std::function<void( const std::string_view& sSymbol, const ou::tf::Bar& )>;
+  // success, error (with code), subscription
+  using fStatus_t = std::function<void( const std::string_view& sType, const std::string_view& sMessage, int code )>;
+
+  struct Stats {
+    size_t nFrames;
+    size_t nTrades;
+    size_t nQuotes;
+    size_t nBars;
+    size_t nStatus;
+    size_t nSkipped;   // message types not decoded (daily bars, statuses, corrections, ...)
+    size_t nMalformed; // frames abandoned part way, and messages without their required fields
+    Stats(): nFrames {}, nTrades {}, nQuotes {}, nBars {}, nStatus {}, nSkipped {}, nMalformed {} {}
+  };
+
+  StreamDecoder();
+
+  void Set( fTrade_t&&, fQuote_t&&, fBar_t&&, fStatus_t&& );
+
+  bool Decode( const std::string_view& frame ); // false if the frame is malformed, messages prior are delivered
+
+  const Stats& GetStats() const { return m_stats; }
+
+protected:
+private:
+
+  using ptime = boost::posix_time::ptime;
+
+  struct Fields; // one message
+
+  fTrade_t m_fTrade;
+  fQuote_t m_fQuote;
+  fBar_t m_fBar;
+  fStatus_t m_fStatus;
+
+  Stats m_stats;
+
+  // successive messages mostly share the date
+  char m_rchDate[ 10 ];
+  boost::gregorian::date m_date;
+
+  bool Message( const char*& p, const char* e );
+  void Emit( const Fields& );
+  bool Time( const std::string_view&, ptime& );
+};
+
+} // namespace alpaca
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,432 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    data_stream.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFAlpaca
+ * Created: October 19, 2026 23:40
+ */
+
+#include <iostream>
+
+#include "data_stream.hpp"
+
+namespace http  = beast::http;      // from <boost/beast/http.hpp>
+
+namespace ou {
+namespace tf {
+namespace alpaca {
+namespace session {
+
+namespace {
+
+const static std::string sUserAgent( "ounl.tradeframe/1.0" );
+
+const char* rszChannel[] = { "trades", "quotes", "bars" }; // indexed by EChannel
+
+// Report a failure
+void fail( beast::error_code ec, char const* what ) {
+  std::cerr << what << ": " << ec.message() << "\n";
+}
+
+// a json string, only quote and backslash need escaping in keys and symbols
+void append_quoted( std::string& s, const std::string& value ) {
+  s += '"';
+  for ( const char ch: value ) {
+    if ( ( '"' == ch ) || ( '\\' == ch ) ) s += '\\';
+    s += ch;
+  }
+  s += '"';
+}
+
+} // namespace anonymous
+
+data_stream::data_stream( asio::io_context& ioc, ssl::context& ssl_ctx )
+: m_state( EState::start )
+, m_strand( asio::make_strand( ioc ) )
+, m_resolver( m_strand )
+, m_pssl_ctx( &ssl_ctx )
+, m_pwss( std::make_unique<wss_t>( m_strand, ssl_ctx ) )
+{
+  m_decoder.Set( nullptr, nullptr, nullptr,
+    [this]( const std::string_view& sType, const std::string_view& sMessage, int code ){
+      on_status( sType, sMessage, code );
+    } );
+}
+
+data_stream::data_stream( asio::io_context& ioc )
+: m_state( EState::start )
+, m_strand( asio::make_strand( ioc ) )
+, m_resolver( m_strand )
+, m_pssl_ctx( nullptr )
+, m_pws( std::make_unique<ws_t>( m_strand ) )
+{
+  m_decoder.Set( nullptr, nullptr, nullptr,
+    [this]( const std::string_view& sType, const std::string_view& sMessage, int code ){
+      on_status( sType, sMessage, code );
+    } );
+}
+
+data_stream::~data_stream() {
+}
+
+void data_stream::set(
+  StreamDecoder::fTrade_t&& fTrade
+, StreamDecoder::fQuote_t&& fQuote
+, StreamDecoder::fBar_t&& fBar
+) {
+  m_decoder.Set(
+    std::move( fTrade ), std::move( fQuote ), std::move( fBar ),
+    [this]( const std::string_view& sType, const std::string_view& sMessage, int code ){
+      on_status( sType, sMessage, code );
+    } );
+}
+
+void data_stream::record( const std::string& sFileName ) {
+  m_ofsRecord.open( sFileName, std::ios::out | std::ios::trunc );
+  if ( !m_ofsRecord.is_open() ) {
+    std::cerr << "alpaca::data_stream can not record to " << sFileName << std::endl;
+  }
+}
+
+void data_stream::connect(
+  const std::string& host
+, const std::string& port
+, const std::string& target
+, const std::string& sAlpacaKey
+, const std::string& sAlpacaSecret
+, fConnected_t&& fConnected
+) {
+  m_host = host;
+  m_port = port;
+  m_target = target;
+
+  m_key = sAlpacaKey;
+  m_secret = sAlpacaSecret;
+
+  m_fConnected = std::move( fConnected );
+
+  resolve();
+}
+
+void data_stream::reconnect() {
+  asio::post(
+    m_strand,
+    [this, self = shared_from_this()](){
+      if ( EState::start != m_state ) return;
+      // a websocket stream is not reusable once closed or failed
+      if ( m_pssl_ctx ) m_pwss = std::make_unique<wss_t>( m_strand, *m_pssl_ctx );
+      else m_pws = std::make_unique<ws_t>( m_strand );
+      resolve();
+    } );
+}
+
+void data_stream::resolve() {
+  m_state = EState::connecting;
+  m_resolver.async_resolve(
+    m_host,
+    m_port,
+    beast::bind_front_handler(
+      &data_stream::on_resolve,
+      shared_from_this()
+    )
+  );
+}
+
+void data_stream::on_resolve( beast::error_code ec, tcp::resolver::results_type results ) {
+
+  if ( ec ) return lost( ec, "ds.on_resolve" );
+  if ( EState::connecting != m_state ) return; // disconnect() while resolving
+
+  with_ws( [this,&results]( auto& ws ){
+    beast::get_lowest_layer( ws ).expires_after( std::chrono::seconds( 15 ) );
+    beast::get_lowest_layer( ws ).async_connect(
+      results,
+      beast::bind_front_handler(
+        &data_stream::on_connect,
+        shared_from_this()
+      )
+    );
+  } );
+}
+
+void data_stream::on_connect( beast::error_code ec, tcp::resolver::results_type::endpoint_type ep ) {
+
+  if ( ec ) return lost( ec, "ds.on_connect" );
+
+  if ( m_pwss ) {
+    // Set SNI Hostname (many hosts need this to handshake successfully)
+    if( !SSL_set_tlsext_host_name(
+      m_pwss->next_layer().native_handle(),
+      m_host.c_str())
+    ) {
+      ec = beast::error_code(static_cast<int>(::ERR_get_error()),
+          asio::error::get_ssl_category());
+      return lost( ec, "ds.on_connect sni" );
+    }
+  }
+
+  // the Host HTTP header during the WebSocket handshake
+  m_hostHeader = m_host + ':' + std::to_string( ep.port() );
+
+  if ( m_pwss ) {
+    m_pwss->next_layer().async_handshake(
+      ssl::stream_base::client,
+      beast::bind_front_handler(
+        &data_stream::on_ssl_handshake,
+        shared_from_this()
+      )
+    );
+  }
+  else {
+    ws_handshake();
+  }
+}
+
+void data_stream::on_ssl_handshake( beast::error_code ec ) {
+  if ( ec ) return lost( ec, "ds.on_ssl_handshake" );
+  ws_handshake();
+}
+
+void data_stream::ws_handshake() {
+
+  m_state = EState::handshake;
+
+  with_ws( [this]( auto& ws ){
+
+    // the websocket stream has its own timeout system
+    beast::get_lowest_layer( ws ).expires_never();
+
+    // pings on an idle connection, so a silent drop is reported as lost
+    websocket::stream_base::timeout timeout( websocket::stream_base::timeout::suggested( beast::role_type::client ) );
+    timeout.idle_timeout = std::chrono::seconds( 30 );
+    timeout.keep_alive_pings = true;
+    ws.set_option( timeout );
+
+    ws.set_option( websocket::stream_base::decorator(
+      []( websocket::request_type& request )
+      {
+        request.set(http::field::user_agent,
+          std::string( sUserAgent ) + " websocket-client-async");
+      })
+    );
+
+    ws.async_handshake(
+      m_hostHeader, m_target,
+      beast::bind_front_handler(
+        &data_stream::on_handshake,
+        shared_from_this()
+      )
+    );
+  } );
+}
+
+void data_stream::on_handshake( beast::error_code ec ) {
+  if ( ec ) return lost( ec, "ds.on_handshake" );
+  // the server opens with [{"T":"success","msg":"connected"}]
+  read();
+}
+
+void data_stream::read() {
+  with_ws( [this]( auto& ws ){
+    ws.async_read(
+      m_buffer,
+      beast::bind_front_handler(
+        &data_stream::on_read,
+        shared_from_this()
+      )
+    );
+  } );
+}
+
+void data_stream::on_read( beast::error_code ec, std::size_t bytes_transferred ) {
+
+  boost::ignore_unused( bytes_transferred );
+
+  if ( ec ) return lost( ec, "ds.on_read" ); // includes a close from the server
+
+  const auto data( m_buffer.cdata() );
+  const std::string_view frame( static_cast<const char*>( data.data() ), data.size() );
+
+  if ( m_ofsRecord.is_open() ) {
+    m_ofsRecord << frame << '\n';
+  }
+
+  m_decoder.Decode( frame );
+  m_buffer.consume( m_buffer.size() ); // capacity is retained for the next frame
+
+  if ( EState::closing != m_state ) {
+    read();
+  }
+}
+
+void data_stream::on_status( const std::string_view& sType, const std::string_view& sMessage, int code ) {
+
+  if ( "success" == sType ) {
+    if ( "connected" == sMessage ) {
+      m_state = EState::authenticating;
+      std::string auth( "{\"action\":\"auth\",\"key\":" );
+      append_quoted( auth, m_key );
+      auth += ",\"secret\":";
+      append_quoted( auth, m_secret );
+      auth += '}';
+      send( std::move( auth ) );
+    }
+    else {
+      if ( "authenticated" == sMessage ) {
+        m_state = EState::authenticated;
+        subscribe_all();
+        if ( m_fConnected ) m_fConnected( true );
+      }
+    }
+    return;
+  }
+
+  if ( "error" == sType ) {
+    std::cerr << "alpaca::data_stream error " << code << ": " << sMessage << std::endl;
+    if ( EState::authenticating == m_state ) {
+      lost( beast::error_code(), "ds.auth" ); // auth failed, connection limit exceeded, ...
+    }
+    return;
+  }
+
+  // subscription: the complete list, as acknowledged
+}
+
+void data_stream::send( std::string&& message ) {
+  m_queueWrite.emplace_back( std::move( message ) );
+  if ( 1 == m_queueWrite.size() ) write();
+}
+
+void data_stream::write() {
+  with_ws( [this]( auto& ws ){
+    ws.text( true );
+    ws.async_write(
+      asio::buffer( m_queueWrite.front() ),
+      beast::bind_front_handler(
+        &data_stream::on_write,
+        shared_from_this()
+      )
+    );
+  } );
+}
+
+void data_stream::on_write( beast::error_code ec, std::size_t bytes_transferred ) {
+
+  boost::ignore_unused( bytes_transferred );
+
+  if ( ec ) return lost( ec, "ds.on_write" );
+
+  m_queueWrite.pop_front();
+  if ( !m_queueWrite.empty() ) write();
+}
+
+void data_stream::action( const char* szAction, EChannel channel, const std::string& sSymbol ) {
+  std::string message( "{\"action\":\"" );
+  message += szAction;
+  message += "\",\"";
+  message += rszChannel[ channel ];
+  message += "\":[";
+  append_quoted( message, sSymbol );
+  message += "]}";
+  send( std::move( message ) );
+}
+
+void data_stream::subscribe_all() {
+  std::string message( "{\"action\":\"subscribe\"" );
+  bool bAny( false );
+  for ( size_t ix = 0; ix < m_rsetSymbol.size(); ++ix ) {
+    const setSymbol_t& set( m_rsetSymbol[ ix ] );
+    if ( !set.empty() ) {
+      bAny = true;
+      message += ",\"";
+      message += rszChannel[ ix ];
+      message += "\":[";
+      bool bComma( false );
+      for ( const setSymbol_t::value_type& sSymbol: set ) {
+        if ( bComma ) message += ',';
+        else bComma = true;
+        append_quoted( message, sSymbol );
+      }
+      message += ']';
+    }
+  }
+  message += '}';
+  if ( bAny ) send( std::move( message ) );
+}
+
+void data_stream::subscribe( EChannel channel, const std::string& sSymbol ) {
+  asio::post(
+    m_strand,
+    [this, self = shared_from_this(), channel, sSymbol](){
+      if ( m_rsetSymbol[ channel ].emplace( sSymbol ).second ) {
+        if ( EState::authenticated == m_state ) action( "subscribe", channel, sSymbol );
+      }
+    } );
+}
+
+void data_stream::unsubscribe( EChannel channel, const std::string& sSymbol ) {
+  asio::post(
+    m_strand,
+    [this, self = shared_from_this(), channel, sSymbol](){
+      if ( 0 < m_rsetSymbol[ channel ].erase( sSymbol ) ) {
+        if ( EState::authenticated == m_state ) action( "unsubscribe", channel, sSymbol );
+      }
+    } );
+}
+
+void data_stream::disconnect() {
+  asio::post(
+    m_strand,
+    [this, self = shared_from_this()](){
+      if ( ( EState::start == m_state ) || ( EState::closing == m_state ) ) return;
+      if ( EState::connecting == m_state ) { // no websocket to close yet
+        m_state = EState::start;
+        m_resolver.cancel();
+        with_ws( []( auto& ws ){ beast::get_lowest_layer( ws ).close(); } );
+        return;
+      }
+      m_state = EState::closing;
+      with_ws( [this]( auto& ws ){
+        ws.async_close( websocket::close_code::normal,
+          beast::bind_front_handler(
+            &data_stream::on_close,
+            shared_from_this()
+          )
+        );
+      } );
+    } );
+}
+
+void data_stream::on_close( beast::error_code ec ) {
+  if( ec ) fail( ec, "ds.on_close" );
+  m_state = EState::start;
+}
+
+// reported once per connection, pending operations complete with errors and are ignored, until reconnect()
+void data_stream::lost( beast::error_code ec, char const* what ) {
+  if ( ( EState::start == m_state ) || ( EState::closing == m_state ) ) return; // reported, or disconnect()
+  if ( ec ) fail( ec, what );
+  m_state = EState::start;
+  m_queueWrite.clear();
+  m_buffer.clear();
+  with_ws( []( auto& ws ){ beast::get_lowest_layer( ws ).close(); } );
+  if ( m_fConnected ) m_fConnected( false );
+}
+
+} // namespace session
+} // namespace alpaca
+} // namespace tf
+} // namespace ou
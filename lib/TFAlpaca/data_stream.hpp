@@ -0,0 +1,167 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    data_stream.hpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFAlpaca
+ * Created: October 19, 2026 23:40
+ */
+
+#pragma once
+
+// market data stream: wss://stream.data.alpaca.markets/v2/{iex,sip}
+//   connects, authenticates, then (re)sends the subscriptions for trades, quotes, and minute bars
+//   a lost connection is reported through fConnected( false ), reconnect() starts over with the held subscriptions
+//   frames are decoded in place from the read buffer, which is reused across reads
+//   tls for alpaca, plain for a local stand in (see AlpacaReplay)
+
+#include <set>
+#include <array>
+#include <deque>
+#include <memory>
+#include <string>
+#include <fstream>
+#include <functional>
+
+#include <boost/asio/strand.hpp>
+
+#include <boost/beast/ssl.hpp>
+#include <boost/beast/core.hpp>
+
+#include <boost/beast/websocket.hpp>
+
+#include "StreamDecoder.hpp"
+
+namespace asio  = boost::asio;      // from <boost/asio.hpp>
+namespace ssl   = asio::ssl;        // from <boost/asio/ssl.hpp>
+
+namespace beast = boost::beast;     // from <boost/beast.hpp>
+namespace websocket = beast::websocket; // from <boost/beast/websocket.hpp>
+
+using tcp = boost::asio::ip::tcp;   // from <boost/asio/ip/tcp.hpp>
+
+namespace ou {
+namespace tf {
+namespace alpaca {
+namespace session {
+
+class data_stream : public std::enable_shared_from_this<data_stream>
+{
+public:
+
+  enum EChannel { trades = 0, quotes, bars };
+
+  explicit data_stream( asio::io_context&, ssl::context& ); // tls
+  explicit data_stream( asio::io_context& ); // plain
+  ~data_stream();
+
+  using fConnected_t = std::function<void(bool)>; // true when authenticated, false on a failed connect, an authentication error, or a lost connection
+
+  // handlers run on the stream's strand
+  void set(
+    StreamDecoder::fTrade_t&&,
+    StreamDecoder::fQuote_t&&,
+    StreamDecoder::fBar_t&&
+  );
+
+  // target: /v2/iex, /v2/sip
+  void connect(
+    const std::string& host,
+    const std::string& port,
+    const std::string& target,
+    const std::string& sAlpacaKey,
+    const std::string& sAlpacaSecret,
+    fConnected_t&&
+  );
+  void reconnect(); // after fConnected( false ), with the arguments to connect
+  void disconnect();
+
+  // may be called before the connection completes, subscriptions are held and re-sent on authentication
+  void subscribe( EChannel, const std::string& sSymbol );
+  void unsubscribe( EChannel, const std::string& sSymbol );
+
+  void record( const std::string& sFileName ); // frames as received, one per line, for AlpacaReplay
+
+  const StreamDecoder::Stats& stats() const { return m_decoder.GetStats(); }
+
+private:
+
+  using ws_t = websocket::stream<beast::tcp_stream>;
+  using wss_t = websocket::stream<beast::ssl_stream<beast::tcp_stream>>;
+
+  enum EState { start, connecting, handshake, authenticating, authenticated, closing } m_state;
+
+  asio::strand<asio::io_context::executor_type> m_strand;
+  tcp::resolver m_resolver;
+  ssl::context* m_pssl_ctx; // nullptr when plain, the websocket is rebuilt for each connection
+  std::unique_ptr<ws_t> m_pws;
+  std::unique_ptr<wss_t> m_pwss;
+
+  beast::flat_buffer m_buffer;
+
+  std::string m_host;
+  std::string m_port;
+  std::string m_target;
+  std::string m_hostHeader; // host:port
+
+  std::string m_key;
+  std::string m_secret;
+
+  fConnected_t m_fConnected;
+
+  StreamDecoder m_decoder;
+
+  using setSymbol_t = std::set<std::string>;
+  std::array<setSymbol_t,3> m_rsetSymbol; // indexed by EChannel
+
+  using queueWrite_t = std::deque<std::string>;
+  queueWrite_t m_queueWrite; // one write outstanding at a time
+
+  std::ofstream m_ofsRecord;
+
+  template<typename F>
+  void with_ws( F&& f ) {
+    if ( m_pwss ) f( *m_pwss );
+    else f( *m_pws );
+  }
+
+  void resolve();
+  void on_resolve( beast::error_code, tcp::resolver::results_type );
+  void on_connect( beast::error_code, tcp::resolver::results_type::endpoint_type );
+  void on_ssl_handshake( beast::error_code );
+  void ws_handshake();
+  void on_handshake( beast::error_code );
+
+  void read();
+  void on_read( beast::error_code, std::size_t bytes_transferred );
+
+  void on_status( const std::string_view& sType, const std::string_view& sMessage, int code );
+
+  void send( std::string&& );
+  void write();
+  void on_write( beast::error_code, std::size_t bytes_transferred );
+
+  void on_close( beast::error_code );
+
+  void lost( beast::error_code, char const* what );
+
+  void action( const char* szAction, EChannel, const std::string& sSymbol );
+  void subscribe_all();
+};
+
+} // namespace session
+} // namespace alpaca
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,326 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    InstrumentScanner.h
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFBitsNPieces
+ * Created: October 19, 2026 15:45
+ */
+
+// universe scan of the hdf5 time series, as InstrumentFilter does, as a pipeline:
+//   enumerate: the datasets under the root are listed, fUseGroup selects the groups, calling thread
+//   read:      datasets are read a batch at a time in enumeration order, calling thread,
+//              the hdf5 library is only ever entered from this one thread,
+//              at most nInFlight batches are read and not yet merged, which bounds the series held in memory
+//   compute:   fCompute filters and ranks each instrument on a worker pool,
+//              it sees only its own series and result, so needs no locking
+//   merge:     fResult is called on the calling thread in enumeration order, for those which passed,
+//              so the outcome does not depend upon the thread count or scheduling
+
+#pragma once
+
+#include <mutex>
+#include <memory>
+#include <deque>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <stdexcept>
+#include <condition_variable>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <TFHDF5TimeSeries/HDF5DataManager.h>
+#include <TFHDF5TimeSeries/HDF5IterateGroups.h>
+#include <TFHDF5TimeSeries/HDF5TimeSeriesContainer.h>
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+template<typename TS, typename R> // TS=time series type, R=per instrument result of the compute stage
+class InstrumentScanner {
+public:
+
+  using fUseGroup_t = std::function<bool (const std::string& sPath, const std::string& sGroup)>;
+  using fCompute_t  = std::function<bool (const std::string& sName, const TS&, R&)>; // worker thread, true to pass
+  using fResult_t   = std::function<void (const std::string& sPath, const std::string& sName, const TS&, R&)>;
+
+  struct Stats {
+    std::size_t nDatasets;  // enumerated in used groups
+    std::size_t nRead;      // with sufficient bars in the date range
+    std::size_t nPassed;
+    double dblSecondsRead;  // in the read stage
+    double dblSecondsTotal;
+    Stats(): nDatasets {}, nRead {}, nPassed {}, dblSecondsRead {}, dblSecondsTotal {} {}
+    double InstrumentsPerSecond() const { return ( 0.0 < dblSecondsTotal ) ? ( nDatasets / dblSecondsTotal ) : 0.0; }
+  };
+
+  InstrumentScanner(
+    const std::string& sPath,
+    boost::posix_time::ptime dtBegin, boost::posix_time::ptime dtEnd,
+    typename TS::size_type nRequired,
+    std::size_t nThreads = 0, // 0 for hardware concurrency
+    std::size_t nBatch = 256, // datasets read per batch
+    std::size_t nInFlight = 4 // batches read ahead of the merge
+  );
+  ~InstrumentScanner();
+
+  Stats Scan( fUseGroup_t&&, fCompute_t&&, fResult_t&& );
+
+protected:
+private:
+
+  struct Item {
+    std::string sPath;
+    std::string sName;
+    std::unique_ptr<TS> pts; // from read until merged
+    R result;
+    bool bRead;
+    bool bPassed;
+    bool bComputed;
+    Item( const std::string& sPath_, const std::string& sName_ )
+    : sPath( sPath_ ), sName( sName_ ), result {}, bRead( false ), bPassed( false ), bComputed( false ) {}
+  };
+
+  const std::string m_sRootPath;
+  const boost::posix_time::ptime m_dtBegin;
+  const boost::posix_time::ptime m_dtEnd;
+  const typename TS::size_type m_nRequired;
+  const std::size_t m_nBatch;
+  const std::size_t m_nInFlight;
+  std::size_t m_nThreads;
+
+  ou::tf::HDF5DataManager m_dm;
+
+  std::vector<Item> m_vItem; // enumeration order
+
+  fCompute_t m_fCompute;
+
+  std::mutex m_mutex;
+  std::condition_variable m_cvWork;     // items queued, or stopping
+  std::condition_variable m_cvComputed; // an item has been computed
+  std::deque<std::size_t> m_dequeWork;  // indexes into m_vItem
+  std::size_t m_nComputed;
+  bool m_bStop;
+
+  std::vector<std::thread> m_vThread;
+
+  void Worker();
+  void Read( Item& );
+  std::size_t Merge( std::size_t ixNext, std::size_t ixLimit, bool bWait, const fResult_t&, Stats& );
+};
+
+template<typename TS, typename R>
+InstrumentScanner<TS,R>::InstrumentScanner(
+  const std::string& sPath,
+  boost::posix_time::ptime dtBegin, boost::posix_time::ptime dtEnd,
+  typename TS::size_type nRequired,
+  std::size_t nThreads, std::size_t nBatch, std::size_t nInFlight
+)
+: m_sRootPath( sPath )
+, m_dtBegin( dtBegin ), m_dtEnd( dtEnd )
+, m_nRequired( nRequired )
+, m_nBatch( std::max<std::size_t>( 1, nBatch ) )
+, m_nInFlight( std::max<std::size_t>( 1, nInFlight ) )
+, m_nThreads( nThreads )
+, m_dm( ou::tf::HDF5DataManager::RO )
+, m_nComputed {}
+, m_bStop( false )
+{
+  if ( dtBegin >= dtEnd ) {
+    throw std::runtime_error( "dtBegin >= dtEnd" );
+  }
+  if ( 0 == m_nThreads ) {
+    m_nThreads = std::max<std::size_t>( 1, std::thread::hardware_concurrency() );
+  }
+}
+
+template<typename TS, typename R>
+InstrumentScanner<TS,R>::~InstrumentScanner() {
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_bStop = true;
+  }
+  m_cvWork.notify_all();
+  for ( std::thread& thread: m_vThread ) {
+    thread.join();
+  }
+}
+
+template<typename TS, typename R>
+void InstrumentScanner<TS,R>::Worker() {
+  while ( true ) {
+    std::size_t ix;
+    {
+      std::unique_lock<std::mutex> lock( m_mutex );
+      m_cvWork.wait( lock, [this](){ return m_bStop || !m_dequeWork.empty(); } );
+      if ( m_dequeWork.empty() ) break; // stopping
+      ix = m_dequeWork.front();
+      m_dequeWork.pop_front();
+    }
+
+    Item& item( m_vItem[ ix ] );
+    try {
+      item.bPassed = m_fCompute( item.sName, *item.pts, item.result );
+    }
+    catch ( const std::exception& e ) {
+      std::cout << "InstrumentScanner compute " << item.sName << " problem: " << e.what() << std::endl;
+      item.bPassed = false;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      item.bComputed = true;
+      m_nComputed++;
+    }
+    m_cvComputed.notify_one();
+  }
+}
+
+template<typename TS, typename R>
+void InstrumentScanner<TS,R>::Read( Item& item ) {
+  typename ou::tf::HDF5TimeSeriesContainer<typename TS::datum_t> tsRepository( m_dm, item.sPath );
+  typename ou::tf::HDF5TimeSeriesContainer<typename TS::datum_t>::iterator begin, end;
+  begin = std::lower_bound( tsRepository.begin(), tsRepository.end(), m_dtBegin );
+  end   = std::lower_bound( begin, tsRepository.end(), m_dtEnd );
+  hsize_t cnt = end - begin;
+  if ( m_nRequired <= cnt ) {
+    item.pts = std::make_unique<TS>();
+    item.pts->Resize( cnt );
+    tsRepository.Read( begin, end, item.pts.get() );
+    item.bRead = true;
+  }
+}
+
+// delivers, in order, items which have completed, optionally waiting for all up to ixLimit
+template<typename TS, typename R>
+std::size_t InstrumentScanner<TS,R>::Merge(
+  std::size_t ixNext, std::size_t ixLimit, bool bWait, const fResult_t& fResult, Stats& stats
+) {
+  while ( ixNext < ixLimit ) {
+    Item& item( m_vItem[ ixNext ] );
+    if ( item.bRead ) {
+      {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        if ( !item.bComputed ) {
+          if ( !bWait ) break;
+          m_cvComputed.wait( lock, [&item](){ return item.bComputed; } );
+        }
+      }
+      if ( item.bPassed ) {
+        stats.nPassed++;
+        fResult( item.sPath, item.sName, *item.pts, item.result );
+      }
+      item.pts.reset(); // release the series once delivered
+    }
+    ixNext++;
+  }
+  return ixNext;
+}
+
+template<typename TS, typename R>
+typename InstrumentScanner<TS,R>::Stats InstrumentScanner<TS,R>::Scan(
+  fUseGroup_t&& fUseGroup, fCompute_t&& fCompute, fResult_t&& fResult
+) {
+
+  Stats stats;
+  const auto tpBegin = std::chrono::steady_clock::now();
+
+  m_fCompute = std::move( fCompute );
+
+  // enumerate
+
+  m_vItem.clear();
+  {
+    bool bUseGroup( false );
+    ou::tf::hdf5::IterateGroups ig(
+      m_dm, m_sRootPath,
+      [&bUseGroup,&fUseGroup]( const std::string& sPath, const std::string& sGroup ){
+        bUseGroup = fUseGroup( sPath, sGroup );
+      },
+      [this,&bUseGroup]( const std::string& sPath, const std::string& sName ){
+        if ( bUseGroup ) m_vItem.emplace_back( sPath, sName );
+      }
+      );
+  }
+  stats.nDatasets = m_vItem.size();
+
+  // each batch is read, then queued to the workers while the next batch is read,
+  //   the workers never touch hdf5, so reads stay on this thread
+
+  for ( std::size_t ix = m_vThread.size(); ix < m_nThreads; ix++ ) {
+    m_vThread.emplace_back( [this](){ Worker(); } );
+  }
+
+  std::size_t ixMerge {};
+  for ( std::size_t ixBatch = 0; ixBatch < m_vItem.size(); ixBatch += m_nBatch ) {
+
+    const std::size_t ixBatchEnd = std::min( ixBatch + m_nBatch, m_vItem.size() );
+
+    const std::size_t nAhead = ( m_nInFlight - 1 ) * m_nBatch; // with this batch, m_nInFlight batches unmerged
+    if ( nAhead < ixBatch ) {
+      ixMerge = Merge( ixMerge, ixBatch - nAhead, true, fResult, stats );
+    }
+
+    const auto tpRead = std::chrono::steady_clock::now();
+    std::vector<std::size_t> vRead;
+    for ( std::size_t ix = ixBatch; ix < ixBatchEnd; ix++ ) {
+      Item& item( m_vItem[ ix ] );
+      try {
+        Read( item );
+      }
+      catch ( const H5::Exception& e ) {
+        std::cout << "InstrumentScanner read " << item.sPath << " problem: " << e.getDetailMsg() << std::endl;
+      }
+      catch ( const std::exception& e ) {
+        std::cout << "InstrumentScanner read " << item.sPath << " problem: " << e.what() << std::endl;
+      }
+      if ( item.bRead ) vRead.push_back( ix );
+    }
+    stats.dblSecondsRead += std::chrono::duration<double>( std::chrono::steady_clock::now() - tpRead ).count();
+    stats.nRead += vRead.size();
+
+    {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      m_dequeWork.insert( m_dequeWork.end(), vRead.begin(), vRead.end() );
+    }
+    m_cvWork.notify_all();
+
+    ixMerge = Merge( ixMerge, ixBatch, false, fResult, stats ); // prior batches, as far as they are done
+  }
+
+  Merge( ixMerge, m_vItem.size(), true, fResult, stats );
+  m_vItem.clear();
+
+  stats.dblSecondsTotal = std::chrono::duration<double>( std::chrono::steady_clock::now() - tpBegin ).count();
+
+  std::cout
+    << "InstrumentScanner " << m_sRootPath
+    << ": datasets=" << stats.nDatasets
+    << ",read=" << stats.nRead
+    << ",passed=" << stats.nPassed
+    << ",threads=" << m_nThreads
+    << ",read_s=" << stats.dblSecondsRead
+    << ",total_s=" << stats.dblSecondsTotal
+    << ",instruments/s=" << stats.InstrumentsPerSecond()
+    << std::endl;
+
+  return stats;
+}
+
+} // namespace tf
+} // namespace ou
@@ -16,11 +16,27 @@
 #include <TFHDF5TimeSeries/HDF5IterateGroups.h>
 #include <TFHDF5TimeSeries/HDF5TimeSeriesContainer.h>
 
+#include "InstrumentScanner.h"
+
 #include "InstrumentSelection.h"
 
 namespace ou { // One Unified
 namespace tf { // TradeFrame
 
+struct AverageVolume {
+private:
+  ou::tf::Bar::volume_t m_nTotalVolume;
+  unsigned long m_nNumberOfValues;
+protected:
+public:
+  AverageVolume() : m_nTotalVolume( 0 ), m_nNumberOfValues( 0 ) {};
+  void operator() ( const ou::tf::Bar& bar ) {
+    m_nTotalVolume += bar.Volume();
+    ++m_nNumberOfValues;
+  }
+  operator ou::tf::Bar::volume_t() { return m_nTotalVolume / m_nNumberOfValues; };
+};
+
 InstrumentSelection::InstrumentSelection(void): m_dm( ou::tf::HDF5DataManager::RO ) {
 }
 
@@ -34,15 +50,29 @@ void InstrumentSelection::Process( const ptime& eod, setInfo_t& selected ) {
   m_dtDate1 = eod - date_duration( m_nDaysToAverage );  // average two weeks of volume
   m_dtDate2 = eod;
 
-  std::cout << "Running" << std::endl;
+  // average volume and price filter on the worker pool, ranking merged in hdf5 order
+  struct Result {
+    ou::tf::Bar::volume_t volAverage;
+  };
 
-  ou::tf::HDF5IterateGroups groups;
-  groups.SetOnHandleObject( MakeDelegate( this, &InstrumentSelection::ProcessGroupItem ) );
   try {
-    int result = groups.Start( "/bar/86400/" );
+    ou::tf::InstrumentScanner<ou::tf::Bars,Result> scanner( "/bar/86400/", m_dtDate1, m_dtDate2, 9 );
+    scanner.Scan(
+      []( const std::string&, const std::string& )->bool{ return true; },
+      []( const std::string&, const ou::tf::Bars& bars, Result& result )->bool{
+        result.volAverage = std::for_each( bars.begin(), bars.end(), AverageVolume() );
+        return ( 1000000 < result.volAverage )
+          && ( 12.0 <= bars.last().Close() )
+          && ( 80.0 >= bars.last().Close() );
+      },
+      [this]( const std::string&, const std::string& sObjectName, const ou::tf::Bars& bars, Result& result ){
+        Info info( sObjectName, bars.last() );
+        m_mapInfoRankedByVolume.insert( pairInfoRankedByVolume_t( result.volAverage, info ) );
+      }
+      );
   }
-  catch (...) {
-    std::cout << "ouch" << std::endl;
+  catch ( const std::runtime_error& e ) {
+    std::cout << "InstrumentSelection::Process " << e.what() << std::endl;
   }
 
   std::cout << "History Scanned." << std::endl;
@@ -56,20 +86,6 @@ void InstrumentSelection::Process( const ptime& eod, setInfo_t& selected ) {
 
 }
 
-struct AverageVolume {
-private:
-  ou::tf::Bar::volume_t m_nTotalVolume;
-  unsigned long m_nNumberOfValues;
-protected:
-public:
-  AverageVolume() : m_nTotalVolume( 0 ), m_nNumberOfValues( 0 ) {};
-  void operator() ( const ou::tf::Bar& bar ) {
-    m_nTotalVolume += bar.Volume();
-    ++m_nNumberOfValues;
-  }
-  operator ou::tf::Bar::volume_t() { return m_nTotalVolume / m_nNumberOfValues; };
-};
-
 void InstrumentSelection::ProcessGroupItem( const std::string& sObjectPath, const std::string& sObjectName ) {
   ou::tf::HDF5TimeSeriesContainer<ou::tf::Bar> barRepository( m_dm, sObjectPath );
   ou::tf::HDF5TimeSeriesContainer<ou::tf::Bar>::iterator begin, end;
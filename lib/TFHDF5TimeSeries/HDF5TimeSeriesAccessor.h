@@ -37,7 +37,7 @@ public:
   size_type size() const { return m_curElementCount; };
   void Read( hsize_t index, DD* );
   void Read( hsize_t ixStart, hsize_t count, H5::DataSpace *pMemoryDataSpace, DD* pDatedDatum );
-  void Write( hsize_t ixStart, size_t count, const DD* );
+  void Write( hsize_t ixStart, size_t count, const DD* ); // reports, then rethrows, a failed write
 protected:
   std::string m_sPathName;
   H5::DataSet* m_pDiskDataSet;
@@ -206,10 +206,15 @@ template<class DD> void HDF5TimeSeriesAccessor<DD>::Write( hsize_t ixStart, size
     catch ( H5::Exception e ) {
       std::cout << "HDF5TimeSeriesAccessor<DD>::Write H5::Exception " << e.getDetailMsg() << std::endl;
       e.walkErrorStack( H5E_WALK_DOWNWARD, (H5E_walk2_t) &HDF5DataManager::PrintH5ErrorStackItem, this );
+      throw; // so HDF5WriteTimeSeries can report the failed write
     }
   }
+  catch ( const H5::Exception& ) {
+    throw;
+  }
   catch (...) {
     std::cout << "unknown error in HDF5TimeSeriesAccessor<DD>::Write" << std::endl;
+    throw;
   }
 }
 
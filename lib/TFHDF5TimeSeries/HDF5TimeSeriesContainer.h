@@ -40,7 +40,8 @@ public:
   const iterator &end();
   //void Read( const iterator &_begin, const iterator &_end, T* _dest );
   void Read( iterator &_begin, iterator &_end, typename ou::tf::TimeSeries<DD>* _dest );
-  void Write( const DD* _begin, const DD* _end );
+  hsize_t Write( const DD* _begin, const DD* _end ); // returns the index following the written elements
+  hsize_t Write( hsize_t ix, const DD* _begin, const DD* _end ); // continue at ix, for the following blocks of a series
 protected:
   iterator* m_end;
   virtual void SetNewSize( size_type newsize );
@@ -77,22 +78,42 @@ template<class DD> void HDF5TimeSeriesContainer<DD>::SetNewSize( size_type newsi
 
 template<class DD> void HDF5TimeSeriesContainer<DD>::Read( iterator& _begin, iterator& _end, typename ou::tf::TimeSeries<DD>* _dest ) {
   hsize_t cnt = _end - _begin;
-  H5::DataSpace* pDs = _dest->DefineDataSpace();
+  assert( cnt <= _dest->Size() ); // caller has Resize'd the destination
   if ( cnt > 0 ) {
-    HDF5TimeSeriesAccessor<DD>::Read( _begin.m_ItemIndex, cnt, pDs, const_cast<DD*>( &(*_dest->First()) ) );
+    // destination is stored in blocks, each is one contiguous hyperslab read
+    hsize_t ixSource = _begin.m_ItemIndex;
+    _dest->ForEachBlock( [this,&ixSource,&cnt]( DD* pBlock, typename TimeSeries<DD>::size_type n ){
+      const hsize_t nRead = std::min<hsize_t>( n, cnt );
+      if ( 0 < nRead ) {
+        H5::DataSpace dsMemory( 1, &nRead );
+        HDF5TimeSeriesAccessor<DD>::Read( ixSource, nRead, &dsMemory, pBlock );
+        dsMemory.close();
+        ixSource += nRead;
+        cnt -= nRead;
+      }
+    } );
   }
-  pDs->close();
-  delete pDs;
 }
 
-template<class DD> void HDF5TimeSeriesContainer<DD>::Write( const DD* _begin, const DD* _end ) {
+template<class DD> hsize_t HDF5TimeSeriesContainer<DD>::Write( const DD* _begin, const DD* _end ) {
   size_t cnt = _end - _begin;
+  hsize_t ix {};
   if ( cnt > 0 ) {
     std::pair<HDF5TimeSeriesContainer<DD>::iterator, HDF5TimeSeriesContainer<DD>::iterator> p;
     p = std::equal_range( begin(), end(), *_begin );
     // whether we found something or not, p.first is insertion point
-    HDF5TimeSeriesAccessor<DD>::Write( p.first.m_ItemIndex, cnt, _begin );
+    ix = p.first.m_ItemIndex;
+    HDF5TimeSeriesAccessor<DD>::Write( ix, cnt, _begin );
   }
+  return ix + cnt;
+}
+
+template<class DD> hsize_t HDF5TimeSeriesContainer<DD>::Write( hsize_t ix, const DD* _begin, const DD* _end ) {
+  size_t cnt = _end - _begin;
+  if ( cnt > 0 ) {
+    HDF5TimeSeriesAccessor<DD>::Write( ix, cnt, _begin );
+  }
+  return ix + cnt;
 }
 
 } // namespace tf
@@ -0,0 +1,181 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    HDF5WriteQueue.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFHDF5TimeSeries
+ * Created: October 19, 2026 22:10
+ */
+
+#include <cassert>
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+
+#include "HDF5WriteQueue.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+HDF5WriteQueue::HDF5WriteQueue( const Options& options )
+: m_options( options )
+, m_bWriting( false ), m_bStop( false )
+{
+  assert( 0 < m_options.nMaxBatches );
+  assert( ( 0 <= m_options.nDeflate ) && ( 9 >= m_options.nDeflate ) );
+  assert( ( 0 < m_options.nChunkMin ) && ( m_options.nChunkMin <= m_options.nChunkMax ) );
+  m_thread = std::thread( [this](){ Run(); } );
+}
+
+HDF5WriteQueue::~HDF5WriteQueue() {
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_bStop = true;
+  }
+  m_cvNotEmpty.notify_one();
+  m_thread.join();
+}
+
+// a chunk sized to the first write: small series are not padded out, large ones are not split finely
+hsize_t HDF5WriteQueue::ChunkFor( size_t nRows ) const {
+  hsize_t nChunk( m_options.nChunkMin );
+  while ( ( nChunk < nRows ) && ( nChunk < m_options.nChunkMax ) ) nChunk <<= 1;
+  return std::min( nChunk, m_options.nChunkMax );
+}
+
+void HDF5WriteQueue::Enqueue( fWrite_t&& fWrite ) {
+  std::unique_lock<std::mutex> lock( m_mutex );
+  m_cvNotFull.wait( lock, [this](){ return m_queue.size() < m_options.nMaxBatches; } );
+  m_queue.emplace_back( std::move( fWrite ) );
+  m_stats.nDepth = m_queue.size();
+  m_stats.nDepthMax = std::max( m_stats.nDepthMax, m_stats.nDepth );
+  lock.unlock();
+  m_cvNotEmpty.notify_one();
+}
+
+void HDF5WriteQueue::Drain() {
+  std::unique_lock<std::mutex> lock( m_mutex );
+  m_cvIdle.wait( lock, [this](){ return m_queue.empty() && !m_bWriting; } );
+}
+
+HDF5WriteQueue::Stats HDF5WriteQueue::GetStats() const {
+  std::lock_guard<std::mutex> lock( m_mutex );
+  return m_stats;
+}
+
+void HDF5WriteQueue::Report( std::chrono::steady_clock::duration duration, size_t nRows ) {
+  const double dblSeconds = std::chrono::duration<double>( duration ).count();
+  const Stats stats( GetStats() );
+  std::cout
+    << "HDF5WriteQueue: "
+    << (size_t)( ( 0.0 < dblSeconds ) ? ( (double)nRows / dblSeconds ) : 0.0 ) << " rows/s"
+    << ", " << stats.nBatches << " batches"
+    << ", " << stats.nRows << " rows"
+    << ", queue " << stats.nDepth << "/" << m_options.nMaxBatches
+    << " (max " << stats.nDepthMax << ")"
+    << std::endl;
+}
+
+void HDF5WriteQueue::Run() {
+
+  using clock_t = std::chrono::steady_clock;
+
+  std::unique_ptr<HDF5DataManager> pdm;
+  if ( m_options.sFileName.empty() ) {
+    pdm = std::make_unique<HDF5DataManager>( HDF5DataManager::RDWR );
+  }
+  else {
+    pdm = std::make_unique<HDF5DataManager>( HDF5DataManager::RDWR, m_options.sFileName );
+  }
+
+  const bool bReport( std::chrono::seconds::zero() < m_options.intervalReport );
+  clock_t::time_point tpReport( clock_t::now() );
+  size_t nRowsReport {};
+
+  std::unique_lock<std::mutex> lock( m_mutex );
+  while ( true ) {
+
+    if ( bReport ) {
+      m_cvNotEmpty.wait_until( lock, tpReport + m_options.intervalReport, [this](){ return m_bStop || !m_queue.empty(); } );
+    }
+    else {
+      m_cvNotEmpty.wait( lock, [this](){ return m_bStop || !m_queue.empty(); } );
+    }
+
+    if ( !m_queue.empty() ) {
+
+      fWrite_t fWrite( std::move( m_queue.front() ) );
+      m_queue.pop_front();
+      m_stats.nDepth = m_queue.size();
+      m_bWriting = true;
+      lock.unlock();
+      m_cvNotFull.notify_one();
+
+      size_t nRows {};
+      bool bError( false );
+      try {
+        nRows = fWrite( *pdm );
+      }
+      catch ( const H5::Exception& e ) {
+        std::cout << "HDF5WriteQueue: " << e.getDetailMsg() << std::endl;
+        bError = true;
+      }
+      catch ( const std::exception& e ) {
+        std::cout << "HDF5WriteQueue: " << e.what() << std::endl;
+        bError = true;
+      }
+      fWrite = nullptr; // release the series outside the lock
+
+      lock.lock();
+      m_bWriting = false;
+      m_stats.nBatches++;
+      m_stats.nRows += nRows;
+      if ( bError ) m_stats.nErrors++;
+      nRowsReport += nRows;
+      if ( m_queue.empty() ) {
+        m_cvIdle.notify_all();
+      }
+    }
+    else {
+      if ( m_bStop ) break;
+    }
+
+    if ( bReport ) {
+      const clock_t::time_point tpNow( clock_t::now() );
+      if ( ( tpReport + m_options.intervalReport ) <= tpNow ) {
+        if ( 0 < nRowsReport ) {
+          lock.unlock();
+          Report( tpNow - tpReport, nRowsReport );
+          lock.lock();
+        }
+        tpReport = tpNow;
+        nRowsReport = 0;
+      }
+    }
+  }
+
+  lock.unlock();
+  if ( bReport ) {
+    const Stats stats( GetStats() );
+    std::cout
+      << "HDF5WriteQueue: done, " << stats.nBatches << " batches, " << stats.nRows << " rows"
+      << ", max queue " << stats.nDepthMax
+      << ", " << stats.nErrors << " errors"
+      << std::endl;
+  }
+}
+
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,117 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    HDF5WriteQueue.h
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFHDF5TimeSeries
+ * Created: October 19, 2026 22:10
+ */
+
+#pragma once
+
+// single writer for many producers: completed series are queued to one thread,
+//   which keeps the hdf5 file open and performs all the writes
+// Write takes over the contents of the series (Swap), and blocks while the queue is full
+
+#include <mutex>
+#include <deque>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <stdexcept>
+#include <functional>
+#include <condition_variable>
+
+#include "HDF5DataManager.h"
+#include "HDF5WriteTimeSeries.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+class HDF5WriteQueue {
+public:
+
+  struct Options {
+    std::string sFileName;  // empty for HDF5DataManager::GetHdf5FileDefault()
+    size_t nMaxBatches;     // queue bound, producers wait beyond this
+    int nDeflate;           // 0 for no compression, otherwise 1 .. 9
+    hsize_t nChunkMin;      // chunk elements follow the first write of a series, within these bounds
+    hsize_t nChunkMax;
+    std::chrono::seconds intervalReport; // 0 for no progress lines
+    Options()
+    : nMaxBatches( 64 ), nDeflate( 0 ), nChunkMin( 64 ), nChunkMax( 4096 )
+    , intervalReport( 5 )
+    {}
+  };
+
+  struct Stats {
+    size_t nBatches;
+    size_t nRows;
+    size_t nDepth;     // batches waiting
+    size_t nDepthMax;
+    size_t nErrors;    // batches which failed to write
+    Stats(): nBatches {}, nRows {}, nDepth {}, nDepthMax {}, nErrors {} {}
+  };
+
+  HDF5WriteQueue( const Options& = Options() );
+  ~HDF5WriteQueue(); // writes what is queued, then closes the file
+
+  template<typename TS>
+  void Write( const std::string& sPath, TS& series ) {
+    auto pSeries = std::make_shared<TS>();
+    pSeries->Swap( series );
+    Enqueue(
+      [this,sPath,pSeries]( HDF5DataManager& dm )->size_t {
+        HDF5WriteTimeSeries<TS> wts( dm, 0 < m_options.nDeflate, true, m_options.nDeflate, ChunkFor( pSeries->Size() ) );
+        if ( !wts.Write( sPath, pSeries.get() ) ) {
+          throw std::runtime_error( "write failed for " + sPath ); // counted in nErrors
+        }
+        return pSeries->Size();
+      } );
+  }
+
+  void Drain(); // returns once the queued batches are written, the file is flushed on destruction
+  Stats GetStats() const;
+
+protected:
+private:
+
+  using fWrite_t = std::function<size_t(HDF5DataManager&)>; // returns rows written
+  using queue_t = std::deque<fWrite_t>;
+
+  const Options m_options;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_cvNotEmpty;
+  std::condition_variable m_cvNotFull;
+  std::condition_variable m_cvIdle;
+
+  queue_t m_queue;
+  bool m_bWriting;
+  bool m_bStop;
+
+  Stats m_stats;
+
+  std::thread m_thread;
+
+  hsize_t ChunkFor( size_t nRows ) const;
+  void Enqueue( fWrite_t&& );
+  void Run();
+  void Report( std::chrono::steady_clock::duration, size_t nRows );
+};
+
+} // namespace tf
+} // namespace ou
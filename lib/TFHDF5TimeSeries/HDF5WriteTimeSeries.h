@@ -15,6 +15,7 @@
 #pragma once
 
 #include <string>
+#include <optional>
 #include <stdexcept>
 
 #include "HDF5TimeSeriesContainer.h"
@@ -31,7 +32,9 @@ public:
   HDF5WriteTimeSeries<TS>( HDF5DataManager& dm );  // dm needs to be read/write
   HDF5WriteTimeSeries<TS>( HDF5DataManager& dm, bool bDeflatable, bool bExpandable, int nDeflate = 5, hsize_t nChunkSize = 1024 );
   virtual ~HDF5WriteTimeSeries<TS>( void );
-  void Write( const std::string &sPathName, TS* timeseries );
+  // returns the stored index of its first element: positioned by key, it overwrites from there
+  //   empty when the write failed, the failure is reported on cout, the dataset may hold part of the series
+  std::optional<hsize_t> Write( const std::string &sPathName, TS* timeseries );
 
 protected:
 private:
@@ -57,7 +60,7 @@ template<class TS> HDF5WriteTimeSeries<TS>::HDF5WriteTimeSeries( HDF5DataManager
 template<class TS> HDF5WriteTimeSeries<TS>::~HDF5WriteTimeSeries() {
 }
 
-template<class TS> void HDF5WriteTimeSeries<TS>::Write(const std::string &sPathName, TS* timeseries) {
+template<class TS> std::optional<hsize_t> HDF5WriteTimeSeries<TS>::Write(const std::string &sPathName, TS* timeseries) {
 
   if ( 0 == timeseries->Size() ) {
     throw std::invalid_argument( "zero length time series found" );
@@ -122,19 +125,34 @@ template<class TS> void HDF5WriteTimeSeries<TS>::Write(const std::string &sPathN
     e.walkErrorStack( H5E_WALK_DOWNWARD, (H5E_walk2_t) &HDF5DataManager::PrintH5ErrorStackItem, this );
   }
 
+  hsize_t ixFirst {};
   try {
     HDF5TimeSeriesContainer<DD> repository( m_dm, sPathName );
-    repository.Write( timeseries->First(), timeseries->Last() + 1 );
+    // series is stored in blocks: the first is positioned by its key, the rest follow it
+    const TS* pts( timeseries );
+    bool bFirst( true );
+    hsize_t ix {};
+    pts->ForEachBlock( [&repository,&bFirst,&ix,&ixFirst]( const DD* pBlock, typename TS::size_type n ){
+      ix = bFirst ? repository.Write( pBlock, pBlock + n ) : repository.Write( ix, pBlock, pBlock + n );
+      if ( bFirst ) ixFirst = ix - n;
+      bFirst = false;
+    } );
     //dm.AddGroupForSymbol( m_sSymbol );
     //dm.GetH5File()->link( H5L_type_t::H5L_TYPE_HARD, sFileName1, "/symbol/" + m_sSymbol + "/bar.86400" );
   }
   catch ( H5::FileIException e ) {
     std::cout << "H5::FileIException " << e.getDetailMsg() << std::endl;
     e.walkErrorStack( H5E_WALK_DOWNWARD, (H5E_walk2_t) &HDF5DataManager::PrintH5ErrorStackItem, this );
+    return std::nullopt;
+  }
+  catch ( const H5::Exception& ) { // reported by HDF5TimeSeriesAccessor::Write
+    return std::nullopt;
   }
   catch ( ... ) {
     std::cout << "CHistoryCollectorDaily::WriteData:  unknown error 2" << std::endl;
+    return std::nullopt;
   }
+  return ixFirst;
 }
 
 
@@ -22,6 +22,7 @@
 
 #include <OUCommon/Debug.h>
 #include <OUCommon/Network.h>
+#include <OUCommon/LatencyTrace.h>
 #include <OUCommon/ReusableBuffers.h>
 
 #include "SymbolLookup.h"
@@ -268,6 +269,7 @@ void IQFeed<T>::OnNetworkLineBuffer( linebuffer_t* pBuffer ) {
           case v49: {
             IQFUpdateMessage* msg = m_reposUpdateMessages.CheckOutL();
             msg->Assign( iter, end );
+            TF_LATENCY_STAGE( "iqfeed.tokenised" );
             if ( &IQFeed<T>::OnIQFeedUpdateMessage != &T::OnIQFeedUpdateMessage ) {
               static_cast<T*>( this )->OnIQFeedUpdateMessage( pBuffer, msg);
             }
@@ -280,6 +282,7 @@ void IQFeed<T>::OnNetworkLineBuffer( linebuffer_t* pBuffer ) {
           case v62: {
             IQFDynamicFeedUpdateMessage* msg = m_reposDynamicFeedUpdateMessages.CheckOutL();
             msg->Assign( iter, end );
+            TF_LATENCY_STAGE( "iqfeed.tokenised" );
             if ( &IQFeed<T>::OnIQFeedDynamicFeedUpdateMessage != &T::OnIQFeedDynamicFeedUpdateMessage ) {
               static_cast<T*>( this )->OnIQFeedDynamicFeedUpdateMessage( pBuffer, msg);
             }
@@ -177,6 +177,13 @@ public:
     }
   }
 
+  void MoveParsedStructure( trd_t&& trd ) {
+    auto result = m_symbols.insert( std::move( trd ) );
+    if ( !result.second ) {
+      assert( result.second );
+    }
+  }
+
   void operator()( const trd_t& trd ) {
     m_symbols.insert( trd );
   }
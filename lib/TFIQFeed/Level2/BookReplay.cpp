@@ -0,0 +1,437 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    BookReplay.cpp
+ * Author:  raymond@burkholder.net
+ * Project: TFIQFeed/Level2
+ * Created: October 19, 2026 21:05
+ */
+
+#include <algorithm>
+
+#include <TFHDF5TimeSeries/HDF5Attribute.h>
+#include <TFHDF5TimeSeries/HDF5DataManager.h>
+#include <TFHDF5TimeSeries/HDF5WriteTimeSeries.h>
+#include <TFHDF5TimeSeries/HDF5TimeSeriesContainer.h>
+
+#include "BookReplay.hpp"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace iqfeed { // IQFeed
+namespace l2 { // level 2 data
+
+namespace {
+
+  static const size_t c_nWindow = 64 * 1024; // depth rows read at a time
+
+  bool DataSetExists( ou::tf::HDF5DataManager& dm, const std::string& sPath ) {
+    bool bExists( false );
+    H5E_BEGIN_TRY { // absence is expected, so no error stack printout
+      const hid_t id = H5Dopen2( dm.GetH5File()->getId(), sPath.c_str(), H5P_DEFAULT );
+      if ( 0 <= id ) {
+        H5Dclose( id );
+        bExists = true;
+      }
+    } H5E_END_TRY;
+    return bExists;
+  }
+
+  void Read( ou::tf::HDF5TimeSeriesContainer<ou::tf::DepthByOrder>& container, size_t ix, size_t n, ou::tf::DepthsByOrder& dest ) {
+    dest.Resize( n );
+    auto begin = container.begin();
+    begin += ix;
+    auto end = begin;
+    end += n;
+    container.Read( begin, end, &dest );
+  }
+
+} // namespace anonymous
+
+// ==== LimitOrders
+
+void LimitOrders::Apply( const ou::tf::DepthByOrder& depth ) {
+  switch ( depth.MsgType() ) {
+    case '3': // add
+    case '6': // summary
+      m_mapOrder.emplace( depth.OrderID(), Order{ depth.Price(), depth.Volume(), depth.Priority(), depth.Side() } );
+      break;
+    case '4': { // update
+        mapOrder_t::iterator iter = m_mapOrder.find( depth.OrderID() );
+        if ( m_mapOrder.end() != iter ) {
+          iter->second.dblPrice = depth.Price();
+          iter->second.nQuantity = depth.Volume();
+        }
+      }
+      break;
+    case '5': // delete
+      m_mapOrder.erase( depth.OrderID() );
+      break;
+    case 'C': // clear the side
+      for ( mapOrder_t::iterator iter = m_mapOrder.begin(); m_mapOrder.end() != iter; ) {
+        if ( depth.Side() == iter->second.chSide ) iter = m_mapOrder.erase( iter );
+        else iter++;
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+void LimitOrders::Emit( boost::posix_time::ptime dt, vDepth_t& vDepth ) const {
+  vDepth.clear();
+  vDepth.reserve( m_mapOrder.size() );
+  for ( const mapOrder_t::value_type& vt: m_mapOrder ) {
+    const Order& order( vt.second );
+    vDepth.emplace_back( dt, dt, vt.first, order.nPriority, '6', order.chSide, order.dblPrice, order.nQuantity );
+  }
+  std::sort(
+    vDepth.begin(), vDepth.end(),
+    []( const ou::tf::DepthByOrder& lhs, const ou::tf::DepthByOrder& rhs ){
+      return ( lhs.Priority() < rhs.Priority() ) || ( ( lhs.Priority() == rhs.Priority() ) && ( lhs.OrderID() < rhs.OrderID() ) );
+    } );
+}
+
+// ==== Snapshots
+
+std::string Snapshots::Path( const std::string& sPathDepth ) {
+  static const std::string sDirectory( ou::tf::DepthsByOrder::Directory() ); // "/depths_o/"
+  std::string sPath( sPathDepth );
+  const std::string::size_type ix = sPath.rfind( sDirectory );
+  if ( std::string::npos == ix ) {
+    sPath += ".snapshot";
+  }
+  else {
+    sPath.replace( ix, sDirectory.size(), "/depths_o_snapshot/" );
+  }
+  return sPath;
+}
+
+Snapshots::Snapshots( size_t nInterval )
+: m_nInterval( nInterval ), m_nRows {}, m_nSnapshots {}
+{
+  assert( 0 < m_nInterval );
+}
+
+void Snapshots::Append( const ou::tf::DepthByOrder& depth ) {
+  if ( ( 0 < m_nRows ) && ( 0 == ( m_nRows % m_nInterval ) ) ) {
+    if ( m_dtLastSnapshot.is_not_a_date_time() || ( m_dtLastSnapshot < m_dtLastRow ) ) {
+      m_dtLastSnapshot = m_dtLastRow;
+      m_nSnapshots++;
+      m_orders.Emit( m_dtLastRow, m_vOrder );
+      m_pending.Append( ou::tf::DepthByOrder( m_dtLastRow, m_dtLastRow, m_nRows, m_vOrder.size(), c_chHeader, ' ' ) );
+      for ( const ou::tf::DepthByOrder& order: m_vOrder ) m_pending.Append( order );
+    }
+  }
+  m_orders.Apply( depth );
+  m_dtLastRow = depth.DateTime();
+  m_nRows++;
+}
+
+void Snapshots::Resume( ou::tf::HDF5DataManager& dm, const std::string& sPathDepth, size_t ixRow ) {
+
+  m_orders.Clear();
+  m_pending.Clear();
+  m_nSnapshots = 0;
+  m_dtLastRow = boost::posix_time::ptime();
+  m_dtLastSnapshot = boost::posix_time::ptime();
+
+  size_t ixReplay {}; // first stored row to re-apply
+
+  const std::string sPath( Path( sPathDepth ) );
+  if ( DataSetExists( dm, sPath ) ) {
+    size_t nKeep {}; // records of the snapshots still valid
+    size_t ixHeader {};
+    size_t nOrders {};
+    {
+      ou::tf::HDF5TimeSeriesContainer<ou::tf::DepthByOrder> snapshots( dm, sPath );
+      const size_t nRecords( snapshots.size() );
+      ou::tf::DepthsByOrder record;
+      while ( nKeep < nRecords ) {
+        Read( snapshots, nKeep, 1, record );
+        const ou::tf::DepthByOrder& header( record.At( 0 ) );
+        if ( ( c_chHeader != header.MsgType() ) || ( ixRow < header.OrderID() ) || ( nRecords < ( nKeep + 1 + header.Priority() ) ) ) break;
+        ixHeader = nKeep;
+        nOrders = header.Priority();
+        ixReplay = header.OrderID();
+        m_dtLastSnapshot = header.DateTime();
+        m_dtLastRow = header.DateTime();
+        m_nSnapshots++;
+        nKeep += 1 + header.Priority();
+      }
+      if ( 0 < m_nSnapshots ) {
+        Read( snapshots, ixHeader + 1, nOrders, record );
+        record.ForEachBlock( [this]( const ou::tf::DepthByOrder* pDepth, ou::tf::DepthsByOrder::size_type n ){
+          for ( ou::tf::DepthsByOrder::size_type ix = 0; ix < n; ix++ ) m_orders.Apply( pDepth[ ix ] );
+        } );
+      }
+      if ( nKeep < nRecords ) {
+        std::cout << "Snapshots: " << sPath << " truncated to " << nKeep << " of " << nRecords << " records" << std::endl;
+      }
+    }
+    const hid_t id = H5Dopen2( dm.GetH5File()->getId(), sPath.c_str(), H5P_DEFAULT );
+    if ( 0 <= id ) {
+      const hsize_t size( nKeep );
+      H5Dset_extent( id, &size ); // a no-op when nothing is dropped
+      H5Dclose( id );
+    }
+  }
+
+  if ( ixReplay < ixRow ) {
+    ou::tf::HDF5TimeSeriesContainer<ou::tf::DepthByOrder> depths( dm, sPathDepth );
+    ou::tf::DepthsByOrder block;
+    for ( size_t ix = ixReplay; ix < ixRow; ix += c_nWindow ) {
+      Read( depths, ix, std::min( c_nWindow, ixRow - ix ), block );
+      block.ForEachBlock( [this]( const ou::tf::DepthByOrder* pDepth, ou::tf::DepthsByOrder::size_type n ){
+        for ( ou::tf::DepthsByOrder::size_type ixDepth = 0; ixDepth < n; ixDepth++ ) m_orders.Apply( pDepth[ ixDepth ] );
+        m_dtLastRow = pDepth[ n - 1 ].DateTime();
+      } );
+    }
+  }
+
+  m_nRows = ixRow;
+}
+
+void Snapshots::Write( ou::tf::HDF5DataManager& dm, const std::string& sPathDepth ) {
+  if ( 0 != m_pending.Size() ) {
+    const std::string sPath( Path( sPathDepth ) );
+    const bool bNew( !DataSetExists( dm, sPath ) );
+    ou::tf::HDF5WriteTimeSeries<ou::tf::DepthsByOrder> wts( dm, true, true, 5, 256 );
+    wts.Write( sPath, &m_pending );
+    if ( bNew ) {
+      ou::tf::HDF5Attributes attr( dm, sPath );
+      attr.SetSignature( ou::tf::DepthByOrder::Signature() );
+    }
+    m_pending.Clear();
+  }
+}
+
+size_t Snapshots::Build( ou::tf::HDF5DataManager& dm, const std::string& sPathDepth, size_t nInterval ) {
+
+  const std::string sPath( Path( sPathDepth ) );
+  if ( DataSetExists( dm, sPath ) ) {
+    dm.GetH5File()->unlink( sPath );
+  }
+
+  Snapshots snapshots( nInterval );
+
+  ou::tf::HDF5TimeSeriesContainer<ou::tf::DepthByOrder> depths( dm, sPathDepth );
+  const size_t nRows( depths.size() );
+  ou::tf::DepthsByOrder block;
+
+  for ( size_t ix = 0; ix < nRows; ix += c_nWindow * 16 ) {
+    const size_t n = std::min( c_nWindow * 16, nRows - ix );
+    block.Resize( n );
+    auto begin = depths.begin();
+    begin += ix;
+    auto end = begin;
+    end += n;
+    depths.Read( begin, end, &block );
+    block.ForEachBlock( [&snapshots]( const ou::tf::DepthByOrder* pDepth, ou::tf::DepthsByOrder::size_type nDepth ){
+      for ( ou::tf::DepthsByOrder::size_type ixDepth = 0; ixDepth < nDepth; ixDepth++ ) snapshots.Append( pDepth[ ixDepth ] );
+    } );
+    snapshots.Write( dm, sPathDepth );
+  }
+
+  return snapshots.Count();
+}
+
+// ==== BookReplay
+
+BookReplay::BookReplay( const std::string& sFileName, const std::string& sPathDepth )
+: m_nRows {}
+, m_ixWindow {}
+, m_ixRow {}
+, m_bStop( false ), m_bAnchor( true )
+, m_dblRate( 1.0 )
+{
+  m_pdm = std::make_unique<ou::tf::HDF5DataManager>( ou::tf::HDF5DataManager::RO, sFileName );
+  m_pDepths = std::make_unique<container_t>( *m_pdm, sPathDepth ); // throws when not found
+  m_nRows = m_pDepths->size();
+  if ( 0 < m_nRows ) {
+    m_dtBegin = Row( 0 ).DateTime();
+    m_dtEnd = Row( m_nRows - 1 ).DateTime();
+  }
+
+  const std::string sPathSnapshot( Snapshots::Path( sPathDepth ) );
+  if ( DataSetExists( *m_pdm, sPathSnapshot ) ) {
+    m_pSnapshots = std::make_unique<container_t>( *m_pdm, sPathSnapshot );
+    LoadSnapshotIndex();
+  }
+  else {
+    std::cout << "BookReplay: no snapshots for " << sPathDepth << ", seeks replay from the start, see Snapshots::Build" << std::endl;
+  }
+}
+
+BookReplay::~BookReplay() {
+  Stop();
+  m_pSnapshots.reset();
+  m_pDepths.reset();
+  m_pdm.reset();
+}
+
+void BookReplay::LoadSnapshotIndex() {
+  const size_t nRecords( m_pSnapshots->size() );
+  ou::tf::DepthsByOrder record;
+  size_t ix {};
+  while ( ix < nRecords ) {
+    Read( *m_pSnapshots, ix, 1, record );
+    const ou::tf::DepthByOrder& header( record.At( 0 ) );
+    if ( ( Snapshots::c_chHeader != header.MsgType() ) || ( m_nRows < header.OrderID() ) || ( nRecords < ( ix + 1 + header.Priority() ) ) ) {
+      std::cout << "BookReplay: snapshot record " << ix << " is not a header, index truncated" << std::endl;
+      break;
+    }
+    m_vSnapshot.push_back( Snapshot{ header.DateTime(), header.OrderID(), ix, header.Priority() } );
+    ix += 1 + header.Priority();
+  }
+}
+
+void BookReplay::Set( fBookChanges_t&& fBid, fBookChanges_t&& fAsk ) {
+  std::lock_guard<std::mutex> lock( m_mutex );
+  m_book.Set( std::move( fBid ), std::move( fAsk ) );
+}
+
+BookReplay::ptime BookReplay::Position() const {
+  std::lock_guard<std::mutex> lock( m_mutex );
+  return m_dtPosition;
+}
+
+const ou::tf::DepthByOrder& BookReplay::Row( size_t ix ) {
+  assert( ix < m_nRows );
+  if ( ( ix < m_ixWindow ) || ( ( m_ixWindow + m_window.Size() ) <= ix ) ) {
+    Read( *m_pDepths, ix, std::min( c_nWindow, m_nRows - ix ), m_window );
+    m_ixWindow = ix;
+  }
+  return m_window.At( ix - m_ixWindow );
+}
+
+void BookReplay::Seek( ptime dt ) {
+
+  std::lock_guard<std::mutex> lock( m_mutex );
+
+  m_orders.Clear();
+  size_t ixRow {};
+
+  // nearest snapshot at or before dt
+  vSnapshot_t::const_iterator iter = std::upper_bound(
+    m_vSnapshot.begin(), m_vSnapshot.end(), dt,
+    []( const ptime& dt, const Snapshot& snapshot ){ return dt < snapshot.dt; } );
+  if ( m_vSnapshot.begin() != iter ) {
+    const Snapshot& snapshot( *( --iter ) );
+    if ( 0 < snapshot.nOrders ) {
+      ou::tf::DepthsByOrder orders;
+      Read( *m_pSnapshots, snapshot.ixRecord + 1, snapshot.nOrders, orders );
+      orders.ForEachBlock( [this]( const ou::tf::DepthByOrder* pDepth, ou::tf::DepthsByOrder::size_type n ){
+        for ( ou::tf::DepthsByOrder::size_type ix = 0; ix < n; ix++ ) m_orders.Apply( pDepth[ ix ] );
+      } );
+    }
+    ixRow = snapshot.ixRow;
+  }
+
+  // messages from the snapshot to dt
+  while ( ( ixRow < m_nRows ) && ( Row( ixRow ).DateTime() <= dt ) ) {
+    m_orders.Apply( Row( ixRow ) );
+    ixRow++;
+  }
+
+  // replace the published book
+  m_book.MarketDepth( ou::tf::DepthByOrder( dt, dt, 0, 0, 'C', 'B' ) );
+  m_book.MarketDepth( ou::tf::DepthByOrder( dt, dt, 0, 0, 'C', 'A' ) );
+  m_orders.Emit( dt, m_vOrder );
+  for ( const ou::tf::DepthByOrder& order: m_vOrder ) m_book.MarketDepth( order );
+
+  m_ixRow = ixRow;
+  m_dtPosition = dt;
+  m_bAnchor = true;
+  m_cv.notify_one();
+}
+
+bool BookReplay::StepLocked( ptime dt ) {
+  while ( ( m_ixRow < m_nRows ) && ( Row( m_ixRow ).DateTime() <= dt ) ) {
+    m_book.MarketDepth( Row( m_ixRow ) );
+    m_ixRow++;
+  }
+  m_dtPosition = dt;
+  return m_ixRow < m_nRows;
+}
+
+bool BookReplay::Step( ptime dt ) {
+  std::lock_guard<std::mutex> lock( m_mutex );
+  return StepLocked( dt );
+}
+
+void BookReplay::Play( double dblRate ) {
+  Stop();
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_dblRate = dblRate;
+    m_bStop = false;
+    m_bAnchor = true;
+  }
+  m_thread = std::thread( [this](){ Run(); } );
+}
+
+void BookReplay::Rate( double dblRate ) {
+  std::lock_guard<std::mutex> lock( m_mutex );
+  m_dblRate = dblRate;
+  m_bAnchor = true;
+  m_cv.notify_one();
+}
+
+void BookReplay::Stop() {
+  if ( m_thread.joinable() ) {
+    {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      m_bStop = true;
+    }
+    m_cv.notify_one();
+    m_thread.join();
+  }
+}
+
+void BookReplay::Run() {
+
+  clock_t::time_point tpAnchor;
+  ptime dtAnchor;
+
+  std::unique_lock<std::mutex> lock( m_mutex );
+  while ( !m_bStop && ( m_ixRow < m_nRows ) ) {
+
+    const ptime dtNext( Row( m_ixRow ).DateTime() );
+
+    if ( m_bAnchor ) { // market time dtAnchor is played at tpAnchor
+      m_bAnchor = false;
+      tpAnchor = clock_t::now();
+      dtAnchor = m_dtPosition.is_not_a_date_time() ? dtNext : std::min( m_dtPosition, dtNext );
+    }
+
+    if ( 0.0 < m_dblRate ) {
+      const clock_t::time_point tpDue
+        = tpAnchor
+        + std::chrono::microseconds( (int64_t)( (double)( dtNext - dtAnchor ).total_microseconds() / m_dblRate ) );
+      if ( clock_t::now() < tpDue ) {
+        m_cv.wait_until( lock, tpDue, [this](){ return m_bStop || m_bAnchor; } );
+        continue; // re-evaluate after a wake, a Seek or a Rate change
+      }
+    }
+
+    StepLocked( dtNext );
+  }
+}
+
+} // namespace l2
+} // namespace iqfeed
+} // namespace tf
+} // namespace ou
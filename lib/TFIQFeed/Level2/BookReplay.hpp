@@ -0,0 +1,201 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    BookReplay.hpp
+ * Author:  raymond@burkholder.net
+ * Project: TFIQFeed/Level2
+ * Created: October 19, 2026 21:05
+ */
+
+#pragma once
+
+// order book reconstruction from a stored DepthsByOrder series (as recorded by Collector)
+//   Snapshots: the live orders, every n messages, stored beside the series in the same hdf5 file
+//   BookReplay: seeks to any time from the nearest snapshot, then steps or plays forward,
+//     driving the same fBookChanges_t callbacks as the live iqfeed::l2::Symbols
+
+#include <mutex>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unordered_map>
+#include <condition_variable>
+
+#include "Symbols.hpp"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+  class HDF5DataManager;
+  template<class DD> class HDF5TimeSeriesContainer;
+namespace iqfeed { // IQFeed
+namespace l2 { // level 2 data
+
+// ==== LimitOrders
+// live orders only, no level aggregation, no callbacks
+
+class LimitOrders {
+public:
+
+  using idorder_t = ou::tf::DepthByOrder::idorder_t;
+  using vDepth_t = std::vector<ou::tf::DepthByOrder>;
+
+  void Apply( const ou::tf::DepthByOrder& ); // message types as in OrderBased::MarketDepth
+  void Clear() { m_mapOrder.clear(); }
+  size_t Size() const { return m_mapOrder.size(); }
+
+  // as summary ('6') messages, in priority sequence
+  void Emit( boost::posix_time::ptime, vDepth_t& ) const;
+
+protected:
+private:
+
+  struct Order {
+    price_t dblPrice;
+    volume_t nQuantity;
+    uint64_t nPriority;
+    char chSide;
+  };
+
+  using mapOrder_t = std::unordered_map<idorder_t,Order>;
+  mapOrder_t m_mapOrder;
+};
+
+// ==== Snapshots
+// a DepthsByOrder series at Path( depth path ), a header record followed by the orders, per snapshot
+//   header: message type 'S', OrderID is the depth row which follows the snapshot, Priority is the order count
+//   the header and its orders carry the time of the last depth row applied
+
+class Snapshots {
+public:
+
+  static constexpr size_t c_nInterval = 250000; // depth rows between snapshots
+  static constexpr char c_chHeader = 'S';
+
+  static std::string Path( const std::string& sPathDepth );
+
+  Snapshots( size_t nInterval = c_nInterval );
+
+  // the depth write landed at ixRow rather than at Rows(): after an earlier session's rows, or over stored rows sharing its first time,
+  //   the orders are rebuilt from the stored rows before ixRow, from the last snapshot before them,
+  //   and stored snapshots past ixRow, taken from rows since overwritten, are truncated
+  void Resume( ou::tf::HDF5DataManager&, const std::string& sPathDepth, size_t ixRow );
+  void Append( const ou::tf::DepthByOrder& ); // every row, in stored sequence, starting at row 0, or at the Resume
+  void Write( ou::tf::HDF5DataManager&, const std::string& sPathDepth ); // appends pending snapshots
+
+  size_t Rows() const { return m_nRows; } // stored index of the next row
+  size_t Count() const { return m_nSnapshots; }
+
+  // (re)builds the snapshots of an already recorded series, returns the snapshot count
+  static size_t Build( ou::tf::HDF5DataManager&, const std::string& sPathDepth, size_t nInterval = c_nInterval );
+
+protected:
+private:
+
+  const size_t m_nInterval;
+  size_t m_nRows;
+  size_t m_nSnapshots;
+
+  boost::posix_time::ptime m_dtLastRow;
+  boost::posix_time::ptime m_dtLastSnapshot; // hdf5 writes position by time, snapshots need distinct times
+
+  LimitOrders m_orders;
+  LimitOrders::vDepth_t m_vOrder; // scratch
+  ou::tf::DepthsByOrder m_pending;
+};
+
+// ==== BookReplay
+// callbacks run on the thread calling Seek/Step, or on the Play thread,
+//   and must not call back into the BookReplay
+
+class BookReplay {
+public:
+
+  using ptime = boost::posix_time::ptime;
+
+  BookReplay( const std::string& sFileName, const std::string& sPathDepth ); // throws std::runtime_error
+  ~BookReplay();
+
+  void Set( fBookChanges_t&& fBid, fBookChanges_t&& fAsk );
+
+  size_t Size() const { return m_nRows; }
+  size_t SnapshotCount() const { return m_vSnapshot.size(); }
+  ptime Begin() const { return m_dtBegin; }
+  ptime End() const { return m_dtEnd; }
+  ptime Position() const;
+
+  // the book as of the last message at or before dt, emitted as a clear followed by the rebuilt levels
+  void Seek( ptime dt );
+
+  // emits the book changes up to and including dt, false once the series is exhausted
+  bool Step( ptime dt );
+
+  // paced on a thread: rate 1.0 is market time, 0.0 is as fast as possible
+  void Play( double dblRate );
+  void Rate( double dblRate ); // while playing
+  void Stop();
+
+protected:
+private:
+
+  using clock_t = std::chrono::steady_clock;
+  using container_t = ou::tf::HDF5TimeSeriesContainer<ou::tf::DepthByOrder>;
+
+  struct Snapshot {
+    ptime dt;
+    size_t ixRow;    // depth row following the snapshot
+    size_t ixRecord; // header record in the snapshot series
+    size_t nOrders;
+  };
+  using vSnapshot_t = std::vector<Snapshot>;
+
+  std::unique_ptr<ou::tf::HDF5DataManager> m_pdm;
+  std::unique_ptr<container_t> m_pDepths;
+  std::unique_ptr<container_t> m_pSnapshots;
+
+  size_t m_nRows;
+  ptime m_dtBegin;
+  ptime m_dtEnd;
+
+  vSnapshot_t m_vSnapshot;
+
+  ou::tf::DepthsByOrder m_window; // rows [m_ixWindow, m_ixWindow + size) in memory
+  size_t m_ixWindow;
+
+  size_t m_ixRow; // next row to apply
+  ptime m_dtPosition;
+
+  OrderBased m_book; // publishes via fBookChanges_t
+  LimitOrders m_orders; // silent rebuild during Seek
+  LimitOrders::vDepth_t m_vOrder;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::thread m_thread;
+  bool m_bStop;
+  bool m_bAnchor; // re-pace after a Seek or a Rate change
+  double m_dblRate;
+
+  void LoadSnapshotIndex();
+  const ou::tf::DepthByOrder& Row( size_t ix );
+  bool StepLocked( ptime dt );
+  void Run();
+};
+
+} // namespace l2
+} // namespace iqfeed
+} // namespace tf
+} // namespace ou
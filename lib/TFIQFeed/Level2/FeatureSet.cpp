@@ -170,6 +170,20 @@ const std::string FeatureSet::Header() {
   return header;
 }
 
+void FeatureSet::Names( vName_t& vName ) const {
+  vName.clear();
+  vName.reserve( Columns() );
+  for ( size_t level = 1; level <= m_nLevels; level++ ) {
+    FeatureSet_Level::Names( level, vName );
+  }
+}
+
+void FeatureSet::Values( double* pValue ) const {
+  for ( size_t level = 1; level <= m_nLevels; level++ ) {
+    m_vLevels[ level ].Values( pValue );
+  }
+}
+
 void FeatureSet::Changed( bool& bChanged ) {
   for ( const vLevels_t::value_type& vt: m_vLevels ) {
     vt.Changed( bChanged );
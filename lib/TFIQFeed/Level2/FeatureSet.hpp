@@ -62,6 +62,13 @@ public:
 
   void ImbalanceSummary( ou::tf::linear::Stats& ) const;
 
+  // columnar access, levels 1 .. n, each with FeatureSet_Level::Columns() columns, as in Header
+  using vName_t = std::vector<std::string>;
+  size_t Levels() const { return m_nLevels; }
+  size_t Columns() const { return m_nLevels * FeatureSet_Level::Columns(); }
+  void Names( vName_t& ) const;
+  void Values( double* ) const; // fills Columns() values
+
   // Assignment / Update
 
   void HandleBookChangesAsk( ou::tf::iqfeed::l2::EOp, unsigned int, const ou::tf::Depth& );
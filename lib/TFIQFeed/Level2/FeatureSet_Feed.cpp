@@ -0,0 +1,141 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    FeatureSet_Feed.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFIQFeed/Level2
+ * Created: October 19, 2026 18:05
+ */
+
+#include "FeatureSet_Feed.hpp"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace iqfeed { // IQFeed
+namespace l2 { // level 2 data
+
+FeatureSet_Feed::FeatureSet_Feed()
+: m_nMarketOrdersAsk {}, m_nMarketOrdersBid {}
+, m_bChanged( false )
+{
+  m_OrderBased.Set(
+    [this]( EOp op, unsigned int ix, const ou::tf::Depth& depth ){ // fBookChanges_t&& fBid_
+      BookChangesBid( op, ix, depth );
+    },
+    [this]( EOp op, unsigned int ix, const ou::tf::Depth& depth ){ // fBookChanges_t&& fAsk_
+      BookChangesAsk( op, ix, depth );
+    }
+  );
+}
+
+FeatureSet_Feed::~FeatureSet_Feed() {}
+
+void FeatureSet_Feed::Set( size_t nLevels ) {
+  m_FeatureSet.Set( nLevels );
+}
+
+void FeatureSet_Feed::Set( fBookChanged_t&& fBookChanged ) {
+  m_fBookChanged = std::move( fBookChanged );
+}
+
+void FeatureSet_Feed::MarketDepth( const ou::tf::DepthByOrder& depth ) {
+  m_bChanged = false;
+  m_OrderBased.MarketDepth( depth );
+  if ( m_bChanged && m_fBookChanged ) m_fBookChanged( depth );
+}
+
+void FeatureSet_Feed::Trade( const ou::tf::Trade& trade ) {
+  if ( 0 == m_FeatureSet.Levels() ) return;
+  const double mid = m_FeatureSet.FVS()[ 1 ].cross.v2.mid;
+  if ( trade.Price() >= mid ) {
+    m_nMarketOrdersAsk++;
+  }
+  else {
+    m_nMarketOrdersBid++;
+  }
+}
+
+void FeatureSet_Feed::BookChangesBid( EOp op, unsigned int ix, const ou::tf::Depth& depth ) {
+
+  using EState = OrderBased::EState;
+
+  if ( ( 0 == ix ) || ( m_FeatureSet.Levels() < ix ) ) return; // beyond the levels of the feature set
+
+  m_FeatureSet.HandleBookChangesBid( op, ix, depth );
+  m_bChanged = true;
+
+  switch ( m_OrderBased.State() ) {
+    case EState::Add:
+    case EState::Delete:
+      switch ( op ) {
+        case EOp::Increase:
+        case EOp::Insert:
+          m_FeatureSet.Bid_IncLimit( ix, depth );
+          break;
+        case EOp::Decrease:
+        case EOp::Delete:
+          if ( ( 1 == ix ) && ( 0 != m_nMarketOrdersBid ) ) {
+            --m_nMarketOrdersBid;
+            m_FeatureSet.Bid_IncMarket( 1, depth );
+          }
+          else {
+            m_FeatureSet.Bid_IncCancel( ix, depth );
+          }
+          break;
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+void FeatureSet_Feed::BookChangesAsk( EOp op, unsigned int ix, const ou::tf::Depth& depth ) {
+
+  using EState = OrderBased::EState;
+
+  if ( ( 0 == ix ) || ( m_FeatureSet.Levels() < ix ) ) return; // beyond the levels of the feature set
+
+  m_FeatureSet.HandleBookChangesAsk( op, ix, depth );
+  m_bChanged = true;
+
+  switch ( m_OrderBased.State() ) {
+    case EState::Add:
+    case EState::Delete:
+      switch ( op ) {
+        case EOp::Increase:
+        case EOp::Insert:
+          m_FeatureSet.Ask_IncLimit( ix, depth );
+          break;
+        case EOp::Decrease:
+        case EOp::Delete:
+          if ( ( 1 == ix ) && ( 0 != m_nMarketOrdersAsk ) ) {
+            --m_nMarketOrdersAsk;
+            m_FeatureSet.Ask_IncMarket( 1, depth );
+          }
+          else {
+            m_FeatureSet.Ask_IncCancel( ix, depth );
+          }
+          break;
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+} // namespace l2
+} // namesapce iqfeed
+} // namespace tf
+} // namespace ou
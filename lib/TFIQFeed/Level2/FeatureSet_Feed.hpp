@@ -0,0 +1,79 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    FeatureSet_Feed.hpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFIQFeed/Level2
+ * Created: October 19, 2026 18:05
+ */
+
+// feeds order based depth and trades into a FeatureSet, as IndicatorTrading/FeedModel does live,
+//   usable with the live dispatch (Symbols::WatchAdd) or with DepthsByOrder read back from hdf5
+// trades are classified as market orders against the level 1 mid of the feature set:
+//   the next level 1 decrease or delete on that side counts as market rather than cancel
+
+#pragma once
+
+#include <functional>
+
+#include <TFTimeSeries/DatedDatum.h>
+
+#include "Symbols.hpp"
+#include "FeatureSet.hpp"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace iqfeed { // IQFeed
+namespace l2 { // level 2 data
+
+class FeatureSet_Feed {
+public:
+
+  // called once the book and features reflect the depth message
+  using fBookChanged_t = std::function<void( const ou::tf::DepthByOrder& )>;
+
+  FeatureSet_Feed();
+  ~FeatureSet_Feed();
+
+  void Set( size_t nLevels ); // levels in the feature set, at most Symbols.hpp max_ix
+  void Set( fBookChanged_t&& );
+
+  void MarketDepth( const ou::tf::DepthByOrder& );
+  void Trade( const ou::tf::Trade& );
+
+  const FeatureSet& Features() const { return m_FeatureSet; }
+
+protected:
+private:
+
+  FeatureSet m_FeatureSet;
+  OrderBased m_OrderBased;
+
+  uint32_t m_nMarketOrdersAsk;
+  uint32_t m_nMarketOrdersBid;
+
+  bool m_bChanged; // a level within the feature set changed
+
+  fBookChanged_t m_fBookChanged;
+
+  void BookChangesBid( EOp, unsigned int ix, const ou::tf::Depth& );
+  void BookChangesAsk( EOp, unsigned int ix, const ou::tf::Depth& );
+
+};
+
+} // namespace l2
+} // namesapce iqfeed
+} // namespace tf
+} // namespace ou
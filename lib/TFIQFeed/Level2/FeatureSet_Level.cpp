@@ -353,6 +353,30 @@ const std::string FeatureSet_Level::Header( const size_t level ) {
   return sHeader;
 }
 
+size_t FeatureSet_Level::Columns() {
+  return ARRAY_NAMES_SIZE;
+}
+
+void FeatureSet_Level::Names( const size_t level, vSentinel_t& vName ) {
+
+  static const std::vector<std::string> vColumnName = {
+    BOOST_PP_REPEAT( ARRAY_NAMES_SIZE, VECTOR_VALUE, 0 )
+  };
+
+  const std::string sLevel( std::to_string( level ) );
+  for ( const std::string& sColumnName: vColumnName ) {
+    vName.emplace_back( sColumnName + ".l" + sLevel );
+  }
+}
+
+void FeatureSet_Level::Values( double*& pValue ) const {
+
+  #define STORE_VALUE(z,n,data) \
+    *pValue++ = (double) BOOST_PP_ARRAY_ELEM( n,ARRAY_NAMES );
+
+  BOOST_PP_REPEAT( ARRAY_NAMES_SIZE, STORE_VALUE, 0 )
+}
+
 void FeatureSet_Level::Changed( bool& bChanged ) const {
   m_pFeatureSet_Column->Changed( bChanged );
 }
@@ -216,6 +216,11 @@ public:
 
   static const std::string Header( const size_t level );
   void Changed( bool& ) const;
+
+  // columnar access, same columns in the same order as Header
+  static size_t Columns();
+  static void Names( const size_t level, vSentinel_t& ); // appends
+  void Values( double*& ) const; // fills Columns() values, advances the pointer
   std::ostream& operator<<( std::ostream& s ) const;
 
 protected:
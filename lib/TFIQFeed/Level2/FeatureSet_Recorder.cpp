@@ -0,0 +1,233 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    FeatureSet_Recorder.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFIQFeed/Level2
+ * Created: October 19, 2026 18:25
+ */
+
+#include <stdexcept>
+
+#include <boost/filesystem.hpp>
+
+#include <hdf5/H5Cpp.h>
+
+#include "FeatureSet_Recorder.hpp"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace iqfeed { // IQFeed
+namespace l2 { // level 2 data
+
+namespace {
+
+  const ptime dtEpoch( boost::gregorian::date( 1970, 1, 1 ) );
+
+  // H5Lexists needs each intermediate group present, so walk the path a component at a time
+  bool Exists( H5::H5File& file, const std::string& sPath, bool bCreate ) {
+    bool bExists( true );
+    std::string::size_type ix = 0;
+    while ( std::string::npos != ix ) {
+      const std::string::size_type ixNext = sPath.find( '/', ix + 1 );
+      const std::string sPartial( sPath.substr( 0, ixNext ) );
+      if ( !sPartial.empty() && ( "/" != sPartial ) ) {
+        if ( !file.nameExists( sPartial ) ) {
+          bExists = false;
+          if ( bCreate ) file.createGroup( sPartial );
+          else break;
+        }
+      }
+      ix = ixNext;
+    }
+    return bExists;
+  }
+
+  H5::DataSet CreateColumn(
+    H5::Group& group, const std::string& sName, const H5::PredType& type, hsize_t nChunkRows, unsigned int nDeflate
+  ) {
+    const hsize_t dimInitial[] = { 0 };
+    const hsize_t dimMax[] = { H5S_UNLIMITED };
+    H5::DataSpace space( 1, dimInitial, dimMax );
+
+    H5::DSetCreatPropList props;
+    const hsize_t dimChunk[] = { nChunkRows };
+    props.setChunk( 1, dimChunk );
+    if ( 0 < nDeflate ) {
+      props.setShuffle(); // byte shuffle ahead of gzip, slowly varying doubles compress much better
+      props.setDeflate( nDeflate );
+    }
+    return group.createDataSet( sName, type, space, props );
+  }
+
+  void AppendColumn( H5::DataSet& dataset, const H5::PredType& type, const void* pData, hsize_t nOffset, hsize_t nRows ) {
+    const hsize_t dimNew[] = { nOffset + nRows };
+    dataset.extend( dimNew );
+    H5::DataSpace spaceFile( dataset.getSpace() );
+    const hsize_t dimOffset[] = { nOffset };
+    const hsize_t dimCount[] = { nRows };
+    spaceFile.selectHyperslab( H5S_SELECT_SET, dimCount, dimOffset );
+    H5::DataSpace spaceMemory( 1, dimCount );
+    dataset.write( pData, type, spaceMemory, spaceFile );
+  }
+
+  void Attribute( H5::Group& group, const std::string& sName, const std::string& sValue ) {
+    H5::StrType type( H5::PredType::C_S1, std::max<size_t>( 1, sValue.size() ) );
+    H5::Attribute attribute = group.createAttribute( sName, type, H5::DataSpace( H5S_SCALAR ) );
+    attribute.write( type, sValue );
+  }
+
+  template<typename T>
+  void Attribute( H5::Group& group, const std::string& sName, const H5::PredType& type, T value ) {
+    H5::Attribute attribute = group.createAttribute( sName, type, H5::DataSpace( H5S_SCALAR ) );
+    attribute.write( type, &value );
+  }
+
+} // namespace anonymous
+
+FeatureSet_Recorder::FeatureSet_Recorder(
+  const FeatureSet& fs,
+  const std::string& sFileName, const std::string& sGroup,
+  uint8_t triggers,
+  boost::posix_time::time_duration tdInterval,
+  size_t nChunkRows,
+  unsigned int nDeflate
+)
+: m_fs( fs )
+, m_triggers( triggers )
+, m_tdInterval( tdInterval )
+, m_dtNextInterval( boost::posix_time::not_a_date_time )
+, m_nColumns( fs.Columns() )
+, m_nChunkRows( std::max<size_t>( 1, nChunkRows ) )
+, m_nRowsBuffered {}, m_nRowsWritten {}
+{
+  if ( 0 == m_nColumns ) {
+    throw std::runtime_error( "FeatureSet_Recorder: feature set has no levels" );
+  }
+  if ( ( 0 != ( m_triggers & TriggerInterval ) ) && ( boost::posix_time::time_duration() >= m_tdInterval ) ) {
+    throw std::runtime_error( "FeatureSet_Recorder: interval trigger needs a positive interval" );
+  }
+
+  m_vDateTime.resize( m_nChunkRows );
+  m_vTrigger.resize( m_nChunkRows );
+  m_vColumns.resize( m_nChunkRows * m_nColumns );
+  m_vRow.resize( m_nColumns );
+
+  m_pFile = std::make_unique<H5::H5File>(
+    sFileName,
+    boost::filesystem::exists( sFileName ) ? H5F_ACC_RDWR : H5F_ACC_TRUNC );
+
+  if ( Exists( *m_pFile, sGroup, true ) ) {
+    throw std::runtime_error( "FeatureSet_Recorder: " + sGroup + " already recorded" );
+  }
+  H5::Group group( m_pFile->openGroup( sGroup ) );
+
+  FeatureSet::vName_t vName;
+  fs.Names( vName );
+
+  m_vDataSet.reserve( 2 + m_nColumns );
+  m_vDataSet.emplace_back( CreateColumn( group, "datetime", H5::PredType::NATIVE_INT64, m_nChunkRows, nDeflate ) );
+  m_vDataSet.emplace_back( CreateColumn( group, "trigger", H5::PredType::NATIVE_UINT8, m_nChunkRows, nDeflate ) );
+  for ( const std::string& sName: vName ) {
+    m_vDataSet.emplace_back( CreateColumn( group, sName, H5::PredType::NATIVE_DOUBLE, m_nChunkRows, nDeflate ) );
+  }
+
+  Attribute( group, "format", "ou.tf.featureset.v1" );
+  Attribute( group, "schema", Schema( fs ) );
+  Attribute( group, "levels", H5::PredType::NATIVE_UINT32, (uint32_t) fs.Levels() );
+  Attribute( group, "triggers", H5::PredType::NATIVE_UINT8, m_triggers );
+  Attribute( group, "interval_us", H5::PredType::NATIVE_INT64, (int64_t) m_tdInterval.total_microseconds() );
+}
+
+FeatureSet_Recorder::~FeatureSet_Recorder() {
+  Flush();
+  m_vDataSet.clear();
+  m_pFile->close();
+}
+
+std::string FeatureSet_Recorder::Schema( const FeatureSet& fs ) {
+  FeatureSet::vName_t vName;
+  fs.Names( vName );
+  std::string sSchema( "datetime:int64,trigger:uint8" );
+  for ( const std::string& sName: vName ) {
+    sSchema += "," + sName + ":float64";
+  }
+  return sSchema;
+}
+
+void FeatureSet_Recorder::Time( const ptime& dt ) {
+  if ( 0 != ( m_triggers & TriggerInterval ) ) {
+    if ( m_dtNextInterval.is_not_a_date_time() ) {
+      // first boundary at or after dt, aligned to the interval from midnight
+      const int64_t nInterval( m_tdInterval.ticks() );
+      const int64_t nTicks( dt.time_of_day().ticks() );
+      const int64_t nNext( ( ( nTicks + nInterval - 1 ) / nInterval ) * nInterval );
+      m_dtNextInterval = ptime( dt.date() ) + boost::posix_time::time_duration( 0, 0, 0, nNext );
+    }
+    while ( m_dtNextInterval < dt ) {
+      Record( m_dtNextInterval, TriggerInterval );
+      m_dtNextInterval += m_tdInterval;
+    }
+  }
+}
+
+void FeatureSet_Recorder::BookChange( const ptime& dt ) {
+  if ( 0 != ( m_triggers & TriggerBookChange ) ) {
+    Record( dt, TriggerBookChange );
+  }
+}
+
+void FeatureSet_Recorder::Trade( const ptime& dt ) {
+  if ( 0 != ( m_triggers & TriggerTrade ) ) {
+    Record( dt, TriggerTrade );
+  }
+}
+
+void FeatureSet_Recorder::Record( const ptime& dt, ETrigger trigger ) {
+
+  m_vDateTime[ m_nRowsBuffered ] = ( dt - dtEpoch ).total_microseconds();
+  m_vTrigger[ m_nRowsBuffered ] = trigger;
+
+  m_fs.Values( m_vRow.data() );
+  double* pColumn = m_vColumns.data() + m_nRowsBuffered;
+  for ( const double value: m_vRow ) {
+    *pColumn = value;
+    pColumn += m_nChunkRows;
+  }
+
+  m_nRowsBuffered++;
+  if ( m_nChunkRows == m_nRowsBuffered ) {
+    Flush();
+  }
+}
+
+void FeatureSet_Recorder::Flush() {
+  if ( 0 < m_nRowsBuffered ) {
+    AppendColumn( m_vDataSet[ 0 ], H5::PredType::NATIVE_INT64, m_vDateTime.data(), m_nRowsWritten, m_nRowsBuffered );
+    AppendColumn( m_vDataSet[ 1 ], H5::PredType::NATIVE_UINT8, m_vTrigger.data(), m_nRowsWritten, m_nRowsBuffered );
+    for ( size_t ix = 0; ix < m_nColumns; ix++ ) {
+      AppendColumn(
+        m_vDataSet[ 2 + ix ], H5::PredType::NATIVE_DOUBLE,
+        m_vColumns.data() + ix * m_nChunkRows, m_nRowsWritten, m_nRowsBuffered );
+    }
+    m_nRowsWritten += m_nRowsBuffered;
+    m_nRowsBuffered = 0;
+  }
+}
+
+} // namespace l2
+} // namesapce iqfeed
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,117 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    FeatureSet_Recorder.hpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFIQFeed/Level2
+ * Created: October 19, 2026 18:25
+ */
+
+// snapshots of a FeatureSet into columnar, chunked hdf5 datasets, for offline model training
+//   one group per recording, one extendible dataset per column:
+//     datetime  int64   microseconds since 1970-01-01 UTC
+//     trigger   uint8   ETrigger which caused the row
+//     <feature> float64 one per FeatureSet column, named as FeatureSet::Header, eg ask.v1.price.l1
+//   group attributes:
+//     format    "ou.tf.featureset.v1"
+//     schema    "name:dtype,..." of the datasets, in column order
+//     levels, triggers, interval_us
+//   rows are buffered per column, and written a chunk at a time
+
+// triggers are driven by data time, so a replay records the same rows as the live session:
+//   TriggerBookChange: after each depth message which changed a level within the feature set
+//   TriggerTrade:      on each trade
+//   TriggerInterval:   on each interval boundary, with the features as they stood at the boundary,
+//                      call Time() with the time of each message before the message is applied
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include <TFTimeSeries/DatedDatum.h>
+
+#include "FeatureSet.hpp"
+
+namespace H5 {
+  class H5File;
+  class DataSet;
+}
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace iqfeed { // IQFeed
+namespace l2 { // level 2 data
+
+class FeatureSet_Recorder {
+public:
+
+  enum ETrigger: uint8_t { TriggerBookChange = 0x01, TriggerInterval = 0x02, TriggerTrade = 0x04 };
+
+  // the FeatureSet needs to have had its levels Set
+  //   sFileName is created when not present, sGroup (eg /featureset/@ESZ26/20261019) must not already exist
+  FeatureSet_Recorder(
+    const FeatureSet&,
+    const std::string& sFileName, const std::string& sGroup,
+    uint8_t triggers,
+    boost::posix_time::time_duration tdInterval = boost::posix_time::milliseconds( 100 ),
+    size_t nChunkRows = 4096,
+    unsigned int nDeflate = 0 // 0 is none, 1 - 9 for gzip level
+  );
+  ~FeatureSet_Recorder(); // flushes
+
+  void Time( const ptime& );       // records interval rows for boundaries prior to this time
+  void BookChange( const ptime& ); // after the feature set has been updated
+  void Trade( const ptime& );
+
+  void Flush();
+
+  uint64_t Rows() const { return m_nRowsWritten + m_nRowsBuffered; }
+
+  static std::string Schema( const FeatureSet& );
+
+protected:
+private:
+
+  const FeatureSet& m_fs;
+
+  const uint8_t m_triggers;
+  const boost::posix_time::time_duration m_tdInterval;
+  ptime m_dtNextInterval;
+
+  const size_t m_nColumns; // feature columns
+  const size_t m_nChunkRows;
+
+  std::vector<int64_t> m_vDateTime;
+  std::vector<uint8_t> m_vTrigger;
+  std::vector<double> m_vColumns; // column major, m_nChunkRows per column
+  std::vector<double> m_vRow;     // scratch for FeatureSet::Values
+
+  size_t m_nRowsBuffered;
+  uint64_t m_nRowsWritten;
+
+  std::unique_ptr<H5::H5File> m_pFile;
+  std::vector<H5::DataSet> m_vDataSet; // datetime, trigger, then features
+
+  void Record( const ptime&, ETrigger );
+
+};
+
+} // namespace l2
+} // namesapce iqfeed
+} // namespace tf
+} // namespace ou
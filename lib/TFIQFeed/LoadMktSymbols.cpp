@@ -20,8 +20,7 @@
 
 #include "CurlGetMktSymbols.h"
 #include "UnzipMktSymbols.h"
-#include "ParseMktSymbolDiskFile.h"
-#include "ValidateMktSymbolLine.h"
+#include "LoadMktSymbolsParallel.h"
 
 #include "LoadMktSymbols.h"
 
@@ -53,9 +52,6 @@ void LoadMktSymbols( InMemoryMktSymbolList& symbols, MktSymbolLoadType::Enum e,
 
   symbols.Clear();
 
-  ValidateMktSymbolLine validator;
-  validator.SetOnProcessLine( MakeDelegate( &symbols, &InMemoryMktSymbolList::InsertParsedStructure ) );
-
   switch ( e ) {
   case MktSymbolLoadType::Download:
     try {
@@ -82,24 +78,15 @@ void LoadMktSymbols( InMemoryMktSymbolList& symbols, MktSymbolLoadType::Enum e,
       std::cout << "Processing Contents" << std::endl;
       const char* pBegin = pUnZippedFile.get();
       const char* pEnd = pBegin + uzmsf.UnZippedFileSize();
-      validator.ParseHeaderLine( pBegin, pEnd );
-      while ( pBegin != pEnd ) {
-        validator.Parse( pBegin, pEnd );
-      }
+      LoadMktSymbolsParallel( symbols, pBegin, pEnd );
     }
     catch( ... ) {
       std::cout << "Some Sort of failure in Download" << std::endl;
     }
     break;
   case MktSymbolLoadType::LoadTextFromDisk:
-    typedef ParseMktSymbolDiskFile diskfile_t;
-
     try {
-
-      diskfile_t diskfile;
-      diskfile.SetOnProcessLine( MakeDelegate( &validator, &ValidateMktSymbolLine::Parse<diskfile_t::iterator_t> ) );
-
-      diskfile.Run( detail::sFileNameMarketSymbolsText );
+      LoadMktSymbolsParallel( symbols, detail::sFileNameMarketSymbolsText );
     }
     catch (...) {
       std::cout << "Some sort of failure on disk read" << std::endl;
@@ -107,11 +94,6 @@ void LoadMktSymbols( InMemoryMktSymbolList& symbols, MktSymbolLoadType::Enum e,
     break;
   }
 
-  validator.SetOnProcessHasOption( MakeDelegate( &symbols, &InMemoryMktSymbolList::HandleSymbolHasOption ) );
-  validator.SetOnUpdateOptionUnderlying( MakeDelegate( &symbols, &InMemoryMktSymbolList::HandleUpdateOptionUnderlying ) );
-  validator.PostProcess();
-  validator.Summary();
-
 }
 
 } // namespace iqfeed
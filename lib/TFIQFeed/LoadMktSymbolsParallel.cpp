@@ -0,0 +1,156 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    LoadMktSymbolsParallel.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFIQFeed
+ * Created: October 20, 2026 02:10
+ */
+
+#include <mutex>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+
+#include "ParseMktSymbolDiskFile.h"
+#include "ValidateMktSymbolLine.h"
+
+#include "LoadMktSymbolsParallel.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace iqfeed { // IQFeed
+
+namespace {
+
+using trd_t = InMemoryMktSymbolList::trd_t;
+
+struct Chunk {
+  ValidateMktSymbolLine validator;
+  std::vector<trd_t> vTrd;
+  bool bParsed;
+  Chunk(): bParsed( false ) {
+    validator.SetOnProcessLine( MakeDelegate( this, &Chunk::HandleProcessLine ) );
+  }
+  Chunk( InMemoryMktSymbolList& symbols ): bParsed( false ) { // the first chunk has nothing ahead of it, it inserts directly
+    validator.SetOnProcessLine( MakeDelegate( &symbols, &InMemoryMktSymbolList::InsertParsedStructure ) );
+  }
+  void HandleProcessLine( const trd_t& trd ) { vTrd.push_back( trd ); }
+};
+
+// more chunks than threads, so the in order insertion of the parsed chunks overlaps the parsing of the later ones:
+//   the thread completing the next chunk due inserts it, and any following chunks already parsed
+// no other chunk is inserted until the first is parsed, so the first inserts as it parses, a single thread is the sequential load
+class Loader {
+public:
+
+  Loader( InMemoryMktSymbolList& symbols, size_t nThreads )
+  : m_symbols( symbols ), m_nThreads( nThreads ), m_ixInsert {}, m_bInserting( false )
+  {
+    const size_t nChunks = ( 1 == m_nThreads ) ? 1 : 8 * m_nThreads;
+    for ( size_t ix = 0; ix < nChunks; ix++ ) {
+      m_vChunk.emplace_back( ( 0 == ix ) ? std::make_unique<Chunk>( m_symbols ) : std::make_unique<Chunk>() );
+      m_vOnProcessLine.emplace_back( MakeDelegate( &m_vChunk.back()->validator, &ValidateMktSymbolLine::Parse<ParseMktSymbolDiskFile::iterator_t> ) );
+    }
+  }
+
+  template<typename Parse>
+  void Run( Parse&& parse, bool bSummary ) {
+
+    m_symbols.Clear();
+
+    const size_t cntLines = parse( m_vOnProcessLine, m_nThreads, MakeDelegate( this, &Loader::HandleChunkParsed ) );
+    std::cout << cntLines << " lines parsed on " << m_nThreads << " threads" << std::endl;
+
+    ValidateMktSymbolLine& validator( m_vChunk.front()->validator );
+    validator.SetOnProcessHasOption( MakeDelegate( &m_symbols, &InMemoryMktSymbolList::HandleSymbolHasOption ) );
+    validator.SetOnUpdateOptionUnderlying( MakeDelegate( &m_symbols, &InMemoryMktSymbolList::HandleUpdateOptionUnderlying ) );
+    validator.PostProcess();
+    if ( bSummary ) validator.Summary();
+  }
+
+private:
+
+  using pChunk_t = std::unique_ptr<Chunk>;
+  using vChunk_t = std::vector<pChunk_t>;
+
+  InMemoryMktSymbolList& m_symbols;
+  const size_t m_nThreads;
+
+  vChunk_t m_vChunk;
+  ParseMktSymbolDiskFile::vOnProcessLine_t m_vOnProcessLine;
+
+  std::mutex m_mutex;
+  size_t m_ixInsert; // next chunk due for insertion
+  bool m_bInserting;
+
+  void HandleChunkParsed( size_t ix ) {
+    {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      m_vChunk[ ix ]->bParsed = true;
+      if ( m_bInserting || ( ix != m_ixInsert ) ) return;
+      m_bInserting = true;
+    }
+    while ( true ) {
+      Insert( m_ixInsert );
+      std::lock_guard<std::mutex> lock( m_mutex );
+      m_ixInsert++;
+      if ( ( m_vChunk.size() == m_ixInsert ) || !m_vChunk[ m_ixInsert ]->bParsed ) {
+        m_bInserting = false;
+        return;
+      }
+    }
+  }
+
+  void Insert( size_t ix ) { // one thread at a time, in chunk order
+    Chunk& chunk( *m_vChunk[ ix ] );
+    for ( trd_t& trd: chunk.vTrd ) m_symbols.MoveParsedStructure( std::move( trd ) );
+    std::vector<trd_t>().swap( chunk.vTrd );
+    if ( 0 != ix ) m_vChunk.front()->validator.Merge( chunk.validator );
+  }
+
+};
+
+} // namespace anonymous
+
+namespace {
+  size_t Threads( size_t nThreads ) {
+    return ( 0 == nThreads ) ? std::max<size_t>( 1, std::thread::hardware_concurrency() ) : nThreads;
+  }
+}
+
+void LoadMktSymbolsParallel( InMemoryMktSymbolList& symbols, const std::string& sFileName, size_t nThreads, bool bSummary ) {
+  Loader loader( symbols, Threads( nThreads ) );
+  loader.Run(
+    [&sFileName]( const ParseMktSymbolDiskFile::vOnProcessLine_t& vOnProcessLine, size_t nThreads, ParseMktSymbolDiskFile::OnChunkParsed_t f ){
+      return ParseMktSymbolDiskFile::Run( sFileName, vOnProcessLine, nThreads, f );
+    },
+    bSummary );
+}
+
+void LoadMktSymbolsParallel( InMemoryMktSymbolList& symbols, const char* begin, const char* end, size_t nThreads, bool bSummary ) {
+  Loader loader( symbols, Threads( nThreads ) );
+  loader.Run(
+    [begin,end]( const ParseMktSymbolDiskFile::vOnProcessLine_t& vOnProcessLine, size_t nThreads, ParseMktSymbolDiskFile::OnChunkParsed_t f ){
+      return ParseMktSymbolDiskFile::Run( begin, end, vOnProcessLine, nThreads, f );
+    },
+    bSummary );
+}
+
+} // namespace iqfeed
+} // namespace tf
+} // namespace ou
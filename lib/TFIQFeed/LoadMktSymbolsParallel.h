@@ -0,0 +1,43 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    LoadMktSymbolsParallel.h
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFIQFeed
+ * Created: October 20, 2026 02:10
+ */
+
+#pragma once
+
+// mktsymbols_v2.txt split at line boundaries into chunks, parsed on a pool of threads,
+//   each chunk is validated into its own records, the records are inserted in file order,
+//   and the validators merged, so the list is the same as with a single pass
+// the list is cleared first, PostProcess is applied, Summary is optional
+
+#include <string>
+
+#include "InMemoryMktSymbolList.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace iqfeed { // IQFeed
+
+// nThreads of 0 uses std::thread::hardware_concurrency
+void LoadMktSymbolsParallel( InMemoryMktSymbolList&, const std::string& sFileName, size_t nThreads = 0, bool bSummary = true ); // memory mapped
+void LoadMktSymbolsParallel( InMemoryMktSymbolList&, const char* begin, const char* end, size_t nThreads = 0, bool bSummary = true ); // header line included
+
+} // namespace iqfeed
+} // namespace tf
+} // namespace ou
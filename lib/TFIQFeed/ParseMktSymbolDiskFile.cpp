@@ -12,10 +12,19 @@
  * See the file LICENSE.txt for redistribution information.             *
  ************************************************************************/
 
+#include <atomic>
+#include <thread>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <algorithm>
 #include <stdexcept>
 
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
 #include "ParseMktSymbolDiskFile.h"
 
 namespace ou { // One Unified
@@ -65,6 +74,112 @@ void ParseMktSymbolDiskFile::Run( const std::string& sName ) {
 
 }
 
+namespace {
+
+class MappedFile {
+public:
+  MappedFile( const std::string& sName ): m_fd( -1 ), m_pBegin( nullptr ), m_nSize {} {
+    m_fd = ::open( sName.c_str(), O_RDONLY );
+    if ( -1 == m_fd ) {
+      throw std::runtime_error( "Can't open input file " + sName );
+    }
+    struct stat st;
+    if ( -1 == ::fstat( m_fd, &st ) ) {
+      ::close( m_fd );
+      throw std::runtime_error( "Can't stat input file " + sName );
+    }
+    m_nSize = st.st_size;
+    if ( 0 < m_nSize ) {
+      void* p = ::mmap( nullptr, m_nSize, PROT_READ, MAP_PRIVATE, m_fd, 0 );
+      if ( MAP_FAILED == p ) {
+        ::close( m_fd );
+        throw std::runtime_error( "Can't map input file " + sName );
+      }
+      ::madvise( p, m_nSize, MADV_SEQUENTIAL | MADV_WILLNEED );
+      m_pBegin = static_cast<const char*>( p );
+    }
+  }
+  ~MappedFile() {
+    if ( nullptr != m_pBegin ) ::munmap( const_cast<char*>( m_pBegin ), m_nSize );
+    ::close( m_fd );
+  }
+  const char* Begin() const { return m_pBegin; }
+  const char* End() const { return m_pBegin + m_nSize; }
+private:
+  int m_fd;
+  const char* m_pBegin;
+  size_t m_nSize;
+};
+
+inline const char* EndOfLine( const char* p, const char* end ) {
+  const void* eol = std::memchr( p, '\n', end - p );
+  return ( nullptr == eol ) ? end : static_cast<const char*>( eol );
+}
+
+} // namespace anonymous
+
+size_t ParseMktSymbolDiskFile::Run( const std::string& sName, const vOnProcessLine_t& vOnProcessLine, size_t nThreads, OnChunkParsed_t OnChunkParsed ) {
+
+  std::cout << "Mapping Input Symbol File " << sName << std::endl;
+  MappedFile file( sName );
+
+  return Run( file.Begin(), file.End(), vOnProcessLine, nThreads, OnChunkParsed );
+}
+
+size_t ParseMktSymbolDiskFile::Run( iterator_t begin, iterator_t end, const vOnProcessLine_t& vOnProcessLine, size_t nThreads, OnChunkParsed_t OnChunkParsed ) {
+
+  if ( ( begin == end ) || vOnProcessLine.empty() ) return 0;
+
+  begin = EndOfLine( begin, end );  // remove header line
+  if ( begin != end ) ++begin;
+
+  // chunk ix is [ vBoundary[ ix ], vBoundary[ ix + 1 ] ), each boundary follows a \n
+  const size_t nChunks = vOnProcessLine.size();
+  std::vector<iterator_t> vBoundary( nChunks + 1, end );
+  vBoundary[ 0 ] = begin;
+  for ( size_t ix = 1; ix < nChunks; ix++ ) {
+    iterator_t p = std::max( begin + ( end - begin ) * ix / nChunks, vBoundary[ ix - 1 ] );
+    p = EndOfLine( p, end );
+    if ( p != end ) ++p;
+    vBoundary[ ix ] = p;
+  }
+
+  std::vector<size_t> vLines( nChunks );
+  std::atomic<size_t> ixChunkNext( 0 );
+
+  auto worker = [&vBoundary,&vLines,&vOnProcessLine,&ixChunkNext,nChunks,OnChunkParsed](){
+    for ( size_t ix = ixChunkNext++; ix < nChunks; ix = ixChunkNext++ ) {
+      iterator_t p = vBoundary[ ix ];
+      iterator_t e = vBoundary[ ix + 1 ];
+      const OnProcessLine_t& OnProcessLine( vOnProcessLine[ ix ] );
+      size_t cntLines {};
+      while ( p != e ) {
+        iterator_t eol = EndOfLine( p, e );
+        iterator_t pLine1( p );
+        iterator_t pLine2( eol );
+        if ( nullptr != OnProcessLine ) OnProcessLine( pLine1, pLine2 );
+        ++cntLines;
+        p = ( eol == e ) ? e : eol + 1;
+      }
+      vLines[ ix ] = cntLines;
+      if ( nullptr != OnChunkParsed ) OnChunkParsed( ix );
+    }
+  };
+
+  nThreads = std::min( std::max<size_t>( 1, nThreads ), nChunks );
+  std::vector<std::thread> vThread;
+  vThread.reserve( nThreads - 1 );
+  for ( size_t ix = 1; ix < nThreads; ix++ ) {
+    vThread.emplace_back( std::thread( worker ) );
+  }
+  worker();
+  for ( std::thread& thread: vThread ) thread.join();
+
+  size_t cntLines {};
+  for ( size_t n: vLines ) cntLines += n;
+  return cntLines;
+}
+
 } // namespace iqfeed
 } // namespace tf
 } // namespace ou
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include <OUCommon/FastDelegate.h>
 using namespace fastdelegate;
@@ -38,6 +39,16 @@ public:
 
   void Run( const std::string& );  // "mktsymbols_v2.txt"
 
+  // the lines following the header are split at line boundaries into a chunk per delegate,
+  //   nThreads take the chunks in file order, a chunk's lines go to its delegate in file order
+  //   a line is passed without its \n, as getline does
+  //   OnChunkParsed is called with the chunk index, on the parsing thread, once the chunk's lines are done
+  // returns the number of lines
+  using vOnProcessLine_t = std::vector<OnProcessLine_t>;
+  typedef FastDelegate1<size_t> OnChunkParsed_t;
+  static size_t Run( const std::string&, const vOnProcessLine_t&, size_t nThreads, OnChunkParsed_t = nullptr ); // memory mapped
+  static size_t Run( iterator_t begin, iterator_t end, const vOnProcessLine_t&, size_t nThreads, OnChunkParsed_t = nullptr ); // in memory, eg unzipped
+
 protected:
 private:
   OnProcessLine_t m_OnProcessLine;
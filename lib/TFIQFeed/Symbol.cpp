@@ -32,7 +32,11 @@ IQFeedSymbol::IQFeedSymbol( const idSymbol_t& sSymbol, pInstrument_t pInstrument
 , m_QStatus( qUnknown )
 , m_stateWatch( WatchState::None )
 , m_bWaitForFirstQuote( true )
+, m_idLatencyClass( ou::latency::c_classUnknown )
 {
+  if ( pInstrument ) {
+    m_idLatencyClass = ou::latency::Class( InstrumentType::Name[ pInstrument->GetInstrumentType() ] );
+  }
   m_pFundamentals = std::make_shared<Fundamentals>();
   m_pSummary = std::make_shared<Summary>();
 }
@@ -319,6 +323,8 @@ void IQFeedSymbol::HandleDynamicFeedUpdateMessage( IQFDynamicFeedUpdateMessage*
 //  }
 //  if ( qFound == m_QStatus ) {
     DecodeDynamicFeedMessage<IQFDynamicFeedUpdateMessage>( pMsg );
+    TF_LATENCY_CLASS( m_idLatencyClass );
+    TF_LATENCY_STAGE( "symbol.decoded" );
 
     STRAND( OnUpdateMessage( m_pSummary ) )
 
@@ -18,6 +18,7 @@
 #include <string>
 
 #include <OUCommon/Delegate.h>
+#include <OUCommon/LatencyTrace.h>
 
 #include <TFTrading/Symbol.h>
 
@@ -132,6 +133,8 @@ private:
   pFundamentals_t m_pFundamentals;
   pSummary_t m_pSummary;
 
+  ou::latency::class_t m_idLatencyClass; // instrument type, for the latency trace
+
 };
 
 } // namespace iqfeed
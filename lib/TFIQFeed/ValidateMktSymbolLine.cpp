@@ -98,6 +98,37 @@ void ValidateMktSymbolLine::PostProcess() {
   }
 }
 
+void ValidateMktSymbolLine::Merge( const ValidateMktSymbolLine& rhs ) {
+
+  cntLinesTotal += rhs.cntLinesTotal;
+  cntLinesParsed += rhs.cntLinesParsed;
+  cntSIC += rhs.cntSIC;
+  cntNAICS += rhs.cntNAICS;
+  nUnderlyingSize = std::max( nUnderlyingSize, rhs.nUnderlyingSize );
+
+  for ( size_t ix = 0; ix < vSymbolTypeStats.size(); ++ix ) {
+    vSymbolTypeStats[ ix ] += rhs.vSymbolTypeStats[ ix ];
+  }
+
+  for ( size_t ixRhs = 1; ixRhs < rhs.vSymbolsPerExchange.size(); ++ixRhs ) { // 0 is the unknown entry
+    const structCountPerString& cpsRhs( rhs.vSymbolsPerExchange[ ixRhs ] );
+    const size_t ix = kwmExchanges.FindMatch( cpsRhs.s );
+    if ( ( 0 == ix ) || ( cpsRhs.s.length() != vSymbolsPerExchange[ ix ].s.length() ) ) {
+      size_t cnt = kwmExchanges.GetPatternCount();
+      kwmExchanges.AddPattern( cpsRhs.s, cnt );
+      vSymbolsPerExchange.push_back( cpsRhs );
+    }
+    else {
+      vSymbolsPerExchange[ ix ].cnt += cpsRhs.cnt;
+    }
+  }
+
+  // later lines replace earlier ones, as with a single pass
+  for ( const mapUnderlying_t::value_type& vt: rhs.mapUnderlying ) {
+    mapUnderlying[ vt.first ] = vt.second;
+  }
+}
+
 void ValidateMktSymbolLine::Summary() {
 
   std::cout << "== Market Symbol Type and Count ==" << std::endl;
@@ -63,6 +63,9 @@ public:
 
   void PostProcess( void );
 
+  // folds in the statistics and optionables of a validator which parsed the lines following this one's
+  void Merge( const ValidateMktSymbolLine& );
+
   void Summary( void );
 
   size_t LinesProcessed( void ) const { return cntLinesTotal; };
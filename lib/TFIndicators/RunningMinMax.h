@@ -14,12 +14,22 @@
 
 #pragma once
 
-#include <map>
+#include <vector>
+#include <cassert>
+#include <cstdint>
 #include <stdexcept>
 
 namespace ou { // One Unified
 namespace tf { // TradeFrame
 
+// sliding window minimum and maximum, amortized O(1) per Add/Remove:
+//   a ring buffer holds the values in the window, oldest first,
+//   a pair of monotonic deques hold the sequence numbers of the candidates for min and for max:
+//     min deque values increase front to back, max deque values decrease front to back
+//     Add drops the candidates the new value dominates, Remove drops the front when it is the oldest
+// Remove is of the oldest value in the window, as the TimeSeriesSlidingWindow Expire sequence supplies
+// the buffers grow to the window size then are re-used, there is no allocation per value after warm up
+
 template<typename CRTP, typename value_t>
 class RunningMinMax {
 public:
@@ -33,22 +43,68 @@ public:
   void Remove( const value_t& );
 
   value_t Min() const {
-    if ( 0 == m_mapValueCount.size() ) throw std::runtime_error( "no value available" );
-    return m_mapValueCount.begin()->first;
+    if ( m_ringValue.empty() ) throw std::runtime_error( "no value available" );
+    return m_ringValue.at( m_ringMin.front() );
   };
   value_t Max() const {
-    if ( 0 == m_mapValueCount.size() ) throw std::runtime_error( "no value available" );
-    return m_mapValueCount.rbegin()->first;
+    if ( m_ringValue.empty() ) throw std::runtime_error( "no value available" );
+    return m_ringValue.at( m_ringMax.front() );
   };
 
+  std::size_t Count() const { return m_ringValue.size(); }
+
   void Reset();
 
 protected:
   void UpdateOnAdd( const value_t min, const value_t max ) {} // CRTP callback
   void UpdateOnDel( const value_t min, const value_t max ) {} // CRTP callback
 private:
-  using mapValueCount_t = std::map<value_t,unsigned int>;
-  mapValueCount_t m_mapValueCount;
+
+  // power of two capacity, doubles when full, addressed by front/back or by sequence number
+  template<typename T>
+  class Ring {
+  public:
+    Ring(): m_ixFront {}, m_nSize {}, m_nSeqFront {} {}
+    bool empty() const { return 0 == m_nSize; }
+    std::size_t size() const { return m_nSize; }
+    const T& front() const { return m_vRing[ m_ixFront ]; }
+    const T& back() const { return m_vRing[ ( m_ixFront + m_nSize - 1 ) & ( m_vRing.size() - 1 ) ]; }
+    const T& at( uint64_t nSeq ) const { // by sequence number, for the value ring
+      return m_vRing[ ( m_ixFront + ( nSeq - m_nSeqFront ) ) & ( m_vRing.size() - 1 ) ];
+    }
+    uint64_t SeqFront() const { return m_nSeqFront; }
+    uint64_t SeqBack() const { return m_nSeqFront + m_nSize - 1; }
+    void push_back( const T& value ) {
+      if ( m_vRing.size() == m_nSize ) Grow();
+      m_vRing[ ( m_ixFront + m_nSize ) & ( m_vRing.size() - 1 ) ] = value;
+      m_nSize++;
+    }
+    void pop_front() {
+      m_ixFront = ( m_ixFront + 1 ) & ( m_vRing.size() - 1 );
+      m_nSize--;
+      m_nSeqFront++;
+    }
+    void pop_back() { m_nSize--; }
+    void clear() { m_ixFront = m_nSize = 0; m_nSeqFront = 0; } // keeps the capacity
+  private:
+    std::vector<T> m_vRing;
+    std::size_t m_ixFront;
+    std::size_t m_nSize;
+    uint64_t m_nSeqFront; // sequence number of the front
+    void Grow() {
+      std::vector<T> vRing( m_vRing.empty() ? 16 : ( 2 * m_vRing.size() ) );
+      for ( std::size_t ix = 0; ix < m_nSize; ix++ ) {
+        vRing[ ix ] = m_vRing[ ( m_ixFront + ix ) & ( m_vRing.size() - 1 ) ];
+      }
+      m_vRing.swap( vRing );
+      m_ixFront = 0;
+    }
+  };
+
+  Ring<value_t> m_ringValue;  // the window, sequence numbered from the first Add
+  Ring<uint64_t> m_ringMin;   // sequence numbers, increasing values
+  Ring<uint64_t> m_ringMax;   // sequence numbers, decreasing values
+
 };
 
 template<typename CRTP, typename value_t>
@@ -56,33 +112,36 @@ RunningMinMax<CRTP,value_t>::RunningMinMax() {}
 
 template<typename CRTP, typename value_t>
 RunningMinMax<CRTP,value_t>::RunningMinMax( const RunningMinMax& rhs )
-  : m_mapValueCount( rhs.m_mapValueCount )
+  : m_ringValue( rhs.m_ringValue ), m_ringMin( rhs.m_ringMin ), m_ringMax( rhs.m_ringMax )
 {
 }
 
 template<typename CRTP, typename value_t>
 RunningMinMax<CRTP,value_t>::RunningMinMax( RunningMinMax&& rhs )
-  : m_mapValueCount( std::move( rhs.m_mapValueCount ) )
+  : m_ringValue( std::move( rhs.m_ringValue ) ), m_ringMin( std::move( rhs.m_ringMin ) ), m_ringMax( std::move( rhs.m_ringMax ) )
 {
+  rhs.Reset();
 }
 
 template<typename CRTP, typename value_t>
 RunningMinMax<CRTP,value_t>::~RunningMinMax() {
-  m_mapValueCount.clear();
+  Reset();
 }
 
 template<typename CRTP, typename value_t>
-void RunningMinMax<CRTP,value_t>::Add(const value_t& value) {
+void RunningMinMax<CRTP,value_t>::Add( const value_t& value ) {
+
+  m_ringValue.push_back( value );
+  const uint64_t nSeq = m_ringValue.SeqBack();
+
+  // an earlier equal value is dominated too, the newer one expires later
+  while ( !m_ringMin.empty() && !( m_ringValue.at( m_ringMin.back() ) < value ) ) m_ringMin.pop_back();
+  m_ringMin.push_back( nSeq );
+  while ( !m_ringMax.empty() && !( value < m_ringValue.at( m_ringMax.back() ) ) ) m_ringMax.pop_back();
+  m_ringMax.push_back( nSeq );
 
-  typename mapValueCount_t::iterator iter = m_mapValueCount.find( value );
-  if ( m_mapValueCount.end() == iter ) {
-    m_mapValueCount.insert( typename mapValueCount_t::value_type( value, 1 ) );
-  }
-  else {
-    (iter->second)++;
-  }
   if ( &RunningMinMax<CRTP,value_t>::UpdateOnAdd != &CRTP::UpdateOnAdd ) {
-    static_cast<CRTP*>(this)->UpdateOnAdd( m_mapValueCount.begin()->first, m_mapValueCount.rbegin()->first );
+    static_cast<CRTP*>(this)->UpdateOnAdd( m_ringValue.at( m_ringMin.front() ), m_ringValue.at( m_ringMax.front() ) );
   }
 
 }
@@ -90,28 +149,25 @@ void RunningMinMax<CRTP,value_t>::Add(const value_t& value) {
 template<typename CRTP, typename value_t>
 void RunningMinMax<CRTP,value_t>::Remove( const value_t& value ) {
 
+  if ( m_ringValue.empty() ) return; // shouldn't land here, a bug if we do
+
   if ( &RunningMinMax<CRTP,value_t>::UpdateOnDel != &CRTP::UpdateOnDel ) {
-    static_cast<CRTP*>(this)->UpdateOnDel( m_mapValueCount.begin()->first, m_mapValueCount.rbegin()->first );
+    static_cast<CRTP*>(this)->UpdateOnDel( m_ringValue.at( m_ringMin.front() ), m_ringValue.at( m_ringMax.front() ) );
   }
 
-  typename mapValueCount_t::iterator iter = m_mapValueCount.find( value );
-  if ( (m_mapValueCount.end() == iter) ) {
-    int i = 1;  // shouldn't land here, a bug if we do
-  }
-  else {
-    (iter->second)--;
-    if ( 0 == iter->second ) {
-      m_mapValueCount.erase( iter );
-      if ( !m_mapValueCount.empty() ) {
+  assert( value == m_ringValue.front() ); // expiry needs to be in the order of addition
 
-      }
-    }
-  }
+  const uint64_t nSeq = m_ringValue.SeqFront();
+  if ( nSeq == m_ringMin.front() ) m_ringMin.pop_front();
+  if ( nSeq == m_ringMax.front() ) m_ringMax.pop_front();
+  m_ringValue.pop_front();
 }
 
 template<typename CRTP, typename value_t>
 void RunningMinMax<CRTP,value_t>::Reset() {
-  m_mapValueCount.clear();
+  m_ringValue.clear();
+  m_ringMin.clear();
+  m_ringMax.clear();
 }
 
 } // namespace tf
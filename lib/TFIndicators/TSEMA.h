@@ -36,6 +36,9 @@ public:
 
   inline double GetEMA() const { return m_dblRecentEMA; };
 
+  // history needed ahead of a replay slice, the weight of older values has decayed below exp(-8)
+  time_duration WarmUp() const { return m_tdTimeRange * 8; }
+
   ou::Delegate<const ou::tf::Price&> OnUpdate;
 
 protected:
@@ -37,6 +37,9 @@ public:
   virtual ~TimeSeriesSlidingWindow<T,D>();
   virtual void Reset();
   ou::Delegate<const D&> OnAppend;
+  // history needed ahead of a replay slice for the window to be populated, see SlicedReplay
+  time_duration WarmUp() const { return m_tdWindowWidth; }
+  size_type WarmUpCount() const { return m_nWindowSizeCount; }
 protected:
   ptime m_dtZero;  // datetime of first element, used as offset
   time_duration WindowWidth() const { return m_tdWindowWidth; };
@@ -0,0 +1,204 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    IBDepthBook.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFInteractiveBrokers
+ * Created: October 19, 2026 23:05
+ */
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+#include "IBDepthBook.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace ib { // Interactive Brokers
+
+namespace {
+  constexpr char rchSide[] = { 'A', 'B' }; // indexed by DepthBook::ESide
+}
+
+DepthBook::DepthBook()
+: m_nRejected {}
+{}
+
+void DepthBook::Set( fDepthByMM_t&& fDepthByMM, fDepthByOrder_t&& fDepthByOrder, fQuote_t&& fQuote ) {
+  m_fDepthByMM = std::move( fDepthByMM );
+  m_fDepthByOrder = std::move( fDepthByOrder );
+  m_fQuote = std::move( fQuote );
+}
+
+void DepthBook::Clear() {
+  m_rSide[ Ask ].nRows = 0;
+  m_rSide[ Bid ].nRows = 0;
+}
+
+DepthBook::mmid_t DepthBook::MarketMaker( const std::string& sMarketMaker ) {
+  char rch[ 4 ] = { 0, 0, 0, 0 };
+  std::memcpy( rch, sMarketMaker.data(), std::min<size_t>( 4, sMarketMaker.size() ) );
+  return ou::tf::DepthByMM::Cast( rch );
+}
+
+DepthBook::idorder_t DepthBook::LevelId( ESide side, price_t dblPrice ) {
+  // 1e-8 resolution covers equities, futures and fx pips
+  return ( (idorder_t)std::llround( dblPrice * 1e8 ) << 1 ) | (idorder_t)side;
+}
+
+bool DepthBook::Apply( int operation, int side, int position, const Level& level, Change& change ) {
+
+  if ( ( Ask != side ) && ( Bid != side ) ) return false;
+  if ( 0 > position ) return false;
+
+  Side& s( m_rSide[ side ] );
+  const size_t ix( position );
+
+  switch ( operation ) {
+    case Insert:
+      if ( s.nRows < ix ) return false; // would leave a gap
+      if ( c_nRows <= ix ) return false;
+      if ( c_nRows == s.nRows ) {
+        change.dropped = s.rLevel[ c_nRows - 1 ];
+        change.bDropped = true;
+        s.nRows--;
+      }
+      std::move_backward( s.rLevel.begin() + ix, s.rLevel.begin() + s.nRows, s.rLevel.begin() + s.nRows + 1 );
+      s.rLevel[ ix ] = level;
+      s.nRows++;
+      break;
+    case Update:
+      if ( s.nRows <= ix ) return false;
+      change.prior = s.rLevel[ ix ];
+      change.bPrior = true;
+      s.rLevel[ ix ] = level;
+      break;
+    case Delete:
+      if ( s.nRows <= ix ) return false;
+      change.prior = s.rLevel[ ix ];
+      change.bPrior = true;
+      std::move( s.rLevel.begin() + ix + 1, s.rLevel.begin() + s.nRows, s.rLevel.begin() + ix );
+      s.nRows--;
+      break;
+    default:
+      return false;
+  }
+  return true;
+}
+
+bool DepthBook::Holds( ESide side, const Level& level ) const {
+  const Side& s( m_rSide[ side ] );
+  for ( size_t ix = 0; ix < s.nRows; ix++ ) {
+    const Level& row( s.rLevel[ ix ] );
+    if ( ( row.mmid == level.mmid ) && ( row.dblPrice == level.dblPrice ) ) return true;
+  }
+  return false;
+}
+
+// aggregated depth
+bool DepthBook::MarketDepth( dt_t dt, int operation, int side, int position, price_t dblPrice, volume_t nSize ) {
+
+  Change change;
+  if ( !Apply( operation, side, position, Level( dblPrice, nSize, 0 ), change ) ) {
+    m_nRejected++;
+    return false;
+  }
+
+  if ( m_fDepthByOrder ) {
+    const ESide eSide( (ESide)side );
+    const char chSide( rchSide[ side ] );
+    if ( change.bDropped ) {
+      m_fDepthByOrder( ou::tf::DepthByOrder( dt, dt, LevelId( eSide, change.dropped.dblPrice ), 0, '5', chSide ) );
+    }
+    switch ( operation ) {
+      case Insert:
+        m_fDepthByOrder( ou::tf::DepthByOrder( dt, dt, LevelId( eSide, dblPrice ), position, '3', chSide, dblPrice, nSize ) );
+        break;
+      case Update:
+        if ( change.prior.dblPrice == dblPrice ) {
+          m_fDepthByOrder( ou::tf::DepthByOrder( dt, dt, LevelId( eSide, dblPrice ), position, '4', chSide, dblPrice, nSize ) );
+        }
+        else { // the row now holds a different level
+          m_fDepthByOrder( ou::tf::DepthByOrder( dt, dt, LevelId( eSide, change.prior.dblPrice ), 0, '5', chSide ) );
+          m_fDepthByOrder( ou::tf::DepthByOrder( dt, dt, LevelId( eSide, dblPrice ), position, '3', chSide, dblPrice, nSize ) );
+        }
+        break;
+      case Delete:
+        m_fDepthByOrder( ou::tf::DepthByOrder( dt, dt, LevelId( eSide, change.prior.dblPrice ), 0, '5', chSide ) );
+        break;
+    }
+  }
+
+  if ( 0 == position ) Top( dt );
+  return true;
+}
+
+// market maker depth
+bool DepthBook::MarketDepth( dt_t dt, int operation, int side, int position, const std::string& sMarketMaker, price_t dblPrice, volume_t nSize ) {
+
+  const mmid_t mmid( MarketMaker( sMarketMaker ) );
+
+  Change change;
+  if ( !Apply( operation, side, position, Level( dblPrice, nSize, mmid ), change ) ) {
+    m_nRejected++;
+    return false;
+  }
+
+  if ( m_fDepthByMM ) {
+    // with smart depth a market maker holds several rows, a level leaving a row is withdrawn
+    //   only when no other row holds the market maker at that price
+    const ESide eSide( (ESide)side );
+    const char chSide( rchSide[ side ] );
+    if ( change.bDropped && !Holds( eSide, change.dropped ) ) {
+      m_fDepthByMM( ou::tf::DepthByMM( dt, '5', chSide, 0, change.dropped.dblPrice, change.dropped.mmid ) );
+    }
+    switch ( operation ) {
+      case Insert:
+        m_fDepthByMM( ou::tf::DepthByMM( dt, '4', chSide, nSize, dblPrice, mmid ) );
+        break;
+      case Update:
+        if ( !Holds( eSide, change.prior ) ) {
+          m_fDepthByMM( ou::tf::DepthByMM( dt, '5', chSide, 0, change.prior.dblPrice, change.prior.mmid ) );
+        }
+        m_fDepthByMM( ou::tf::DepthByMM( dt, '4', chSide, nSize, dblPrice, mmid ) );
+        break;
+      case Delete:
+        if ( !Holds( eSide, change.prior ) ) {
+          m_fDepthByMM( ou::tf::DepthByMM( dt, '5', chSide, 0, change.prior.dblPrice, change.prior.mmid ) );
+        }
+        break;
+    }
+  }
+
+  if ( 0 == position ) Top( dt );
+  return true;
+}
+
+void DepthBook::Top( dt_t dt ) {
+  if ( m_fQuote ) {
+    const Side& ask( m_rSide[ Ask ] );
+    const Side& bid( m_rSide[ Bid ] );
+    if ( ( 0 < ask.nRows ) && ( 0 < bid.nRows ) ) {
+      const Level& a( ask.rLevel[ 0 ] );
+      const Level& b( bid.rLevel[ 0 ] );
+      m_fQuote( ou::tf::Quote( dt, b.dblPrice, b.nSize, a.dblPrice, a.nSize ) );
+    }
+  }
+}
+
+} // namespace ib
+} // namespace tf
+} // namespace ou
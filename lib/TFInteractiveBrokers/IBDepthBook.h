@@ -0,0 +1,119 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    IBDepthBook.h
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFInteractiveBrokers
+ * Created: October 19, 2026 23:05
+ */
+
+#pragma once
+
+// price level book maintained from the tws updateMktDepth / updateMktDepthL2 callbacks
+//   rows are position indexed, as sent: insert shifts the rows below down, delete shifts them up
+//   storage is a fixed array per side, nothing is allocated per message
+// each change is re-published in the existing depth types:
+//   updateMktDepthL2 -> DepthByMM: '4' add/update for the market maker at a price, '5' delete of the market maker at a price
+//     the delete is withheld while another row still holds the market maker at that price (smart depth)
+//   updateMktDepth   -> DepthByOrder: a level is an 'order' keyed by side & price, '3' add, '4' update, '5' delete
+//   a change to row 0 of either side publishes a Quote, once both sides have a row
+
+#include <array>
+#include <string>
+#include <functional>
+
+#include <TFTimeSeries/DatedDatum.h>
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace ib { // Interactive Brokers
+
+class DepthBook {
+public:
+
+  using dt_t = ou::tf::DatedDatum::dt_t;
+  using price_t = ou::tf::DatedDatum::price_t;
+  using volume_t = ou::tf::DatedDatum::volume_t;
+  using mmid_t = ou::tf::DepthByMM::MMID_t;
+  using idorder_t = ou::tf::DepthByOrder::idorder_t;
+
+  static constexpr size_t c_nRows = 64; // tws sends at most the rows requested, smart depth is capped lower
+
+  enum EOperation { Insert = 0, Update = 1, Delete = 2 }; // as in tws
+  enum ESide { Ask = 0, Bid = 1 }; // as in tws
+
+  struct Level {
+    price_t dblPrice;
+    volume_t nSize;
+    mmid_t mmid;
+    Level(): dblPrice {}, nSize {}, mmid {} {}
+    Level( price_t dblPrice_, volume_t nSize_, mmid_t mmid_ )
+    : dblPrice( dblPrice_ ), nSize( nSize_ ), mmid( mmid_ ) {}
+  };
+
+  using fDepthByMM_t = std::function<void(const ou::tf::DepthByMM&)>;
+  using fDepthByOrder_t = std::function<void(const ou::tf::DepthByOrder&)>;
+  using fQuote_t = std::function<void(const ou::tf::Quote&)>;
+
+  DepthBook();
+
+  void Set( fDepthByMM_t&&, fDepthByOrder_t&&, fQuote_t&& );
+
+  // false when the message does not fit the book (position out of range, unknown side or operation)
+  bool MarketDepth( dt_t, int operation, int side, int position, price_t, volume_t );
+  bool MarketDepth( dt_t, int operation, int side, int position, const std::string& sMarketMaker, price_t, volume_t );
+
+  void Clear(); // silent, as on a new subscription
+
+  size_t Rows( ESide side ) const { return m_rSide[ side ].nRows; }
+  const Level& Row( ESide side, size_t ix ) const { return m_rSide[ side ].rLevel[ ix ]; }
+
+  size_t Rejected() const { return m_nRejected; }
+
+  static mmid_t MarketMaker( const std::string& ); // first four characters, zero padded
+  static idorder_t LevelId( ESide, price_t ); // side & price as an order id
+
+protected:
+private:
+
+  struct Side {
+    size_t nRows;
+    std::array<Level,c_nRows> rLevel;
+    Side(): nRows {} {}
+  };
+
+  struct Change {
+    bool bPrior;   // prior holds the level replaced or deleted
+    bool bDropped; // dropped holds the level shifted off the end by an insert
+    Level prior;
+    Level dropped;
+    Change(): bPrior( false ), bDropped( false ) {}
+  };
+
+  std::array<Side,2> m_rSide;
+  size_t m_nRejected;
+
+  fDepthByMM_t m_fDepthByMM;
+  fDepthByOrder_t m_fDepthByOrder;
+  fQuote_t m_fQuote;
+
+  bool Apply( int operation, int side, int position, const Level&, Change& );
+  bool Holds( ESide, const Level& ) const; // a row with the level's market maker & price
+  void Top( dt_t );
+};
+
+} // namespace ib
+} // namespace tf
+} // namespace ou
@@ -31,9 +31,14 @@ Symbol::Symbol( inherited_t::idSymbol_t idSym, pInstrument_t pInstrument, Ticker
     m_dblAsk( 0 ), m_dblBid( 0 ), m_dblLast( 0 ),
     m_nVolume( 0 ),
     m_dblHigh( 0 ), m_dblLow( 0 ), m_dblClose( 0 ),
-    m_bQuoteTradeWatchInProgress( false ), m_bDepthWatchInProgress( false ),
+    m_bQuoteTradeWatchInProgress( false ), m_bDepthWatchInProgress( false ), m_bDepthRows( false ), m_bSmartDepth( false ),
     m_dblOptionPrice( 0 ), m_dblUnderlyingPrice( 0 ), m_dblPvDividend( 0 )
 {
+  m_book.Set(
+    [this]( const DepthByMM& depth ){ m_OnDepthByMM( depth ); },
+    [this]( const DepthByOrder& depth ){ m_OnDepthByOrder( depth ); },
+    [this]( const Quote& quote ){ m_OnQuote( quote ); }
+  );
   inherited_t::m_id = idSym;
 }
 
@@ -48,14 +53,30 @@ Symbol::Symbol( pInstrument_t pInstrument, TickerId idTicker )
     m_dblAsk( 0 ), m_dblBid( 0 ), m_dblLast( 0 ),
     m_nVolume( 0 ),
     m_dblHigh( 0 ), m_dblLow( 0 ), m_dblClose( 0 ),
-    m_bQuoteTradeWatchInProgress( false ), m_bDepthWatchInProgress( false ),
+    m_bQuoteTradeWatchInProgress( false ), m_bDepthWatchInProgress( false ), m_bDepthRows( false ), m_bSmartDepth( false ),
     m_dblOptionPrice( 0 ), m_dblUnderlyingPrice( 0 ), m_dblPvDividend( 0 )
 {
+  m_book.Set(
+    [this]( const DepthByMM& depth ){ m_OnDepthByMM( depth ); },
+    [this]( const DepthByOrder& depth ){ m_OnDepthByOrder( depth ); },
+    [this]( const Quote& quote ){ m_OnQuote( quote ); }
+  );
 }
 
 Symbol::~Symbol(void) {
 }
 
+namespace {
+  // 2024/03/17 found with a BID_SIZE forex quote
+  static const Decimal scary( 0x7c00000000000000 ); // 8935141660703064064
+
+  uint32_t DecimalToSize( Decimal size_decimal ) {
+    if ( scary == size_decimal ) return 0;
+    // go native at some point?  [high conversion overhead]
+    return __bid64_to_uint32_rnint( size_decimal );
+  }
+}
+
 void Symbol::AcceptTickPrice(TickType tickType, double price) {
   switch ( tickType ) {
     case TickType::BID:
@@ -94,17 +115,7 @@ void Symbol::AcceptTickPrice(TickType tickType, double price) {
 
 void Symbol::AcceptTickSize(TickType tickType, Decimal size_decimal) {
 
-  // 2024/03/17 found with a BID_SIZE forex quote
-  static const Decimal scary( 0x7c00000000000000 ); // 8935141660703064064
-
-  uint32_t size;
-  if ( scary == size_decimal ) {
-    size = 0;
-  }
-  else {
-    // go native at some point?  [high conversion overhead]
-    uint32_t size = __bid64_to_uint32_rnint( size_decimal );
-  }
+  uint32_t size = DecimalToSize( size_decimal );
 
   switch ( m_pInstrument->GetInstrumentType() ) {
   case InstrumentType::Stock:
@@ -158,7 +169,11 @@ void Symbol::AcceptTickString(TickType tickType, const std::string& value) {
 
 void Symbol::BuildQuote() {
 //  if ( m_bAskFound && m_bBidFound && m_bAskSizeFound && m_bBidSizeFound ) {
-    if ( m_bAskFound || m_bBidFound ) {
+  if ( m_bDepthWatchInProgress && m_bDepthRows ) {
+    // quotes are built from the top of m_book
+    m_bAskFound = m_bBidFound = m_bAskSizeFound = m_bBidSizeFound = false;
+  }
+  else if ( m_bAskFound || m_bBidFound ) {
     //boost::local_time::local_date_time ldt =
     //  boost::local_time::local_microsec_clock::local_time();
     Quote quote( ou::TimeSource::GlobalInstance().External(), m_dblBid, m_nBidSize, m_dblAsk, m_nAskSize );
@@ -174,6 +189,19 @@ void Symbol::BuildQuote() {
   }
 }
 
+// depth sizes arrive in shares, unlike the tick sizes
+void Symbol::AcceptDepth( int position, int operation, int side, double price, Decimal size ) {
+  if ( m_book.MarketDepth( ou::TimeSource::GlobalInstance().External(), operation, side, position, price, DecimalToSize( size ) ) ) {
+    m_bDepthRows = true;
+  }
+}
+
+void Symbol::AcceptDepthL2( int position, const std::string& marketMaker, int operation, int side, double price, Decimal size ) {
+  if ( m_book.MarketDepth( ou::TimeSource::GlobalInstance().External(), operation, side, position, marketMaker, price, DecimalToSize( size ) ) ) {
+    m_bDepthRows = true;
+  }
+}
+
 void Symbol::BuildTrade() {
   //if ( !m_bLastTimeStampFound && m_bLastFound && m_bLastSizeFound ) {
   //  std::cout << m_sSymbolName << " Trade is weird" << std::endl;
@@ -21,6 +21,8 @@
 
 #include <TFTrading/Symbol.h>
 
+#include "IBDepthBook.h"
+
 namespace ou { // One Unified
 namespace tf { // TradeFrame
 namespace ib { // Interactive Brokers
@@ -80,10 +82,18 @@ protected:
   bool GetQuoteTradeWatchInProgress() { return m_bQuoteTradeWatchInProgress; };
   bool m_bQuoteTradeWatchInProgress;
 
-  void SetDepthWatchInProgress() { m_bDepthWatchInProgress = true; };
-  void ResetDepthWatchInProgress() { m_bDepthWatchInProgress = false; };
+  void SetDepthWatchInProgress() { m_bDepthWatchInProgress = true; m_bDepthRows = false; };
+  void ResetDepthWatchInProgress() { m_bDepthWatchInProgress = m_bDepthRows = false; };
   bool GetDepthWatchInProgress() { return m_bDepthWatchInProgress; };
+  void ResetDepthRows() { m_bDepthRows = false; };
   bool m_bDepthWatchInProgress;
+  bool m_bDepthRows; // depth rows have arrived for the watch in progress
+  bool m_bSmartDepth; // as requested, needed for the cancel
+
+  DepthBook m_book; // fed by updateMktDepth / updateMktDepthL2, quotes come from row 0 once depth rows have arrived
+
+  void AcceptDepth( int position, int operation, int side, double price, Decimal size );
+  void AcceptDepthL2( int position, const std::string& marketMaker, int operation, int side, double price, Decimal size );
 
   void AcceptTickPrice( TickType tickType, double price );
   void AcceptTickSize( TickType tickType, Decimal size );
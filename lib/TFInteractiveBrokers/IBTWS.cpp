@@ -104,6 +104,8 @@ TWS::TWS( const std::string &acctCode, const std::string &address, unsigned int
   m_bProvidesQuotes = true;
   m_bProvidesTrades = true;
   m_bProvidesGreeks = true;
+  // m_bProvidesDepths is left false: Watch would request depth for every instrument, and tws limits
+  //   depth subscriptions, which also need level 2 permissions; add depth handlers explicitly instead
   m_bProvidesBrokerInterface = true;
 }
 
@@ -580,21 +582,61 @@ void TWS::StopQuoteTradeWatch( pSymbol_t pIBSymbol ) {
   }
 }
 
-//void TWS::StartDepthWatch( pSymbol_t pIBSymbol) {  // overridden from base class
-//  if ( !pIBSymbol->GetDepthWatchInProgress() ) {
-//    // start watch
-//    pIBSymbol->SetDepthWatchInProgress();
-//  }
-//}
+void TWS::StartDepthByMMWatch( pSymbol_t pSymbol ) {  // overridden from base class
+  StartDepthWatch( pSymbol );
+}
+
+void TWS::StopDepthByMMWatch( pSymbol_t pSymbol ) {  // overridden from base class
+  StopDepthWatch( pSymbol );
+}
+
+void TWS::StartDepthByOrderWatch( pSymbol_t pSymbol ) {  // overridden from base class
+  StartDepthWatch( pSymbol );
+}
+
+void TWS::StopDepthByOrderWatch( pSymbol_t pSymbol ) {  // overridden from base class
+  StopDepthWatch( pSymbol );
+}
+
+// one depth subscription per symbol, market maker handlers select smart depth (exchange as the market maker)
+//   updateMktDepth feeds DepthByOrder, updateMktDepthL2 feeds DepthByMM, both feed the symbol's book
+//   smart depth is fixed per request, so the subscription is re-issued when the first market maker handler
+//   is added to, or the last removed from, a running watch
+//   while smart depth is in use, tws sends only updateMktDepthL2, by order handlers see no changes
+void TWS::StartDepthWatch( pSymbol_t pIBSymbol ) {
+  const bool bSmartDepth( pIBSymbol->DepthByMMWatchNeeded() );
+  if ( pIBSymbol->GetDepthWatchInProgress() ) {
+    if ( bSmartDepth != pIBSymbol->m_bSmartDepth ) {
+      m_pTWS->cancelMktDepth( pIBSymbol->GetTickerId(), pIBSymbol->m_bSmartDepth );
+      pIBSymbol->ResetDepthWatchInProgress();
+    }
+  }
+  if ( !pIBSymbol->GetDepthWatchInProgress() ) {
+    // start watch
+    Contract contract;
+    contract.conId = pIBSymbol->GetInstrument()->GetContract();
+    contract.exchange = pIBSymbol->GetInstrument()->GetExchangeName();
+    contract.currency = pIBSymbol->GetInstrument()->GetCurrencyName();
+    pIBSymbol->m_book.Clear();
+    pIBSymbol->m_bSmartDepth = bSmartDepth;
+    pIBSymbol->SetDepthWatchInProgress();
+    TagValueListSPtr pMktDepthOptions;
+    m_pTWS->reqMktDepth( pIBSymbol->GetTickerId(), contract, c_nDepthRows, pIBSymbol->m_bSmartDepth, pMktDepthOptions );
+  }
+}
 
-//void TWS::StopDepthWatch( pSymbol_t pIBSymbol) {  // overridden from base class
-//  if ( pIBSymbol->DepthWatchNeeded() ) {
-//  }
-//  else {
-//    // stop watch
-//    pIBSymbol->ResetDepthWatchInProgress();
-//  }
-//}
+void TWS::StopDepthWatch( pSymbol_t pIBSymbol ) {
+  if ( pIBSymbol->DepthByMMWatchNeeded() || pIBSymbol->DepthByOrderWatchNeeded() ) {
+    // a depth watch is still in progress, re-issued without smart depth when the market maker handlers are gone
+    StartDepthWatch( pIBSymbol );
+  }
+  else {
+    // stop watch
+    m_pTWS->cancelMktDepth( pIBSymbol->GetTickerId(), pIBSymbol->m_bSmartDepth );
+    pIBSymbol->ResetDepthWatchInProgress();
+    pIBSymbol->m_book.Clear();
+  }
+}
 
 // indexed with InstrumentType::EInstrumentType
 const char *TWS::szSecurityType[] = {
@@ -1003,6 +1045,24 @@ void TWS::error(const int id, const int errorCode, const std::string& errorStrin
       break;
     case 2104:  // datafarm connected ok
       break;
+    case 309:   // max number of market depth requests has been reached
+    case 10092: // deep market data is not supported for this combination of security/exchange
+      // id is the ticker, the subscription did not start, quotes continue from the ticks
+      std::cout << "IB depth error " << id << ", " << errorCode << ", " << errorString << std::endl;
+      if ( ( id > 0 ) && ( id <= m_curTickerId ) ) {
+        Symbol::pSymbol_t& pSym( m_vTickerToSymbol[ id ] );
+        pSym->ResetDepthWatchInProgress();
+        pSym->m_book.Clear();
+      }
+      break;
+    case 317:   // market depth data has been reset, empty the book before applying new entries
+      // id is the ticker, the subscription continues, quotes come from the ticks until rows arrive again
+      if ( ( id > 0 ) && ( id <= m_curTickerId ) ) {
+        Symbol::pSymbol_t& pSym( m_vTickerToSymbol[ id ] );
+        pSym->ResetDepthRows();
+        pSym->m_book.Clear();
+      }
+      break;
     case 200:  // no security definition has been found
       if ( 0 != OnSecurityDefinitionNotFound ) OnSecurityDefinitionNotFound();
       break;
@@ -1806,9 +1866,24 @@ double TWS::GetInterval( const double price, const int rule ) {
 }
 
 void TWS::updateMktDepth(TickerId id, int position, int operation, int side,
-                            double price, Decimal size) {}
+                            double price, Decimal size) {
+  if ( ( id > 0 ) && ( id <= m_curTickerId ) ) {
+    Symbol::pSymbol_t& pSym( m_vTickerToSymbol[ id ] );
+    if ( pSym->GetDepthWatchInProgress() ) {
+      pSym->AcceptDepth( position, operation, side, price, size );
+    }
+  }
+}
+
 void TWS::updateMktDepthL2(TickerId id, int position, const std::string& marketMaker, int operation,
-                              int side, double price, Decimal size, bool isSmartDepth ) {}
+                              int side, double price, Decimal size, bool isSmartDepth ) {
+  if ( ( id > 0 ) && ( id <= m_curTickerId ) ) {
+    Symbol::pSymbol_t& pSym( m_vTickerToSymbol[ id ] );
+    if ( pSym->GetDepthWatchInProgress() ) {
+      pSym->AcceptDepthL2( position, marketMaker, operation, side, price, size );
+    }
+  }
+}
 
 void TWS::managedAccounts( const std::string& accountsList) {}
 void TWS::receiveFA( faDataType pFaDataType, const std::string& cxml ) {}
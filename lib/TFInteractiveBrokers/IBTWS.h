@@ -179,6 +179,8 @@ protected:
   static const char *szSecurityType[];
   static const char *szOrderType[];
 
+  static constexpr int c_nDepthRows = 20; // rows per side requested with reqMktDepth
+
   pSymbol_t NewCSymbol( pInstrument_t pInstrument );
 
   // overridden from ProviderInterface
@@ -191,8 +193,14 @@ protected:
   void StartQuoteTradeWatch( pSymbol_t pSymbol );
   void  StopQuoteTradeWatch( pSymbol_t pSymbol );
 
-  //void StartDepthWatch( pSymbol_t pSymbol );
-  //void  StopDepthWatch( pSymbol_t pSymbol );
+  void StartDepthByMMWatch( pSymbol_t pSymbol );
+  void  StopDepthByMMWatch( pSymbol_t pSymbol );
+
+  void StartDepthByOrderWatch( pSymbol_t pSymbol );
+  void  StopDepthByOrderWatch( pSymbol_t pSymbol );
+
+  void StartDepthWatch( pSymbol_t pSymbol );
+  void  StopDepthWatch( pSymbol_t pSymbol );
 
   void StartGreekWatch( pSymbol_t pSymbol );
   void  StopGreekWatch( pSymbol_t pSymbol );
@@ -0,0 +1,259 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    DepthBook.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFInteractiveBrokers/test
+ * Created: October 20, 2026 09:15
+ */
+
+// canned tws depth sessions played through ib::DepthBook, as TWS::updateMktDepth / updateMktDepthL2 deliver them
+//   each publication is recorded as a line of text, and compared with the expected tape
+
+#define BOOST_TEST_MODULE IBDepthBook
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <vector>
+#include <sstream>
+
+#include <TFInteractiveBrokers/IBDepthBook.h>
+
+namespace {
+
+using DepthBook = ou::tf::ib::DepthBook;
+using volume_t = DepthBook::volume_t;
+
+// one EWrapper depth callback, arguments in EWrapper order:
+//   updateMktDepth( id, position, operation, side, price, size )
+//   updateMktDepthL2( id, position, marketMaker, operation, side, price, size, isSmartDepth )
+// operation: 0 insert, 1 update, 2 delete; side: 0 ask, 1 bid
+struct Message {
+  const char* szMarketMaker; // nullptr for updateMktDepth
+  int position;
+  int operation;
+  int side;
+  double price;
+  volume_t size;
+};
+
+Message Depth( int position, int operation, int side, double price, volume_t size ) {
+  return Message { nullptr, position, operation, side, price, size };
+}
+
+Message DepthL2( int position, const char* szMarketMaker, int operation, int side, double price, volume_t size ) {
+  return Message { szMarketMaker, position, operation, side, price, size };
+}
+
+using vMessage_t = std::vector<Message>;
+using vTape_t = std::vector<std::string>;
+
+// the book, with its publications recorded as:
+//   DepthByOrder: message type, side, price of the level (from the order id), size
+//   DepthByMM:    message type, side, price, size, market maker
+//   Quote:        Q bid x size, ask x size
+struct Session {
+
+  DepthBook book;
+  vTape_t vTape;
+
+  Session() {
+    book.Set(
+      [this]( const ou::tf::DepthByMM& depth ){
+        std::stringstream ss;
+        ss << depth.MsgType() << depth.Side() << " " << depth.Price() << " " << depth.Volume() << " " << depth.MMIDStr().c_str();
+        vTape.push_back( ss.str() );
+      },
+      [this]( const ou::tf::DepthByOrder& depth ){
+        std::stringstream ss;
+        ss << depth.MsgType() << depth.Side() << " " << ( depth.OrderID() >> 1 ) / 1e8 << " " << depth.Volume();
+        vTape.push_back( ss.str() );
+      },
+      [this]( const ou::tf::Quote& quote ){
+        std::stringstream ss;
+        ss << "Q " << quote.Bid() << "x" << quote.BidSize() << " " << quote.Ask() << "x" << quote.AskSize();
+        vTape.push_back( ss.str() );
+      }
+    );
+  }
+
+  size_t Play( const vMessage_t& vMessage ) { // returns the number accepted
+    const DepthBook::dt_t dt( boost::gregorian::date( 2026, 10, 20 ), boost::posix_time::time_duration( 9, 30, 0 ) );
+    size_t nAccepted {};
+    for ( const Message& message: vMessage ) {
+      const bool bAccepted = ( nullptr == message.szMarketMaker )
+        ? book.MarketDepth( dt, message.operation, message.side, message.position, message.price, message.size )
+        : book.MarketDepth( dt, message.operation, message.side, message.position, message.szMarketMaker, message.price, message.size );
+      if ( bAccepted ) nAccepted++;
+    }
+    return nAccepted;
+  }
+
+  void CheckSide( DepthBook::ESide side, const std::vector<std::pair<double,volume_t> >& vRow ) const {
+    BOOST_REQUIRE_EQUAL( book.Rows( side ), vRow.size() );
+    for ( size_t ix = 0; ix < vRow.size(); ix++ ) {
+      BOOST_CHECK_EQUAL( book.Row( side, ix ).dblPrice, vRow[ ix ].first );
+      BOOST_CHECK_EQUAL( book.Row( side, ix ).nSize, vRow[ ix ].second );
+    }
+  }
+};
+
+} // namespace anonymous
+
+BOOST_FIXTURE_TEST_CASE( aggregated_depth, Session ) {
+
+  const vMessage_t vMessage {
+    Depth( 0, 0, 0, 100.50, 200 ),
+    Depth( 0, 0, 1, 100.25, 300 ),
+    Depth( 1, 0, 1, 100.00, 100 ),
+    Depth( 1, 0, 0, 100.75, 500 ),
+    Depth( 0, 1, 1, 100.25, 400 ), // size change
+    Depth( 1, 1, 0, 101.00, 500 ), // the row takes another price
+    Depth( 0, 2, 0,   0.00,   0 ),
+    Depth( 0, 0, 0, 100.75,  50 ),
+  };
+
+  const vTape_t vExpected {
+    "3A 100.5 200",
+    "3B 100.25 300", "Q 100.25x300 100.5x200",
+    "3B 100 100",
+    "3A 100.75 500",
+    "4B 100.25 400", "Q 100.25x400 100.5x200",
+    "5A 100.75 0", "3A 101 500",
+    "5A 100.5 0", "Q 100.25x400 101x500",
+    "3A 100.75 50", "Q 100.25x400 100.75x50",
+  };
+
+  BOOST_CHECK_EQUAL( Play( vMessage ), vMessage.size() );
+  BOOST_CHECK_EQUAL_COLLECTIONS( vTape.begin(), vTape.end(), vExpected.begin(), vExpected.end() );
+  CheckSide( DepthBook::Ask, { { 100.75, 50 }, { 101.00, 500 } } );
+  CheckSide( DepthBook::Bid, { { 100.25, 400 }, { 100.00, 100 } } );
+}
+
+BOOST_FIXTURE_TEST_CASE( insert_and_delete_shift_rows, Session ) {
+
+  const vMessage_t vMessage {
+    Depth( 0, 0, 1, 100.00, 100 ),
+    Depth( 0, 0, 1, 100.25, 200 ), // 100.00 moves to row 1
+    Depth( 1, 0, 1, 100.125, 300 ), // 100.00 moves to row 2
+    Depth( 3, 0, 1,  99.75, 400 ),
+    Depth( 1, 2, 1,   0.00,   0 ), // 100.00 and 99.75 move up
+  };
+
+  BOOST_CHECK_EQUAL( Play( vMessage ), vMessage.size() );
+  CheckSide( DepthBook::Bid, { { 100.25, 200 }, { 100.00, 100 }, { 99.75, 400 } } );
+  CheckSide( DepthBook::Ask, {} );
+  BOOST_CHECK_EQUAL( vTape.back(), "5B 100.125 0" );
+}
+
+BOOST_FIXTURE_TEST_CASE( full_side_drops_last_row, Session ) {
+
+  vMessage_t vMessage;
+  for ( size_t ix = 0; ix < DepthBook::c_nRows; ix++ ) {
+    vMessage.emplace_back( Depth( ix, 0, 1, 100.0 - 0.25 * ix, 10 ) );
+  }
+  vMessage.emplace_back( Depth( 0, 0, 1, 100.25, 7 ) );
+
+  BOOST_CHECK_EQUAL( Play( vMessage ), vMessage.size() );
+  BOOST_REQUIRE_EQUAL( vTape.size(), DepthBook::c_nRows + 2 );
+  BOOST_CHECK_EQUAL( vTape[ DepthBook::c_nRows ], "5B 84.25 0" ); // the last row is withdrawn first
+  BOOST_CHECK_EQUAL( vTape[ DepthBook::c_nRows + 1 ], "3B 100.25 7" );
+  BOOST_CHECK_EQUAL( book.Rows( DepthBook::Bid ), DepthBook::c_nRows );
+  BOOST_CHECK_EQUAL( book.Row( DepthBook::Bid, 0 ).dblPrice, 100.25 );
+  BOOST_CHECK_EQUAL( book.Row( DepthBook::Bid, DepthBook::c_nRows - 1 ).dblPrice, 84.50 );
+}
+
+BOOST_FIXTURE_TEST_CASE( messages_outside_the_book_are_rejected, Session ) {
+
+  const vMessage_t vMessage {
+    Depth(  0, 1, 0, 100.50, 200 ), // update of an empty row
+    Depth(  1, 0, 0, 100.50, 200 ), // insert leaving a gap
+    Depth(  0, 2, 1,   0.00,   0 ), // delete of an empty row
+    Depth(  0, 0, 2, 100.50, 200 ), // unknown side
+    Depth(  0, 3, 0, 100.50, 200 ), // unknown operation
+    Depth( -1, 0, 0, 100.50, 200 ),
+    DepthL2( 2, "NSDQ", 0, 1, 100.25, 300 ),
+  };
+
+  BOOST_CHECK_EQUAL( Play( vMessage ), 0 );
+  BOOST_CHECK_EQUAL( book.Rejected(), vMessage.size() );
+  BOOST_CHECK( vTape.empty() );
+  BOOST_CHECK_EQUAL( book.Rows( DepthBook::Ask ), 0 );
+  BOOST_CHECK_EQUAL( book.Rows( DepthBook::Bid ), 0 );
+}
+
+BOOST_FIXTURE_TEST_CASE( market_maker_depth, Session ) {
+
+  const vMessage_t vMessage {
+    DepthL2( 0, "NSDQ",   0, 1, 100.25, 300 ),
+    DepthL2( 0, "ISLAND", 0, 0, 100.50, 200 ), // four characters are kept
+    DepthL2( 1, "IB",     0, 1, 100.00, 100 ),
+    DepthL2( 0, "ARCA",   1, 1, 100.25, 500 ), // another market maker takes the row
+    DepthL2( 1, "IB",     2, 1,   0.00,   0 ),
+  };
+
+  const vTape_t vExpected {
+    "4B 100.25 300 NSDQ",
+    "4A 100.5 200 ISLA", "Q 100.25x300 100.5x200",
+    "4B 100 100 IB",
+    "5B 100.25 0 NSDQ", "4B 100.25 500 ARCA", "Q 100.25x500 100.5x200",
+    "5B 100 0 IB",
+  };
+
+  BOOST_CHECK_EQUAL( Play( vMessage ), vMessage.size() );
+  BOOST_CHECK_EQUAL_COLLECTIONS( vTape.begin(), vTape.end(), vExpected.begin(), vExpected.end() );
+  CheckSide( DepthBook::Bid, { { 100.25, 500 } } );
+  BOOST_CHECK_EQUAL( book.Row( DepthBook::Bid, 0 ).mmid, DepthBook::MarketMaker( "ARCA" ) );
+}
+
+BOOST_FIXTURE_TEST_CASE( smart_depth_market_maker_on_several_rows, Session ) {
+
+  const vMessage_t vMessage {
+    DepthL2( 0, "NSDQ", 0, 1, 100.25, 300 ),
+    DepthL2( 1, "ARCA", 0, 1, 100.25, 200 ),
+    DepthL2( 2, "NSDQ", 0, 1, 100.00, 100 ),
+    DepthL2( 0, "ARCA", 1, 1, 100.25, 200 ), // rows rewritten in place, as tws does on a shift
+    DepthL2( 1, "NSDQ", 1, 1, 100.00, 100 ), // ARCA at 100.25 is still on row 0
+    DepthL2( 2, "NSDQ", 2, 1,   0.00,   0 ), // NSDQ at 100.00 is still on row 1
+    DepthL2( 1, "NSDQ", 2, 1,   0.00,   0 ),
+  };
+
+  const vTape_t vExpected {
+    "4B 100.25 300 NSDQ",
+    "4B 100.25 200 ARCA",
+    "4B 100 100 NSDQ",
+    "5B 100.25 0 NSDQ", "4B 100.25 200 ARCA",
+    "4B 100 100 NSDQ",
+    "5B 100 0 NSDQ",
+  };
+
+  BOOST_CHECK_EQUAL( Play( vMessage ), vMessage.size() );
+  BOOST_CHECK_EQUAL_COLLECTIONS( vTape.begin(), vTape.end(), vExpected.begin(), vExpected.end() );
+  CheckSide( DepthBook::Bid, { { 100.25, 200 } } );
+}
+
+BOOST_FIXTURE_TEST_CASE( clear_is_silent, Session ) {
+
+  Play( { Depth( 0, 0, 0, 100.50, 200 ), Depth( 0, 0, 1, 100.25, 300 ) } );
+  const size_t nTape( vTape.size() );
+
+  book.Clear(); // as on a re-issued subscription
+  BOOST_CHECK_EQUAL( vTape.size(), nTape );
+  BOOST_CHECK_EQUAL( book.Rows( DepthBook::Ask ), 0 );
+  BOOST_CHECK_EQUAL( book.Rows( DepthBook::Bid ), 0 );
+
+  BOOST_CHECK_EQUAL( Play( { Depth( 0, 0, 1, 99.75, 100 ) } ), 1 );
+  BOOST_CHECK_EQUAL( vTape.back(), "3B 99.75 100" ); // no quote, the ask side is empty
+}
@@ -0,0 +1,530 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    American.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFOptions
+ * Created: October 19, 2026 15:10
+ */
+
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+#include <boost/lexical_cast.hpp>
+
+#include "American.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace option { // options
+
+const char* Name( PricingModel model ) {
+  switch ( model ) {
+    case PricingModel::CRR: return "crr";
+    case PricingModel::BjerksundStensland: return "bjerksund_stensland";
+    case PricingModel::BaroneAdesiWhaley: return "barone_adesi_whaley";
+  }
+  return "unknown";
+}
+
+namespace american {
+
+namespace {
+
+  const double c_pi = 3.14159265358979323846;
+  const double c_sqrt2pi = 2.50662827463100050242;
+
+  inline double CND( double x ) { return 0.5 * std::erfc( -x * 0.70710678118654752440 ); }
+  inline double ND( double x ) { return std::exp( -0.5 * x * x ) / c_sqrt2pi; }
+
+  inline bool IsCall( const binomial::structInput& input ) {
+    switch ( input.optionSide ) {
+      case ou::tf::OptionSide::Call: return true;
+      case ou::tf::OptionSide::Put: return false;
+      default:
+        throw std::runtime_error( "american: option side unknown" );
+    }
+  }
+
+  double GBS( bool bCall, double S, double X, double T, double r, double b, double v ) {
+    const double vst = v * std::sqrt( T );
+    const double d1 = ( std::log( S / X ) + ( b + 0.5 * v * v ) * T ) / vst;
+    const double d2 = d1 - vst;
+    const double carry = std::exp( ( b - r ) * T );
+    const double df = std::exp( -r * T );
+    if ( bCall ) return S * carry * CND( d1 ) - X * df * CND( d2 );
+    else         return X * df * CND( -d2 ) - S * carry * CND( -d1 );
+  }
+
+  // 2r/v^2 / ( 1 - e^-rT ), with its limit as r goes to zero
+  double RatioMK( double r, double v, double T ) {
+    const double K = -std::expm1( -r * T );
+    if ( 0.0 == K ) return 2.0 / ( v * v * T );
+    return ( 2.0 * r / ( v * v ) ) / K;
+  }
+
+  // ==== Barone-Adesi Whaley
+
+  // critical price, pg 99, newton-raphson from the seed value
+  double Kc( double X, double T, double r, double b, double v ) {
+    const double vst = v * std::sqrt( T );
+    const double N = 2.0 * b / ( v * v );
+    const double m = 2.0 * r / ( v * v );
+    const double q2u = ( -( N - 1.0 ) + std::sqrt( ( N - 1.0 ) * ( N - 1.0 ) + 4.0 * m ) ) / 2.0;
+    const double Su = X / ( 1.0 - 1.0 / q2u );
+    const double h2 = -( b * T + 2.0 * vst ) * X / ( Su - X );
+    double Si = X + ( Su - X ) * ( 1.0 - std::exp( h2 ) );
+
+    const double mk = RatioMK( r, v, T );
+    const double Q2 = ( -( N - 1.0 ) + std::sqrt( ( N - 1.0 ) * ( N - 1.0 ) + 4.0 * mk ) ) / 2.0;
+    const double carry = std::exp( ( b - r ) * T );
+
+    for ( int cnt = 0; cnt < 100; ++cnt ) {
+      const double d1 = ( std::log( Si / X ) + ( b + 0.5 * v * v ) * T ) / vst;
+      const double LHS = Si - X;
+      const double RHS = GBS( true, Si, X, T, r, b, v ) + ( 1.0 - carry * CND( d1 ) ) * Si / Q2;
+      if ( std::abs( LHS - RHS ) / X < 1e-6 ) break;
+      const double bi = carry * CND( d1 ) * ( 1.0 - 1.0 / Q2 ) + ( 1.0 - carry * ND( d1 ) / vst ) / Q2;
+      Si = ( X + RHS - bi * Si ) / ( 1.0 - bi );
+    }
+    return Si;
+  }
+
+  double Kp( double X, double T, double r, double b, double v ) {
+    const double vst = v * std::sqrt( T );
+    const double N = 2.0 * b / ( v * v );
+    const double m = 2.0 * r / ( v * v );
+    const double q1u = ( -( N - 1.0 ) - std::sqrt( ( N - 1.0 ) * ( N - 1.0 ) + 4.0 * m ) ) / 2.0;
+    const double Su = X / ( 1.0 - 1.0 / q1u );
+    const double h1 = ( b * T - 2.0 * vst ) * X / ( X - Su );
+    double Si = Su + ( X - Su ) * std::exp( h1 );
+
+    const double mk = RatioMK( r, v, T );
+    const double Q1 = ( -( N - 1.0 ) - std::sqrt( ( N - 1.0 ) * ( N - 1.0 ) + 4.0 * mk ) ) / 2.0;
+    const double carry = std::exp( ( b - r ) * T );
+
+    for ( int cnt = 0; cnt < 100; ++cnt ) {
+      const double d1 = ( std::log( Si / X ) + ( b + 0.5 * v * v ) * T ) / vst;
+      const double LHS = X - Si;
+      const double RHS = GBS( false, Si, X, T, r, b, v ) - ( 1.0 - carry * CND( -d1 ) ) * Si / Q1;
+      if ( std::abs( LHS - RHS ) / X < 1e-6 ) break;
+      const double bi = -carry * CND( -d1 ) * ( 1.0 - 1.0 / Q1 ) - ( 1.0 + carry * ND( -d1 ) / vst ) / Q1;
+      Si = ( X - RHS + bi * Si ) / ( 1.0 + bi );
+    }
+    return Si;
+  }
+
+  // d/dr of RatioMK, carry held
+  double RatioMK_dr( double r, double v, double T ) {
+    const double K = -std::expm1( -r * T );
+    if ( 0.0 == K ) return 1.0 / ( v * v );
+    return ( 2.0 / ( v * v ) ) * ( K - r * T * std::exp( -r * T ) ) / ( K * K );
+  }
+
+  // price with analytic delta, gamma, vega and rho, vega per unit of volatility, rho with carry held
+  //   the critical price satisfies both value matching and smooth pasting, so the premium is stationary in Sk,
+  //   and vega and rho need only the explicit dependence: the european value at Sk and the exponent q
+  void BAW( const binomial::structInput& in, double& price, double& delta, double& gamma, double& vega, double& rho ) {
+
+    const bool bCall( IsCall( in ) );
+    const double S( in.S ), X( in.X ), T( in.T ), r( in.r ), b( in.b ), v( in.v );
+
+    const double vst = v * std::sqrt( T );
+    const double d1 = ( std::log( S / X ) + ( b + 0.5 * v * v ) * T ) / vst;
+    const double carry = std::exp( ( b - r ) * T );
+
+    price = GBS( bCall, S, X, T, r, b, v );
+    delta = bCall ? carry * CND( d1 ) : -carry * CND( -d1 );
+    gamma = carry * ND( d1 ) / ( S * vst );
+    vega = S * carry * ND( d1 ) * std::sqrt( T );
+    rho = -T * price;
+
+    const double N = 2.0 * b / ( v * v );
+    const double mk = RatioMK( r, v, T );
+    const double root = std::sqrt( ( N - 1.0 ) * ( N - 1.0 ) + 4.0 * mk );
+    const double droot_dv = ( ( N - 1.0 ) * ( -2.0 * N / v ) + 2.0 * ( -2.0 * mk / v ) ) / root; // N and mk go as 1/v^2
+    const double droot_dr = 2.0 * RatioMK_dr( r, v, T ) / root;
+
+    if ( bCall ) {
+      if ( b >= r ) return; // never optimal to exercise early
+      const double Sk = Kc( X, T, r, b, v );
+      if ( S < Sk ) {
+        const double q2 = ( -( N - 1.0 ) + root ) / 2.0;
+        const double d1k = ( std::log( Sk / X ) + ( b + 0.5 * v * v ) * T ) / vst;
+        const double a2 = ( Sk / q2 ) * ( 1.0 - carry * CND( d1k ) );
+        const double ratio = std::pow( S / Sk, q2 );
+        const double log_ratio = std::log( S / Sk );
+        price += a2 * ratio;
+        delta += a2 * q2 * ratio / S;
+        gamma += a2 * q2 * ( q2 - 1.0 ) * ratio / ( S * S );
+        const double vega_k = Sk * carry * ND( d1k ) * std::sqrt( T );
+        const double rho_k = -T * GBS( true, Sk, X, T, r, b, v );
+        vega += ratio * ( -vega_k + a2 * log_ratio * ( 2.0 * N / v + droot_dv ) / 2.0 );
+        rho += ratio * ( -rho_k + a2 * log_ratio * droot_dr / 2.0 );
+      }
+      else {
+        price = S - X; delta = 1.0; gamma = 0.0; vega = 0.0; rho = 0.0;
+      }
+    }
+    else {
+      if ( 0.0 >= r ) return; // no reward for early exercise
+      const double Sk = Kp( X, T, r, b, v );
+      if ( S > Sk ) {
+        const double q1 = ( -( N - 1.0 ) - root ) / 2.0;
+        const double d1k = ( std::log( Sk / X ) + ( b + 0.5 * v * v ) * T ) / vst;
+        const double a1 = -( Sk / q1 ) * ( 1.0 - carry * CND( -d1k ) );
+        const double ratio = std::pow( S / Sk, q1 );
+        const double log_ratio = std::log( S / Sk );
+        price += a1 * ratio;
+        delta += a1 * q1 * ratio / S;
+        gamma += a1 * q1 * ( q1 - 1.0 ) * ratio / ( S * S );
+        const double vega_k = Sk * carry * ND( d1k ) * std::sqrt( T );
+        const double rho_k = -T * GBS( false, Sk, X, T, r, b, v );
+        vega += ratio * ( -vega_k + a1 * log_ratio * ( 2.0 * N / v - droot_dv ) / 2.0 );
+        rho += ratio * ( -rho_k - a1 * log_ratio * droot_dr / 2.0 );
+      }
+      else {
+        price = X - S; delta = -1.0; gamma = 0.0; vega = 0.0; rho = 0.0;
+      }
+    }
+  }
+
+  // slope for the newton step, bjerksund stensland borrows the barone-adesi whaley vega,
+  //   the two approximate the same price, and the bracket catches any step the borrowed slope overshoots
+  double PriceVega( PricingModel model, const binomial::structInput& input, double& vega ) {
+    double price, delta, gamma, rho;
+    BAW( input, price, delta, gamma, vega, rho );
+    if ( PricingModel::BjerksundStensland == model ) {
+      price = BjerksundStensland2002( input );
+    }
+    return price;
+  }
+
+  // ==== Bjerksund Stensland 2002
+
+  double phi( double S, double T, double gamma, double H, double I, double r, double b, double v ) {
+    const double vst = v * std::sqrt( T );
+    const double lambda = ( -r + gamma * b + 0.5 * gamma * ( gamma - 1.0 ) * v * v ) * T;
+    const double d = -( std::log( S / H ) + ( b + ( gamma - 0.5 ) * v * v ) * T ) / vst;
+    const double kappa = 2.0 * b / ( v * v ) + 2.0 * gamma - 1.0;
+    return std::exp( lambda ) * std::pow( S, gamma )
+      * ( CND( d ) - std::pow( I / S, kappa ) * CND( d - 2.0 * std::log( I / S ) / vst ) );
+  }
+
+  double ksi( double S, double T2, double gamma, double H, double I2, double I1, double t1, double r, double b, double v ) {
+    const double vst1 = v * std::sqrt( t1 );
+    const double vst2 = v * std::sqrt( T2 );
+    const double drift = b + ( gamma - 0.5 ) * v * v;
+    const double e1 = ( std::log( S / I1 ) + drift * t1 ) / vst1;
+    const double e2 = ( std::log( I2 * I2 / ( S * I1 ) ) + drift * t1 ) / vst1;
+    const double e3 = ( std::log( S / I1 ) - drift * t1 ) / vst1;
+    const double e4 = ( std::log( I2 * I2 / ( S * I1 ) ) - drift * t1 ) / vst1;
+    const double f1 = ( std::log( S / H ) + drift * T2 ) / vst2;
+    const double f2 = ( std::log( I2 * I2 / ( S * H ) ) + drift * T2 ) / vst2;
+    const double f3 = ( std::log( I1 * I1 / ( S * H ) ) + drift * T2 ) / vst2;
+    const double f4 = ( std::log( S * I1 * I1 / ( H * I2 * I2 ) ) + drift * T2 ) / vst2;
+    const double rho = std::sqrt( t1 / T2 );
+    const double lambda = -r + gamma * b + 0.5 * gamma * ( gamma - 1.0 ) * v * v;
+    const double kappa = 2.0 * b / ( v * v ) + 2.0 * gamma - 1.0;
+    return std::exp( lambda * T2 ) * std::pow( S, gamma )
+      * ( CBND( -e1, -f1, rho )
+        - std::pow( I2 / S, kappa ) * CBND( -e2, -f2, rho )
+        - std::pow( I1 / S, kappa ) * CBND( -e3, -f3, -rho )
+        + std::pow( I1 / I2, kappa ) * CBND( -e4, -f4, -rho ) );
+  }
+
+  double BSCall2002( double S, double X, double T, double r, double b, double v ) {
+
+    if ( b >= r ) return GBS( true, S, X, T, r, b, v );
+
+    const double t1 = 0.5 * ( std::sqrt( 5.0 ) - 1.0 ) * T;
+    const double v2 = v * v;
+    const double Beta = ( 0.5 - b / v2 ) + std::sqrt( ( b / v2 - 0.5 ) * ( b / v2 - 0.5 ) + 2.0 * r / v2 );
+    const double BInfinity = Beta / ( Beta - 1.0 ) * X;
+    const double B0 = ( 0.0 < r - b ) ? std::max( X, r / ( r - b ) * X ) : X;
+    const double ht1 = -( b * t1 + 2.0 * v * std::sqrt( t1 ) ) * X * X / ( ( BInfinity - B0 ) * B0 );
+    const double ht2 = -( b * T + 2.0 * v * std::sqrt( T ) ) * X * X / ( ( BInfinity - B0 ) * B0 );
+    const double I1 = B0 + ( BInfinity - B0 ) * ( 1.0 - std::exp( ht1 ) );
+    const double I2 = B0 + ( BInfinity - B0 ) * ( 1.0 - std::exp( ht2 ) );
+    const double alfa1 = ( I1 - X ) * std::pow( I1, -Beta );
+    const double alfa2 = ( I2 - X ) * std::pow( I2, -Beta );
+
+    if ( S >= I2 ) return S - X;
+
+    return alfa2 * std::pow( S, Beta )
+      - alfa2 * phi( S, t1, Beta, I2, I2, r, b, v )
+      + phi( S, t1, 1.0, I2, I2, r, b, v )
+      - phi( S, t1, 1.0, I1, I2, r, b, v )
+      - X * phi( S, t1, 0.0, I2, I2, r, b, v )
+      + X * phi( S, t1, 0.0, I1, I2, r, b, v )
+      + alfa1 * phi( S, t1, Beta, I1, I2, r, b, v )
+      - alfa1 * ksi( S, T, Beta, I1, I2, I1, t1, r, b, v )
+      + ksi( S, T, 1.0, I1, I2, I1, t1, r, b, v )
+      - ksi( S, T, 1.0, X, I2, I1, t1, r, b, v )
+      - X * ksi( S, T, 0.0, I1, I2, I1, t1, r, b, v )
+      + X * ksi( S, T, 0.0, X, I2, I1, t1, r, b, v );
+  }
+
+  double Price( PricingModel model, const binomial::structInput& input ) {
+    switch ( model ) {
+      case PricingModel::BjerksundStensland:
+        return BjerksundStensland2002( input );
+      case PricingModel::BaroneAdesiWhaley:
+        return BaroneAdesiWhaley( input );
+      case PricingModel::CRR:
+      default:
+        {
+          binomial::structOutput output;
+          binomial::CRR( input, output );
+          return output.option;
+        }
+    }
+  }
+
+} // namespace anonymous
+
+double GBS( const binomial::structInput& in ) {
+  return GBS( IsCall( in ), in.S, in.X, in.T, in.r, in.b, in.v );
+}
+
+double BaroneAdesiWhaley( const binomial::structInput& input ) {
+  double price, delta, gamma, vega, rho;
+  BAW( input, price, delta, gamma, vega, rho );
+  return price;
+}
+
+double BjerksundStensland2002( const binomial::structInput& in ) {
+  if ( IsCall( in ) ) {
+    return BSCall2002( in.S, in.X, in.T, in.r, in.b, in.v );
+  }
+  else { // put-call transformation, pg 106
+    return BSCall2002( in.X, in.S, in.T, in.r - in.b, -in.b, in.v );
+  }
+}
+
+void Greeks( PricingModel model, const binomial::structInput& input_, binomial::structOutput& output ) {
+
+  binomial::structInput input( input_ );
+
+  output.iv = input.v;
+
+  if ( PricingModel::BaroneAdesiWhaley == model ) {
+    double vega, rho;
+    BAW( input, output.option, output.delta, output.gamma, vega, rho );
+    output.vega = 0.01 * vega; // per 1% of volatility
+    output.rho = rho;
+    const double dt = std::min( 1.0 / 365.0, 0.5 * input_.T ); // per calendar day
+    input.T = input_.T - dt;
+    output.theta = ( Price( model, input ) - output.option ) / dt / 365.0;
+    return;
+  }
+
+  if ( PricingModel::CRR == model ) { // the tree's own delta, gamma, theta, differences across steps are noisy
+    binomial::CRR( input, output );
+  }
+  else {
+    output.option = Price( model, input );
+    const double h = 1e-3 * input_.S;
+    input.S = input_.S + h;
+    const double up = Price( model, input );
+    input.S = input_.S - h;
+    const double dn = Price( model, input );
+    input.S = input_.S;
+    output.delta = ( up - dn ) / ( 2.0 * h );
+    output.gamma = ( up - 2.0 * output.option + dn ) / ( h * h );
+  }
+
+  { // per 1% of volatility
+    const double dv = 1e-3;
+    input.v = input_.v + dv;
+    const double up = Price( model, input );
+    input.v = std::max( 1e-4, input_.v - dv );
+    const double dn = Price( model, input );
+    output.vega = 0.01 * ( up - dn ) / ( input_.v + dv - input.v );
+    input.v = input_.v;
+  }
+
+  if ( PricingModel::CRR != model ) { // per calendar day
+    const double dt = std::min( 1.0 / 365.0, 0.5 * input_.T );
+    input.T = input_.T - dt;
+    output.theta = ( Price( model, input ) - output.option ) / dt / 365.0;
+    input.T = input_.T;
+  }
+
+  { // rate only, carry held, as in binomial::CalcImpliedVolatility
+    const double dr = 1e-4;
+    input.r = input_.r + dr;
+    const double up = Price( model, input );
+    input.r = input_.r - dr;
+    const double dn = Price( model, input );
+    output.rho = ( up - dn ) / ( 2.0 * dr );
+  }
+}
+
+double CalcImpliedVolatility(
+  PricingModel model, const binomial::structInput& input_, double option, binomial::structOutput& output, double epsilon
+) {
+
+  if ( PricingModel::CRR == model ) {
+    return binomial::CalcImpliedVolatility( input_, option, output, epsilon );
+  }
+
+  binomial::structInput input( input_ );
+  const bool bCall( IsCall( input ) );
+
+  const double intrinsic = std::max( 0.0, bCall ? ( input.S - input.X ) : ( input.X - input.S ) );
+  const double ceiling = bCall ? input.S : input.X;
+  if ( ( option <= intrinsic ) || ( option >= ceiling ) ) {
+    throw std::runtime_error(
+      "IV american: price outside bounds "
+      + boost::lexical_cast<std::string>( intrinsic )
+      + "," + boost::lexical_cast<std::string>( option )
+      + "," + boost::lexical_cast<std::string>( ceiling )
+    );
+  }
+
+  // Corrado-Miller (1996) on the european equivalent, put via parity
+  const double Sd = input.S * std::exp( ( input.b - input.r ) * input.T );
+  const double Kd = input.X * std::exp( -input.r * input.T );
+  const double call = bCall ? option : ( option + Sd - Kd );
+  const double a = call - 0.5 * ( Sd - Kd );
+  const double disc = std::max( 0.0, a * a - ( Sd - Kd ) * ( Sd - Kd ) / c_pi );
+  double vol = c_sqrt2pi / ( Sd + Kd ) * ( a + std::sqrt( disc ) ) / std::sqrt( input.T );
+  if ( !( 0.0 < vol ) ) { // Manaster and Koehler, as in Option::CalcGreeks
+    vol = std::sqrt( std::abs( std::log( input.S / input.X ) + input.r * input.T ) * 2.0 / input.T );
+  }
+
+  double lo = 1e-4;
+  double hi = 5.0;
+  vol = std::min( hi, std::max( lo, vol ) );
+
+  double diff = 2.0 * epsilon;
+  std::size_t cnt = 50;
+  while ( epsilon < std::abs( diff ) ) {
+    input.v = vol;
+    double vega;
+    diff = PriceVega( model, input, vega ) - option;
+    if ( epsilon >= std::abs( diff ) ) break;
+    if ( 0.0 < diff ) hi = vol;
+    else lo = vol;
+
+    double next = ( 0.0 < vega ) ? ( vol - diff / vega ) : 0.0;
+    if ( !( ( lo < next ) && ( next < hi ) ) ) next = 0.5 * ( lo + hi ); // newton left the bracket
+    vol = next;
+
+    --cnt;
+    if ( 0 == cnt ) {
+      const std::string sError(
+        "IV american: "
+        + boost::lexical_cast<std::string>( epsilon )
+        + "," + boost::lexical_cast<std::string>( diff )
+      );
+      throw std::runtime_error( sError );
+    }
+  }
+
+  input.v = vol;
+  Greeks( model, input, output );
+  return output.iv;
+}
+
+double CBND( double x, double y, double rho ) {
+
+  static const double XX[ 3 ][ 10 ] = {
+    { -0.932469514203152, -0.661209386466265, -0.238619186083197 }
+  , { -0.981560634246719, -0.904117256370475, -0.769902674194305, -0.587317954286617, -0.36783149899818, -0.125233408511469 }
+  , { -0.993128599185095, -0.963971927277914, -0.912234428251326, -0.839116971822219, -0.746331906460151
+    , -0.636053680726515, -0.510867001950827, -0.37370608871542, -0.227785851141645, -0.0765265211334973 }
+  };
+  static const double W[ 3 ][ 10 ] = {
+    { 0.17132449237917, 0.360761573048138, 0.46791393457269 }
+  , { 0.0471753363865118, 0.106939325995318, 0.160078328543346, 0.203167426723066, 0.233492536538355, 0.249147045813403 }
+  , { 0.0176140071391521, 0.0406014298003869, 0.0626720483341091, 0.0832767415767048, 0.10193011981724
+    , 0.118194531961518, 0.131688638449177, 0.142096109318382, 0.149172986472604, 0.152753387130726 }
+  };
+
+  int NG, LG;
+  if ( std::abs( rho ) < 0.3 ) { NG = 0; LG = 3; }
+  else if ( std::abs( rho ) < 0.75 ) { NG = 1; LG = 6; }
+  else { NG = 2; LG = 10; }
+
+  double h = -x;
+  double k = -y;
+  double hk = h * k;
+  double BVN = 0.0;
+
+  if ( std::abs( rho ) < 0.925 ) {
+    if ( 0.0 != rho ) {
+      const double hs = ( h * h + k * k ) / 2.0;
+      const double asr = std::asin( rho );
+      for ( int i = 0; i < LG; ++i ) {
+        for ( int is = -1; is <= 1; is += 2 ) {
+          const double sn = std::sin( asr * ( is * XX[ NG ][ i ] + 1.0 ) / 2.0 );
+          BVN += W[ NG ][ i ] * std::exp( ( sn * hk - hs ) / ( 1.0 - sn * sn ) );
+        }
+      }
+      BVN = BVN * asr / ( 4.0 * c_pi );
+    }
+    BVN += CND( -h ) * CND( -k );
+  }
+  else {
+    if ( rho < 0.0 ) {
+      k = -k;
+      hk = -hk;
+    }
+    if ( std::abs( rho ) < 1.0 ) {
+      const double Ass = ( 1.0 - rho ) * ( 1.0 + rho );
+      double A = std::sqrt( Ass );
+      const double bs = ( h - k ) * ( h - k );
+      const double c = ( 4.0 - hk ) / 8.0;
+      const double d = ( 12.0 - hk ) / 16.0;
+      double asr = -( bs / Ass + hk ) / 2.0;
+      if ( asr > -100.0 ) {
+        BVN = A * std::exp( asr ) * ( 1.0 - c * ( bs - Ass ) * ( 1.0 - d * bs / 5.0 ) / 3.0 + c * d * Ass * Ass / 5.0 );
+      }
+      if ( -hk < 100.0 ) {
+        const double B = std::sqrt( bs );
+        BVN -= std::exp( -hk / 2.0 ) * c_sqrt2pi * CND( -B / A ) * B * ( 1.0 - c * bs * ( 1.0 - d * bs / 5.0 ) / 3.0 );
+      }
+      A = A / 2.0;
+      for ( int i = 0; i < LG; ++i ) {
+        for ( int is = -1; is <= 1; is += 2 ) {
+          const double xs = ( A * ( is * XX[ NG ][ i ] + 1.0 ) ) * ( A * ( is * XX[ NG ][ i ] + 1.0 ) );
+          const double rs = std::sqrt( 1.0 - xs );
+          asr = -( bs / xs + hk ) / 2.0;
+          if ( asr > -100.0 ) {
+            BVN += A * W[ NG ][ i ] * std::exp( asr )
+              * ( std::exp( -hk * ( 1.0 - rs ) / ( 2.0 * ( 1.0 + rs ) ) ) / rs - ( 1.0 + c * xs * ( 1.0 + d * xs ) ) );
+          }
+        }
+      }
+      BVN = -BVN / ( 2.0 * c_pi );
+    }
+    if ( rho > 0.0 ) {
+      BVN += CND( -std::max( h, k ) );
+    }
+    else {
+      BVN = -BVN;
+      if ( k > h ) BVN += CND( k ) - CND( h );
+    }
+  }
+  return BVN;
+}
+
+} // namespace american
+} // namespace option
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,72 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    American.h
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFOptions
+ * Created: October 19, 2026 15:10
+ */
+
+// closed form approximations of american options, as a fast alternative to the CRR tree in Binomial.h
+//   pg 97  Option Pricing Formulas, 2e, Barone-Adesi and Whaley (1987) quadratic approximation
+//   pg 104 Option Pricing Formulas, 2e, Bjerksund and Stensland (2002)
+
+// same structInput/structOutput as binomial, input.n is not used
+//   greeks are in the same units as binomial::CRR/CalcImpliedVolatility:
+//     theta per calendar day, vega per 1% of volatility, rho per unit of rate
+//   delta, gamma, vega and rho are analytic for Barone-Adesi Whaley, theta is a one day difference,
+//   Bjerksund Stensland greeks are central differences of the closed form, a few evaluations each
+
+#pragma once
+
+#include "Binomial.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace option { // options
+
+enum class PricingModel {
+  CRR                // binomial::CalcImpliedVolatility, 91 step tree
+, BjerksundStensland // american::BjerksundStensland2002
+, BaroneAdesiWhaley  // american::BaroneAdesiWhaley
+};
+
+const char* Name( PricingModel );
+
+namespace american {
+
+// generalized black scholes merton, cost of carry b
+double GBS( const binomial::structInput& input );
+
+double BaroneAdesiWhaley( const binomial::structInput& input );
+double BjerksundStensland2002( const binomial::structInput& input );
+
+// price and greeks into output, option iv is input.v
+void Greeks( PricingModel, const binomial::structInput& input, binomial::structOutput& output );
+
+// inverts the closed form to match the option price, then fills output as with Greeks
+//   seeded by Corrado-Miller on the european price, refined with safeguarded newton steps inside a bisection bracket,
+//   one evaluation per step, the slope is the analytic Barone-Adesi Whaley vega for either closed form
+//   throws std::runtime_error when price is outside the arbitrage bounds or does not converge, as does the binomial version
+double CalcImpliedVolatility(
+  PricingModel, const binomial::structInput& input, double option, binomial::structOutput& output, double epsilon = 0.0001 );
+
+// bivariate cumulative normal, Genz (2004) as presented by West (2005)
+double CBND( double x, double y, double rho );
+
+} // namespace american
+} // namespace option
+} // namespace tf
+} // namespace ou
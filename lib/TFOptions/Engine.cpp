@@ -29,6 +29,7 @@
 // old way: https://www.boost.org/doc/libs/1_67_0/doc/html/boost_asio/reference/io_service.html
 // new way: https://www.boost.org/doc/libs/1_67_0/doc/html/boost_asio/reference/io_context.html
 
+#include <cmath>
 #include <algorithm>
 
 #include <boost/bind/bind.hpp>
@@ -44,18 +45,26 @@ namespace option { // options
 
 OptionEntry::OptionEntry( OptionEntry&& rhs ) {
   if ( 0 < rhs.m_cntInstances ) {
-    rhs.m_pUnderlying->OnQuote.Remove( MakeDelegate( &rhs, &OptionEntry::HandleUnderlyingQuote ) );
+    rhs.m_pOption->OnQuote.Remove( MakeDelegate( &rhs, &OptionEntry::HandleOptionQuote ) );
   }
   m_cntInstances = rhs.m_cntInstances;
   m_pOption = std::move( rhs.m_pOption );
   m_pUnderlying = std::move( rhs.m_pUnderlying );
   m_fGreek = std::move( rhs.m_fGreek );
+  m_ePricingModel = rhs.m_ePricingModel;
+  m_quoteScheduled = rhs.m_quoteScheduled;
+  m_quoteLastOption = rhs.m_quoteLastOption;
+  m_bOptionQuoteChanged = rhs.m_bOptionQuoteChanged.load();
+  m_bCalculated = rhs.m_bCalculated;
+  m_dblMidpointCalculated = rhs.m_dblMidpointCalculated;
+  m_tpCalculated = rhs.m_tpCalculated;
+  m_pInProgress = rhs.m_pInProgress;
   //m_bStartedWatch = rhs.m_bStartedWatch;
   //rhs.m_bStartedWatch = false;
   rhs.m_cntInstances = 0; // can this be set, what happens on delete?  what happens when tied to m_bStartedWatch?
   //if ( m_bStartedWatch ) {
   if ( 0 < m_cntInstances ) {
-    m_pUnderlying->OnQuote.Add( MakeDelegate( this, &OptionEntry::HandleUnderlyingQuote) );
+    m_pOption->OnQuote.Add( MakeDelegate( this, &OptionEntry::HandleOptionQuote ) );
   }
   //PrintState( "OptionEntry::OptionEntry(0)" );
 }
@@ -123,7 +132,7 @@ void OptionEntry::PrintState( const std::string id ) {
 
 void OptionEntry::Inc() {
   if ( 0 == m_cntInstances ) {
-    m_pUnderlying->OnQuote.Add( MakeDelegate( this, &OptionEntry::HandleUnderlyingQuote ) );
+    m_pOption->OnQuote.Add( MakeDelegate( this, &OptionEntry::HandleOptionQuote ) );
     m_pUnderlying->StartWatch();
     m_pOption->StartWatch();  }
   m_cntInstances++;
@@ -134,31 +143,57 @@ size_t OptionEntry::Dec() {
   if ( 0 == m_cntInstances ) {
     m_pUnderlying->StopWatch();
     m_pOption->StopWatch();
-    m_pUnderlying->OnQuote.Remove( MakeDelegate( this, &OptionEntry::HandleUnderlyingQuote ) );
+    m_pOption->OnQuote.Remove( MakeDelegate( this, &OptionEntry::HandleOptionQuote ) );
   }
   return m_cntInstances;
 }
 
 
-void OptionEntry::HandleUnderlyingQuote(const ou::tf::Quote& quote_) {
-  m_quoteLastUnderlying = quote_;
+void OptionEntry::HandleOptionQuote(const ou::tf::Quote& quote_) {
+  if ( ! m_quoteLastOption.SameBidAsk( quote_ ) ) {
+    m_quoteLastOption = quote_;
+    m_bOptionQuoteChanged = true;
+  }
 }
 
-//void OptionEntry::HandleOptionQuote(const ou::tf::Quote& quote_) { // should this be kept?
-//  if ( ! m_quoteLastOption.SameBidAsk( quote_ ) ) {
-//    m_quoteLastOption = quote_;
-//    m_bChanged = true;
-//  }
-//}
+// runs on the engine thread from the scan
+OptionEntry::EDecision OptionEntry::Schedule( clock_t::time_point tpNow, double dblTolerance, clock_t::duration durMaxAge ) {
+
+  if ( m_pInProgress->load() ) return EDecision::Coalesced; // change flags remain for a later scan
+
+  const ou::tf::Quote quote( m_pUnderlying->SnapshotQuote() ); // consistent bid/ask, written on the feed thread
+  if ( !quote.IsNonZero() ) return EDecision::NoQuote; // underlying is unstable
+  const double midpoint( quote.Midpoint() );
+  if ( 0.0 >= midpoint ) return EDecision::NoQuote;
+
+  bool bDue( !m_bCalculated || m_bOptionQuoteChanged.load() || ( durMaxAge <= ( tpNow - m_tpCalculated ) ) );
+  if ( !bDue ) {
+    bDue = ( dblTolerance * m_dblMidpointCalculated ) < std::abs( midpoint - m_dblMidpointCalculated );
+  }
+  if ( !bDue ) return EDecision::Unchanged;
+
+  m_bCalculated = true;
+  m_bOptionQuoteChanged = false;
+  m_dblMidpointCalculated = midpoint;
+  m_tpCalculated = tpNow;
+  m_quoteScheduled = quote;
+  m_pInProgress->store( true );
+  return EDecision::Issue;
+}
 
 void OptionEntry::Calc( const fCalc_t& fCalc ) {
-  fCalc( m_pOption, m_quoteLastUnderlying, m_fGreek );
+  fCalc( m_pOption, m_quoteScheduled, m_fGreek );
 }
 
 // ====================
 
 Engine::Engine( const ou::tf::NoRiskInterestRateSeries& feed ):
   m_InterestRateFeed( feed ),
+  m_nScan {}, m_cntBatches {},
+  m_dblUnderlyingTolerance( 0.0 ),
+  m_msMaxAge( 30000 ),
+  m_msScanInterval( 495 ),
+  m_nScansCrossCheck {},
   m_srvcWork(boost::asio::make_work_guard( m_srvc )),
   m_timerScan( m_srvc )
 {
@@ -287,6 +322,14 @@ void Engine::Add( pOption_t pOption, pWatch_t pUnderlying ) {
 //  }
 }
 
+void Engine::Add( pOption_t pOption, pWatch_t pUnderlying, PricingModel model ) {
+  assert( ( 0 != pOption.use_count() ) && ( 0 != pUnderlying.use_count() ) );
+  OptionEntry oe( pUnderlying, pOption );
+  oe.SetPricingModel( model );
+  std::lock_guard<std::mutex> lock(m_mutexOptionEntryOperationQueue);
+  m_dequeOptionEntryOperation.push_back( OptionEntryOperation( Action::AddOption, std::move(oe) ) );
+}
+
 void Engine::Remove( pOption_t pOption, pWatch_t pUnderlying ) {
 //  if ( m_srvcWork.owns_work() ) {
     assert( ( 0 != pOption.use_count() ) && ( 0 != pUnderlying.use_count() ) );
@@ -315,7 +358,7 @@ void Engine::HandleTimerScan( const boost::system::error_code &ec ) {
     // other ways:
       //timer_.expires_at(timer_.expiry() + boost::asio::chrono::seconds(1));
       //m_timerScan.expires_after( boost::asio::chrono::milliseconds(250) );
-      m_timerScan.expires_after( boost::asio::chrono::milliseconds(495) );
+      m_timerScan.expires_after( boost::asio::chrono::milliseconds( m_msScanInterval.load() ) );
       //m_timerScan.expires_after( boost::asio::chrono::milliseconds(750) );
       m_timerScan.async_wait(
         boost::bind(
@@ -358,6 +401,9 @@ void Engine::ProcessOptionEntryOperationQueue() {
           }
           else {
             //std::cout << "Engine::AddOption: " << MapKey << " dropped" << std::endl;
+            if ( oe.m_oe.HasPricingModel() ) {
+              iterOption->second.SetPricingModel( oe.m_oe.GetPricingModel() );
+            }
           }
           iterOption->second.Inc();
         }
@@ -396,49 +442,145 @@ void Engine::ScanOptionEntryQueue() {
   // dtUtcNow needs to be passed by value
   boost::posix_time::ptime dtUtcNow = ou::TimeSource::GlobalInstance().External();
 
-  // TODO:  process only those being watched
+  const std::uint64_t nScan( ++m_nScan );
+
+  const std::size_t nScansCrossCheck( m_nScansCrossCheck.load() );
+  const bool bCrossCheck( ( 0 != nScansCrossCheck ) && ( 0 == ( nScan % nScansCrossCheck ) ) );
+
+  pScan_t pScan;
+  if ( !OnGreekBatch.IsEmpty() ) {
+    pScan = std::make_shared<Scan>( nScan );
+    pScan->batch.vEntry.reserve( m_mapOptionEntry.size() );
+  }
+
+  const OptionEntry::clock_t::time_point tpNow( OptionEntry::clock_t::now() );
+  const double dblTolerance( m_dblUnderlyingTolerance.load() );
+  const OptionEntry::clock_t::duration durMaxAge( std::chrono::milliseconds( m_msMaxAge.load() ) );
+
+  ScanStats stats;
+  stats.nScans = 1;
+  stats.nEntries = m_mapOptionEntry.size();
 
   // three step lambda call:
-  //  1) lambda for each active mapOptionEntry
+  //  1) lambda for each active mapOptionEntry, only those with a change are calculated
   //  2) capture private values from the OptionEntry
   //  3) use the values in a background thread for calculations via post to io_service
   std::for_each(
     m_mapOptionEntry.begin(), m_mapOptionEntry.end(),
-    [this, dtUtcNow](mapOptionEntry_t::value_type& vt){
+    [this, dtUtcNow, &pScan, bCrossCheck, tpNow, dblTolerance, durMaxAge, &stats](mapOptionEntry_t::value_type& vt){
+      switch ( vt.second.Schedule( tpNow, dblTolerance, durMaxAge ) ) {
+        case OptionEntry::EDecision::Unchanged:
+          stats.nUnchanged++;
+          return;
+        case OptionEntry::EDecision::Coalesced:
+          stats.nCoalesced++;
+          return;
+        case OptionEntry::EDecision::NoQuote:
+          stats.nNoQuote++;
+          return;
+        case OptionEntry::EDecision::Issue:
+          stats.nIssued++;
+          break;
+      }
+      const PricingModel model( vt.second.GetPricingModel() );
+      OptionEntry::pInProgress_t pInProgress( vt.second.InProgress() );
       //std::cout << "for each " << vt.second.GetUnderlying()->GetInstrument()->GetInstrumentName() << std::endl;
       //std::cout << "         " << vt.second.GetOption()->GetInstrument()->GetInstrumentName() << std::endl;
       vt.second.Calc(
-        [this, dtUtcNow](OptionEntry::pOption_t pOption, const ou::tf::Quote& quoteUnderlying, fCallbackWithGreek_t& fCallbackWithGreek ){
-          if ( !quoteUnderlying.IsNonZero() ) {
-            // underlying is unstable
-          }
-          else {
-            double midpointUnderlying( quoteUnderlying.Midpoint() );
-            if ( 0.0 < midpointUnderlying ) {  // only start calculations once underlying has quotes
-              // TODO: add flag to start calculation only after previous calculation is complete
-              boost::asio::post( m_srvc,
-                [this, dtUtcNow, pOption, midpointUnderlying, fCallbackWithGreek](){
-                  try {
-                    //boost::timer::auto_cpu_timer t;
-                    ou::tf::option::binomial::structInput input;
-                    input.S = midpointUnderlying;
-                    pOption->CalcRate( input, dtUtcNow, m_InterestRateFeed );
-                    pOption->CalcGreeks( input, dtUtcNow, true ); // TODO, don't proceed if option quote is bad (test on exit)
-                    if ( nullptr != fCallbackWithGreek ) {
-                      fCallbackWithGreek( pOption->LastGreek() ); // need to create the method
-                    }
-                  }
-                  catch ( std::runtime_error& e ) {
-                    std::cout << "Engine::ScanOptionEntryQueue runtime: " << e.what() << std::endl;
-                  }
-                  catch (...) {
-                    std::cout << "Engine::ScanOptionEntryQueue exception: unknown" << std::endl;
-                  }
-              });
-            }
-          }
+        [this, dtUtcNow, &pScan, bCrossCheck, model, &pInProgress](OptionEntry::pOption_t pOption, const ou::tf::Quote& quoteUnderlying, fCallbackWithGreek_t& fCallbackWithGreek ){
+          // Schedule has validated the underlying quote
+          double midpointUnderlying( quoteUnderlying.Midpoint() );
+          if ( pScan ) pScan->nOutstanding++;
+          boost::asio::post( m_srvc,
+            [this, dtUtcNow, pOption, midpointUnderlying, fCallbackWithGreek, pScan, bCrossCheck, model, pInProgress]() mutable {
+              try {
+                //boost::timer::auto_cpu_timer t;
+                ou::tf::option::binomial::structInput input;
+                input.S = midpointUnderlying;
+                pOption->CalcRate( input, dtUtcNow, m_InterestRateFeed );
+                pOption->CalcGreeks( input, dtUtcNow, model, true ); // TODO, don't proceed if option quote is bad (test on exit)
+                if ( nullptr != fCallbackWithGreek ) {
+                  fCallbackWithGreek( pOption->LastGreek() ); // need to create the method
+                }
+                if ( bCrossCheck && ( PricingModel::CRR != model ) && ( dtUtcNow == pOption->LastGreek().DateTime() ) ) {
+                  CrossCheckCRR( pOption, input );
+                }
+              }
+              catch ( std::runtime_error& e ) {
+                std::cout << "Engine::ScanOptionEntryQueue runtime: " << e.what() << std::endl;
+              }
+              catch (...) {
+                std::cout << "Engine::ScanOptionEntryQueue exception: unknown" << std::endl;
+              }
+              pInProgress->store( false );
+              if ( pScan ) {
+                const ou::tf::Greek& greek( pOption->LastGreek() );
+                if ( dtUtcNow == greek.DateTime() ) { // CalcGreeks skips the greek on a failed calculation
+                  std::lock_guard<std::mutex> lock( pScan->mutex );
+                  pScan->batch.vEntry.emplace_back( pOption.get(), greek );
+                }
+                ScanComplete( pScan );
+              }
+          });
       });
     });
+
+  if ( pScan ) ScanComplete( pScan );
+
+  std::lock_guard<std::mutex> lock( m_mutexScanStats );
+  m_statsLast = stats;
+  m_statsTotal += stats;
+}
+
+Engine::ScanStats Engine::GetScanStatsLast() {
+  std::lock_guard<std::mutex> lock( m_mutexScanStats );
+  return m_statsLast;
+}
+
+Engine::ScanStats Engine::GetScanStatsTotal() {
+  std::lock_guard<std::mutex> lock( m_mutexScanStats );
+  return m_statsTotal;
+}
+
+// input has been through CalcGreeks, so carries strike, side, and rate
+void Engine::CrossCheckCRR( const pOption_t& pOption, const ou::tf::option::binomial::structInput& input_ ) {
+  const ou::tf::Greek& greek( pOption->LastGreek() );
+  ou::tf::option::binomial::structInput input( input_ );
+  input.v = greek.ImpliedVolatility();
+  ou::tf::option::binomial::structOutput output;
+  bool bOk( true );
+  try {
+    ou::tf::option::binomial::CalcImpliedVolatility( input, pOption->SnapshotQuote().Midpoint(), output );
+  }
+  catch ( std::runtime_error& e ) {
+    bOk = false;
+  }
+  std::lock_guard<std::mutex> lock( m_mutexCrossCheck );
+  if ( bOk ) {
+    const double dblIvDiff( std::abs( output.iv - greek.ImpliedVolatility() ) );
+    m_crossCheck.cnt++;
+    m_crossCheck.dblSumIvDiff += dblIvDiff;
+    m_crossCheck.dblMaxIvDiff = std::max( m_crossCheck.dblMaxIvDiff, dblIvDiff );
+    m_crossCheck.dblMaxDeltaDiff = std::max( m_crossCheck.dblMaxDeltaDiff, std::abs( output.delta - greek.Delta() ) );
+  }
+  else {
+    m_crossCheck.cntFailed++;
+  }
+}
+
+Engine::CrossCheck Engine::GetCrossCheck() {
+  std::lock_guard<std::mutex> lock( m_mutexCrossCheck );
+  return m_crossCheck;
+}
+
+// last of the scan's calculations to finish publishes the batch
+void Engine::ScanComplete( pScan_t& pScan ) {
+  if ( 1 == pScan->nOutstanding.fetch_sub( 1 ) ) {
+    if ( !pScan->batch.vEntry.empty() ) {
+      m_cntBatches++;
+      OnGreekBatch( pScan->batch );
+    }
+  }
 }
 
 } // namespace option
@@ -24,7 +24,10 @@
 
 #include <queue>
 #include <mutex>
+#include <atomic>
+#include <memory>
 #include <chrono>
+#include <optional>
 #include <functional>
 #include <unordered_map>
 
@@ -57,6 +60,11 @@ public:
   using fCallbackWithGreek_t = Option::fCallbackWithGreek_t;
   using fCalc_t = std::function<void(pOption_t, const ou::tf::Quote&, fCallbackWithGreek_t&)>; // underlying quote
 
+  using clock_t = std::chrono::steady_clock;
+  using pInProgress_t = std::shared_ptr<std::atomic<bool> >; // shared with the posted calculation
+
+  enum class EDecision { Issue, Unchanged, Coalesced, NoQuote };
+
 private:
   size_type m_cntInstances; // when pOption and pUnderlying are added in
   //bool m_bStartedWatch; // needs to be based upon cntInstances
@@ -64,11 +72,20 @@ private:
   pWatch_t m_pUnderlying;
   fCallbackWithGreek_t m_fGreek;
 
-  ou::tf::Quote m_quoteLastUnderlying;
-  //ou::tf::Quote m_quoteLastOption;  // is this actually needed?
+  std::optional<PricingModel> m_ePricingModel; // otherwise the option's model
+
+  ou::tf::Quote m_quoteScheduled; // underlying snapshot taken by Schedule, handed to Calc, engine thread only
+  ou::tf::Quote m_quoteLastOption;  // only used by HandleOptionQuote to detect a change
   //double m_dblLastUnderlyingQuote;  // should these be atomic as well?  can doubles be atomic?
   //double m_dblLastOptionQuote;
 
+  // change tracking for Schedule
+  std::atomic<bool> m_bOptionQuoteChanged { true };
+  bool m_bCalculated { false };
+  double m_dblMidpointCalculated { 0.0 }; // underlying midpoint at the last issued calculation
+  clock_t::time_point m_tpCalculated;
+  pInProgress_t m_pInProgress { std::make_shared<std::atomic<bool> >( false ) };
+
 public:
 
   OptionEntry(): m_cntInstances( 0 ) {};
@@ -86,14 +103,25 @@ public:
   void Inc();
   size_t Dec();
 
-  void Calc( const fCalc_t& );  // supply underlying and option quotes
+  // Issue when the underlying midpoint moved by more than dblTolerance (a fraction of the midpoint at the last calculation),
+  //   the option quote changed, or durMaxAge has passed since the last calculation.
+  //   Coalesced while the previous calculation is still queued or running, the change is picked up on a later scan.
+  //   On Issue, the entry is marked in progress, the posted calculation clears InProgress() when done.
+  EDecision Schedule( clock_t::time_point tpNow, double dblTolerance, clock_t::duration durMaxAge );
+  pInProgress_t InProgress() { return m_pInProgress; }
+
+  void Calc( const fCalc_t& );  // supply the underlying quote Schedule decided on, and the option
 
   pWatch_t GetUnderlying() { return m_pUnderlying; }
   pOption_t GetOption() { return m_pOption; }
 
+  void SetPricingModel( PricingModel model ) { m_ePricingModel = model; }
+  bool HasPricingModel() const { return m_ePricingModel.has_value(); }
+  PricingModel GetPricingModel() const { return m_ePricingModel.value_or( m_pOption->GetPricingModel() ); }
+
 private:
 
-  void HandleUnderlyingQuote( const ou::tf::Quote& );
+  void HandleOptionQuote( const ou::tf::Quote& );
   void PrintState( const std::string id );
 
 };
@@ -132,6 +160,7 @@ public:
 
   // start the calculation process, the option and underlying need to be pre-registered
   void Add( pOption_t pOption, pWatch_t pUnderlying );  // the option already has a delegate for callback
+  void Add( pOption_t pOption, pWatch_t pUnderlying, PricingModel ); // overrides the option's model for this entry
   void Remove( pOption_t pOption, pWatch_t pUnderlying ); // part of the reference counting, will change reference count on associated underlying and auto remove
 
   // these effectively handle registration of underlying and option, using a callback - deprecated, use Register... above
@@ -141,6 +170,50 @@ public:
   fBuildOption_t m_fBuildOption;
   pOption_t FindOption( const pInstrument_t pInstrument );  // if Option not found, construct one.  Then provide the option.
 
+  // the greeks of a scan, delivered once all of the scan's calculations are complete, on the engine thread
+  //   the batch is only collected while there is a handler
+  ou::Delegate<const GreekBatch&> OnGreekBatch;
+
+  std::uint64_t GetCountScans() const { return m_nScan.load(); }
+  std::uint64_t GetCountBatches() const { return m_cntBatches.load(); }
+
+  // entries priced with a closed form model are also solved with CRR every nScans scans (0 disables),
+  //   the result is not published, only the differences are accumulated
+  struct CrossCheck {
+    std::size_t cnt;       // pairs compared
+    std::size_t cntFailed; // CRR did not converge where the fast model did
+    double dblSumIvDiff;
+    double dblMaxIvDiff;
+    double dblMaxDeltaDiff;
+    CrossCheck(): cnt {}, cntFailed {}, dblSumIvDiff {}, dblMaxIvDiff {}, dblMaxDeltaDiff {} {}
+  };
+
+  void SetCrossCheck( std::size_t nScans ) { m_nScansCrossCheck = nScans; }
+  CrossCheck GetCrossCheck();
+
+  // change driven scheduling, see OptionEntry::Schedule
+  void SetUnderlyingTolerance( double dblFraction ) { m_dblUnderlyingTolerance = dblFraction; } // 0 (default) is any move
+  void SetMaxAge( std::chrono::milliseconds ms ) { m_msMaxAge = ms.count(); } // default 30 s
+  void SetScanInterval( std::chrono::milliseconds ms ) { m_msScanInterval = ms.count(); } // default 495 ms
+
+  struct ScanStats {
+    std::uint64_t nScans;
+    std::size_t nEntries;
+    std::size_t nIssued;    // calculations posted
+    std::size_t nUnchanged; // skipped, nothing moved
+    std::size_t nCoalesced; // skipped, previous calculation still outstanding
+    std::size_t nNoQuote;   // skipped, underlying not yet quoted
+    ScanStats(): nScans {}, nEntries {}, nIssued {}, nUnchanged {}, nCoalesced {}, nNoQuote {} {}
+    ScanStats& operator+=( const ScanStats& rhs ) {
+      nScans += rhs.nScans; nEntries += rhs.nEntries; nIssued += rhs.nIssued;
+      nUnchanged += rhs.nUnchanged; nCoalesced += rhs.nCoalesced; nNoQuote += rhs.nNoQuote;
+      return *this;
+    }
+  };
+
+  ScanStats GetScanStatsLast();  // the most recent scan
+  ScanStats GetScanStatsTotal(); // accumulated since construction
+
 
 private:
 
@@ -182,6 +255,33 @@ private:
   mapKnownOptions_t m_mapKnownOptions;
   mapOptionEntry_t m_mapOptionEntry;
 
+  struct Scan {
+    std::mutex mutex;
+    GreekBatch batch;
+    std::atomic<std::size_t> nOutstanding; // calculations posted, plus one for the scan itself
+    Scan( std::uint64_t nScan ): nOutstanding( 1 ) { batch.nScan = nScan; }
+  };
+  using pScan_t = std::shared_ptr<Scan>;
+
+  std::atomic<std::uint64_t> m_nScan;
+  std::atomic<std::uint64_t> m_cntBatches;
+
+  std::atomic<double> m_dblUnderlyingTolerance;
+  std::atomic<std::int64_t> m_msMaxAge;
+  std::atomic<std::int64_t> m_msScanInterval;
+
+  std::mutex m_mutexScanStats;
+  ScanStats m_statsLast;
+  ScanStats m_statsTotal;
+
+  std::atomic<std::size_t> m_nScansCrossCheck;
+  std::mutex m_mutexCrossCheck;
+  CrossCheck m_crossCheck;
+
+  void CrossCheckCRR( const pOption_t&, const ou::tf::option::binomial::structInput& );
+
+  void ScanComplete( pScan_t& );
+
   void HandleTimerScan( const boost::system::error_code &ec );
   void ProcessOptionEntryOperationQueue();
   void ScanOptionEntryQueue();
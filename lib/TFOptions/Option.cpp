@@ -32,7 +32,8 @@ namespace option { // options
 Option::Option( pInstrument_t& pInstrument, pProvider_t pDataProvider, pProvider_t pGreekProvider )
 : Watch( pInstrument, pDataProvider ),
   m_pGreekProvider( pGreekProvider ),
-  m_dblStrike( pInstrument->GetStrike() )
+  m_dblStrike( pInstrument->GetStrike() ),
+  m_ePricingModel( PricingModel::CRR )
 {
   //std::cout << "Option::Option construction 1: " << pInstrument->GetInstrumentName() << std::endl;
   Initialize();
@@ -40,7 +41,8 @@ Option::Option( pInstrument_t& pInstrument, pProvider_t pDataProvider, pProvider
 
 Option::Option( pInstrument_t& pInstrument, pProvider_t pDataProvider )
 : Watch( pInstrument, pDataProvider ),
-  m_dblStrike( pInstrument->GetStrike() )
+  m_dblStrike( pInstrument->GetStrike() ),
+  m_ePricingModel( PricingModel::CRR )
 {
   //std::cout << "Option::Option construction 2: " << pInstrument->GetInstrumentName() << std::endl;
   Initialize();
@@ -50,6 +52,7 @@ Option::Option( const Option& rhs )
 : Watch( rhs )
 , m_dblStrike( rhs.m_dblStrike )
 , m_greek( rhs.m_greek )
+, m_ePricingModel( rhs.m_ePricingModel )
 , m_pGreekProvider( rhs.m_pGreekProvider )
 {
   //std::cout << "Option::Option construction 3: " << m_pInstrument->GetInstrumentName() << std::endl;
@@ -65,6 +68,7 @@ Option& Option::operator=( const Option& rhs ) {
   Watch::operator=( rhs );
   m_dblStrike = rhs.m_dblStrike;
   m_greek = rhs.m_greek;
+  m_ePricingModel = rhs.m_ePricingModel;
   m_pGreekProvider = rhs.m_pGreekProvider;
   Initialize();
   return *this;
@@ -135,8 +139,13 @@ void Option::CalcRate( // version 2, calls version 1, uses instrument expiry dat
   CalcRate( input, riskfree, dtUtcNow, dtUtcExpiry );
 }
 
-void Option::CalcGreeks( // TODO: need to not calc if quote is bad
+void Option::CalcGreeks(
   ou::tf::option::binomial::structInput& input, ptime dtUtcNow, bool bNeedsGuess ) {
+  CalcGreeks( input, dtUtcNow, m_ePricingModel, bNeedsGuess );
+}
+
+void Option::CalcGreeks( // TODO: need to not calc if quote is bad
+  ou::tf::option::binomial::structInput& input, ptime dtUtcNow, PricingModel model, bool bNeedsGuess ) {
   // example caller: void ExpiryBundle::CalcGreeksAtStrike
 
   // needs CalcRate before entering here
@@ -162,7 +171,7 @@ void Option::CalcGreeks( // TODO: need to not calc if quote is bad
     input.optionSide = m_pInstrument->GetOptionSide();
     input.Check();
     ou::tf::option::binomial::structOutput output;
-    ou::tf::option::binomial::CalcImpliedVolatility( input, LastQuote().Midpoint(), output );
+    ou::tf::option::american::CalcImpliedVolatility( model, input, SnapshotQuote().Midpoint(), output ); // CRR passes through to binomial, engine thread so a snapshot
     ou::tf::Greek greek( dtUtcNow, output.iv, output.delta, output.gamma, output.theta, output.vega, output.rho );
     AppendGreek( greek );
   }
@@ -18,16 +18,17 @@
 // 2012/03/31 be aware that some options do not expire on friday.  Some like, next week,
 //            expire on thursday due to good friday being a holiday
 
+#include <vector>
+#include <cstdint>
+
 #include <TFTrading/Watch.h>
 
+#include "American.h"
 #include "NoRiskInterestRateSeries.h"
 
 namespace ou { // One Unified
 namespace tf { // TradeFrame
 namespace option { // options
-namespace binomial {
-  class structInput;
-}
 
 class Option: public ou::tf::Watch {
 public:
@@ -59,7 +60,12 @@ public:
   // calls static CalcRate with specific expiry info
   void CalcRate( ou::tf::option::binomial::structInput& input, const ptime dtUtcNow, const ou::tf::NoRiskInterestRateSeries& libor );
   // caller needs to have updated input with CalcRate
-  void CalcGreeks( ou::tf::option::binomial::structInput& input, ptime dtUtcNow, bool bNeedsGuess = true ); // Calc and Append
+  void CalcGreeks( ou::tf::option::binomial::structInput& input, ptime dtUtcNow, bool bNeedsGuess = true ); // Calc and Append, with GetPricingModel()
+  void CalcGreeks( ou::tf::option::binomial::structInput& input, ptime dtUtcNow, PricingModel, bool bNeedsGuess = true );
+
+  // model used by CalcGreeks, CRR unless set
+  void SetPricingModel( PricingModel model ) { m_ePricingModel = model; }
+  PricingModel GetPricingModel() const { return m_ePricingModel; }
 
   struct premium_t {
     double intrinsic;
@@ -101,6 +107,8 @@ protected:
   double m_dblStrike;
   Greek m_greek;
 
+  PricingModel m_ePricingModel;
+
   ou::tf::Greeks m_greeks;
 
   pProvider_t m_pGreekProvider;
@@ -118,6 +126,21 @@ private:
 // ==================
 //
 
+// greeks from one Engine scan, published as a unit rather than one OnGreek per option
+//   consumers, eg PortfolioGreek, can then aggregate once per scan
+
+struct GreekBatch {
+  using entry_t = std::pair<const Option*, Greek>;
+  using vEntry_t = std::vector<entry_t>;
+  std::uint64_t nScan; // increments with each scan of the engine
+  vEntry_t vEntry;     // only options which produced a greek in this scan
+  GreekBatch(): nScan {} {}
+};
+
+//
+// ==================
+//
+
 class Call: public Option {
 public:
   Call( pInstrument_t pInstrument, pProvider_t pDataProvider, pProvider_t pGreekProvider );
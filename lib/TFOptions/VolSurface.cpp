@@ -0,0 +1,331 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    VolSurface.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFOptions
+ * Created: October 20, 2026 04:20
+ */
+
+#include <cmath>
+#include <limits>
+#include <cassert>
+#include <algorithm>
+
+#include "Option.h"
+#include "VolSurface.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace option { // options
+
+namespace {
+  const std::size_t nNone( std::numeric_limits<std::size_t>::max() );
+}
+
+VolSurface::VolSurface( date_t dateToday, const Grid& grid )
+: m_grid( grid )
+, m_dblStep( ( grid.dblMoneynessHigh - grid.dblMoneynessLow ) / ( grid.nCells - 1 ) )
+, m_dateToday( dateToday )
+, m_dblUnderlying {}, m_dblReference {}
+, m_bBuilt( true )
+{
+  assert( 1 < grid.nCells );
+  assert( grid.dblMoneynessLow < grid.dblMoneynessHigh );
+}
+
+VolSurface::handle_t VolSurface::Add( date_t expiry, double dblStrike, ou::tf::OptionSide::EOptionSide side ) {
+  assert( ou::tf::OptionSide::Unknown != side );
+  assert( 0.0 < dblStrike );
+  const handle_t handle( m_vHandle.size() );
+  m_vHandle.push_back( Handle { expiry, dblStrike, ou::tf::OptionSide::Call == side, 0.0, 0, 0 } );
+  m_bBuilt = false;
+  return handle;
+}
+
+VolSurface::handle_t VolSurface::Add( const Option& option ) {
+  const handle_t handle( Add( option.GetExpiry(), option.GetStrike(), option.GetOptionSide() ) );
+  m_mapOption[ &option ] = handle;
+  return handle;
+}
+
+void VolSurface::SetDate( date_t date ) {
+  m_dateToday = date;
+  if ( m_bBuilt ) Years();
+  else Build();
+}
+
+void VolSurface::SetUnderlying( double dblUnderlying ) {
+  m_dblUnderlying = dblUnderlying;
+  if ( !m_bBuilt ) Build();
+  else {
+    if ( ( 0.0 == m_dblReference )
+      || ( ( 0.5 * m_dblStep ) < std::abs( dblUnderlying / m_dblReference - 1.0 ) )
+    ) {
+      Rebase();
+    }
+  }
+}
+
+void VolSurface::Update( handle_t handle, double dblIV ) {
+
+  if ( !m_bBuilt ) Build();
+
+  ++m_stats.nUpdates;
+
+  Handle& h( m_vHandle[ handle ] );
+  h.dblIV = dblIV;
+
+  Slice& slice( m_vSlice[ h.ixSlice ] );
+  Point& point( slice.vPoint[ h.ixPoint ] );
+  if ( h.bCall ) point.dblCall = dblIV;
+  else point.dblPut = dblIV;
+
+  const double dblPoint( Choose( point ) );
+  if ( dblPoint == point.dblIV ) {
+    ++m_stats.nUnchanged;
+    return;
+  }
+
+  if ( 0.0 == point.dblIV ) ++slice.nValid;
+  else {
+    if ( 0.0 == dblPoint ) --slice.nValid;
+  }
+  point.dblIV = dblPoint;
+
+  if ( 0.0 == m_dblReference ) return; // cells follow once there is an underlying
+
+  // the cells between the neighbouring points with an iv
+  std::size_t ixCellBegin( 0 );
+  std::size_t ixCellEnd( m_grid.nCells );
+  for ( std::size_t ix = h.ixPoint; 0 < ix; --ix ) {
+    const Point& lo( slice.vPoint[ ix - 1 ] );
+    if ( 0.0 != lo.dblIV ) {
+      const double dblCell( std::ceil( ( lo.dblStrike / m_dblReference - m_grid.dblMoneynessLow ) / m_dblStep ) );
+      ixCellBegin = ( 0.0 >= dblCell ) ? 0 : std::min<std::size_t>( dblCell, m_grid.nCells );
+      break;
+    }
+  }
+  for ( std::size_t ix = h.ixPoint + 1; ix < slice.vPoint.size(); ++ix ) {
+    const Point& hi( slice.vPoint[ ix ] );
+    if ( 0.0 != hi.dblIV ) {
+      const double dblCell( std::floor( ( hi.dblStrike / m_dblReference - m_grid.dblMoneynessLow ) / m_dblStep ) + 1.0 );
+      ixCellEnd = ( 0.0 >= dblCell ) ? 0 : std::min<std::size_t>( dblCell, m_grid.nCells );
+      break;
+    }
+  }
+
+  if ( ixCellBegin < ixCellEnd ) {
+    Fill( slice, ixCellBegin, ixCellEnd );
+    m_stats.nCells += ixCellEnd - ixCellBegin;
+  }
+}
+
+void VolSurface::Update( const Option& option, const Greek& greek ) {
+  mapOption_t::const_iterator iter = m_mapOption.find( &option );
+  if ( m_mapOption.end() != iter ) {
+    Update( iter->second, greek.ImpliedVolatility() );
+  }
+}
+
+void VolSurface::Update( const GreekBatch& batch ) {
+  for ( const GreekBatch::entry_t& entry: batch.vEntry ) {
+    Update( *entry.first, entry.second );
+  }
+}
+
+double VolSurface::IV( double dblYears, double dblMoneyness ) const {
+
+  assert( m_bBuilt ); // Add is followed by SetDate or SetUnderlying prior to lookups
+
+  if ( m_vSlice.empty() || ( 0.0 == m_dblReference ) ) return 0.0;
+
+  // moneyness relative to the reference the cells were laid out at
+  double dblCell( ( dblMoneyness * m_dblUnderlying / m_dblReference - m_grid.dblMoneynessLow ) / m_dblStep );
+  dblCell = std::max( 0.0, std::min( dblCell, double( m_grid.nCells - 1 ) ) );
+
+  vSlice_t::const_iterator iterHi = std::lower_bound(
+    m_vSlice.begin(), m_vSlice.end(), dblYears,
+    []( const Slice& slice, double dblYears ){ return slice.dblYears < dblYears; } );
+
+  if ( m_vSlice.begin() == iterHi ) return Interpolate( *iterHi, dblCell );
+  if ( m_vSlice.end() == iterHi ) return Interpolate( m_vSlice.back(), dblCell );
+
+  const Slice& lo( *( iterHi - 1 ) );
+  const Slice& hi( *iterHi );
+  const double dblLo( Interpolate( lo, dblCell ) );
+  const double dblHi( Interpolate( hi, dblCell ) );
+  if ( 0.0 == dblLo ) return dblHi;
+  if ( 0.0 == dblHi ) return dblLo;
+
+  // linear in total variance
+  const double dblVarianceLo( dblLo * dblLo * lo.dblYears );
+  const double dblVarianceHi( dblHi * dblHi * hi.dblYears );
+  const double dblVariance( dblVarianceLo + ( dblVarianceHi - dblVarianceLo ) * ( dblYears - lo.dblYears ) / ( hi.dblYears - lo.dblYears ) );
+  return ( 0.0 < dblVariance ) ? std::sqrt( dblVariance / dblYears ) : 0.0;
+}
+
+double VolSurface::IV( date_t expiry, double dblMoneyness ) const {
+  const double dblDays( ( expiry - m_dateToday ).days() );
+  return IV( std::max( 0.5, dblDays ) / 365.0, dblMoneyness );
+}
+
+void VolSurface::Build() {
+
+  m_vSlice.clear();
+
+  std::vector<date_t> vExpiry;
+  vExpiry.reserve( m_vHandle.size() );
+  for ( const Handle& h: m_vHandle ) vExpiry.push_back( h.expiry );
+  std::sort( vExpiry.begin(), vExpiry.end() );
+  vExpiry.erase( std::unique( vExpiry.begin(), vExpiry.end() ), vExpiry.end() );
+
+  m_vSlice.reserve( vExpiry.size() );
+  for ( const date_t expiry: vExpiry ) m_vSlice.emplace_back( Slice( expiry ) );
+
+  for ( Handle& h: m_vHandle ) {
+    h.ixSlice = std::lower_bound( vExpiry.begin(), vExpiry.end(), h.expiry ) - vExpiry.begin();
+    m_vSlice[ h.ixSlice ].vPoint.emplace_back( Point( h.dblStrike ) );
+  }
+
+  for ( Slice& slice: m_vSlice ) {
+    vPoint_t& v( slice.vPoint );
+    std::sort( v.begin(), v.end(), []( const Point& lhs, const Point& rhs ){ return lhs.dblStrike < rhs.dblStrike; } );
+    v.erase(
+      std::unique( v.begin(), v.end(), []( const Point& lhs, const Point& rhs ){ return lhs.dblStrike == rhs.dblStrike; } ),
+      v.end() );
+    slice.vCell.assign( m_grid.nCells, 0.0 );
+  }
+
+  for ( Handle& h: m_vHandle ) {
+    vPoint_t& v( m_vSlice[ h.ixSlice ].vPoint );
+    h.ixPoint = std::lower_bound(
+      v.begin(), v.end(), h.dblStrike,
+      []( const Point& point, double dblStrike ){ return point.dblStrike < dblStrike; } ) - v.begin();
+    Point& point( v[ h.ixPoint ] );
+    if ( h.bCall ) point.dblCall = h.dblIV;
+    else point.dblPut = h.dblIV;
+  }
+
+  m_bBuilt = true;
+
+  Years();
+  Rebase();
+}
+
+void VolSurface::Years() {
+  for ( Slice& slice: m_vSlice ) {
+    const double dblDays( ( slice.expiry - m_dateToday ).days() );
+    slice.dblYears = std::max( 0.5, dblDays ) / 365.0;
+  }
+}
+
+void VolSurface::Rebase() {
+
+  m_dblReference = m_dblUnderlying;
+  if ( 0.0 < m_dblReference ) ++m_stats.nRebases;
+
+  for ( Slice& slice: m_vSlice ) {
+    slice.nValid = 0;
+    for ( Point& point: slice.vPoint ) {
+      point.dblIV = Choose( point );
+      if ( 0.0 != point.dblIV ) ++slice.nValid;
+    }
+    if ( 0.0 < m_dblReference ) Fill( slice, 0, m_grid.nCells );
+  }
+}
+
+// the out of the money side, at the money taken as the call
+double VolSurface::Choose( const Point& point ) const {
+  if ( point.dblStrike < m_dblReference ) {
+    return ( 0.0 != point.dblPut ) ? point.dblPut : point.dblCall;
+  }
+  else {
+    return ( 0.0 != point.dblCall ) ? point.dblCall : point.dblPut;
+  }
+}
+
+void VolSurface::Fill( Slice& slice, std::size_t ixCellBegin, std::size_t ixCellEnd ) const {
+
+  if ( 0 == slice.nValid ) {
+    std::fill( slice.vCell.begin() + ixCellBegin, slice.vCell.begin() + ixCellEnd, 0.0 );
+    return;
+  }
+
+  const vPoint_t& v( slice.vPoint );
+
+  std::size_t ixPoint = nNone; // first point at or above the cell's strike
+  std::size_t ixLo = nNone;    // valid neighbours of the cell's strike
+  std::size_t ixHi = nNone;
+
+  for ( std::size_t ixCell = ixCellBegin; ixCell < ixCellEnd; ++ixCell ) {
+
+    const double dblStrike( ( m_grid.dblMoneynessLow + ixCell * m_dblStep ) * m_dblReference );
+
+    std::size_t ix;
+    if ( nNone == ixPoint ) {
+      ix = std::lower_bound(
+        v.begin(), v.end(), dblStrike,
+        []( const Point& point, double dblStrike ){ return point.dblStrike < dblStrike; } ) - v.begin();
+    }
+    else {
+      ix = ixPoint;
+      while ( ( ix < v.size() ) && ( v[ ix ].dblStrike < dblStrike ) ) ++ix;
+    }
+
+    if ( ix != ixPoint ) {
+      ixPoint = ix;
+      ixLo = nNone;
+      for ( std::size_t ixScan = ix; 0 < ixScan; --ixScan ) {
+        if ( 0.0 != v[ ixScan - 1 ].dblIV ) {
+          ixLo = ixScan - 1;
+          break;
+        }
+      }
+      ixHi = nNone;
+      for ( std::size_t ixScan = ix; ixScan < v.size(); ++ixScan ) {
+        if ( 0.0 != v[ ixScan ].dblIV ) {
+          ixHi = ixScan;
+          break;
+        }
+      }
+    }
+
+    double dblIV;
+    if ( nNone == ixLo ) dblIV = v[ ixHi ].dblIV;
+    else {
+      if ( nNone == ixHi ) dblIV = v[ ixLo ].dblIV;
+      else {
+        const Point& lo( v[ ixLo ] );
+        const Point& hi( v[ ixHi ] );
+        dblIV = lo.dblIV + ( hi.dblIV - lo.dblIV ) * ( dblStrike - lo.dblStrike ) / ( hi.dblStrike - lo.dblStrike );
+      }
+    }
+    slice.vCell[ ixCell ] = dblIV;
+  }
+}
+
+double VolSurface::Interpolate( const Slice& slice, double dblCell ) const {
+  const std::size_t ixCell( dblCell );
+  if ( ( m_grid.nCells - 1 ) <= ixCell ) return slice.vCell.back();
+  const double dblFraction( dblCell - ixCell );
+  const double dblLo( slice.vCell[ ixCell ] );
+  const double dblHi( slice.vCell[ ixCell + 1 ] );
+  return dblLo + ( dblHi - dblLo ) * dblFraction;
+}
+
+} // namespace option
+} // namespace tf
+} // namespace ou
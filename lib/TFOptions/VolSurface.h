@@ -0,0 +1,163 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    VolSurface.h
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFOptions
+ * Created: October 20, 2026 04:20
+ */
+
+// implied volatility surface, a grid by expiry and moneyness (strike / underlying), kept current an option at a time
+//   each option added is a point in its expiry's strike slice, holding the call and the put iv,
+//     the point uses the out of the money side, or the other side while that has none
+//   a cell is the iv interpolated linearly in strike between the points with an iv either side of it,
+//     flat beyond the first and the last, at strike = moneyness x reference underlying
+//   an iv update recomputes only the cells between the point's neighbours, nothing when the iv is unchanged
+//   the reference follows SetUnderlying once the underlying has moved by more than half a cell,
+//     then every cell, and every point's choice of side, is recomputed
+// lookups are linear between cells, and linear in total variance (iv^2 x years) between expiries,
+//   flat outside the expiries held, and relative to the current underlying, not the reference
+// fed from Engine::OnGreekBatch, or per option from Option::OnGreek, the engine's answer to a quote change
+// Add takes effect with the next SetDate, SetUnderlying, or Update
+// not locked, updates and lookups are to be made on the one thread
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+
+#include <boost/date_time/gregorian/greg_date.hpp>
+
+#include <TFTrading/TradingEnumerations.h>
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+class Greek;
+
+namespace option { // options
+
+class Option;
+struct GreekBatch;
+
+class VolSurface {
+public:
+
+  using handle_t = std::uint32_t;
+  using date_t = boost::gregorian::date;
+
+  struct Grid {
+    double dblMoneynessLow;
+    double dblMoneynessHigh;
+    std::size_t nCells; // from low to high inclusive
+    Grid(): dblMoneynessLow( 0.5 ), dblMoneynessHigh( 1.5 ), nCells( 201 ) {} // half percent steps
+  };
+
+  struct Stats {
+    std::size_t nUpdates;
+    std::size_t nUnchanged; // updates which left the point's iv as it was
+    std::size_t nCells;     // cells recomputed by updates
+    std::size_t nRebases;
+    Stats(): nUpdates {}, nUnchanged {}, nCells {}, nRebases {} {}
+  };
+
+  VolSurface( date_t dateToday, const Grid& = Grid() );
+
+  handle_t Add( date_t expiry, double dblStrike, ou::tf::OptionSide::EOptionSide );
+  handle_t Add( const Option& ); // also keyed by the option, for the Greek and GreekBatch updates
+
+  void SetDate( date_t ); // years to expiry are counted from this date
+  void SetUnderlying( double );
+
+  void Update( handle_t, double dblIV ); // 0 removes the side's iv
+  void Update( const Option&, const Greek& );
+  void Update( const GreekBatch& );
+
+  // 0 when there is nothing to interpolate from
+  double IV( double dblYears, double dblMoneyness ) const;
+  double IV( date_t expiry, double dblMoneyness ) const;
+
+  // the grid, for charting
+  std::size_t Expiries() const { return m_vSlice.size(); }
+  date_t Expiry( std::size_t ixExpiry ) const { return m_vSlice[ ixExpiry ].expiry; }
+  double Years( std::size_t ixExpiry ) const { return m_vSlice[ ixExpiry ].dblYears; }
+  std::size_t Cells() const { return m_grid.nCells; }
+  double Moneyness( std::size_t ixCell ) const { return m_grid.dblMoneynessLow + ixCell * m_dblStep; }
+  double Cell( std::size_t ixExpiry, std::size_t ixCell ) const { return m_vSlice[ ixExpiry ].vCell[ ixCell ]; }
+  double Reference() const { return m_dblReference; }
+
+  const Stats& GetStats() const { return m_stats; }
+
+protected:
+private:
+
+  struct Point {
+    double dblStrike;
+    double dblCall;
+    double dblPut;
+    double dblIV; // the side in use, 0 when neither has one
+    Point( double dblStrike_ ): dblStrike( dblStrike_ ), dblCall {}, dblPut {}, dblIV {} {}
+  };
+  using vPoint_t = std::vector<Point>;
+
+  struct Slice {
+    date_t expiry;
+    double dblYears;
+    vPoint_t vPoint; // ascending strike
+    std::vector<double> vCell;
+    std::size_t nValid; // points with an iv
+    Slice( date_t expiry_ ): expiry( expiry_ ), dblYears {}, nValid {} {}
+  };
+  using vSlice_t = std::vector<Slice>;
+
+  struct Handle {
+    date_t expiry;
+    double dblStrike;
+    bool bCall;
+    double dblIV; // kept to re-apply when the slices are rebuilt
+    std::uint32_t ixSlice;
+    std::uint32_t ixPoint;
+  };
+  using vHandle_t = std::vector<Handle>;
+
+  const Grid m_grid;
+  const double m_dblStep;
+
+  date_t m_dateToday;
+  double m_dblUnderlying;
+  double m_dblReference; // cells are at strikes relative to this
+
+  bool m_bBuilt;
+  vSlice_t m_vSlice; // ascending expiry
+  vHandle_t m_vHandle;
+
+  using mapOption_t = std::unordered_map<const Option*, handle_t>;
+  mapOption_t m_mapOption;
+
+  Stats m_stats;
+
+  void Build(); // slices from the handles, then Rebase
+  void Rebase(); // every point's side, and every cell
+  void Years();
+
+  double Choose( const Point& ) const;
+  void Fill( Slice&, std::size_t ixCellBegin, std::size_t ixCellEnd ) const;
+  double Interpolate( const Slice&, double dblCell ) const; // fractional cell index
+};
+
+} // namespace option
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,118 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    GatewayBook.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFPhemex
+ * Created: October 20, 2026 00:20
+ */
+
+#include <OUCommon/JsonScan.h>
+
+#include "GatewayBook.hpp"
+
+namespace ou {
+namespace tf {
+namespace phemex {
+namespace gateway {
+namespace book {
+
+namespace {
+
+  using ou::json_scan::Expect;
+  using ou::json_scan::String;
+  using ou::json_scan::Number;
+  using ou::json_scan::Skip;
+
+  // [[price,qty],...], a level may carry trailing elements, they are skipped
+  bool Levels( const char*& p, const char* e, v_level_t& v ) {
+    if ( !Expect( p, e, '[' ) ) return false;
+    if ( Expect( p, e, ']' ) ) return true;
+    do {
+      level l;
+      if ( !Expect( p, e, '[' ) ) return false;
+      if ( !Number( p, e, l.price ) ) return false;
+      if ( !Expect( p, e, ',' ) ) return false;
+      if ( !Number( p, e, l.quantity ) ) return false;
+      while ( Expect( p, e, ',' ) ) {
+        if ( !Skip( p, e ) ) return false;
+      }
+      if ( !Expect( p, e, ']' ) ) return false;
+      v.push_back( l );
+    } while ( Expect( p, e, ',' ) );
+    return Expect( p, e, ']' );
+  }
+
+  bool Book( const char*& p, const char* e, message& msg ) {
+    if ( !Expect( p, e, '{' ) ) return false;
+    if ( Expect( p, e, '}' ) ) return true;
+    std::string_view key;
+    do {
+      if ( !String( p, e, key ) ) return false;
+      if ( !Expect( p, e, ':' ) ) return false;
+      bool bOk;
+      if      ( "bids" == key ) bOk = Levels( p, e, msg.bids );
+      else if ( "asks" == key ) bOk = Levels( p, e, msg.asks );
+      else bOk = Skip( p, e );
+      if ( !bOk ) return false;
+    } while ( Expect( p, e, ',' ) );
+    return Expect( p, e, '}' );
+  }
+
+} // namespace anonymous
+
+bool IsBook( std::string_view frame ) {
+  return std::string_view::npos != frame.find( "\"book\"" );
+}
+
+bool Decode( std::string_view frame, message& msg ) {
+
+  msg.symbol = std::string_view();
+  msg.type = std::string_view();
+  msg.sequence = 0;
+  msg.time_stamp = 0;
+  msg.bids.clear();
+  msg.asks.clear();
+
+  const char* p( frame.data() );
+  const char* e( p + frame.size() );
+
+  bool bBook( false );
+  bool bSequence( false );
+
+  if ( !Expect( p, e, '{' ) ) return false;
+  std::string_view key;
+  do {
+    if ( !String( p, e, key ) ) return false;
+    if ( !Expect( p, e, ':' ) ) return false;
+    bool bOk;
+    if ( "book" == key ) bOk = bBook = Book( p, e, msg );
+    else if ( "sequence" == key ) bOk = bSequence = Number( p, e, msg.sequence );
+    else if ( "timestamp" == key ) bOk = Number( p, e, msg.time_stamp );
+    else if ( "symbol" == key ) bOk = String( p, e, msg.symbol );
+    else if ( "type" == key ) bOk = String( p, e, msg.type );
+    else bOk = Skip( p, e );
+    if ( !bOk ) return false;
+  } while ( Expect( p, e, ',' ) );
+  if ( !Expect( p, e, '}' ) ) return false;
+
+  return bBook && bSequence && !msg.symbol.empty() && !msg.type.empty();
+}
+
+} // namespace book
+} // namespace gateway
+} // namespace phemex
+} // namespace tf
+} // namespace ou
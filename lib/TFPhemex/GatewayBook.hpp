@@ -0,0 +1,72 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    GatewayBook.hpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFPhemex
+ * Created: October 20, 2026 00:20
+ */
+
+#pragma once
+
+// == OrderBook ==
+// orderbook.subscribe: a snapshot, then incrementals, for the symbol
+// {"book":{"asks":[[priceEp,qty],...],"bids":[[priceEp,qty],...]},"depth":30,"sequence":N,"symbol":"BTCUSD","timestamp":ns,"type":"snapshot"}
+//   an incremental quantity of 0 removes the level
+//   scaled integer prices and quantities only (not the orderbook_p string form)
+
+#include <vector>
+#include <cstdint>
+#include <string_view>
+
+namespace ou {
+namespace tf {
+namespace phemex {
+namespace gateway {
+namespace book {
+
+struct level {
+  std::int64_t price;    // Ep, scaled
+  std::int64_t quantity;
+  level(): price {}, quantity {} {}
+  level( std::int64_t price_, std::int64_t quantity_ ): price( price_ ), quantity( quantity_ ) {}
+  bool operator==( const level& rhs ) const { return ( price == rhs.price ) && ( quantity == rhs.quantity ); }
+};
+
+using v_level_t = std::vector<level>;
+
+// views refer to the decoded frame, the vectors are re-used from message to message
+struct message {
+  std::string_view symbol;
+  std::string_view type;   // snapshot, incremental
+  std::uint64_t sequence;
+  std::uint64_t time_stamp; // ns
+  v_level_t bids;
+  v_level_t asks;
+  message(): sequence {}, time_stamp {} {}
+  bool snapshot() const { return "snapshot" == type; }
+};
+
+// a single pass over the frame, no json tree, unknown keys are skipped
+// false if the frame is not an order book message, or is malformed
+bool Decode( std::string_view frame, message& );
+
+bool IsBook( std::string_view frame ); // cheap test prior to Decode
+
+} // namespace book
+} // namespace gateway
+} // namespace phemex
+} // namespace tf
+} // namespace ou
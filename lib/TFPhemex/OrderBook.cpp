@@ -0,0 +1,245 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    OrderBook.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFPhemex
+ * Created: October 20, 2026 00:20
+ */
+
+#include <algorithm>
+
+#include "OrderBook.hpp"
+
+namespace ou {
+namespace tf {
+namespace phemex {
+
+namespace {
+
+  constexpr char rchSide[] = { 'A', 'B' }; // indexed by OrderBook::ESide
+
+  // ordered worst to best: bids ascend, asks descend
+  inline bool Worse( OrderBook::ESide side, std::int64_t lhs, std::int64_t rhs ) {
+    return ( OrderBook::Bid == side ) ? ( lhs < rhs ) : ( lhs > rhs );
+  }
+
+  inline OrderBook::v_level_t::iterator Find( OrderBook::ESide side, OrderBook::v_level_t& v, std::int64_t price ) {
+    return std::lower_bound(
+      v.begin(), v.end(), price,
+      [side]( const OrderBook::level_t& level, std::int64_t price ){ return Worse( side, level.price, price ); } );
+  }
+
+} // namespace anonymous
+
+OrderBook::OrderBook( ESequence eSequence )
+: m_eSequence( eSequence )
+, m_bSynchronized( false )
+, m_nSequence {}
+{}
+
+void OrderBook::Set( fDepthByOrder_t&& fDepthByOrder, fQuote_t&& fQuote ) {
+  m_fDepthByOrder = std::move( fDepthByOrder );
+  m_fQuote = std::move( fQuote );
+}
+
+OrderBook::idorder_t OrderBook::LevelId( ESide side, std::int64_t price ) {
+  return ( (idorder_t)price << 1 ) | (idorder_t)side;
+}
+
+OrderBook::EResult OrderBook::Apply( dt_t dt, dt_t dtMarket, const gateway::book::message& msg ) {
+  if ( msg.snapshot() ) return Snapshot( dt, dtMarket, msg );
+  else return Incremental( dt, dtMarket, msg );
+}
+
+OrderBook::EResult OrderBook::Snapshot( dt_t dt, dt_t dtMarket, const gateway::book::message& msg ) {
+
+  const Top prior( GetTop() );
+
+  auto Side = [this,dt,dtMarket]( ESide side, const v_level_t& v ){
+    m_vSnapshot.clear();
+    for ( const level_t& level: v ) {
+      if ( 0 < level.quantity ) m_vSnapshot.push_back( level );
+    }
+    std::sort(
+      m_vSnapshot.begin(), m_vSnapshot.end(),
+      [side]( const level_t& lhs, const level_t& rhs ){ return Worse( side, lhs.price, rhs.price ); } );
+    Merge( side, dt, dtMarket, m_vSnapshot );
+  };
+
+  Side( Bid, msg.bids );
+  Side( Ask, msg.asks );
+
+  m_stats.nSnapshots++;
+  m_nSequence = msg.sequence;
+
+  // a snapshot is authoritative, a crossed one is counted, re-requesting would repeat it
+  if ( Crossed() ) m_stats.nCrossed++;
+
+  m_bSynchronized = true;
+  Quote( dt, prior );
+  return EResult::Applied;
+}
+
+OrderBook::EResult OrderBook::Incremental( dt_t dt, dt_t dtMarket, const gateway::book::message& msg ) {
+
+  if ( !m_bSynchronized ) {
+    m_stats.nWaiting++;
+    return EResult::Waiting;
+  }
+
+  if ( msg.sequence <= m_nSequence ) {
+    m_stats.nStale++;
+    return EResult::Stale;
+  }
+
+  if ( ( ESequence::Contiguous == m_eSequence ) && ( ( m_nSequence + 1 ) != msg.sequence ) ) {
+    m_stats.nGaps++;
+    m_bSynchronized = false;
+    return EResult::Gap;
+  }
+
+  const Top prior( GetTop() );
+
+  for ( const level_t& level: msg.bids ) Change( Bid, dt, dtMarket, level );
+  for ( const level_t& level: msg.asks ) Change( Ask, dt, dtMarket, level );
+
+  m_stats.nIncrementals++;
+  m_nSequence = msg.sequence;
+
+  if ( Crossed() ) {
+    m_stats.nCrossed++;
+    m_bSynchronized = false;
+    return EResult::Crossed;
+  }
+
+  Quote( dt, prior );
+  return EResult::Applied;
+}
+
+void OrderBook::Merge( ESide side, dt_t dt, dt_t dtMarket, const v_level_t& vSnapshot ) {
+
+  v_level_t& vHeld( m_rvSide[ side ] );
+
+  // both ordered worst to best, publish the differences
+  v_level_t::const_iterator iterHeld( vHeld.begin() );
+  v_level_t::const_iterator iterNew( vSnapshot.begin() );
+  uint64_t nPriority( vSnapshot.size() );
+  while ( ( vHeld.end() != iterHeld ) || ( vSnapshot.end() != iterNew ) ) {
+    if ( ( vSnapshot.end() == iterNew ) || ( ( vHeld.end() != iterHeld ) && Worse( side, iterHeld->price, iterNew->price ) ) ) {
+      Publish( side, dt, dtMarket, '5', *iterHeld, 0 );
+      m_stats.nLevels++;
+      ++iterHeld;
+    }
+    else {
+      nPriority--;
+      if ( ( vHeld.end() == iterHeld ) || Worse( side, iterNew->price, iterHeld->price ) ) {
+        Publish( side, dt, dtMarket, '3', *iterNew, nPriority );
+        m_stats.nLevels++;
+      }
+      else {
+        if ( iterHeld->quantity != iterNew->quantity ) {
+          Publish( side, dt, dtMarket, '4', *iterNew, nPriority );
+          m_stats.nLevels++;
+        }
+        ++iterHeld;
+      }
+      ++iterNew;
+    }
+  }
+
+  vHeld.assign( vSnapshot.begin(), vSnapshot.end() );
+}
+
+void OrderBook::Change( ESide side, dt_t dt, dt_t dtMarket, const level_t& level ) {
+
+  v_level_t& v( m_rvSide[ side ] );
+  v_level_t::iterator iter( Find( side, v, level.price ) );
+  const bool bFound( ( v.end() != iter ) && ( level.price == iter->price ) );
+
+  if ( 0 >= level.quantity ) {
+    if ( bFound ) {
+      Publish( side, dt, dtMarket, '5', *iter, 0 );
+      v.erase( iter );
+      m_stats.nLevels++;
+    }
+    else {
+      m_stats.nUnknown++;
+    }
+  }
+  else {
+    if ( bFound ) {
+      if ( level.quantity != iter->quantity ) {
+        iter->quantity = level.quantity;
+        Publish( side, dt, dtMarket, '4', level, v.end() - iter - 1 );
+        m_stats.nLevels++;
+      }
+    }
+    else {
+      iter = v.insert( iter, level );
+      Publish( side, dt, dtMarket, '3', level, v.end() - iter - 1 );
+      m_stats.nLevels++;
+    }
+  }
+}
+
+void OrderBook::Publish( ESide side, dt_t dt, dt_t dtMarket, char chMsgType, const level_t& level, uint64_t nPriority ) {
+  if ( m_fDepthByOrder ) {
+    if ( '5' == chMsgType ) {
+      m_fDepthByOrder( ou::tf::DepthByOrder( dt, dtMarket, LevelId( side, level.price ), 0, '5', rchSide[ side ] ) );
+    }
+    else {
+      m_fDepthByOrder(
+        ou::tf::DepthByOrder(
+          dt, dtMarket, LevelId( side, level.price ), nPriority, chMsgType, rchSide[ side ],
+          (ou::tf::DatedDatum::price_t)level.price, (ou::tf::DatedDatum::volume_t)level.quantity ) );
+    }
+  }
+}
+
+OrderBook::Top OrderBook::GetTop() const {
+  Top top;
+  if ( !m_rvSide[ Bid ].empty() ) top.bid = m_rvSide[ Bid ].back();
+  if ( !m_rvSide[ Ask ].empty() ) top.ask = m_rvSide[ Ask ].back();
+  return top;
+}
+
+bool OrderBook::Crossed() const {
+  const v_level_t& vBid( m_rvSide[ Bid ] );
+  const v_level_t& vAsk( m_rvSide[ Ask ] );
+  return ( !vBid.empty() && !vAsk.empty() && ( vBid.back().price >= vAsk.back().price ) );
+}
+
+void OrderBook::Quote( dt_t dt, const Top& prior ) {
+  if ( m_fQuote ) {
+    const v_level_t& vBid( m_rvSide[ Bid ] );
+    const v_level_t& vAsk( m_rvSide[ Ask ] );
+    if ( !vBid.empty() && !vAsk.empty() ) {
+      const level_t& bid( vBid.back() );
+      const level_t& ask( vAsk.back() );
+      if ( !( bid == prior.bid ) || !( ask == prior.ask ) ) {
+        m_fQuote(
+          ou::tf::Quote(
+            dt,
+            (ou::tf::DatedDatum::price_t)bid.price, (ou::tf::DatedDatum::volume_t)bid.quantity,
+            (ou::tf::DatedDatum::price_t)ask.price, (ou::tf::DatedDatum::volume_t)ask.quantity ) );
+      }
+    }
+  }
+}
+
+} // namespace phemex
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,132 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    OrderBook.hpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFPhemex
+ * Created: October 20, 2026 00:20
+ */
+
+#pragma once
+
+// price level book for one symbol, maintained from the orderbook snapshot and incrementals
+//   each side is a sorted vector with the best level at the back,
+//     changes cluster at the top of the book, so inserts and erases move few levels
+//   a snapshot is merged against the levels held, only the differences are published,
+//     so a resynchronisation leaves subscribers with the correct book
+//   sequence: an incremental at or below the sequence held is stale and is dropped,
+//     with ESequence::Contiguous, any skipped sequence number is a gap
+//   a gap, or an incremental leaving the book crossed, marks the book out of sync
+//     until the next snapshot, the caller re-subscribes to obtain one
+// changes are published as DepthByOrder, a level is an 'order' keyed by side & price:
+//   '3' add, '4' update, '5' delete, priority is the distance from the top of the book
+// a change at the top of either side publishes a Quote, once both sides have a level
+// prices are the scaled Ep values, as with trades
+
+#include <array>
+#include <cstdint>
+#include <functional>
+
+#include <TFTimeSeries/DatedDatum.h>
+
+#include "GatewayBook.hpp"
+
+namespace ou {
+namespace tf {
+namespace phemex {
+
+class OrderBook {
+public:
+
+  using dt_t = ou::tf::DatedDatum::dt_t;
+  using idorder_t = ou::tf::DepthByOrder::idorder_t;
+  using level_t = gateway::book::level;
+  using v_level_t = gateway::book::v_level_t;
+
+  enum ESide { Ask = 0, Bid = 1 };
+  enum class ESequence { Increasing, Contiguous };
+  enum class EResult { Applied, Stale, Waiting, Gap, Crossed };
+
+  struct Stats {
+    size_t nSnapshots;
+    size_t nIncrementals; // applied
+    size_t nLevels;       // level changes applied, snapshot differences included
+    size_t nStale;
+    size_t nWaiting;      // incrementals received while out of sync
+    size_t nGaps;
+    size_t nCrossed;
+    size_t nUnknown;      // removal of a level not held
+    Stats(): nSnapshots {}, nIncrementals {}, nLevels {}, nStale {}, nWaiting {}, nGaps {}, nCrossed {}, nUnknown {} {}
+  };
+
+  using fDepthByOrder_t = std::function<void(const ou::tf::DepthByOrder&)>;
+  using fQuote_t = std::function<void(const ou::tf::Quote&)>;
+
+  OrderBook( ESequence = ESequence::Increasing );
+
+  void Set( fDepthByOrder_t&&, fQuote_t&& );
+
+  // dt: time of receipt, dtMarket: the message time stamp
+  EResult Apply( dt_t dt, dt_t dtMarket, const gateway::book::message& );
+
+  bool Synchronized() const { return m_bSynchronized; }
+  std::uint64_t Sequence() const { return m_nSequence; }
+
+  size_t Levels( ESide side ) const { return m_rvSide[ side ].size(); }
+  const level_t& Level( ESide side, size_t ix ) const { // 0 is the top of the book
+    const v_level_t& v( m_rvSide[ side ] );
+    return v[ v.size() - 1 - ix ];
+  }
+
+  const Stats& GetStats() const { return m_stats; }
+
+  static idorder_t LevelId( ESide, std::int64_t price ); // side & price as an order id
+
+protected:
+private:
+
+  const ESequence m_eSequence;
+
+  bool m_bSynchronized;
+  std::uint64_t m_nSequence;
+
+  std::array<v_level_t,2> m_rvSide; // indexed by ESide, ordered worst to best
+  v_level_t m_vSnapshot; // re-used for ordering a snapshot
+
+  Stats m_stats;
+
+  fDepthByOrder_t m_fDepthByOrder;
+  fQuote_t m_fQuote;
+
+  EResult Snapshot( dt_t, dt_t, const gateway::book::message& );
+  EResult Incremental( dt_t, dt_t, const gateway::book::message& );
+
+  void Merge( ESide, dt_t, dt_t, const v_level_t& ); // snapshot side, ordered worst to best
+  void Change( ESide, dt_t, dt_t, const level_t& );  // incremental level
+
+  void Publish( ESide, dt_t, dt_t, char chMsgType, const level_t&, uint64_t nPriority );
+
+  struct Top {
+    level_t bid;
+    level_t ask;
+  };
+  Top GetTop() const;
+  bool Crossed() const;
+  void Quote( dt_t, const Top& prior );
+};
+
+} // namespace phemex
+} // namespace tf
+} // namespace ou
@@ -52,8 +52,9 @@ Provider::Provider()
 {
   m_sName = "phemex"; // this needs to match provider used in the database
   m_nID = keytypes::EProviderPhemex;
-//  m_bProvidesQuotes = true; // need to derive from order table
+  m_bProvidesQuotes = true; // top of the order book
   m_bProvidesTrades = true;
+  m_bProvidesDepths = true;
 //m_bProvidesBrokerInterface = true;
 
   if ( 0 == GetThreadCount() ) { // affects m_srvc
@@ -274,6 +275,10 @@ void Provider::DataGateWayUp() {
       ProviderInterfaceBase::OnDisconnected( 0 );
     },
     [this]( std::string&& sMessage){ // fMessage_t
+      if ( gateway::book::IsBook( sMessage ) ) { // the busiest, decoded without a json tree
+        HandleBook( sMessage );
+        return;
+      }
       json::error_code jec;
       json::value jv = json::parse( sMessage, jec );
       if ( jec.failed() ) {
@@ -302,6 +307,13 @@ void Provider::DataGateWayUp() {
                   << "provider/phemex gw stop watch: " << sMessage;
               }
               break;
+            case (int)session::web_socket::EMessageId::StartBookWatch:
+            case (int)session::web_socket::EMessageId::StopBookWatch:
+              if ( !obj.at( "error" ).is_null() ) {
+                BOOST_LOG_TRIVIAL(error)
+                  << "provider/phemex gw book watch: " << sMessage;
+              }
+              break;
             default:
               BOOST_LOG_TRIVIAL(error) << "provider/phemex gw error: " << sMessage;
               break;
@@ -365,13 +377,64 @@ void Provider::DataGateWayUp() {
     });
 }
 
-//void Provider::StartQuoteWatch( pSymbol_t pSymbol ) {
-  // no quotes to watch for now, will need to pull from order book
-//}
+void Provider::HandleBook( const std::string& sMessage ) {
+
+  if ( !gateway::book::Decode( sMessage, m_msgBook ) ) {
+    BOOST_LOG_TRIVIAL(error) << "provider/phemex malformed order book: " << sMessage;
+    return;
+  }
 
-//void Provider::StopQuoteWatch( pSymbol_t pSymbol ) {
-  // no quotes to watch for now, will need to pull from order book
-//}
+  m_sLookup.assign( m_msgBook.symbol.data(), m_msgBook.symbol.size() );
+  mapSymbols_t::iterator iterSymbol = m_mapSymbols.find( m_sLookup );
+  if ( m_mapSymbols.end() == iterSymbol ) {
+    BOOST_LOG_TRIVIAL(error) << "provider/phemex DataGateway can not find symbol " << m_sLookup;
+    return;
+  }
+
+  switch ( iterSymbol->second->HandleBook( m_msgBook ) ) {
+    case OrderBook::EResult::Gap:
+    case OrderBook::EResult::Crossed:
+      // a repeated subscribe is answered with a snapshot, incrementals are dropped until it arrives
+      BOOST_LOG_TRIVIAL(warning)
+        << "provider/phemex " << m_sLookup << " order book out of sync at " << m_msgBook.sequence << ", re-subscribing";
+      if ( m_pDataGateWay ) {
+        m_pDataGateWay->StartBookWatch( m_sLookup );
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+void Provider::StartBookWatch( pSymbol_t pSymbol ) {
+  if ( m_pDataGateWay ) {
+    m_pDataGateWay->StartBookWatch( pSymbol->GetInstrument()->GetInstrumentName() );
+  }
+}
+
+void Provider::StopBookWatch( pSymbol_t pSymbol ) {
+  if ( m_pDataGateWay ) {
+    m_pDataGateWay->StopBookWatch( pSymbol->GetInstrument()->GetInstrumentName() );
+  }
+}
+
+// quotes are the top of the order book, one subscription serves both watches
+
+void Provider::StartQuoteWatch( pSymbol_t pSymbol ) {
+  if ( 0 == pSymbol->GetDepthByOrderHandlerCount() ) StartBookWatch( pSymbol );
+}
+
+void Provider::StopQuoteWatch( pSymbol_t pSymbol ) {
+  if ( 0 == pSymbol->GetDepthByOrderHandlerCount() ) StopBookWatch( pSymbol );
+}
+
+void Provider::StartDepthByOrderWatch( pSymbol_t pSymbol ) {
+  if ( 0 == pSymbol->GetQuoteHandlerCount() ) StartBookWatch( pSymbol );
+}
+
+void Provider::StopDepthByOrderWatch( pSymbol_t pSymbol ) {
+  if ( 0 == pSymbol->GetQuoteHandlerCount() ) StopBookWatch( pSymbol );
+}
 
 void Provider::StartTradeWatch( pSymbol_t pSymbol ) {
   // does inherited handle watch count?
@@ -27,6 +27,7 @@
 
 #include "Symbol.hpp"
 #include "Products.hpp"
+#include "GatewayBook.hpp"
 
 
 // The default Rest API base endpoint is: https://api.phemex.com.
@@ -90,13 +91,16 @@ public:
 protected:
 
   // overridden from ProviderInterface, called when application adds/removes watches
-  // for phemex: Subscribe tick event for symbol price?
-  //virtual void StartQuoteWatch( pSymbol_t pSymbol );
-  //virtual void  StopQuoteWatch( pSymbol_t pSymbol );
+  // quotes and depth share the orderbook subscription
+  virtual void StartQuoteWatch( pSymbol_t pSymbol );
+  virtual void  StopQuoteWatch( pSymbol_t pSymbol );
 
   virtual void StartTradeWatch( pSymbol_t pSymbol );
   virtual void  StopTradeWatch( pSymbol_t pSymbol );
 
+  virtual void StartDepthByOrderWatch( pSymbol_t pSymbol );
+  virtual void  StopDepthByOrderWatch( pSymbol_t pSymbol );
+
   pSymbol_t NewCSymbol( pInstrument_t pInstrument );  // used by Add/Remove x handlers in base class
 
   // From ProviderInterface Execution Section
@@ -127,9 +131,16 @@ private:
 
   bool m_bSendHeartBeat;
 
+  gateway::book::message m_msgBook; // re-used, decoded on the web_socket thread
+  std::string m_sLookup;
+
   void GetProducts();
   void DataGateWayUp();
 
+  void StartBookWatch( pSymbol_t );
+  void StopBookWatch( pSymbol_t );
+  void HandleBook( const std::string& );
+
 };
 
 } // namespace phemex
@@ -32,6 +32,10 @@ namespace phemex {
 Symbol::Symbol( const idSymbol_t& sSymbol, pInstrument_t pInstrument )
 : ou::tf::Symbol<Symbol>( pInstrument, sSymbol )
 {
+  m_book.Set(
+    [this]( const DepthByOrder& depth ){ m_OnDepthByOrder( depth ); },
+    [this]( const Quote& quote ){ m_OnQuote( quote ); }
+  );
 }
 
 Symbol::~Symbol() {
@@ -43,6 +47,13 @@ void Symbol::HandleTrade( const gateway::trades::trade& trade ) {
   m_OnTrade( tf_trade );
 }
 
+OrderBook::EResult Symbol::HandleBook( const gateway::book::message& msg ) {
+  static const boost::posix_time::ptime epoch( boost::gregorian::date( 1970, 1, 1 ) );
+  const boost::posix_time::ptime dt( ou::TimeSource::GlobalInstance().External() );
+  const boost::posix_time::ptime dtMarket( epoch + boost::posix_time::microseconds( msg.time_stamp / 1000 ) ); // ns
+  return m_book.Apply( dt, dtMarket, msg );
+}
+
 } // namespace phemex
 } // namespace tf
 } // namespace ou
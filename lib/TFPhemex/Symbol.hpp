@@ -23,6 +23,7 @@
 
 #include <TFTrading/Symbol.h>
 
+#include "OrderBook.hpp"
 #include "GatewayTrades.hpp"
 
 namespace ou {
@@ -46,8 +47,11 @@ public:
 protected:
 
   void HandleTrade( const gateway::trades::trade& );
+  OrderBook::EResult HandleBook( const gateway::book::message& ); // publishes depth & quotes
 
 private:
+
+  OrderBook m_book;
 };
 
 } // namespace phemex
@@ -61,17 +61,29 @@ void fail( beast::error_code ec, char const* what ) {
 // Resolver and socket require an io_context
 web_socket::web_socket( asio::io_context& srvc, ssl::context& ssl_ctx )
 : m_srvc( srvc )
-, m_strand( srvc )
+, m_strand( asio::make_strand( srvc ) )
 , m_timer( srvc )
 , m_bSendHeartBeat( false )
 , m_id( 0 )
 , m_bConnected( false )
-, m_resolver( asio::make_strand( srvc ) )
-, m_ws( asio::make_strand( srvc ), ssl_ctx )
+, m_resolver( m_strand )
+, m_pwss( std::make_unique<wss_t>( m_strand, ssl_ctx ) )
 {
   std::cout << "phemex::web_socket construction" << std::endl; // ensuring proper timing of handling
 }
 
+web_socket::web_socket( asio::io_context& srvc )
+: m_srvc( srvc )
+, m_strand( asio::make_strand( srvc ) )
+, m_timer( srvc )
+, m_bSendHeartBeat( false )
+, m_id( 0 )
+, m_bConnected( false )
+, m_resolver( m_strand )
+, m_pws( std::make_unique<ws_t>( m_strand ) )
+{
+}
+
 web_socket::~web_socket() {
   std::cout << "phemex::web_socket destruction" << std::endl; // ensuring proper timing of handling
 }
@@ -111,17 +123,20 @@ void web_socket::on_resolve(
     //std::cout << "ws.on_resolve" << std::endl;
   }
 
-  // Set a timeout on the operation
-  beast::get_lowest_layer( m_ws ).expires_after(std::chrono::seconds( 15 ));
+  with_ws( [this,&results]( auto& ws ){
 
-  // Make the connection on the IP address we get from a lookup
-  beast::get_lowest_layer( m_ws ).async_connect(
-    results,
-    beast::bind_front_handler(
-      &web_socket::on_connect,
-      shared_from_this()
-    )
-  );
+    // Set a timeout on the operation
+    beast::get_lowest_layer( ws ).expires_after(std::chrono::seconds( 15 ));
+
+    // Make the connection on the IP address we get from a lookup
+    beast::get_lowest_layer( ws ).async_connect(
+      results,
+      beast::bind_front_handler(
+        &web_socket::on_connect,
+        shared_from_this()
+      )
+    );
+  } );
 }
 
 void web_socket::on_connect(beast::error_code ec, tcp::resolver::results_type::endpoint_type ep ) {
@@ -132,12 +147,18 @@ void web_socket::on_connect(beast::error_code ec, tcp::resolver::results_type::e
     //std::cout << "ws.on_connect" << std::endl;
   }
 
+  if ( !m_pwss ) {
+    m_host += ':' + std::to_string(ep.port());
+    ws_handshake();
+    return;
+  }
+
   // Set a timeout on the operation
-  beast::get_lowest_layer( m_ws ).expires_after( std::chrono::seconds( 15 ) );
+  beast::get_lowest_layer( *m_pwss ).expires_after( std::chrono::seconds( 15 ) );
 
   // Set SNI Hostname (many hosts need this to handshake successfully)
   if( !SSL_set_tlsext_host_name(
-    m_ws.next_layer().native_handle(),
+    m_pwss->next_layer().native_handle(),
     m_host.c_str())
   ) {
     ec = beast::error_code(static_cast<int>(::ERR_get_error()),
@@ -151,7 +172,7 @@ void web_socket::on_connect(beast::error_code ec, tcp::resolver::results_type::e
   m_host += ':' + std::to_string(ep.port());
 
   // Perform the SSL handshake
-  m_ws.next_layer().async_handshake(
+  m_pwss->next_layer().async_handshake(
     ssl::stream_base::client,
     beast::bind_front_handler(
       &web_socket::on_ssl_handshake,
@@ -168,33 +189,41 @@ void web_socket::on_ssl_handshake( beast::error_code ec ) {
     //std::cout << "ws.on_ssl_handshake" << std::endl;
   }
 
-  // Turn off the timeout on the tcp_stream, because
-  // the websocket stream has its own timeout system.
-  beast::get_lowest_layer( m_ws ).expires_never();
+  ws_handshake();
+}
 
-  // Set suggested timeout settings for the websocket
-  m_ws.set_option(
-    websocket::stream_base::timeout::suggested(
-      beast::role_type::client)
-    );
+void web_socket::ws_handshake() {
 
-  // Set a decorator to change the User-Agent of the handshake
-  m_ws.set_option( websocket::stream_base::decorator(
-    []( websocket::request_type& request )
-    {
-      request.set(http::field::user_agent,
-        std::string( sUserAgent ) + " websocket-client-async-ssl");
-    })
-  );
+  with_ws( [this]( auto& ws ){
 
-  // Perform the websocket handshake
-  m_ws.async_handshake(
-    m_host, "/ws",
-    beast::bind_front_handler(
-      &web_socket::on_handshake,
-      shared_from_this()
-    )
-  );
+    // Turn off the timeout on the tcp_stream, because
+    // the websocket stream has its own timeout system.
+    beast::get_lowest_layer( ws ).expires_never();
+
+    // Set suggested timeout settings for the websocket
+    ws.set_option(
+      websocket::stream_base::timeout::suggested(
+        beast::role_type::client)
+      );
+
+    // Set a decorator to change the User-Agent of the handshake
+    ws.set_option( websocket::stream_base::decorator(
+      []( websocket::request_type& request )
+      {
+        request.set(http::field::user_agent,
+          std::string( sUserAgent ) + " websocket-client-async-ssl");
+      })
+    );
+
+    // Perform the websocket handshake
+    ws.async_handshake(
+      m_host, "/ws",
+      beast::bind_front_handler(
+        &web_socket::on_handshake,
+        shared_from_this()
+      )
+    );
+  } );
 }
 
 void web_socket::on_handshake( beast::error_code ec ) {
@@ -208,26 +237,29 @@ void web_socket::on_handshake( beast::error_code ec ) {
   m_bConnected = true;
   if ( m_fConnected ) m_fConnected( true );
 
-  // start up generic listener
-  m_ws.async_read(
-    m_buffer,
-    beast::bind_front_handler(
-      &web_socket::on_read_listen,
-      shared_from_this()
-    )
-  );
+  with_ws( [this]( auto& ws ){
+
+    // start up generic listener
+    ws.async_read(
+      m_buffer,
+      beast::bind_front_handler(
+        &web_socket::on_read_listen,
+        shared_from_this()
+      )
+    );
 
-  m_ws.control_callback(
-    []( beast::websocket::frame_type kind, boost::string_view payload)
-    {
-        // Do something with the payload
-        std::cout
-          << "ws.handshake.control_callback "
-          << (int)kind
-          << " view " << payload
-          << std::endl;
-        boost::ignore_unused(kind, payload);
-    });
+    ws.control_callback(
+      []( beast::websocket::frame_type kind, boost::string_view payload)
+      {
+          // Do something with the payload
+          std::cout
+            << "ws.handshake.control_callback "
+            << (int)kind
+            << " view " << payload
+            << std::endl;
+          boost::ignore_unused(kind, payload);
+      });
+  } );
 
   m_bSendHeartBeat = true;
   m_timer.expires_from_now(boost::posix_time::seconds( nHeartBeatIntervalSeconds ));
@@ -273,18 +305,7 @@ void web_socket::on_timer( const boost::system::error_code& ec ) {
 
       std::cout << "ws.on_timer send " << sSerialized << std::endl;
 
-      // Send the message, may need to fix this, may not need the strand
-      asio::post(
-        m_strand,
-        [this,s=std::move(sSerialized)](){
-          m_ws.async_write(
-            asio::buffer( s ),
-            beast::bind_front_handler(
-              &web_socket::on_write_heart_beat,
-              shared_from_this()
-            )
-          );
-        } );
+      send( std::move( sSerialized ) );
 
       m_timer.expires_from_now(boost::posix_time::seconds( nHeartBeatIntervalSeconds ));
       m_timer.async_wait( std::bind( &web_socket::on_timer, this, std::placeholders::_1 ) );
@@ -292,28 +313,6 @@ void web_socket::on_timer( const boost::system::error_code& ec ) {
   }
 }
 
-void web_socket::on_write_heart_beat(
-  beast::error_code ec,
-  std::size_t bytes_transferred
-) {
-  boost::ignore_unused(bytes_transferred);
-
-  if ( ec )
-    return fail( ec, "ws.on_write_heart_beat" );
-  else {
-    //std::cout << "ws.on_write_heart_beat " << bytes_transferred << std::endl;
-  }
-
-  // Read a message into our buffer?
-  //m_ws.async_read(
-  //  m_buffer,
-  //  beast::bind_front_handler(
-  //    &web_socket::on_read_auth,
-  //    shared_from_this()
-  //  )
-  //);
-}
-
 // unused at the moment
 void web_socket::on_write_auth(
   beast::error_code ec,
@@ -328,13 +327,15 @@ void web_socket::on_write_auth(
   }
 
   // Read a message into our buffer
-  m_ws.async_read(
-    m_buffer,
-    beast::bind_front_handler(
-      &web_socket::on_read_auth,
-      shared_from_this()
-    )
-  );
+  with_ws( [this]( auto& ws ){
+    ws.async_read(
+      m_buffer,
+      beast::bind_front_handler(
+        &web_socket::on_read_auth,
+        shared_from_this()
+      )
+    );
+  } );
 }
 
 // unused at the moment
@@ -364,13 +365,15 @@ void web_socket::on_read_auth(
     m_buffer.clear();
 
     // wait for more reads
-    m_ws.async_read(
-      m_buffer,
-      beast::bind_front_handler(
-        &web_socket::on_read_listen,
-        shared_from_this()
-      )
-    );
+    with_ws( [this]( auto& ws ){
+      ws.async_read(
+        m_buffer,
+        beast::bind_front_handler(
+          &web_socket::on_read_listen,
+          shared_from_this()
+        )
+      );
+    } );
   }
 
 }
@@ -430,8 +433,12 @@ void web_socket::on_read_listen(
 ) {
   boost::ignore_unused( bytes_transferred );
 
-  if ( ec )
-    return fail( ec, "ws.on_read_listen" );
+  if ( ec ) {
+    if ( ( websocket::error::closed != ec ) && ( asio::error::operation_aborted != ec ) ) {
+      fail( ec, "ws.on_read_listen" );
+    }
+    return;
+  }
   else {
     //std::cout << "ws.on_read_listen" << std::endl;
 
@@ -441,19 +448,23 @@ void web_socket::on_read_listen(
     std::string sMessage( beast::buffers_to_string( m_buffer.data() ) );
     //std::cout << "ws.on_read_listen: " << sMessage << std::endl;
 
+    if ( m_ofsRecord.is_open() ) m_ofsRecord << sMessage << '\n';
+
     if ( m_fMessage ) m_fMessage( std::move( sMessage ) );
     m_buffer.clear();
 
     if ( m_bConnected ) {
       // wait for more reads
       //std::cout << "ws.on_read_listen: start again" << std::endl;
-      m_ws.async_read(
-        m_buffer,
-        beast::bind_front_handler(
-          &web_socket::on_read_listen,
-          shared_from_this()
-        )
-      );
+      with_ws( [this]( auto& ws ){
+        ws.async_read(
+          m_buffer,
+          beast::bind_front_handler(
+            &web_socket::on_read_listen,
+            shared_from_this()
+          )
+        );
+      } );
     }
   }
 
@@ -464,14 +475,20 @@ void web_socket::disconnect() {
   m_bSendHeartBeat = false;
   m_timer.cancel();
 
-  // Close the WebSocket connection
-  m_ws.async_close(
-    websocket::close_code::normal,
-    beast::bind_front_handler(
-      &web_socket::on_close,
-      shared_from_this()
-    )
-  );
+  // Close the WebSocket connection, on the strand, as writes may be outstanding
+  asio::post(
+    m_strand,
+    [this, self = shared_from_this()](){
+      with_ws( [this]( auto& ws ){
+        ws.async_close(
+          websocket::close_code::normal,
+          beast::bind_front_handler(
+            &web_socket::on_close,
+            shared_from_this()
+          )
+        );
+      } );
+    } );
 }
 
 void web_socket::on_close(beast::error_code ec) {
@@ -489,83 +506,79 @@ void web_socket::on_close(beast::error_code ec) {
 
 }
 
-void web_socket::StartTradeWatch( const std::string& sSymbol ) {
-
-  json::object subscribe_trade;
-  subscribe_trade[ "id" ] = (int)EMessageId::StartTradeWatch;
-  subscribe_trade[ "method" ] = "trade.subscribe";
-  subscribe_trade[ "params" ] = { sSymbol };
-
-  auto sSerialized( json::serialize( subscribe_trade ) );
-
-  std::cout << "ws.StartTradeWatch send " << sSerialized << std::endl;
+void web_socket::record( const std::string& sFileName ) {
+  m_ofsRecord.open( sFileName, std::ios::out | std::ios::trunc );
+  if ( !m_ofsRecord.is_open() ) {
+    std::cerr << "phemex::web_socket can not record to " << sFileName << std::endl;
+  }
+}
 
+void web_socket::send( std::string&& message ) {
   asio::post(
     m_strand,
-    [this,s=std::move(sSerialized)](){
-      m_ws.async_write(
-        asio::buffer( s ),
-        beast::bind_front_handler(
-          &web_socket::on_write_subscribe_trade,
-          shared_from_this()
-        )
-      );
+    [this, self = shared_from_this(), s=std::move( message )]() mutable {
+      m_queueWrite.emplace_back( std::move( s ) );
+      if ( 1 == m_queueWrite.size() ) write();
     } );
+}
 
+void web_socket::write() {
+  with_ws( [this]( auto& ws ){
+    ws.text( true );
+    ws.async_write(
+      asio::buffer( m_queueWrite.front() ),
+      beast::bind_front_handler(
+        &web_socket::on_write,
+        shared_from_this()
+      )
+    );
+  } );
 }
 
-void web_socket::on_write_subscribe_trade(
+void web_socket::on_write(
   beast::error_code ec,
   std::size_t bytes_transferred
 ) {
   boost::ignore_unused(bytes_transferred);
 
-  if ( ec )
-    return fail( ec, "ws.on_write_subscribe_trade" );
-  else {
-    //std::cout << "ws.on_write_subscribe_trade " << bytes_transferred << std::endl;
+  if ( ec ) {
+    m_queueWrite.clear();
+    return fail( ec, "ws.on_write" );
   }
-}
 
+  m_queueWrite.pop_front();
+  if ( !m_queueWrite.empty() ) write();
+}
 
-void web_socket::StopTradeWatch( const std::string& sSymbol ) {
+void web_socket::method( EMessageId id, const char* szMethod, const std::string& sSymbol ) {
 
-  json::object un_subscribe_trade;
-  un_subscribe_trade[ "id" ] = (int)EMessageId::StopTradeWatch;
-  un_subscribe_trade[ "method" ] = "trade.unsubscribe";
-  un_subscribe_trade[ "params" ] = { sSymbol };
+  json::object request;
+  request[ "id" ] = (int)id;
+  request[ "method" ] = szMethod;
+  request[ "params" ] = { sSymbol };
 
-  const std::string sSerialized( json::serialize( un_subscribe_trade ) );
+  std::string sSerialized( json::serialize( request ) );
 
-  std::cout << "ws.StopTradeWatch send " << sSerialized << std::endl;
+  std::cout << "ws." << szMethod << " send " << sSerialized << std::endl;
 
-  asio::post(
-    m_strand,
-    [this,s=std::move(sSerialized)](){
-      m_ws.async_write(
-        asio::buffer( s ),
-        beast::bind_front_handler(
-          &web_socket::on_write_un_subscribe_trade,
-          shared_from_this()
-        )
-      );
-    } );
+  send( std::move( sSerialized ) );
 }
 
-void web_socket::on_write_un_subscribe_trade(
-  beast::error_code ec,
-  std::size_t bytes_transferred
-) {
-  boost::ignore_unused(bytes_transferred);
+void web_socket::StartTradeWatch( const std::string& sSymbol ) {
+  method( EMessageId::StartTradeWatch, "trade.subscribe", sSymbol );
+}
 
-  if ( ec )
-    return fail( ec, "ws.on_write_un_subscribe_trade" );
-  else {
-    //std::cout << "ws.on_write_un_subscribe_trade " << bytes_transferred << std::endl;
-  }
+void web_socket::StopTradeWatch( const std::string& sSymbol ) {
+  method( EMessageId::StopTradeWatch, "trade.unsubscribe", sSymbol );
 }
 
+void web_socket::StartBookWatch( const std::string& sSymbol ) {
+  method( EMessageId::StartBookWatch, "orderbook.subscribe", sSymbol );
+}
 
+void web_socket::StopBookWatch( const std::string& sSymbol ) {
+  method( EMessageId::StopBookWatch, "orderbook.unsubscribe", sSymbol );
+}
 
 } // namespace session
 } // namespace phemex
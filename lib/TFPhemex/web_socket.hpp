@@ -21,12 +21,14 @@
 
 #pragma once
 
+#include <deque>
 #include <memory>
 #include <string>
 #include <atomic>
+#include <fstream>
 #include <functional>
 
-#include <boost/asio/io_context_strand.hpp>
+#include <boost/asio/strand.hpp>
 
 #include <boost/beast/ssl.hpp>
 #include <boost/beast/core.hpp>
@@ -52,10 +54,11 @@ class web_socket : public std::enable_shared_from_this<web_socket>
 {
 public:
 
-  enum class EMessageId { HeartBeat=1, StartTradeWatch, StopTradeWatch };
+  enum class EMessageId { HeartBeat=1, StartTradeWatch, StopTradeWatch, StartBookWatch, StopBookWatch };
 
   // Resolver and socket require an io_context
-  explicit web_socket( asio::io_context&, ssl::context& );
+  explicit web_socket( asio::io_context&, ssl::context& ); // tls
+  explicit web_socket( asio::io_context& ); // plain, for a local stand in (see PhemexReplay)
   virtual ~web_socket();
 
   using fConnected_t = std::function<void(bool)>;
@@ -75,8 +78,17 @@ public:
   void StartTradeWatch( const std::string& );
   void StopTradeWatch( const std::string& );
 
+  // orderbook.subscribe: a snapshot, then incrementals, subscribing again returns a fresh snapshot
+  void StartBookWatch( const std::string& );
+  void StopBookWatch( const std::string& );
+
+  void record( const std::string& sFileName ); // frames as received, one per line, for PhemexReplay
+
 private:
 
+  using ws_t = websocket::stream<beast::tcp_stream>;
+  using wss_t = websocket::stream<beast::ssl_stream<beast::tcp_stream>>;
+
   bool m_bConnected;
   std::atomic_uint64_t m_id; // used for incrementing message id in messages
 
@@ -84,19 +96,30 @@ private:
   boost::asio::deadline_timer m_timer;
 
   asio::io_context& m_srvc;
-  asio::io_context::strand m_strand;
+  asio::strand<asio::io_context::executor_type> m_strand; // shared by the resolver, the stream and writes
 
   tcp::resolver m_resolver;
-  websocket::stream<
-    beast::ssl_stream<beast::tcp_stream>> m_ws;
+  std::unique_ptr<ws_t> m_pws;
+  std::unique_ptr<wss_t> m_pwss;
   beast::flat_buffer m_buffer;
 
+  using queueWrite_t = std::deque<std::string>;
+  queueWrite_t m_queueWrite; // beast allows one write outstanding at a time
+
+  std::ofstream m_ofsRecord;
+
   std::string m_host;
 
   fConnected_t m_fConnected;
   fDisconnected_t m_fDisconnected;
   fMessage_t m_fMessage;
 
+  template<typename F>
+  void with_ws( F&& f ) {
+    if ( m_pwss ) f( *m_pwss );
+    else f( *m_pws );
+  }
+
   void on_resolve(
     beast::error_code ec,
     tcp::resolver::results_type results
@@ -105,23 +128,19 @@ private:
   void on_connect(beast::error_code, tcp::resolver::results_type::endpoint_type );
 
   void on_ssl_handshake( beast::error_code );
+  void ws_handshake();
   void on_handshake( beast::error_code );
 
   void on_timer( const boost::system::error_code& );
-  void on_write_heart_beat(
-    beast::error_code,
-    std::size_t bytes_transferred
-  );
 
-  void on_write_subscribe_trade(
+  void send( std::string&& ); // queued on the strand
+  void write();
+  void on_write(
     beast::error_code,
     std::size_t bytes_transferred
   );
 
-  void on_write_un_subscribe_trade(
-    beast::error_code,
-    std::size_t bytes_transferred
-  );
+  void method( EMessageId, const char* szMethod, const std::string& sSymbol );
 
   // m_fConnected call back on completion - needs positive & negative calc
   void on_write_auth(
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <algorithm>
 #include <stdexcept>
 
 #include <OUCommon/FastDelegate.h>
@@ -23,10 +25,13 @@ using namespace fastdelegate;
 
 #include <TFTimeSeries/TimeSeries.h>
 
-// Each carrier holds a TimeSeries.  The carrier holds an index to the current DatedDatum in each TimeSeries.
-// The current DatedDatum timestamp is maintained for the merge process to figure out which DatedDatum to
+// Each carrier holds a TimeSeries.  The carrier holds an iterator to the current DatedDatum in each TimeSeries.
+// The current DatedDatum timestamp is cached as an int64 key for the merge process to figure out which DatedDatum to
 // send into the merge process
 
+// 2026/10/19 carriers drain a run of datums in one call, bounded by the key of the runner up in the merge,
+//   so consecutive datums from the same series do not touch the merge structure
+
 namespace ou { // One Unified
 namespace tf { // TradeFrame
 
@@ -35,26 +40,37 @@ namespace tf { // TradeFrame
 class MergeCarrierBase {
   friend class MergeDatedDatums;
 public:
+
+  using key_t = std::int64_t;
   using OnDatumHandler = FastDelegate1<const DatedDatum &>;
-  MergeCarrierBase() {};
+
+  MergeCarrierBase(): m_key( KeyExhausted() ) {};
   virtual ~MergeCarrierBase() {};
-  virtual void ProcessDatum()
-    { throw std::runtime_error( "ProcessDatum not defined" ); };
-  virtual void Reset()
-    { throw std::runtime_error( "Reset not defined" ); };
-  inline const ptime &GetDateTime() { return m_dt; };
-  const DatedDatum* GetDatedDatum() const { return m_pDatum; };
-  bool operator<( const MergeCarrierBase& other ) const { return m_dt < other.m_dt; };
-  bool operator<( const MergeCarrierBase* pOther ) const { return m_dt < pOther->m_dt; };
-  static bool lt( MergeCarrierBase* plhs, MergeCarrierBase *prhs ) { return plhs->m_dt < prhs->m_dt; };
+
+  // emits the current datum plus following datums which still order ahead of keyBound, up to nMax,
+  //   bTieWins when this carrier wins an equal key, returns count emitted
+  virtual std::size_t Drain( key_t keyBound, bool bTieWins, std::size_t nMax, bool bSimulationMode ) = 0;
+  virtual void Reset() = 0;
+
+  key_t GetKey() const { return m_key; }
+  bool Exhausted() const { return KeyExhausted() == m_key; }
+  inline bool Ahead( key_t keyBound, bool bTieWins ) const {
+    return ( m_key < keyBound ) || ( bTieWins && ( m_key == keyBound ) && !Exhausted() );
+  }
+
+  static constexpr key_t KeyExhausted() { return std::numeric_limits<key_t>::max(); }
+
+  static key_t Key( const ptime& dt ) {
+    static const ptime epoch( boost::gregorian::date( 1970, 1, 1 ) );
+    return ( dt - epoch ).ticks();
+  }
+
 protected:
-  ptime m_dt;  // datetime of datum to be merged (used in comparison)
-  const DatedDatum* m_pDatum;
-  OnDatumHandler OnDatum;
+  key_t m_key;  // key of datum to be merged (used in comparison)
 private:
 };
 
-// MergeCarrier
+// MergeCarrier: one delegate call per datum
 
 template<class T> // T is a DatedDatum type
 class MergeCarrier: public MergeCarrierBase {
@@ -62,23 +78,26 @@ class MergeCarrier: public MergeCarrierBase {
 public:
   MergeCarrier<T>( TimeSeries<T>& series, OnDatumHandler function );
   virtual ~MergeCarrier<T>();
-  void ProcessDatum();
-  void Reset();
+  std::size_t Drain( key_t keyBound, bool bTieWins, std::size_t nMax, bool bSimulationMode ) override;
+  void Reset() override;
 protected:
+  using const_iterator = typename TimeSeries<T>::const_iterator;
   TimeSeries<T>& m_series;  // series from which a datum is to be merged to output
+  const_iterator m_iter;
+  const_iterator m_end; // series is not appended to while merging
+  void Load() {
+    m_key = ( m_end == m_iter ) ? KeyExhausted() : Key( m_iter->DateTime() );
+  }
 private:
+  OnDatumHandler OnDatum;
 };
 
 template<class T>
 MergeCarrier<T>::MergeCarrier( TimeSeries<T>& series, OnDatumHandler function )
-  : MergeCarrierBase(), m_series( series )
+  : MergeCarrierBase(), m_series( series ), OnDatum( function )
 {
   assert( 0 != m_series.Size() );
-  OnDatum = function;
-  m_pDatum = m_series.First();  // preload with first datum so we have it's time available for comparison
-  m_dt = ( 0 == m_pDatum )
-    ? boost::date_time::special_values::not_a_date_time
-    : m_pDatum->DateTime();
+  Reset();  // preload with first datum so we have it's time available for comparison
 }
 
 template<class T>
@@ -86,24 +105,66 @@ MergeCarrier<T>::~MergeCarrier() {
 }
 
 template<class T>
-void MergeCarrier<T>::ProcessDatum() {
-  if ( ou::TimeSource::LocalCommonInstance().GetSimulationMode() ) {
-    ou::TimeSource::LocalCommonInstance().SetSimulationTime( m_pDatum->DateTime() );
-  }
-  if ( nullptr != OnDatum )
-    OnDatum( *m_pDatum );
-  m_pDatum = m_series.Next();
-  m_dt = ( nullptr == m_pDatum )
-    ? boost::date_time::special_values::not_a_date_time
-    : m_pDatum->DateTime();
+std::size_t MergeCarrier<T>::Drain( key_t keyBound, bool bTieWins, std::size_t nMax, bool bSimulationMode ) {
+  std::size_t nEmitted {};
+  do {
+    const T& datum( *m_iter );
+    if ( bSimulationMode ) {
+      ou::TimeSource::LocalCommonInstance().SetSimulationTime( datum.DateTime() );
+    }
+    if ( nullptr != OnDatum ) OnDatum( datum );
+    ++nEmitted;
+    ++m_iter;
+    Load();
+  } while ( ( nEmitted < nMax ) && Ahead( keyBound, bTieWins ) );
+  return nEmitted;
 }
 
 template<class T>
 void MergeCarrier<T>::Reset() {
-  m_pDatum = m_series.First();  // preload with first datum so we have it's time available for comparison
-  m_dt = ( 0 == m_pDatum )
-    ? boost::date_time::special_values::not_a_date_time
-    : m_pDatum->DateTime();
+  m_iter = m_series.begin();
+  m_end = m_series.end();
+  Load();
+}
+
+// MergeCarrierBatch: one delegate call per run of consecutive datums
+//   the run is contiguous in memory, so stops at the end of a block of the series, the merge then drains the next block,
+//   simulation time is set to the first datum of the run,
+//   the handler uses datum.DateTime() if it needs the time of later datums
+
+template<class T> // T is a DatedDatum type
+class MergeCarrierBatch: public MergeCarrier<T> {
+  friend class MergeDatedDatums;
+public:
+  using OnBatchHandler = FastDelegate2<const T*, std::size_t>; // first datum, count
+  MergeCarrierBatch<T>( TimeSeries<T>& series, OnBatchHandler function );
+  virtual ~MergeCarrierBatch<T>() {}
+  std::size_t Drain( MergeCarrierBase::key_t keyBound, bool bTieWins, std::size_t nMax, bool bSimulationMode ) override;
+protected:
+private:
+  OnBatchHandler OnBatch;
+};
+
+template<class T>
+MergeCarrierBatch<T>::MergeCarrierBatch( TimeSeries<T>& series, OnBatchHandler function )
+  : MergeCarrier<T>( series, nullptr ), OnBatch( function )
+{}
+
+template<class T>
+std::size_t MergeCarrierBatch<T>::Drain( MergeCarrierBase::key_t keyBound, bool bTieWins, std::size_t nMax, bool bSimulationMode ) {
+  const T* pFirst( &(*this->m_iter) );
+  nMax = std::min( nMax, this->m_series.Contiguous( this->m_iter ) );
+  if ( bSimulationMode ) {
+    ou::TimeSource::LocalCommonInstance().SetSimulationTime( pFirst->DateTime() );
+  }
+  std::size_t nEmitted {};
+  do {
+    ++nEmitted;
+    ++this->m_iter;
+    this->Load();
+  } while ( ( nEmitted < nMax ) && this->Ahead( keyBound, bTieWins ) );
+  if ( nullptr != OnBatch ) OnBatch( pFirst, nEmitted );
+  return nEmitted;
 }
 
 } // namespace tf
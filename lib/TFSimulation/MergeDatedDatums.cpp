@@ -12,6 +12,8 @@
  * See the file LICENSE.txt for redistribution information.             *
  ************************************************************************/
 
+#include <limits>
+
 #include "MergeDatedDatums.h"
 
 namespace ou { // One Unified
@@ -23,38 +25,36 @@ namespace tf { // TradeFrame
 
 MergeDatedDatums::MergeDatedDatums()
 : m_state( eInit ), m_request( eUnknown )
+, m_cntProcessedDatums( 0 ), m_cntReplays( 0 )
 {
 }
 
 MergeDatedDatums::~MergeDatedDatums() {
-  while ( !m_mhCarriers.Empty() ) {
-    MergeCarrierBase *p = m_mhCarriers.RemoveEnd();
-    delete p;
-  }
+  m_vCarriers.clear();
 }
 
 void MergeDatedDatums::Add( TimeSeries<Quote>& series, MergeDatedDatums::OnDatumHandler function ) {
-  m_mhCarriers.Append( new MergeCarrier<Quote>( series, function ) );
+  m_vCarriers.emplace_back( std::make_unique<MergeCarrier<Quote>>( series, function ) );
 }
 
 void MergeDatedDatums::Add( TimeSeries<Trade>& series, MergeDatedDatums::OnDatumHandler function ) {
-  m_mhCarriers.Append( new MergeCarrier<Trade>( series, function ) );
+  m_vCarriers.emplace_back( std::make_unique<MergeCarrier<Trade>>( series, function ) );
 }
 
 void MergeDatedDatums::Add( TimeSeries<Bar>& series, MergeDatedDatums::OnDatumHandler function ) {
-  m_mhCarriers.Append( new MergeCarrier<Bar>( series, function ) );
+  m_vCarriers.emplace_back( std::make_unique<MergeCarrier<Bar>>( series, function ) );
 }
 
 void MergeDatedDatums::Add( TimeSeries<Greek>& series, MergeDatedDatums::OnDatumHandler function ) {
-  m_mhCarriers.Append( new MergeCarrier<Greek>( series, function ) );
+  m_vCarriers.emplace_back( std::make_unique<MergeCarrier<Greek>>( series, function ) );
 }
 
 void MergeDatedDatums::Add( TimeSeries<DepthByMM>& series, MergeDatedDatums::OnDatumHandler function ) {
-  m_mhCarriers.Append( new MergeCarrier<DepthByMM>( series, function ) );
+  m_vCarriers.emplace_back( std::make_unique<MergeCarrier<DepthByMM>>( series, function ) );
 }
 
 void MergeDatedDatums::Add( TimeSeries<DepthByOrder>& series, MergeDatedDatums::OnDatumHandler function ) {
-  m_mhCarriers.Append( new MergeCarrier<DepthByOrder>( series, function ) );
+  m_vCarriers.emplace_back( std::make_unique<MergeCarrier<DepthByOrder>>( series, function ) );
 }
 
 // http://www.codeguru.com/forum/archive/index.php/t-344661.html
@@ -72,28 +72,42 @@ protected:
 // be aware that this maybe running in alternate thread
 // the thread is not created in this class
 void MergeDatedDatums::Run() {
+
+  // bounds a drained run so Stop() remains responsive when few carriers remain
+  static const std::size_t nMaxRun( 4096 );
+
   m_request = eRun;
-  size_t cntCarriers = m_mhCarriers.Size();
-//  LOG << "#carriers: " << cntCarriers;  // need cross thread writing
-  MergeCarrierBase* pCarrier = nullptr;
+
+  m_tree.Reset( m_vCarriers.size() );
+  for ( std::size_t ix = 0; ix < m_vCarriers.size(); ++ix ) {
+    m_tree.SetKey( ix, m_vCarriers[ ix ]->GetKey() );
+  }
+  m_tree.Build();
+
+  const bool bSimulationMode( ou::TimeSource::LocalCommonInstance().GetSimulationMode() );
+
+  MergeCarrierBase::key_t keyBound;
+  bool bTieWins;
+
   m_cntProcessedDatums = 0;
+  m_cntReplays = 0;
   m_state = eRunning;
-  while ( ( 0 != cntCarriers ) && ( eRun == m_request ) ) {  // once all series have been depleted, end of run
-    pCarrier = m_mhCarriers.GetRoot();
-    pCarrier->ProcessDatum();  // automatically loads next datum when done
-    ++m_cntProcessedDatums;
-    if ( nullptr == pCarrier->GetDatedDatum() ) {
-      // retire the consumed carrier
-      m_mhCarriers.ArchiveRoot();
-      --cntCarriers;
+  while ( !m_tree.Empty() && ( eRun == m_request ) ) {  // once all series have been depleted, end of run
+    MergeCarrierBase& carrier( *m_vCarriers[ m_tree.Winner() ] );
+    // the runner up is known once a carrier has won twice in succession, ie, a run is forming,
+    //   otherwise one datum is emitted
+    if ( m_tree.Running() ) {
+      m_tree.Bound( keyBound, bTieWins );
     }
     else {
-      // reorder the carriers
-      m_mhCarriers.SiftDown();
+      keyBound = std::numeric_limits<MergeCarrierBase::key_t>::min();
+      bTieWins = false;
     }
+    m_cntProcessedDatums += carrier.Drain( keyBound, bTieWins, nMaxRun, bSimulationMode );  // automatically loads next datum when done
+    m_tree.Replay( carrier.GetKey() ); // exhausted carriers sink out of contention
+    ++m_cntReplays;
   }
   m_state = eStopped;
-//  LOG << "Merge stats: " << m_cntProcessedDatums << ", " << m_cntReorders;
 }
 
 void MergeDatedDatums::Stop() {
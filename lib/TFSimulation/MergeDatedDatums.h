@@ -15,9 +15,11 @@
 #pragma once
 
 #include <vector>
+#include <memory>
 
 // 2012/08/12 could try using std:priority_queue instead or boost::max_heap
-#include <OUCommon/MinHeap.h>
+// 2026/10/19 replaced CMinHeap with a loser tree on int64 keys, carriers drain runs between replays
+#include <OUCommon/LoserTree.h>
 
 #include <OUCommon/FastDelegate.h>
 using namespace fastdelegate;
@@ -45,16 +47,28 @@ public:
   void Add( TimeSeries<Greek>& series, OnDatumHandler );
   void Add( TimeSeries<DepthByMM>& series, OnDatumHandler );
   void Add( TimeSeries<DepthByOrder>& series, OnDatumHandler );
+
+  // typed delivery: one call per run of consecutive datums from the series
+  template<typename T>
+  void AddBatch( TimeSeries<T>& series, typename MergeCarrierBatch<T>::OnBatchHandler function ) {
+    m_vCarriers.emplace_back( std::make_unique<MergeCarrierBatch<T> >( series, function ) );
+  }
+
   void Run();
   void Stop();
 
   enumMergingState GetState() const { return m_state; };
 
   unsigned long GetCountProcessedDatums() const { return m_cntProcessedDatums; };
+  unsigned long GetCountReplays() const { return m_cntReplays; }; // tree replays, ie runs drained
 
 protected:
 
-  ou::CMinHeap<MergeCarrierBase*, MergeCarrierBase> m_mhCarriers;
+  using pMergeCarrierBase_t = std::unique_ptr<MergeCarrierBase>;
+  using vCarriers_t = std::vector<pMergeCarrierBase_t>;
+  vCarriers_t m_vCarriers; // index is the source index in m_tree
+
+  ou::LoserTree m_tree;
 
   // not all states or commands are implemented yet
   enum enumMergingCommands { eUnknown, eRun, eStop, ePause, eResume, eReset };
@@ -63,6 +77,7 @@ protected:
   enumMergingCommands m_request;
 
   unsigned long m_cntProcessedDatums;
+  unsigned long m_cntReplays;
 
 private:
 
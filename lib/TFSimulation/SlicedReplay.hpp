@@ -0,0 +1,282 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    SlicedReplay.hpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFSimulation
+ * Created: October 19, 2026 13:40
+ */
+
+#pragma once
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+
+#include <TFTimeSeries/TimeSeries.h>
+
+// Research replay of a series for indicator outputs only, no orders, no SimulationProvider.
+//   The series is split into slices of about equal datum count, one worker thread per core.
+//   Each slice builds its own indicators against its own copy of the series, starts replay early enough
+//   for the indicators to be populated (the warm-up), and keeps only the outputs stamped within the slice.
+//   Slice outputs are then stitched back in order into the result series.
+
+// Indicators declare the history they need with WarmUp() (a time_duration) and optionally
+//   WarmUpCount() (a number of datums), see TimeSeriesSlidingWindow and TSEMA.  The build function
+//   passes each indicator to Slice::Require, the build function is run once on an empty series
+//   to collect those requirements before the slices are laid out.
+
+// Outputs match a sequential replay once the warm-up spans the indicator's memory.  Running sums
+//   accumulate in a different order, so may differ in the last bits.  Outputs relative to the first
+//   datum of the series (eg TSSWStats Offset) are relative to the start of the warm-up instead.
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+namespace replay {
+
+  template<typename I, typename = void>
+  struct has_warm_up_count: std::false_type {};
+
+  template<typename I>
+  struct has_warm_up_count<I, std::void_t<decltype( std::declval<const I&>().WarmUpCount() )> >: std::true_type {};
+
+} // namespace replay
+
+// I: replayed series, O: result series, either TimeSeries<datum> or the named series, eg Quotes, Prices
+template<typename I, typename O>
+class SlicedReplay {
+public:
+
+  using Input = I;
+  using Output = O;
+
+  using D = typename Input::datum_t;
+  using R = typename Output::datum_t;
+
+  class Slice {
+    friend class SlicedReplay<I,O>;
+  public:
+
+    std::size_t Index() const { return m_ix; }
+
+    const ptime& WarmUp() const { return m_dtWarmUp; } // first datum replayed
+    const ptime& Begin() const { return m_dtBegin; }   // first output kept
+    const ptime& End() const { return m_dtEnd; }       // outputs kept up to, not including
+
+    bool Keep( const ptime& dt ) const { return ( m_dtBegin <= dt ) && ( dt < m_dtEnd ); }
+
+    void Require( const time_duration& td ) { m_tdWarmUp = std::max( m_tdWarmUp, td ); }
+    void Require( std::size_t nDatums ) { m_nWarmUp = std::max( m_nWarmUp, nDatums ); }
+
+    template<typename Indicator>
+    void Require( const Indicator& indicator ) {
+      Require( indicator.WarmUp() );
+      if constexpr ( replay::has_warm_up_count<Indicator>::value ) {
+        Require( (std::size_t)indicator.WarmUpCount() );
+      }
+    }
+
+  protected:
+  private:
+
+    std::size_t m_ix;
+
+    std::size_t m_ixWarmUp;
+    std::size_t m_ixBegin;
+    std::size_t m_ixEnd;
+
+    ptime m_dtWarmUp;
+    ptime m_dtBegin;
+    ptime m_dtEnd;
+
+    time_duration m_tdWarmUp;
+    std::size_t m_nWarmUp;
+
+    Slice()
+    : m_ix {}, m_ixWarmUp {}, m_ixBegin {}, m_ixEnd {}
+    , m_dtWarmUp( boost::posix_time::neg_infin ), m_dtBegin( boost::posix_time::neg_infin ), m_dtEnd( boost::posix_time::pos_infin )
+    , m_tdWarmUp {}, m_nWarmUp {}
+    {}
+  };
+
+  // called on the slice's worker thread, once per slice:
+  //   construct indicators against input, pass each to slice.Require, wire their outputs to append to output,
+  //   return whatever holds the indicators, it is released once the slice has been replayed
+  using fBuild_t = std::function<std::shared_ptr<void>( Slice&, Input& input, Output& output )>;
+
+  SlicedReplay()
+  : m_tdWarmUp {}, m_nWarmUp {}
+  , m_cntReplayed {}
+  {}
+
+  // extra warm-up beyond what the indicators declare
+  void Require( const time_duration& td ) { m_tdWarmUp = std::max( m_tdWarmUp, td ); }
+  void Require( std::size_t nDatums ) { m_nWarmUp = std::max( m_nWarmUp, nDatums ); }
+
+  // nSlices = 0 uses one slice per core
+  void Run( const Input& source, Output& result, const fBuild_t& fBuild, std::size_t nSlices = 0 );
+
+  time_duration WarmUp() const { return m_tdWarmUp; }
+  std::size_t WarmUpCount() const { return m_nWarmUp; }
+
+  const std::vector<Slice>& Slices() const { return m_vSlice; }
+
+  // datums appended across all slices, includes the warm-up overlap
+  std::size_t GetCountReplayed() const { return m_cntReplayed; }
+
+protected:
+private:
+
+  time_duration m_tdWarmUp;
+  std::size_t m_nWarmUp;
+
+  std::vector<Slice> m_vSlice;
+
+  std::size_t m_cntReplayed;
+
+  void Layout( const Input& source, std::size_t nSlices );
+};
+
+template<typename I, typename O>
+void SlicedReplay<I,O>::Run( const Input& source, Output& result, const fBuild_t& fBuild, std::size_t nSlices ) {
+
+  m_vSlice.clear();
+  m_cntReplayed = 0;
+
+  if ( 0 == source.Size() ) return;
+
+  { // collect the declared warm-up from a build on an empty series
+    Slice probe;
+    Input input;
+    Output output;
+    std::shared_ptr<void> p = fBuild( probe, input, output );
+    Require( probe.m_tdWarmUp );
+    Require( probe.m_nWarmUp );
+  }
+
+  const std::size_t nThreads = std::max<std::size_t>( 1, std::thread::hardware_concurrency() );
+  if ( 0 == nSlices ) nSlices = nThreads;
+
+  Layout( source, nSlices );
+
+  std::vector<std::vector<R> > vKept( m_vSlice.size() );
+
+  std::atomic<std::size_t> ixNext( 0 );
+  std::mutex mutexBuild; // fBuild may touch shared state in the caller
+
+  auto fWorker = [this,&source,&fBuild,&vKept,&ixNext,&mutexBuild](){
+    std::size_t ix;
+    while ( ( ix = ixNext.fetch_add( 1 ) ) < m_vSlice.size() ) {
+      Slice& slice( m_vSlice[ ix ] );
+
+      Input input( slice.m_ixEnd - slice.m_ixWarmUp );
+      Output output;
+      std::shared_ptr<void> p;
+      {
+        std::lock_guard<std::mutex> lock( mutexBuild );
+        p = fBuild( slice, input, output );
+      }
+
+      for (
+        typename Input::const_iterator iter = source.at( slice.m_ixWarmUp );
+        iter != source.begin() + slice.m_ixEnd;
+        ++iter
+      ) {
+        input.Append( *iter );
+      }
+
+      p.reset(); // indicators detach from input
+
+      std::vector<R>& vR( vKept[ ix ] );
+      vR.reserve( output.Size() );
+      output.ForEach( [&slice,&vR]( const R& r ){
+        if ( slice.Keep( r.DateTime() ) ) vR.emplace_back( r );
+      } );
+    }
+  };
+
+  std::vector<std::thread> vThread;
+  const std::size_t nWorkers = std::min( nThreads, m_vSlice.size() );
+  for ( std::size_t n = 0; n < nWorkers; ++n ) {
+    vThread.emplace_back( fWorker );
+  }
+  for ( std::thread& thread: vThread ) {
+    thread.join();
+  }
+
+  for ( std::size_t ix = 0; ix < m_vSlice.size(); ++ix ) {
+    const Slice& slice( m_vSlice[ ix ] );
+    m_cntReplayed += slice.m_ixEnd - slice.m_ixWarmUp;
+    for ( const R& r: vKept[ ix ] ) {
+      result.Append( r );
+    }
+  }
+}
+
+template<typename I, typename O>
+void SlicedReplay<I,O>::Layout( const Input& source, std::size_t nSlices ) {
+
+  const std::size_t nDatums( source.Size() );
+  nSlices = std::max<std::size_t>( 1, std::min( nSlices, nDatums ) );
+
+  // boundaries by datum count, moved forward off of duplicate time stamps so a time belongs to one slice
+  std::vector<std::size_t> vBoundary;
+  vBoundary.emplace_back( 0 );
+  for ( std::size_t n = 1; n < nSlices; ++n ) {
+    std::size_t ix = std::max( vBoundary.back() + 1, ( n * nDatums ) / nSlices );
+    while ( ( ix < nDatums ) && ( source.at( ix )->DateTime() == source.at( ix - 1 )->DateTime() ) ) {
+      ++ix;
+    }
+    if ( nDatums <= ix ) break;
+    vBoundary.emplace_back( ix );
+  }
+  vBoundary.emplace_back( nDatums );
+
+  for ( std::size_t n = 0; ( n + 1 ) < vBoundary.size(); ++n ) {
+    Slice slice;
+    slice.m_ix = n;
+    slice.m_ixBegin = vBoundary[ n ];
+    slice.m_ixEnd = vBoundary[ n + 1 ];
+    if ( 0 == n ) {
+      slice.m_ixWarmUp = 0;
+    }
+    else {
+      slice.m_dtBegin = source.at( slice.m_ixBegin )->DateTime();
+      const D key( slice.m_dtBegin - m_tdWarmUp );
+      const std::size_t ixByTime
+        = std::lower_bound( source.begin(), source.begin() + slice.m_ixBegin, key ) - source.begin();
+      const std::size_t ixByCount
+        = ( m_nWarmUp < slice.m_ixBegin ) ? ( slice.m_ixBegin - m_nWarmUp ) : 0;
+      slice.m_ixWarmUp = std::min( ixByTime, ixByCount );
+    }
+    slice.m_dtWarmUp = source.at( slice.m_ixWarmUp )->DateTime();
+    if ( nDatums != slice.m_ixEnd ) {
+      slice.m_dtEnd = source.at( slice.m_ixEnd )->DateTime();
+    }
+    slice.m_tdWarmUp = m_tdWarmUp;
+    slice.m_nWarmUp = m_nWarmUp;
+    m_vSlice.emplace_back( slice );
+  }
+}
+
+} // namespace tf
+} // namespace ou
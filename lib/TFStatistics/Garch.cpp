@@ -0,0 +1,415 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Garch.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFStatistics
+ * Created: October 20, 2026 05:00
+ */
+
+#include <cmath>
+#include <array>
+#include <atomic>
+#include <limits>
+#include <thread>
+#include <numeric>
+#include <algorithm>
+
+#include "Garch.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace statistics {
+namespace garch {
+
+namespace {
+
+  const double c_dblLog2Pi( std::log( 2.0 * M_PI ) );
+  const double c_dblAbsZ( std::sqrt( 2.0 / M_PI ) ); // E|z| of the standard normal
+  const double c_dblLogVarianceLimit( 50.0 ); // EGARCH beyond this has blown up
+
+  const std::size_t c_nMinimumObservations( 10 );
+  const std::size_t c_nMaximumEvaluations( 4000 ); // per Nelder-Mead pass
+  const double c_dblTolerance( 1e-10 );
+
+  double Logistic( double x ) { return 1.0 / ( 1.0 + std::exp( -x ) ); }
+  double Logit( double p ) { return std::log( p / ( 1.0 - p ) ); }
+
+  void Moments( const double* pReturn, std::size_t n, double& dblMean, double& dblVariance ) {
+    dblMean = std::accumulate( pReturn, pReturn + n, 0.0 ) / n;
+    double dblSum {};
+    for ( std::size_t ix = 0; ix < n; ++ix ) {
+      const double d( pReturn[ ix ] - dblMean );
+      dblSum += d * d;
+    }
+    dblVariance = dblSum / n;
+  }
+
+  // -inf when the variance leaves the representable range
+  double Likelihood(
+    const double* pReturn, std::size_t n, EModel eModel, const Parameters& p,
+    double dblVariance, double* pdblVariance
+  ) {
+    double dblSum {}; // sum of ln s2 + e^2 / s2
+    switch ( eModel ) {
+      case EModel::Garch:
+        for ( std::size_t ix = 0; ix < n; ++ix ) {
+          const double e( pReturn[ ix ] - p.mu );
+          const double e2( e * e );
+          dblSum += std::log( dblVariance ) + e2 / dblVariance;
+          dblVariance = p.omega + p.alpha * e2 + p.beta * dblVariance;
+        }
+        break;
+      case EModel::EGarch: {
+          double dblLogVariance( std::log( dblVariance ) );
+          for ( std::size_t ix = 0; ix < n; ++ix ) {
+            const double z( ( pReturn[ ix ] - p.mu ) * std::exp( -0.5 * dblLogVariance ) );
+            dblSum += dblLogVariance + z * z;
+            dblLogVariance = p.omega + p.alpha * ( std::abs( z ) - c_dblAbsZ ) + p.gamma * z + p.beta * dblLogVariance;
+            if ( !( c_dblLogVarianceLimit > std::abs( dblLogVariance ) ) ) {
+              return -std::numeric_limits<double>::infinity();
+            }
+          }
+          dblVariance = std::exp( dblLogVariance );
+        }
+        break;
+    }
+    if ( nullptr != pdblVariance ) *pdblVariance = dblVariance;
+    const double dblLikelihood( -0.5 * ( n * c_dblLog2Pi + dblSum ) );
+    return std::isfinite( dblLikelihood ) ? dblLikelihood : -std::numeric_limits<double>::infinity();
+  }
+
+  // the unconstrained search space
+  const std::size_t c_nMaxDimension( 5 );
+  using vector_t = std::array<double,c_nMaxDimension>;
+
+  std::size_t Dimension( EModel eModel ) { return ( EModel::Garch == eModel ) ? 4 : 5; }
+
+  Parameters ToParameters( EModel eModel, const vector_t& x ) {
+    Parameters p;
+    p.mu = x[ 0 ];
+    switch ( eModel ) {
+      case EModel::Garch: {
+          p.omega = std::exp( x[ 1 ] );
+          const double dblPersistence( Logistic( x[ 2 ] ) );
+          const double dblShare( Logistic( x[ 3 ] ) );
+          p.alpha = dblPersistence * dblShare;
+          p.beta = dblPersistence * ( 1.0 - dblShare );
+        }
+        break;
+      case EModel::EGarch:
+        p.omega = x[ 1 ];
+        p.alpha = x[ 2 ];
+        p.gamma = x[ 3 ];
+        p.beta = std::tanh( x[ 4 ] );
+        break;
+    }
+    return p;
+  }
+
+  // starting point, for returns of unit variance
+  vector_t Start( EModel eModel, double dblMean ) {
+    vector_t x {};
+    x[ 0 ] = dblMean;
+    switch ( eModel ) {
+      case EModel::Garch: // alpha 0.05, beta 0.90
+        x[ 1 ] = std::log( 0.05 );
+        x[ 2 ] = Logit( 0.95 );
+        x[ 3 ] = Logit( 0.05 / 0.95 );
+        break;
+      case EModel::EGarch: // alpha 0.1, gamma -0.05, beta 0.95
+        x[ 1 ] = 0.0;
+        x[ 2 ] = 0.1;
+        x[ 3 ] = -0.05;
+        x[ 4 ] = std::atanh( 0.95 );
+        break;
+    }
+    return x;
+  }
+
+  struct Minimum {
+    vector_t x;
+    double f;
+    std::size_t nEvaluations;
+    bool bConverged;
+  };
+
+  // Nelder-Mead, standard coefficients, the simplex from steps along each axis
+  template<typename F>
+  Minimum NelderMead( F&& f, std::size_t nDimension, const vector_t& xStart, double dblStep ) {
+
+    const std::size_t nVertex( nDimension + 1 );
+    std::array<vector_t,c_nMaxDimension + 1> rx;
+    std::array<double,c_nMaxDimension + 1> rf;
+
+    Minimum minimum { xStart, 0.0, 0, false };
+
+    auto evaluate = [&f,&minimum]( const vector_t& x )->double {
+      ++minimum.nEvaluations;
+      return f( x );
+    };
+
+    for ( std::size_t ix = 0; ix < nVertex; ++ix ) {
+      rx[ ix ] = xStart;
+      if ( 0 < ix ) rx[ ix ][ ix - 1 ] += dblStep;
+      rf[ ix ] = evaluate( rx[ ix ] );
+    }
+
+    std::array<std::size_t,c_nMaxDimension + 1> rix;
+    auto combine = [nDimension]( const vector_t& a, const vector_t& b, double t )->vector_t { // a + t * ( b - a )
+      vector_t x {};
+      for ( std::size_t ix = 0; ix < nDimension; ++ix ) x[ ix ] = a[ ix ] + t * ( b[ ix ] - a[ ix ] );
+      return x;
+    };
+
+    while ( c_nMaximumEvaluations > minimum.nEvaluations ) {
+
+      std::iota( rix.begin(), rix.begin() + nVertex, 0 );
+      std::sort( rix.begin(), rix.begin() + nVertex, [&rf]( std::size_t a, std::size_t b ){ return rf[ a ] < rf[ b ]; } );
+      const std::size_t ixBest( rix[ 0 ] );
+      const std::size_t ixWorst( rix[ nDimension ] );
+      const std::size_t ixNext( rix[ nDimension - 1 ] ); // second worst
+
+      if ( ( rf[ ixWorst ] - rf[ ixBest ] ) <= c_dblTolerance * ( std::abs( rf[ ixBest ] ) + c_dblTolerance ) ) {
+        minimum.bConverged = true;
+        break;
+      }
+
+      vector_t centroid {};
+      for ( std::size_t ix = 0; ix < nVertex; ++ix ) {
+        if ( ixWorst != ix ) {
+          for ( std::size_t ixD = 0; ixD < nDimension; ++ixD ) centroid[ ixD ] += rx[ ix ][ ixD ];
+        }
+      }
+      for ( std::size_t ixD = 0; ixD < nDimension; ++ixD ) centroid[ ixD ] /= nDimension;
+
+      const vector_t xReflect( combine( centroid, rx[ ixWorst ], -1.0 ) );
+      const double fReflect( evaluate( xReflect ) );
+
+      if ( fReflect < rf[ ixBest ] ) {
+        const vector_t xExpand( combine( centroid, rx[ ixWorst ], -2.0 ) );
+        const double fExpand( evaluate( xExpand ) );
+        if ( fExpand < fReflect ) {
+          rx[ ixWorst ] = xExpand;
+          rf[ ixWorst ] = fExpand;
+        }
+        else {
+          rx[ ixWorst ] = xReflect;
+          rf[ ixWorst ] = fReflect;
+        }
+        continue;
+      }
+
+      if ( fReflect < rf[ ixNext ] ) {
+        rx[ ixWorst ] = xReflect;
+        rf[ ixWorst ] = fReflect;
+        continue;
+      }
+
+      const bool bOutside( fReflect < rf[ ixWorst ] );
+      const vector_t xContract( bOutside ? combine( centroid, xReflect, 0.5 ) : combine( centroid, rx[ ixWorst ], 0.5 ) );
+      const double fContract( evaluate( xContract ) );
+      if ( fContract < std::min( fReflect, rf[ ixWorst ] ) ) {
+        rx[ ixWorst ] = xContract;
+        rf[ ixWorst ] = fContract;
+        continue;
+      }
+
+      // shrink toward the best
+      for ( std::size_t ix = 0; ix < nVertex; ++ix ) {
+        if ( ixBest != ix ) {
+          rx[ ix ] = combine( rx[ ixBest ], rx[ ix ], 0.5 );
+          rf[ ix ] = evaluate( rx[ ix ] );
+        }
+      }
+    }
+
+    const std::size_t ixBest( std::min_element( rf.begin(), rf.begin() + nVertex ) - rf.begin() );
+    minimum.x = rx[ ixBest ];
+    minimum.f = rf[ ixBest ];
+    return minimum;
+  }
+
+} // namespace anonymous
+
+double Result::Persistence() const {
+  return ( EModel::Garch == eModel ) ? parameters.alpha + parameters.beta : parameters.beta;
+}
+
+double Result::LongRunVariance() const {
+  const Parameters& p( parameters );
+  return ( EModel::Garch == eModel )
+    ? p.omega / ( 1.0 - p.alpha - p.beta )
+    : std::exp( p.omega / ( 1.0 - p.beta ) );
+}
+
+void Returns( const ou::tf::Bars& bars, vReturn_t& vReturn ) {
+  vReturn.reserve( vReturn.size() + bars.Size() );
+  double dblPrior {};
+  for ( const ou::tf::Bar& bar: bars ) {
+    const double dblClose( bar.Close() );
+    if ( 0.0 < dblClose ) {
+      if ( 0.0 < dblPrior ) vReturn.push_back( std::log( dblClose / dblPrior ) );
+      dblPrior = dblClose;
+    }
+  }
+}
+
+double LogLikelihood( const vReturn_t& vReturn, EModel eModel, const Parameters& parameters, double* pdblVariance ) {
+  if ( vReturn.empty() ) return 0.0;
+  double dblMean, dblVariance;
+  Moments( vReturn.data(), vReturn.size(), dblMean, dblVariance );
+  return Likelihood( vReturn.data(), vReturn.size(), eModel, parameters, dblVariance, pdblVariance );
+}
+
+Result Fit( const vReturn_t& vReturn, EModel eModel ) {
+
+  Result result;
+  result.eModel = eModel;
+  result.nObservations = vReturn.size();
+  if ( c_nMinimumObservations > vReturn.size() ) return result;
+
+  double dblMean, dblVariance;
+  Moments( vReturn.data(), vReturn.size(), dblMean, dblVariance );
+  if ( !( 0.0 < dblVariance ) ) return result;
+
+  // fit at unit variance, better conditioned, and the same starting point for every series
+  const double dblScale( std::sqrt( dblVariance ) );
+  vReturn_t vScaled( vReturn.size() );
+  std::transform( vReturn.begin(), vReturn.end(), vScaled.begin(), [dblScale]( double r ){ return r / dblScale; } );
+
+  auto objective = [&vScaled,eModel]( const vector_t& x )->double {
+    const double dblLikelihood( Likelihood( vScaled.data(), vScaled.size(), eModel, ToParameters( eModel, x ), 1.0, nullptr ) );
+    return std::isfinite( dblLikelihood ) ? -dblLikelihood : std::numeric_limits<double>::max();
+  };
+
+  const std::size_t nDimension( Dimension( eModel ) );
+  Minimum minimum( NelderMead( objective, nDimension, Start( eModel, dblMean / dblScale ), 0.2 ) );
+  // restart from the minimum found, a collapsed simplex can stall short of the optimum
+  const Minimum restart( NelderMead( objective, nDimension, minimum.x, 0.05 ) );
+  result.nEvaluations = minimum.nEvaluations + restart.nEvaluations;
+  result.bConverged = restart.bConverged;
+  minimum = restart;
+
+  // back to the units of the returns
+  Parameters& p( result.parameters );
+  p = ToParameters( eModel, minimum.x );
+  p.mu *= dblScale;
+  switch ( eModel ) {
+    case EModel::Garch:
+      p.omega *= dblVariance;
+      break;
+    case EModel::EGarch:
+      p.omega += ( 1.0 - p.beta ) * std::log( dblVariance );
+      break;
+  }
+
+  result.dblLogLikelihood = Likelihood( vReturn.data(), vReturn.size(), eModel, p, dblVariance, &result.dblVariance );
+  result.bConverged = result.bConverged && std::isfinite( result.dblLogLikelihood );
+
+  return result;
+}
+
+Result Fit( const ou::tf::Bars& bars, EModel eModel ) {
+  vReturn_t vReturn;
+  Returns( bars, vReturn );
+  return Fit( vReturn, eModel );
+}
+
+vResult_t Fit( const std::vector<vReturn_t>& vSeries, EModel eModel, std::size_t nThreads ) {
+
+  vResult_t vResult( vSeries.size() );
+
+  if ( 0 == nThreads ) nThreads = std::max<std::size_t>( 1, std::thread::hardware_concurrency() );
+  nThreads = std::min( nThreads, vSeries.size() );
+
+  std::atomic<std::size_t> ixNext( 0 );
+  auto worker = [&vSeries,&vResult,&ixNext,eModel](){
+    for ( std::size_t ix = ixNext++; ix < vSeries.size(); ix = ixNext++ ) {
+      vResult[ ix ] = Fit( vSeries[ ix ], eModel );
+    }
+  };
+
+  if ( 1 >= nThreads ) worker();
+  else {
+    std::vector<std::thread> vThread;
+    for ( std::size_t ix = 0; ix < nThreads; ++ix ) {
+      vThread.emplace_back( std::thread( worker ) );
+    }
+    for ( std::thread& thread: vThread ) thread.join();
+  }
+
+  return vResult;
+}
+
+// ==== Forecast
+
+Forecast::Forecast( const Result& result )
+: m_eModel( result.eModel )
+, m_parameters( result.parameters )
+, m_dblVariance( result.dblVariance )
+, m_dblClose {}
+{}
+
+void Forecast::Update( double dblReturn ) {
+  const Parameters& p( m_parameters );
+  const double e( dblReturn - p.mu );
+  switch ( m_eModel ) {
+    case EModel::Garch:
+      m_dblVariance = p.omega + p.alpha * e * e + p.beta * m_dblVariance;
+      break;
+    case EModel::EGarch: {
+        const double z( e / std::sqrt( m_dblVariance ) );
+        m_dblVariance = std::exp( p.omega + p.alpha * ( std::abs( z ) - c_dblAbsZ ) + p.gamma * z + p.beta * std::log( m_dblVariance ) );
+      }
+      break;
+  }
+}
+
+void Forecast::Update( const ou::tf::Bar& bar ) {
+  const double dblClose( bar.Close() );
+  if ( 0.0 < dblClose ) {
+    if ( 0.0 < m_dblClose ) Update( std::log( dblClose / m_dblClose ) );
+    m_dblClose = dblClose;
+  }
+}
+
+double Forecast::Volatility() const {
+  return std::sqrt( m_dblVariance );
+}
+
+// GARCH: the expected variance, reverting to the long run at rate alpha + beta
+// EGARCH: ln s2 reverting at rate beta, the expectation of ln s2 rather than of s2, an approximation
+double Forecast::Variance( std::size_t nPeriods ) const {
+  if ( 1 >= nPeriods ) return m_dblVariance;
+  const Parameters& p( m_parameters );
+  switch ( m_eModel ) {
+    case EModel::Garch: {
+        const double dblPersistence( p.alpha + p.beta );
+        const double dblLongRun( p.omega / ( 1.0 - dblPersistence ) );
+        return dblLongRun + std::pow( dblPersistence, nPeriods - 1 ) * ( m_dblVariance - dblLongRun );
+      }
+    case EModel::EGarch: {
+        const double dblLongRun( p.omega / ( 1.0 - p.beta ) );
+        return std::exp( dblLongRun + std::pow( p.beta, nPeriods - 1 ) * ( std::log( m_dblVariance ) - dblLongRun ) );
+      }
+  }
+  return m_dblVariance;
+}
+
+} // namespace garch
+} // namespace statistics
+} // namespace tf
+} // namespace ou
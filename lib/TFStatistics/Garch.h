@@ -0,0 +1,105 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    Garch.h
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFStatistics
+ * Created: October 20, 2026 05:00
+ */
+
+// conditional volatility, fitted by maximum likelihood (gaussian) to a series of returns
+//   GARCH(1,1):  s2[t] = omega + alpha * e[t-1]^2 + beta * s2[t-1]
+//   EGARCH(1,1): ln s2[t] = omega + alpha * ( |z[t-1]| - sqrt(2/pi) ) + gamma * z[t-1] + beta * ln s2[t-1]
+//   with e[t] = r[t] - mu, z[t] = e[t] / s[t], s2 the variance of r[t] conditional on the returns before it
+// the first variance is the sample variance of the series
+// Nelder-Mead over unconstrained transforms, which keep GARCH positive and stationary ( alpha + beta < 1 ),
+//   and EGARCH stationary ( |beta| < 1 ), on returns scaled to unit variance, results are in the units of the returns
+// returns are log close to close from bars, or supplied, per period: parameters and variances are not annualized
+// a universe is fitted a series per thread
+// Forecast carries a fit forward a return at a time, for live use
+
+#pragma once
+
+#include <vector>
+
+#include <TFTimeSeries/TimeSeries.h>
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+namespace statistics {
+namespace garch {
+
+enum class EModel { Garch, EGarch };
+
+struct Parameters {
+  double mu;
+  double omega;
+  double alpha;
+  double beta;
+  double gamma; // EGARCH asymmetry, 0 for GARCH
+  Parameters(): mu {}, omega {}, alpha {}, beta {}, gamma {} {}
+};
+
+struct Result {
+  EModel eModel;
+  Parameters parameters;
+  double dblLogLikelihood;
+  double dblVariance; // for the period after the last return
+  std::size_t nObservations;
+  std::size_t nEvaluations; // of the likelihood
+  bool bConverged; // false also when there are too few returns to fit
+  Result(): eModel( EModel::Garch ), dblLogLikelihood {}, dblVariance {}, nObservations {}, nEvaluations {}, bConverged( false ) {}
+  double Persistence() const; // alpha + beta, or beta for EGARCH
+  double LongRunVariance() const; // for EGARCH, exp of the long run mean of ln s2
+};
+
+using vReturn_t = std::vector<double>;
+using vResult_t = std::vector<Result>;
+
+void Returns( const ou::tf::Bars&, vReturn_t& ); // appends log close to close, skips non positive closes
+
+// the log likelihood at the supplied parameters, pdblVariance receives the variance after the last return
+double LogLikelihood( const vReturn_t&, EModel, const Parameters&, double* pdblVariance = nullptr );
+
+Result Fit( const vReturn_t&, EModel );
+Result Fit( const ou::tf::Bars&, EModel );
+
+// results are in the order of the series, nThreads of 0 uses std::thread::hardware_concurrency
+vResult_t Fit( const std::vector<vReturn_t>&, EModel, std::size_t nThreads = 0 );
+
+class Forecast {
+public:
+
+  Forecast( const Result& );
+
+  void Update( double dblReturn ); // the return for the period just ended
+  void Update( const ou::tf::Bar& ); // the first bar only sets the prior close
+
+  double Variance() const { return m_dblVariance; } // for the coming period
+  double Volatility() const;
+  double Variance( std::size_t nPeriods ) const; // nPeriods ahead, 1 is the coming period
+
+protected:
+private:
+  const EModel m_eModel;
+  const Parameters m_parameters;
+  double m_dblVariance;
+  double m_dblClose; // prior, 0 until the first bar
+};
+
+} // namespace garch
+} // namespace statistics
+} // namespace tf
+} // namespace ou
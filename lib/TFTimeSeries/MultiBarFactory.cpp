@@ -0,0 +1,146 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    MultiBarFactory.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFTimeSeries
+ * Created: October 20, 2026 01:30
+ */
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "MultiBarFactory.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+namespace {
+  inline void Start( Bar& bar, const ptime& dt, Bar::price_t price, Bar::volume_t volume ) {
+    bar.DateTime( dt );
+    bar.Open( price );
+    bar.High( price );
+    bar.Low( price );
+    bar.Close( price );
+    bar.Volume( volume );
+  }
+  inline void Update( Bar& bar, Bar::price_t price, Bar::volume_t volume ) {
+    bar.Close( price );
+    bar.High( std::max( bar.High(), price ) );
+    bar.Low( std::min( bar.Low(), price ) );
+    bar.Volume( bar.Volume() + volume );
+  }
+}
+
+MultiBarFactory::MultiBarFactory( const vWidth_t& vWidth )
+: m_dtLower( boost::posix_time::pos_infin ), m_dtUpper( boost::posix_time::neg_infin ) // forces a Roll on the first trade
+, m_bTime( false )
+{
+  m_vSlot.reserve( vWidth.size() );
+  for ( const Width& width: vWidth ) {
+    if ( 0 == width.n ) {
+      throw std::runtime_error( "MultiBarFactory: width of 0" );
+    }
+    if ( EWidth::Seconds == width.eWidth ) {
+      m_bTime = true;
+    }
+    m_vSlot.emplace_back( Slot( width ) );
+  }
+}
+
+MultiBarFactory::~MultiBarFactory() {
+  OnBarComplete = nullptr;
+}
+
+void MultiBarFactory::Complete( size_t ix, Slot& slot ) {
+  if ( nullptr != OnBarComplete ) OnBarComplete( ix, slot.bar );
+  slot.bOpen = false;
+  slot.nCount = 0;
+}
+
+void MultiBarFactory::Roll( const ptime& dt ) {
+
+  // the only place the time of day is broken out
+  const boost::gregorian::date date( dt.date() );
+  const unsigned long seconds = dt.time_of_day().total_seconds();
+  const ptime dtMidnight( date + boost::gregorian::days( 1 ) );
+
+  m_dtLower = ptime( boost::posix_time::neg_infin );
+  m_dtUpper = ptime( boost::posix_time::pos_infin );
+
+  size_t ix {};
+  for ( Slot& slot: m_vSlot ) {
+    if ( EWidth::Seconds == slot.width.eWidth ) {
+      if ( slot.bOpen && ( ( dt < slot.bar.DateTime() ) || ( slot.dtEnd <= dt ) ) ) {
+        slot.bar.DateTime( slot.bar.DateTime() + slot.tdBy2 ); // centered in the time slot for chartdir
+        Complete( ix, slot );
+      }
+      if ( !slot.bOpen ) {
+        const unsigned long interval = seconds / slot.width.n;
+        const ptime dtStart( date, time_duration( 0, 0, interval * slot.width.n ) );
+        slot.dtEnd = std::min( dtStart + time_duration( 0, 0, slot.width.n ), dtMidnight );
+        slot.bar.DateTime( dtStart );
+        slot.bOpen = true;
+        slot.nCount = 0; // the trade is applied by Add
+      }
+      m_dtLower = std::max( m_dtLower, slot.bar.DateTime() );
+      m_dtUpper = std::min( m_dtUpper, slot.dtEnd );
+    }
+    ix++;
+  }
+}
+
+void MultiBarFactory::Add( const ptime& dt, price_t price, volume_t volume ) {
+
+  if ( m_bTime && ( ( dt < m_dtLower ) || ( m_dtUpper <= dt ) ) ) {
+    Roll( dt );
+  }
+
+  size_t ix {};
+  for ( Slot& slot: m_vSlot ) {
+    switch ( slot.width.eWidth ) {
+      case EWidth::Seconds:
+        if ( 0 == slot.nCount ) { // set up by Roll
+          Start( slot.bar, slot.bar.DateTime(), price, volume );
+          slot.nCount = 1;
+        }
+        else {
+          Update( slot.bar, price, volume );
+        }
+        break;
+      case EWidth::Ticks:
+        if ( slot.bOpen ) Update( slot.bar, price, volume );
+        else {
+          Start( slot.bar, dt, price, volume );
+          slot.bOpen = true;
+        }
+        if ( slot.width.n <= ++slot.nCount ) Complete( ix, slot );
+        break;
+      case EWidth::Volume:
+        if ( slot.bOpen ) Update( slot.bar, price, volume );
+        else {
+          Start( slot.bar, dt, price, volume );
+          slot.bOpen = true;
+        }
+        slot.nCount += volume;
+        if ( slot.width.n <= slot.nCount ) Complete( ix, slot );
+        break;
+    }
+    ix++;
+  }
+}
+
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,105 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    MultiBarFactory.h
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFTimeSeries
+ * Created: October 20, 2026 01:30
+ */
+
+#pragma once
+
+// one trade stream into bars of several widths, in a single pass
+//   time widths share the boundary test: the trade is compared against the latest bar start and
+//     the earliest bar end over all time widths, the time of day is only broken out when one of them is crossed
+//   time bars follow BarFactory: aligned to the time of day, and on completion shifted half a bar for chartdir,
+//     a time bar also completes at midnight
+//   tick bars complete on the n-th trade, volume bars on the trade bringing the volume to n or more,
+//     they are stamped with the time of their first trade
+// widths are fixed at construction, Add does not allocate
+
+#include <vector>
+
+#include "DatedDatum.h"
+
+#include <OUCommon/FastDelegate.h>
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+class MultiBarFactory {
+public:
+
+  using price_t = Bar::price_t;
+  using volume_t = Bar::volume_t;
+
+  enum class EWidth { Seconds, Ticks, Volume };
+
+  struct Width {
+    EWidth eWidth;
+    unsigned long n; // seconds, trades, or shares
+    Width( EWidth eWidth_, unsigned long n_ ): eWidth( eWidth_ ), n( n_ ) {}
+    static Width Seconds( unsigned long n ) { return Width( EWidth::Seconds, n ); }
+    static Width Ticks( unsigned long n ) { return Width( EWidth::Ticks, n ); }
+    static Width Volume( unsigned long n ) { return Width( EWidth::Volume, n ); }
+  };
+
+  using vWidth_t = std::vector<Width>;
+
+  MultiBarFactory( const vWidth_t& );
+  ~MultiBarFactory();
+
+  void Add( const ptime&, price_t, volume_t );
+  void Add( const Trade& trade ) { Add( trade.DateTime(), trade.Price(), trade.Volume() ); }
+
+  size_t Widths() const { return m_vSlot.size(); }
+  const Width& GetWidth( size_t ix ) const { return m_vSlot[ ix ].width; }
+  const Bar& GetCurrentBar( size_t ix ) const { return m_vSlot[ ix ].bar; } // start time stamp, IsNull until the first trade
+
+  using OnBarCompleteHandler = fastdelegate::FastDelegate2<size_t,const Bar&>; // index of the width, the bar
+  void SetOnBarComplete( OnBarCompleteHandler function ) {
+    OnBarComplete = function;
+  }
+
+protected:
+private:
+
+  struct Slot {
+    Width width;
+    bool bOpen;
+    unsigned long nCount;   // trades or volume in the open bar
+    ptime dtEnd;            // time widths: start of the next bar
+    time_duration tdBy2;    // time widths: half a bar
+    Bar bar;
+    Slot( const Width& width_ )
+    : width( width_ ), bOpen( false ), nCount {}, tdBy2( 0, 0, width_.n / 2 ) {}
+  };
+
+  using vSlot_t = std::vector<Slot>;
+  vSlot_t m_vSlot;
+
+  // all open time bars hold trades in [m_dtLower, m_dtUpper)
+  ptime m_dtLower;
+  ptime m_dtUpper;
+  bool m_bTime; // at least one time width
+
+  OnBarCompleteHandler OnBarComplete;
+
+  void Roll( const ptime& ); // the time bars crossed by the trade are completed and restarted
+  void Complete( size_t ix, Slot& );
+};
+
+} // namespace tf
+} // namespace ou
@@ -0,0 +1,110 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    TSArena.cpp
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFTimeSeries
+ * Created: October 19, 2026 16:40
+ */
+
+#include <new>
+#include <cstring>
+
+#include "TSArena.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+TSArena::TSArena() {}
+
+TSArena::~TSArena() {
+  Trim();
+}
+
+// never destroyed, series with static storage duration may release blocks during exit
+TSArena& TSArena::Instance() {
+  static TSArena* pArena = new TSArena;
+  return *pArena;
+}
+
+void* TSArena::Allocate( std::size_t nBytes ) {
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    mapFree_t::iterator iter = m_mapFree.find( nBytes );
+    if ( ( m_mapFree.end() != iter ) && !iter->second.empty() ) {
+      void* p = iter->second.back();
+      iter->second.pop_back();
+      m_stats.nBlocksFree--;
+      m_stats.nBytesFree -= nBytes;
+      m_stats.nBlocksInUse++;
+      m_stats.nBytesInUse += nBytes;
+      return p;
+    }
+  }
+  void* p = ::operator new( nBytes ); // outside the lock, throws std::bad_alloc
+  std::lock_guard<std::mutex> lock( m_mutex );
+  m_stats.nBlocksSystem++;
+  m_stats.nBlocksInUse++;
+  m_stats.nBytesInUse += nBytes;
+  return p;
+}
+
+void TSArena::Deallocate( void* p, std::size_t nBytes ) {
+  std::lock_guard<std::mutex> lock( m_mutex );
+  m_mapFree[ nBytes ].push_back( p );
+  m_stats.nBlocksInUse--;
+  m_stats.nBytesInUse -= nBytes;
+  m_stats.nBlocksFree++;
+  m_stats.nBytesFree += nBytes;
+}
+
+void TSArena::Reserve( std::size_t nBytes, std::size_t nBlocks ) {
+  vBlock_t vBlock;
+  vBlock.reserve( nBlocks );
+  for ( std::size_t ix = 0; ix < nBlocks; ix++ ) {
+    void* p = ::operator new( nBytes );
+    std::memset( p, 0, nBytes ); // pre-fault the pages
+    vBlock.push_back( p );
+  }
+  std::lock_guard<std::mutex> lock( m_mutex );
+  vBlock_t& vFree( m_mapFree[ nBytes ] );
+  vFree.insert( vFree.end(), vBlock.begin(), vBlock.end() );
+  m_stats.nBlocksFree += nBlocks;
+  m_stats.nBytesFree += nBlocks * nBytes;
+  m_stats.nBlocksSystem += nBlocks;
+}
+
+void TSArena::Trim() {
+  mapFree_t mapFree;
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    mapFree.swap( m_mapFree );
+    m_stats.nBlocksFree = 0;
+    m_stats.nBytesFree = 0;
+  }
+  for ( mapFree_t::value_type& vt: mapFree ) {
+    for ( void* p: vt.second ) {
+      ::operator delete( p );
+    }
+  }
+}
+
+TSArena::Stats TSArena::GetStats() const {
+  std::lock_guard<std::mutex> lock( m_mutex );
+  return m_stats;
+}
+
+} // namespace tf
+} // namespace ou
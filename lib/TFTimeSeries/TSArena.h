@@ -0,0 +1,76 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    TSArena.h
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFTimeSeries
+ * Created: October 19, 2026 16:40
+ */
+
+#pragma once
+
+// per process pool of the fixed size blocks used by TSChunked, the TimeSeries storage
+//   a released block is kept on a free list by byte size, and handed to the next series needing that size,
+//   so a day of ClearSeries/re-watch settles into no system allocations at all
+// Reserve can be called at start up to pre-fault blocks ahead of the open
+
+#include <map>
+#include <mutex>
+#include <vector>
+#include <cstddef>
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+class TSArena {
+public:
+
+  struct Stats {
+    std::size_t nBlocksInUse;
+    std::size_t nBytesInUse;
+    std::size_t nBlocksFree;     // on the free lists
+    std::size_t nBytesFree;
+    std::size_t nBlocksSystem;   // lifetime count of blocks obtained from the system
+    Stats(): nBlocksInUse {}, nBytesInUse {}, nBlocksFree {}, nBytesFree {}, nBlocksSystem {} {}
+  };
+
+  static TSArena& Instance();
+
+  void* Allocate( std::size_t nBytes );
+  void Deallocate( void*, std::size_t nBytes );
+
+  void Reserve( std::size_t nBytes, std::size_t nBlocks ); // adds pre-faulted blocks to the free list
+  void Trim(); // returns the free lists to the system
+
+  Stats GetStats() const;
+
+protected:
+private:
+
+  using vBlock_t = std::vector<void*>;
+  using mapFree_t = std::map<std::size_t,vBlock_t>; // key is block bytes
+
+  mutable std::mutex m_mutex;
+  mapFree_t m_mapFree;
+  Stats m_stats;
+
+  TSArena();
+  ~TSArena();
+  TSArena( const TSArena& ) = delete;
+  TSArena& operator=( const TSArena& ) = delete;
+};
+
+} // namespace tf
+} // namespace ou
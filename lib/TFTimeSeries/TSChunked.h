@@ -0,0 +1,291 @@
+/************************************************************************
+ * Copyright(c) 2026, One Unified. All rights reserved.                 *
+ * email: info@oneunified.net                                           *
+ *                                                                      *
+ * This file is provided as is WITHOUT ANY WARRANTY                     *
+ *  without even the implied warranty of                                *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                *
+ *                                                                      *
+ * This software may not be used nor distributed without proper license *
+ * agreement.                                                           *
+ *                                                                      *
+ * See the file LICENSE.txt for redistribution information.             *
+ ************************************************************************/
+
+/*
+ * File:    TSChunked.h
+ * Author:  raymond@burkholder.net
+ * Project: lib/TFTimeSeries
+ * Created: October 19, 2026 16:40
+ */
+
+#pragma once
+
+// segmented storage for TimeSeries, replaces the std::vector<T, ou::allocator<T,heap<T>>>
+//   elements live in fixed size blocks from TSArena, growth adds a block, nothing is relocated,
+//   so an element's address is stable for the life of the series (until Clear)
+//   block size is a power of two, so random access is a shift, a mask, and one extra load
+//   the block size is chosen before the first block is allocated, from a hint of the typical final count,
+//     otherwise from the first reserve/resize, otherwise c_nBlockDefault
+// iterators are an index into the series, so remain valid across an append, unlike a vector's
+
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+
+#include "TSArena.h"
+
+namespace ou { // One Unified
+namespace tf { // TradeFrame
+
+template<typename T>
+class TSChunked {
+public:
+
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T&;
+  using const_reference = const T&;
+  using pointer = T*;
+  using const_pointer = const T*;
+
+  static constexpr size_type c_nBlockMin = 64;          // elements
+  static constexpr size_type c_nBlockDefault = 4096;
+  static constexpr size_type c_nBlockMax = 1 << 20;
+
+  template<bool bConst>
+  class Iterator {
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using container_t = typename std::conditional<bConst, const TSChunked, TSChunked>::type;
+    using reference = typename std::conditional<bConst, const T&, T&>::type;
+    using pointer = typename std::conditional<bConst, const T*, T*>::type;
+
+    Iterator(): m_pContainer( nullptr ), m_ix {} {}
+    Iterator( container_t* pContainer, size_type ix ): m_pContainer( pContainer ), m_ix( ix ) {}
+    template<bool bOther, typename = typename std::enable_if<bConst && !bOther>::type>
+    Iterator( const Iterator<bOther>& rhs ): m_pContainer( rhs.m_pContainer ), m_ix( rhs.m_ix ) {}
+
+    reference operator*() const { return m_pContainer->Element( m_ix ); }
+    pointer operator->() const { return &m_pContainer->Element( m_ix ); }
+    reference operator[]( difference_type n ) const { return m_pContainer->Element( m_ix + n ); }
+
+    Iterator& operator++() { ++m_ix; return *this; }
+    Iterator operator++( int ) { Iterator iter( *this ); ++m_ix; return iter; }
+    Iterator& operator--() { --m_ix; return *this; }
+    Iterator operator--( int ) { Iterator iter( *this ); --m_ix; return iter; }
+    Iterator& operator+=( difference_type n ) { m_ix += n; return *this; }
+    Iterator& operator-=( difference_type n ) { m_ix -= n; return *this; }
+    Iterator operator+( difference_type n ) const { return Iterator( m_pContainer, m_ix + n ); }
+    Iterator operator-( difference_type n ) const { return Iterator( m_pContainer, m_ix - n ); }
+    friend Iterator operator+( difference_type n, const Iterator& iter ) { return iter + n; }
+    // mixed with the other constness, as a vector's iterators allow
+    template<bool b> difference_type operator-( const Iterator<b>& rhs ) const { return (difference_type) m_ix - (difference_type) rhs.m_ix; }
+    template<bool b> bool operator==( const Iterator<b>& rhs ) const { return m_ix == rhs.m_ix; }
+    template<bool b> bool operator!=( const Iterator<b>& rhs ) const { return m_ix != rhs.m_ix; }
+    template<bool b> bool operator< ( const Iterator<b>& rhs ) const { return m_ix <  rhs.m_ix; }
+    template<bool b> bool operator> ( const Iterator<b>& rhs ) const { return m_ix >  rhs.m_ix; }
+    template<bool b> bool operator<=( const Iterator<b>& rhs ) const { return m_ix <= rhs.m_ix; }
+    template<bool b> bool operator>=( const Iterator<b>& rhs ) const { return m_ix >= rhs.m_ix; }
+
+    size_type Index() const { return m_ix; }
+
+  private:
+    friend class Iterator<!bConst>;
+    container_t* m_pContainer;
+    size_type m_ix;
+  };
+
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  TSChunked(): m_nShift( Shift( c_nBlockDefault ) ), m_bBlockSizeSet( false ), m_nSize {} {}
+  TSChunked( const TSChunked& rhs ): TSChunked() { *this = rhs; }
+  TSChunked( TSChunked&& rhs ): TSChunked() { Swap( rhs ); }
+  ~TSChunked() { Release(); }
+
+  TSChunked& operator=( const TSChunked& rhs ) {
+    if ( this != &rhs ) {
+      clear();
+      if ( m_vBlock.empty() ) {
+        m_nShift = rhs.m_nShift;
+        m_bBlockSizeSet = rhs.m_bBlockSizeSet;
+      }
+      reserve( rhs.m_nSize );
+      for ( const T& value: rhs ) push_back( value );
+    }
+    return *this;
+  }
+
+  TSChunked& operator=( TSChunked&& rhs ) {
+    Release();
+    Swap( rhs );
+    return *this;
+  }
+
+  // from the typical number of elements a series reaches, about 1/16 of that per block
+  static size_type BlockSizeFor( size_type nTypical ) {
+    return std::min( c_nBlockMax, std::max( c_nBlockMin, PowerOfTwo( nTypical / 16 ) ) );
+  }
+
+  // rounded up to a power of two, only before the first block is allocated, false if too late
+  bool SetBlockSize( size_type nElements ) {
+    if ( !m_vBlock.empty() ) return false;
+    m_nShift = Shift( std::min( c_nBlockMax, std::max( c_nBlockMin, PowerOfTwo( nElements ) ) ) );
+    m_bBlockSizeSet = true;
+    return true;
+  }
+
+  size_type BlockSize() const { return size_type( 1 ) << m_nShift; }
+  size_type Blocks() const { return m_vBlock.size(); }
+
+  size_type size() const { return m_nSize; }
+  bool empty() const { return 0 == m_nSize; }
+  size_type capacity() const { return m_vBlock.size() << m_nShift; }
+
+  void reserve( size_type n ) {
+    if ( m_vBlock.empty() && !m_bBlockSizeSet && ( 0 < n ) ) {
+      // a bulk load, such as from hdf5, in as few blocks as is reasonable
+      m_nShift = Shift( std::min( c_nBlockMax, std::max( c_nBlockDefault, PowerOfTwo( n ) ) ) );
+    }
+    const size_type nBlocks = ( n + BlockSize() - 1 ) >> m_nShift;
+    m_vBlock.reserve( nBlocks );
+    while ( m_vBlock.size() < nBlocks ) AddBlock();
+  }
+
+  void resize( size_type n ) {
+    if ( n < m_nSize ) {
+      while ( n < m_nSize ) Element( --m_nSize ).~T();
+    }
+    else {
+      reserve( n );
+      while ( m_nSize < n ) {
+        new( &Element( m_nSize ) ) T();
+        m_nSize++;
+      }
+    }
+  }
+
+  void clear() { // blocks are returned to the arena
+    Release();
+  }
+
+  void push_back( const T& value ) {
+    if ( m_nSize == capacity() ) AddBlock();
+    new( &Element( m_nSize ) ) T( value );
+    m_nSize++;
+  }
+
+  iterator insert( const_iterator pos, const T& value ) {
+    const size_type ix = pos.Index();
+    assert( ix <= m_nSize );
+    push_back( value );
+    std::rotate( begin() + ix, end() - 1, end() );
+    return begin() + ix;
+  }
+
+  reference operator[]( size_type ix ) { return Element( ix ); }
+  const_reference operator[]( size_type ix ) const { return Element( ix ); }
+  reference at( size_type ix ) {
+    if ( ix >= m_nSize ) throw std::out_of_range( "TSChunked::at" );
+    return Element( ix );
+  }
+  const_reference at( size_type ix ) const {
+    if ( ix >= m_nSize ) throw std::out_of_range( "TSChunked::at" );
+    return Element( ix );
+  }
+
+  reference front() { assert( 0 < m_nSize ); return Element( 0 ); }
+  const_reference front() const { assert( 0 < m_nSize ); return Element( 0 ); }
+  reference back() { assert( 0 < m_nSize ); return Element( m_nSize - 1 ); }
+  const_reference back() const { assert( 0 < m_nSize ); return Element( m_nSize - 1 ); }
+
+  iterator begin() { return iterator( this, 0 ); }
+  iterator end() { return iterator( this, m_nSize ); }
+  const_iterator begin() const { return const_iterator( this, 0 ); }
+  const_iterator end() const { return const_iterator( this, m_nSize ); }
+  const_iterator cbegin() const { return const_iterator( this, 0 ); }
+  const_iterator cend() const { return const_iterator( this, m_nSize ); }
+  reverse_iterator rbegin() { return reverse_iterator( end() ); }
+  reverse_iterator rend() { return reverse_iterator( begin() ); }
+  const_reverse_iterator rbegin() const { return const_reverse_iterator( end() ); }
+  const_reverse_iterator rend() const { return const_reverse_iterator( begin() ); }
+
+  // elements adjacent in memory from ix: to the end of its block, or of the series
+  size_type Contiguous( size_type ix ) const {
+    assert( ix < m_nSize );
+    return std::min( BlockSize() - ( ix & ( BlockSize() - 1 ) ), m_nSize - ix );
+  }
+
+  // contiguous runs of elements, in order, for block wise i/o: f( pointer, count )
+  template<typename F>
+  void ForEachBlock( F&& f ) {
+    for ( size_type ix = 0; ix < m_nSize; ix += BlockSize() ) {
+      f( m_vBlock[ ix >> m_nShift ], std::min( BlockSize(), m_nSize - ix ) );
+    }
+  }
+
+  template<typename F>
+  void ForEachBlock( F&& f ) const {
+    for ( size_type ix = 0; ix < m_nSize; ix += BlockSize() ) {
+      f( static_cast<const T*>( m_vBlock[ ix >> m_nShift ] ), std::min( BlockSize(), m_nSize - ix ) );
+    }
+  }
+
+protected:
+private:
+
+  using vBlock_t = std::vector<T*>;
+
+  size_type m_nShift; // log2 of the block size
+  bool m_bBlockSizeSet;
+  size_type m_nSize;
+  vBlock_t m_vBlock;
+
+  static size_type PowerOfTwo( size_type n ) {
+    size_type p2( 1 );
+    while ( p2 < n ) p2 <<= 1;
+    return p2;
+  }
+
+  static size_type Shift( size_type nPowerOfTwo ) {
+    size_type shift {};
+    while ( ( size_type( 1 ) << shift ) < nPowerOfTwo ) shift++;
+    return shift;
+  }
+
+  T& Element( size_type ix ) { return m_vBlock[ ix >> m_nShift ][ ix & ( BlockSize() - 1 ) ]; }
+  const T& Element( size_type ix ) const { return m_vBlock[ ix >> m_nShift ][ ix & ( BlockSize() - 1 ) ]; }
+
+  void AddBlock() {
+    m_vBlock.push_back( static_cast<T*>( TSArena::Instance().Allocate( BlockSize() * sizeof( T ) ) ) );
+  }
+
+  void Release() {
+    while ( 0 < m_nSize ) Element( --m_nSize ).~T();
+    for ( T* p: m_vBlock ) {
+      TSArena::Instance().Deallocate( p, BlockSize() * sizeof( T ) );
+    }
+    m_vBlock.clear();
+  }
+
+  void Swap( TSChunked& rhs ) {
+    std::swap( m_nShift, rhs.m_nShift );
+    std::swap( m_bBlockSizeSet, rhs.m_bBlockSizeSet );
+    std::swap( m_nSize, rhs.m_nSize );
+    m_vBlock.swap( rhs.m_vBlock );
+  }
+
+};
+
+} // namespace tf
+} // namespace ou
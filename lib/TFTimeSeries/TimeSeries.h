@@ -16,6 +16,7 @@
 #pragma warning( disable: 4482 )
 
 #include <vector>
+#include <functional>
 #include <algorithm>
 #include <string>
 
@@ -25,7 +26,7 @@
 #include <OUCommon/Delegate.h>
 
 #include "DatedDatum.h"
-#include "TSAllocator.h"
+#include "TSChunked.h"
 
 // 2012/04/01 use Intel Thread Building Blocks to use concurrent_vector?
 // not sure:  the time series here are typically just used for batch mode processing into and out of hdf5 files
@@ -47,6 +48,10 @@
 // 2017/05/06 see DoubleBuffer for a mechanism for locking and reusing data
 //   between threads
 
+// 2026/10/19 storage is TSChunked rather than a std::vector: blocks from a per process arena,
+//   so growth no longer copies the day's history, and element addresses are stable.
+//   Set a BlockSize hint from typical volume before the first Append.
+
 //#include <boost/serialization/vector.hpp>
 // http://www.boost.org/libs/serialization/doc/traits.html
 
@@ -100,9 +105,7 @@ public:
 
   using datum_t = T ;
 
-  using allocator_t = typename ou::allocator<T, heap<T> >;
-
-  using vTimeSeries_t = typename std::vector<T, allocator_t>;
+  using vTimeSeries_t = TSChunked<T>;
 
   using size_type = typename vTimeSeries_t::size_type;
 
@@ -127,8 +130,15 @@ public:
   void Insert( const T& datum );
   void Resize( size_type Size ) { m_vSeries.resize( Size );  }
 
+  // exchanges contents only, name and OnAppend subscribers stay, for handing a completed series to another thread
+  void Swap( TimeSeries<T>& rhs ) {
+    std::swap( m_vSeries, rhs.m_vSeries );
+    m_vIterator = m_vSeries.end();
+    rhs.m_vIterator = rhs.m_vSeries.end();
+  }
+
   void Sort(); // use when loaded from external data
-  void Flip() { reverse( m_vSeries.begin(), m_vSeries.end() ); }
+  void Flip() { std::reverse( m_vSeries.begin(), m_vSeries.end() ); }
 
   // these three methods update m_vIterator, used mostly with MergeDatedDatumCarrier, (const can't be used)
   // TODO: convert to lamdda visitor
@@ -171,6 +181,19 @@ public:
 
   size_type Capacity() const { return m_vSeries.capacity(); }
 
+  // block size from the typical number of elements a series reaches, before the first Append,
+  //   false once blocks have been allocated
+  bool BlockSizeHint( size_type nTypical ) { return m_vSeries.SetBlockSize( vTimeSeries_t::BlockSizeFor( nTypical ) ); }
+  size_type BlockSize() const { return m_vSeries.BlockSize(); }
+  size_type Blocks() const { return m_vSeries.Blocks(); }
+  size_type Contiguous( const_iterator iter ) const { return m_vSeries.Contiguous( iter.Index() ); } // datums adjacent in memory from iter
+
+  // contiguous runs of the series, in order, for block wise i/o
+  using fBlock_t = std::function<void(T*, size_type)>;
+  using fBlockConst_t = std::function<void(const T*, size_type)>;
+  void ForEachBlock( fBlock_t&& f ) { m_vSeries.ForEachBlock( f ); }
+  void ForEachBlock( fBlockConst_t&& f ) const { m_vSeries.ForEachBlock( f ); }
+
   // TSVariance, TSMA uses this, sets to false
   void DisableAppend() { m_bAppendToVector = false; }
   bool AppendEnabled() const { return m_bAppendToVector; }  // affects Append(...) only
@@ -264,7 +287,7 @@ void TimeSeries<T>::Insert( const dt_t& dt, const T& datum ) {
   T key( dt );
   std::pair<iterator, iterator> p;
   //strict_lock<TimeSeries<T> > guard(*this);
-  p = equal_range( m_vSeries.begin(), m_vSeries.end(), key );
+  p = std::equal_range( m_vSeries.begin(), m_vSeries.end(), key );
   if ( m_vSeries.end() == p.second ) {
     m_vSeries.push_back( datum );
   }
@@ -277,7 +300,7 @@ template<typename T>
 void TimeSeries<T>::Insert( const T& datum ) {
   std::pair<iterator, iterator> p;
   //strict_lock<TimeSeries<T> > guard(*this);
-  p = equal_range( m_vSeries.begin(), m_vSeries.end(), datum );
+  p = std::equal_range( m_vSeries.begin(), m_vSeries.end(), datum );
   if ( m_vSeries.end() == p.second ) {
     m_vSeries.push_back( datum );
   }
@@ -339,9 +362,7 @@ template<typename T>
 typename TimeSeries<T>::const_reference TimeSeries<T>::Ago( size_type ix ) {
   //strict_lock<TimeSeries<T> > guard(*this);
   assert( ix < m_vSeries.size() );
-  typename vTimeSeries_t::const_reverse_iterator iter( m_vSeries.rbegin() );
-  iter += ix;
-  return *iter;
+  return m_vSeries[ m_vSeries.size() - 1 - ix ];
 }
 
 template<typename T>
@@ -366,7 +387,7 @@ typename TimeSeries<T>::const_reference TimeSeries<T>::At( const dt_t& dt ) {
   // TODO: Check that this is correct
   T key( dt );
   std::pair<iterator, iterator> p;
-  p = equal_range( m_vSeries.begin(), m_vSeries.end(), key );
+  p = std::equal_range( m_vSeries.begin(), m_vSeries.end(), key );
 //  if ( p.first != p.second ) {
 //    m_vIterator = p.first;
 //  }
@@ -383,7 +404,7 @@ typename TimeSeries<T>::const_iterator TimeSeries<T>::AtOrAfter( const dt_t &dt
   T key( dt );
   std::pair<const_iterator, const_iterator> p;
   //strict_lock<TimeSeries<T> > guard(*this);
-  p = equal_range( m_vSeries.begin(), m_vSeries.end(), key );
+  p = std::equal_range( m_vSeries.begin(), m_vSeries.end(), key );
 //  if ( p.first != p.second ) {
 //    m_vIterator = p.first;
 //  }
@@ -399,14 +420,14 @@ typename TimeSeries<T>::const_iterator TimeSeries<T>::After( const dt_t &dt ) co
   T key( dt );
   std::pair<const_iterator, const_iterator> p;
   //strict_lock<TimeSeries<T> > guard(*this);
-  p = equal_range( m_vSeries.begin(), m_vSeries.end(), key );
+  p = std::equal_range( m_vSeries.begin(), m_vSeries.end(), key );
   return p.second;
 }
 
 template<typename T>
 void TimeSeries<T>::Sort() {
   //strict_lock<TimeSeries<T> > guard(*this);
-  sort( m_vSeries.begin(), m_vSeries.end() );  // may not keep time series with identical keys in acquired order (may not be an issue, as external clock is written to be monotonically increasing)
+  std::sort( m_vSeries.begin(), m_vSeries.end() );  // may not keep time series with identical keys in acquired order (may not be an issue, as external clock is written to be monotonically increasing)
 }
 
 template<typename T>
@@ -415,7 +436,7 @@ TimeSeries<T>* TimeSeries<T>::Subset( const dt_t &dt ) {
   TimeSeries<T>* series = nullptr;
   const_iterator iter;
   //strict_lock<TimeSeries<T> > guard(*this);
-  iter = lower_bound( m_vSeries.begin(), m_vSeries.end(), datum );
+  iter = std::lower_bound( m_vSeries.begin(), m_vSeries.end(), datum );
   if ( m_vSeries.end() != iter ) {
     series = new TimeSeries<T>( (unsigned int) (m_vSeries.end() - iter) );
     while ( m_vSeries.end() != iter ) {
@@ -435,7 +456,7 @@ TimeSeries<T>* TimeSeries<T>::Subset( const dt_t &dt, unsigned int n ) { // n is
   TimeSeries<T>* series = NULL;
   const_iterator iter;
   //strict_lock<TimeSeries<T> > guard(*this);
-  iter = lower_bound( m_vSeries.begin(), m_vSeries.end(), datum );
+  iter = std::lower_bound( m_vSeries.begin(), m_vSeries.end(), datum );
   if ( m_vSeries.end() != iter ) {
     unsigned int todo = std::min<unsigned int>( n, (unsigned int) ( m_vSeries.end() - iter ) );
     series = new TimeSeries<T>( todo );
@@ -25,7 +25,9 @@ namespace ou { // One Unified
 namespace tf { // TradeFrame
 
 AcquireFundamentals::AcquireFundamentals( pWatch_t&& pWatch, fDone_t&& fDone )
-: m_pWatch( std::move( pWatch ) ), m_fDone( std::move( fDone ) ) {
+: m_pWatch( std::move( pWatch ) ), m_fDone( std::move( fDone ) )
+, m_bClaimed( false )
+{
   assert( ou::tf::keytypes::EProviderIQF == m_pWatch->GetProvider()->ID() );
   //std::cout << "AcquireFundamentals::AcquireFundamentals(): " << m_pWatch->GetInstrumentName() << std::endl;
 }
@@ -42,6 +44,24 @@ void AcquireFundamentals::Start() {
   m_pWatch->StartWatch();
 }
 
+void AcquireFundamentals::Cancel() {
+  if ( Claim() ) Stop(); // otherwise the summary arrived first, and fDone has been or is being called
+}
+
+bool AcquireFundamentals::Claim() {
+  std::lock_guard<std::mutex> lock( m_mutex );
+  if ( m_bClaimed ) return false;
+  m_bClaimed = true;
+  return true;
+}
+
+void AcquireFundamentals::Stop() {
+  m_pWatch->StopWatch();
+  m_pWatch->OnSummary.Remove( MakeDelegate( this, &AcquireFundamentals::HandleSummary ) );
+  m_pWatch->OnTrade.Remove( MakeDelegate(this, &AcquireFundamentals::HandleTrade ) );
+  m_pWatch->OnFundamentals.Remove( MakeDelegate( this, &AcquireFundamentals::HandleFundamentals) );
+}
+
 void AcquireFundamentals::HandleFundamentals( const ou::tf::Watch::Fundamentals& fundamentals ) {
   // the watch will retain variables from the fundamentals message
   //std::cout << "AcquireFundamentals::HandleFundamentals() enter: " << m_pWatch->GetInstrumentName()  << std::endl;
@@ -59,10 +79,8 @@ void AcquireFundamentals::HandleSummary( const ou::tf::Watch::Summary& summary )
   //if ( 0 < summary.nOpenInterest ) {
   //  std::cout << "acquire " << m_pWatch->GetInstrumentName() << " open interest " << summary.nOpenInterest << std::endl;
   //}
-  m_pWatch->StopWatch();
-  m_pWatch->OnSummary.Remove( MakeDelegate( this, &AcquireFundamentals::HandleSummary ) );
-  m_pWatch->OnTrade.Remove( MakeDelegate(this, &AcquireFundamentals::HandleTrade ) );
-  m_pWatch->OnFundamentals.Remove( MakeDelegate( this, &AcquireFundamentals::HandleFundamentals) );
+  if ( !Claim() ) return; // cancelled, or a repeated summary before the removal took effect
+  Stop();
   m_fDone( m_pWatch );  // fundamentals reside in watch
   //std::cout << "AcquireFundamentals::HandleSummary() exit: " << m_pWatch->GetInstrumentName() << std::endl;
 }
@@ -19,6 +19,7 @@
  * Created on September 18, 2021, 14:21
  */
 
+#include <mutex>
 #include <functional>
 
 #include <TFTrading/Watch.h>
@@ -42,12 +43,20 @@ public:
   }
 
   void Start();
+  void Cancel(); // stop waiting, fDone will not be called unless the summary got there first, any thread
 
 private:
 
   pWatch_t m_pWatch;
   fDone_t  m_fDone;
 
+  // first of Cancel and HandleSummary claims the request, only that one stops the watch
+  std::mutex m_mutex;
+  bool m_bClaimed;
+
+  bool Claim();
+  void Stop();
+
   void HandleFundamentals( const Watch::Fundamentals& );
   void HandleSummary( const Watch::Summary& );
   void HandleTrade( const Trade& );
@@ -22,7 +22,9 @@ namespace tf { // TradeFrame
 // OrderManager
 //
 
-OrderManager::OrderManager() {
+OrderManager::OrderManager()
+: m_idExecutionLast( 0 )
+{
 }
 
 OrderManager::~OrderManager() {
@@ -186,14 +188,14 @@ void OrderManager::PlaceOrder(ProviderInterfaceBase *pProvider, pOrder_t pOrder)
             , pOrder->GetOrderId(), pOrder->GetRow().eOrderStatus, pOrder->GetRow().dtOrderSubmitted
             , pOrder->GetRow().dblSignalPrice, pOrder->GetRow().sDescription
           );
-        ou::db::QueryFields<OrderManagerQueries::UpdateAtPlaceOrder1>::pQueryFields_t pQuery
-          = m_pSession->SQL<OrderManagerQueries::UpdateAtPlaceOrder1>( // todo:  cache this query
+        m_pSession->Queue<OrderManagerQueries::UpdateAtPlaceOrder1>(
             "update orders set"
             " timeinforce=?, goodtilldate=?, goodaftertime=?"
             ", parentid=?, transmit=?, outsiderth=?"
             ", orderstatus=?, datetimesubmitted=?"
             ", signalprice=?, description=?"
-            , update ).Where( "orderid=?" );
+            " WHERE orderid=?"
+            , update );
       }
     }
     else {
@@ -233,9 +235,8 @@ void OrderManager::UpdateOrder(ProviderInterfaceBase *pProvider, pOrder_t pOrder
       if ( nullptr != m_pSession ) {
         OrderManagerQueries::UpdateAtPlaceOrder2
           update( pOrder->GetOrderId(), pOrder->GetRow().dblPrice1, pOrder->GetRow().dblPrice2 );
-        ou::db::QueryFields<OrderManagerQueries::UpdateAtPlaceOrder2>::pQueryFields_t pQuery
-          = m_pSession->SQL<OrderManagerQueries::UpdateAtPlaceOrder2>( // todo:  cache this query
-            "update orders set price1=?, price2=?", update ).Where( "orderid=?" );
+        m_pSession->Queue<OrderManagerQueries::UpdateAtPlaceOrder2>(
+            "update orders set price1=?, price2=? WHERE orderid=?", update );
       }
     }
     else {
@@ -361,9 +362,8 @@ void OrderManager::ReportCancellation( idOrder_t nOrderId ) {
       if ( nullptr != m_pSession ) {
         OrderManagerQueries::UpdateAtOrderClose
           close( pOrder->GetOrderId(), pOrder->GetRow().eOrderStatus, pOrder->GetRow().dtOrderClosed );
-        ou::db::QueryFields<OrderManagerQueries::UpdateAtOrderClose>::pQueryFields_t pQuery
-          = m_pSession->SQL<OrderManagerQueries::UpdateAtOrderClose>( // todo:  cache this query
-            "update orders set orderstatus=?, datetimeclosed=?", close ).Where( "orderid=?" );
+        m_pSession->Queue<OrderManagerQueries::UpdateAtOrderClose>(
+            "update orders set orderstatus=?, datetimeclosed=? WHERE orderid=?", close );
       }
     }
     else {
@@ -400,6 +400,7 @@ namespace OrderManagerQueries {
   };
 
   std::string sUpdateOrderQuery( "update orders set orderstatus=?, quantityremaining=?, quantityfilled=?, averagefillprice=?, datetimeclosed=?" );
+  std::string sUpdateOrderByIdQuery( sUpdateOrderQuery + " WHERE orderid=?" );
 }
 
 void OrderManager::ReportExecution( idOrder_t nOrderId, const Execution& exec) {
@@ -409,6 +410,7 @@ void OrderManager::ReportExecution( idOrder_t nOrderId, const Execution& exec) {
       pOrder_t pOrder = iter->second.pOrder;
       OrderStatus::EOrderStatus status = pOrder->ReportExecution( exec );
       if ( nullptr != m_pSession ) {
+        // queued as is every order row update, so rows are written in the order reported
         const Order::TableRowDef& row( pOrder->GetRow() );
         switch ( status ) {
         case OrderStatus::CancelledWithPartialFill:
@@ -416,28 +418,23 @@ void OrderManager::ReportExecution( idOrder_t nOrderId, const Execution& exec) {
           {
             OrderManagerQueries::UpdateOrder
               order( nOrderId, row.eOrderStatus, row.nQuantityRemaining, row.nQuantityFilled, row.dblAverageFillPrice, ou::TimeSource::LocalCommonInstance().Internal() );
-            ou::db::QueryFields<OrderManagerQueries::UpdateOrder>::pQueryFields_t pQuery
-              = m_pSession->SQL<OrderManagerQueries::UpdateOrder>( // todo:  cache this query
-              OrderManagerQueries::sUpdateOrderQuery, order ).Where( "orderid=?" );
+            m_pSession->Queue<OrderManagerQueries::UpdateOrder>( OrderManagerQueries::sUpdateOrderByIdQuery, order );
           }
           break;
         default:
           {
             OrderManagerQueries::UpdateOrder
               order( nOrderId, row.eOrderStatus, row.nQuantityRemaining, row.nQuantityFilled, row.dblAverageFillPrice );
-            ou::db::QueryFields<OrderManagerQueries::UpdateOrder>::pQueryFields_t pQuery
-              = m_pSession->SQL<OrderManagerQueries::UpdateOrder>( // todo:  cache this query
-              OrderManagerQueries::sUpdateOrderQuery, order ).Where( "orderid=?" );
+            m_pSession->Queue<OrderManagerQueries::UpdateOrder>( OrderManagerQueries::sUpdateOrderByIdQuery, order );
           }
           break;
         }
         // add execution record
+        idExecution_t idExecution = ++m_idExecutionLast;
         pExecution_t pExecution = std::make_shared<ou::tf::Execution>( exec );
         pExecution->SetOrderId( nOrderId );
-        ou::db::QueryFields<Execution::TableRowDefNoKey>::pQueryFields_t pQueryExecutionWrite
-          = m_pSession->Insert<Execution::TableRowDefNoKey>(
-            const_cast<Execution::TableRowDefNoKey&>( dynamic_cast<const Execution::TableRowDefNoKey&>( pExecution->GetRow() ) ) );
-        idExecution_t idExecution = m_pSession->GetLastRowId();
+        pExecution->SetExecutionId( idExecution );
+        m_pSession->QueueInsert<Execution::TableRowDef>( pExecution->GetRow() );
         pairExecution_t pair( idExecution, pExecution );
         iter->second.pmapExecutions->insert( pair );
       }
@@ -478,9 +475,8 @@ void OrderManager::ReportCommission( idOrder_t nOrderId, double dblCommission )
       if ( nullptr != m_pSession ) {
         OrderManagerQueries::UpdateCommission
           commission( pOrder->GetOrderId(), dblCommission );
-        ou::db::QueryFields<OrderManagerQueries::UpdateCommission>::pQueryFields_t pQuery
-          = m_pSession->SQL<OrderManagerQueries::UpdateCommission>( // todo:  cache this query
-            "update orders set commission=?", commission ).Where( "orderid=?" );
+        m_pSession->Queue<OrderManagerQueries::UpdateCommission>(
+            "update orders set commission=? WHERE orderid=?", commission );
       }
       pOrder->SetCommission( dblCommission );  // need to do afterwards as delegated objects may query the db (other stuff above may not obey this format)
       // as a result, may need to set delegates here so database is updated before order calls delegates.
@@ -520,9 +516,8 @@ void OrderManager::ReportErrors( idOrder_t nOrderId, OrderError::EOrderError eEr
       if ( nullptr != m_pSession ) {
         OrderManagerQueries::UpdateOnOrderError
           error( pOrder->GetOrderId(), pOrder->GetRow().eOrderStatus, pOrder->GetRow().dtOrderClosed );
-        ou::db::QueryFields<OrderManagerQueries::UpdateOnOrderError>::pQueryFields_t pQuery
-          = m_pSession->SQL<OrderManagerQueries::UpdateOnOrderError>( // todo:  cache this query
-            "update orders set orderstatus=?, datetimeclosed=?", error ).Where( "orderid=?" );
+        m_pSession->Queue<OrderManagerQueries::UpdateOnOrderError>(
+            "update orders set orderstatus=?, datetimeclosed=? WHERE orderid=?", error );
       }
     }
     else {
@@ -542,7 +537,7 @@ namespace OrderManagerQueries {
       ou::db::Field( a, "orderid", idOrder );
     }
     Order::idOrder_t idOrder;
-    const std::string& sReference;
+    std::string sReference; // a copy, the write may be deferred
     UpdateReference( Order::idOrder_t idOrder_, const std::string& sReference_ )
     : idOrder( idOrder_ ), sReference( sReference_ ) {}
   };
@@ -556,9 +551,8 @@ void OrderManager::UpdateReference( idOrder_t idOrder, const std::string& sRefer
       pOrder->SetReference( sReference );
       if ( nullptr != m_pSession ) {
         OrderManagerQueries::UpdateReference reference( idOrder, sReference );
-        ou::db::QueryFields<OrderManagerQueries::UpdateReference>::pQueryFields_t pQuery
-          = m_pSession->SQL<OrderManagerQueries::UpdateReference>( // todo:  cache this query
-            "update orders set reference=?", reference ).Where( "orderid=?" );
+        m_pSession->Queue<OrderManagerQueries::UpdateReference>(
+            "update orders set reference=? WHERE orderid=?", reference );
       }
     }
     else {
@@ -582,6 +576,7 @@ void OrderManager::HandleRegisterRows( ou::db::Session& session ) {
 }
 
 void OrderManager::HandlePopulateTables( ou::db::Session& session ) {
+  session.EnableWriteBehind();
 }
 
 namespace OrderManagerQueries {
@@ -592,6 +587,14 @@ namespace OrderManagerQueries {
     }
     Order::idOrder_t idOrder;
   };
+  struct ColumnMaxExecutionId {
+    template<typename A>
+    void Fields( A& a ) {
+      ou::db::Field( a, "executionid", idExecution );
+    }
+    Execution::idExecution_t idExecution;
+    ColumnMaxExecutionId(): idExecution( 0 ) {}
+  };
 }
 
 void OrderManager::HandleLoadTables( ou::db::Session& session ) {
@@ -610,6 +613,17 @@ void OrderManager::HandleLoadTables( ou::db::Session& session ) {
   catch ( const std::runtime_error& error ) {
     std::cout << "OrderManager::HandleLoadTables: no orders found, " << error.what() << std::endl;
   }
+  try {
+    ou::db::QueryFields<ou::db::NoBind>::pQueryFields_t pQuery
+      = m_pSession->SQL<ou::db::NoBind>( "select max(executionid) as executionid from executions;" ); // immediately executed
+    OrderManagerQueries::ColumnMaxExecutionId result;
+    m_pSession->Columns<ou::db::NoBind,OrderManagerQueries::ColumnMaxExecutionId>( pQuery, result );
+    m_idExecutionLast = std::max( m_idExecutionLast, result.idExecution );
+  }
+  catch ( const std::runtime_error& error ) {
+    std::cout << "OrderManager::HandleLoadTables: no executions found, " << error.what() << std::endl;
+  }
+  session.EnableWriteBehind(); // order row updates and executions are committed by the session's worker
 }
 
 // this stuff could probably be rolled into Session with a template
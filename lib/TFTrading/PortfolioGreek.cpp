@@ -26,6 +26,8 @@ namespace tf { // TradeFrame
 PortfolioGreek::PortfolioGreek( const idPortfolio_t& idPortfolio, const idAccountOwner_t& idAccountOwner, const idPortfolio_t& idOwner, EPortfolioType ePortfolioType_, 
     currency_t eCurrency, const std::string& sDescription )
 : Portfolio( idPortfolio, idAccountOwner, idOwner, ePortfolioType_, eCurrency, sDescription )
+, m_bPosted( false )
+, m_cntGreekUpdates {}, m_cntGreekSkipped {}
 {
 }
 
@@ -34,26 +36,113 @@ PortfolioGreek::~PortfolioGreek( ) {
 
 PortfolioGreek::pPositionGreek_t PortfolioGreek::AddPosition( const std::string& sName, pPositionGreek_t pPositionGreek ) {
   Portfolio::AddPosition( sName, pPositionGreek );
+  m_mapPositionGreek[ sName ] = pPositionGreek;
+  m_exposurePending += pPositionGreek->GetExposure();
   return pPositionGreek;
 }
 
 void PortfolioGreek::DeletePosition( const std::string& sName, pPositionGreek_t ) {
   Portfolio::DeletePosition( sName );
+  mapPositionGreek_t::iterator iter = m_mapPositionGreek.find( sName );
+  if ( m_mapPositionGreek.end() != iter ) {
+    m_exposurePending -= iter->second->GetExposure();
+    m_mapPositionGreek.erase( iter );
+  }
 }
   
 void PortfolioGreek::AddSubPortfolio( pPortfolioGreek_t& pPortfolioGreek ) {
   pPortfolio_t pPortfolio( std::dynamic_pointer_cast<Portfolio>( pPortfolioGreek ) );
   Portfolio::AddSubPortfolio( pPortfolio );
+  m_mapPortfolioGreek[ pPortfolioGreek->Id() ] = pPortfolioGreek;
+  m_exposurePending += pPortfolioGreek->GetExposure();
 }
 
 void PortfolioGreek::RemoveSubPortfolio( const idPortfolio_t& idPortfolio ) {
   Portfolio::RemoveSubPortfolio( idPortfolio );
+  mapPortfolioGreek_t::iterator iter = m_mapPortfolioGreek.find( idPortfolio );
+  if ( m_mapPortfolioGreek.end() != iter ) {
+    m_exposurePending -= iter->second->GetExposure();
+    m_mapPortfolioGreek.erase( iter );
+  }
+}
+
+void PortfolioGreek::SetPost( fPost_t&& fPost ) {
+  m_fPost = std::move( fPost );
+}
+
+void PortfolioGreek::HandleGreekBatch( const ou::tf::option::GreekBatch& batch ) {
+  if ( m_fPost ) {
+    bool bPost;
+    {
+      std::lock_guard<std::mutex> lock( m_mutexPending );
+      for ( const ou::tf::option::GreekBatch::entry_t& entry: batch.vEntry ) {
+        m_mapPending[ entry.first ] = entry.second; // a later batch supersedes a greek not yet applied
+      }
+      bPost = !m_bPosted;
+      m_bPosted = true;
+    }
+    if ( bPost ) {
+      m_fPost( [this](){ ApplyPending(); } );
+    }
+  }
+  else {
+    m_mapGreek.clear();
+    for ( const ou::tf::option::GreekBatch::entry_t& entry: batch.vEntry ) {
+      m_mapGreek[ entry.first ] = &entry.second;
+    }
+    ApplyGreeks( m_mapGreek );
+  }
+}
+
+void PortfolioGreek::ApplyPending() {
+  {
+    std::lock_guard<std::mutex> lock( m_mutexPending );
+    m_mapApply.swap( m_mapPending );
+    m_mapPending.clear();
+    m_bPosted = false;
+  }
+  m_mapGreek.clear();
+  for ( const mapGreekValue_t::value_type& vt: m_mapApply ) {
+    m_mapGreek[ vt.first ] = &vt.second;
+  }
+  ApplyGreeks( m_mapGreek );
+}
+
+PortfolioGreek::Exposure PortfolioGreek::ApplyGreeks( const mapGreek_t& mapGreek ) {
+
+  Exposure change( m_exposurePending );
+  m_exposurePending = Exposure();
+
+  for ( mapPositionGreek_t::value_type& vt: m_mapPositionGreek ) {
+    PositionGreek& position( *vt.second );
+    mapGreek_t::const_iterator iter = mapGreek.find( position.m_pOption.get() );
+    change += position.UpdateExposure( mapGreek.end() == iter ? nullptr : iter->second );
+  }
+
+  for ( mapPortfolioGreek_t::value_type& vt: m_mapPortfolioGreek ) {
+    change += vt.second->ApplyGreeks( mapGreek );
+  }
+
+  if ( change.IsZero() ) {
+    m_cntGreekSkipped++;
+  }
+  else {
+    m_exposure += change;
+    m_cntGreekUpdates++;
+    OnGreekUpdate( *this );
+  }
+
+  return change;
 }
 
 std::ostream& operator<<( std::ostream& os, const PortfolioGreek& portfolio ) {
 
   os 
     << (Portfolio) portfolio
+    << ", Delta " << portfolio.GetExposure().delta
+    << ", Gamma " << portfolio.GetExposure().gamma
+    << ", Theta " << portfolio.GetExposure().theta
+    << ", Vega " << portfolio.GetExposure().vega
     ;
   return os;
 }
@@ -21,6 +21,11 @@
 #ifndef PORTFOLIOGREEK_H
 #define PORTFOLIOGREEK_H
 
+#include <map>
+#include <mutex>
+#include <functional>
+#include <unordered_map>
+
 #include "Portfolio.h"
 #include "PositionGreek.h"
 
@@ -40,6 +45,8 @@ public:
 
   using pPortfolioGreek_t = std::shared_ptr<PortfolioGreek>;
 
+  using Exposure = PositionGreek::Exposure;
+
   PortfolioGreek(
     const idPortfolio_t& idPortfolio, const idAccountOwner_t& idAccountOwner, const idPortfolio_t& idOwner, EPortfolioType ePortfolioType_,
     currency_t eCurrency, const std::string& sDescription );
@@ -51,9 +58,55 @@ public:
   void AddSubPortfolio( pPortfolioGreek_t& );
   void RemoveSubPortfolio( const idPortfolio_t& idPortfolio );
 
+  // attach to option::Engine::OnGreekBatch on the top level portfolio only, sub-portfolios are handled from there.
+  //   exposure is maintained from per-position changes, each portfolio fires OnGreekUpdate at most once per batch,
+  //   and only when its exposure changed
+  //   the batch arrives on the engine thread, positions and sub-portfolios are changed on the owner's thread:
+  //     with SetPost, the greeks are merged into a pending set, and one call at a time is posted to apply them,
+  //     without, the batch is applied on the calling thread, which must then be the owner's
+  void HandleGreekBatch( const ou::tf::option::GreekBatch& );
+
+  // runs the supplied function on the owner's thread, eg with wxWindow::CallAfter or boost::asio::post,
+  //   set before attaching to the engine, a posted call must run before the portfolio is destroyed
+  using fApply_t = std::function<void()>;
+  using fPost_t = std::function<void( fApply_t&& )>;
+  void SetPost( fPost_t&& );
+
+  const Exposure& GetExposure() const { return m_exposure; }
+
+  ou::Delegate<const PortfolioGreek&> OnGreekUpdate;
+
+  std::size_t GetCountGreekUpdates() const { return m_cntGreekUpdates; }
+  std::size_t GetCountGreekSkipped() const { return m_cntGreekSkipped; } // batches with no change to this portfolio
+
 protected:
 private:
 
+  using mapPositionGreek_t = std::map<std::string, pPositionGreek_t>;
+  using mapPortfolioGreek_t = std::map<idPortfolio_t, pPortfolioGreek_t>;
+  using mapGreek_t = std::unordered_map<const ou::tf::option::Option*, const ou::tf::Greek*>;
+  using mapGreekValue_t = std::unordered_map<const ou::tf::option::Option*, ou::tf::Greek>;
+
+  mapPositionGreek_t m_mapPositionGreek;
+  mapPortfolioGreek_t m_mapPortfolioGreek;
+
+  mapGreek_t m_mapGreek; // lookup into the current batch, retained to reuse its buckets
+
+  fPost_t m_fPost;
+  std::mutex m_mutexPending;
+  mapGreekValue_t m_mapPending; // latest greek per option, since the posted call last ran, engine thread
+  mapGreekValue_t m_mapApply;   // the pending set being applied, owner's thread
+  bool m_bPosted;
+
+  Exposure m_exposure;
+  Exposure m_exposurePending; // positions and sub-portfolios added or removed since the last batch
+
+  std::size_t m_cntGreekUpdates;
+  std::size_t m_cntGreekSkipped;
+
+  void ApplyPending();
+  Exposure ApplyGreeks( const mapGreek_t& ); // returns the change in exposure
+
 };
 
 std::ostream& operator<<( std::ostream& os, const PortfolioGreek& );
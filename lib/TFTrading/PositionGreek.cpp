@@ -48,6 +48,22 @@ void PositionGreek::HandleGreek( greek_t greek ) {
   OnGreek( greek );
 }
 
+// quantity is re-evaluated on each batch, so fills show up in the next scan even without a new greek
+PositionGreek::Exposure PositionGreek::UpdateExposure( const ou::tf::Greek* pGreek ) {
+
+  if ( nullptr != pGreek ) m_greekBatch = *pGreek;
+
+  double quantity( m_row.nPositionActive * m_pOption->GetInstrument()->GetMultiplier() );
+  if ( OrderSide::Sell == m_row.eOrderSideActive ) quantity = -quantity;
+
+  Exposure exposure; // flat positions contribute nothing, even with an unusable greek
+  if ( 0.0 != quantity ) exposure = Exposure( m_greekBatch, quantity );
+  Exposure delta( exposure );
+  delta -= m_exposure;
+  m_exposure = exposure;
+  return delta;
+}
+
 void PositionGreek::PositionPendingDelta( int n ) {
   switch ( m_row.eOrderSidePending ) {
     case OrderSide::Unknown:
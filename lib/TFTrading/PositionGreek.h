@@ -32,7 +32,10 @@
 namespace ou { // One Unified
 namespace tf { // TradeFrame
 
+class PortfolioGreek;
+
 class PositionGreek: public Position {
+  friend class PortfolioGreek;
   friend class boost::serialization::access;
 public:
 
@@ -53,6 +56,31 @@ public:
 
   ou::Delegate<const ou::tf::Greek&> OnGreek; // need to fire this on option updates
 
+  // greeks scaled by signed active quantity and contract multiplier
+  struct Exposure {
+    double delta;
+    double gamma;
+    double theta;
+    double vega;
+    Exposure(): delta {}, gamma {}, theta {}, vega {} {}
+    Exposure( const ou::tf::Greek& greek, double quantity )
+    : delta( quantity * greek.Delta() ), gamma( quantity * greek.Gamma() )
+    , theta( quantity * greek.Theta() ), vega( quantity * greek.Vega() )
+    {}
+    bool IsZero() const { return ( 0.0 == delta ) && ( 0.0 == gamma ) && ( 0.0 == theta ) && ( 0.0 == vega ); }
+    Exposure& operator+=( const Exposure& rhs ) {
+      delta += rhs.delta; gamma += rhs.gamma; theta += rhs.theta; vega += rhs.vega;
+      return *this;
+    }
+    Exposure& operator-=( const Exposure& rhs ) {
+      delta -= rhs.delta; gamma -= rhs.gamma; theta -= rhs.theta; vega -= rhs.vega;
+      return *this;
+    }
+  };
+
+  // as of the last greek batch applied through the owning PortfolioGreek
+  const Exposure& GetExposure() const { return m_exposure; }
+
   void PositionPendingDelta( int n );  // -1 or +1
 
 protected:
@@ -66,6 +94,10 @@ private:
 
   int m_nQuantity;  // number of contracts
 
+  ou::tf::Greek m_greekBatch; // last greek received via a batch
+  Exposure m_exposure;
+
+  Exposure UpdateExposure( const ou::tf::Greek* ); // nullptr when not in the batch, returns the change
   void Construction();
 
   void HandleGreek( greek_t );
@@ -18,6 +18,7 @@
 #include <TFHDF5TimeSeries/HDF5Attribute.h>
 
 #include <OUCommon/TimeSource.h>
+#include <OUCommon/LatencyTrace.h>
 
 #include <TFIQFeed/Provider.h>
 
@@ -33,7 +34,8 @@ Watch::Watch( pInstrument_t& pInstrument, pProvider_t pDataProvider ) :
   m_bWatching( false ), m_bWatchingEnabled( false ), m_bRecordSeries( true ),
   m_cntWatching {}, m_nEnableStats {},
   m_cntBestSpread {}, m_dblBestSpread {}, m_cntTotalSpread {},
-  m_bEventsAttached( false )
+  m_nVersion {},
+  m_bEventsAttached( false ), m_bSeriesHint( false )
 {
   assert( pInstrument );
   assert( pDataProvider );
@@ -48,7 +50,9 @@ Watch::Watch( const Watch& rhs ) :
   m_bWatching( false ), m_bWatchingEnabled( false ), m_bRecordSeries( rhs.m_bRecordSeries ),
   m_cntWatching {}, m_nEnableStats {},
   m_cntBestSpread {}, m_dblBestSpread {}, m_cntTotalSpread {},
-  m_bEventsAttached( false )
+  m_slQuote( rhs.m_quote ), m_slTrade( rhs.m_trade ),
+  m_nVersion {},
+  m_bEventsAttached( false ), m_bSeriesHint( false )
 {
   assert( 0 == rhs.m_cntWatching );
   assert( 0 == rhs.m_nEnableStats );
@@ -81,12 +85,7 @@ void Watch::Initialize() {
   assert( m_pDataProvider );
   //assert(  );
   assert( m_pDataProvider->ProvidesTrades() );
-  if ( m_pDataProvider->ProvidesQuotes() ) {
-    m_quotes.Reserve( 1024 );  // reduce startup allocations
-  }
-  m_trades.Reserve( 1024 );  // reduce startup allocations
-  m_depths_mm.Reserve( 1024 );  // reduce startup allocations
-  m_depths_order.Reserve( 1024 );  // reduce startup allocations
+  // no Reserve: series grow by arena blocks without relocation, and the block size can still follow SeriesHint
   AddEvents();
   // TODO: check that instrument name, or alt instrument name matches provider type:
   //    contract exists for IBTWS provider, IQFeedName exists for IQFeed provider
@@ -118,6 +117,12 @@ void Watch::SetProvider( pProvider_t& pDataProvider ) {
   EnableWatch();
 }
 
+void Watch::SeriesHint( Quotes::size_type nQuotes, Trades::size_type nTrades ) {
+  m_bSeriesHint = true;
+  m_quotes.BlockSizeHint( nQuotes );
+  m_trades.BlockSizeHint( nTrades );
+}
+
 void Watch::EnableStatsAdd() {
   m_nEnableStats++;
 }
@@ -228,6 +233,7 @@ void Watch::EmitValues( bool bEmitName ) const {
   if ( m_pDataProvider->ProvidesQuotes() ) {
     std::cout
       << "Cnt=" << m_quotes.Size() << "(q)," << m_trades.Size() << "(t)"
+      << ",Blk=" << m_quotes.Blocks() << "x" << m_quotes.BlockSize() << "(q)," << m_trades.Blocks() << "x" << m_trades.BlockSize() << "(t)"
       << ",P=" << m_trade.Price()
       << ",B=" << m_quote.Bid()
       << ",A=" << m_quote.Ask()
@@ -245,6 +251,8 @@ void Watch::EmitValues( bool bEmitName ) const {
 
 void Watch::HandleQuote( const Quote& quote ) {
 
+  TF_LATENCY_STAGE( "watch.quote" );
+
   // TODO: mean, median, mode on spread to determine 'normal' spread for actionable events
   //   * sliding window for n quotes or n seconds?
   //   * need to filter quotes when value is at zero as end of life otm
@@ -286,14 +294,19 @@ void Watch::HandleQuote( const Quote& quote ) {
       }
 
       m_quote = quote;
+      m_slQuote.Store( quote );
+      Published();
       if ( m_bRecordSeries ) {
         m_quotes.Append( quote );
       }
 
       OnQuote( quote );
+      TF_LATENCY_STAGE( "delegates.quote" );
     }
     else {
         m_quote = quote;
+        m_slQuote.Store( quote );
+        Published();
         //OnPossibleResizeBegin( stateTimeSeries_t( m_quotes.Capacity(), m_quotes.Size() ) );
         {
           //boost::mutex::scoped_lock lock(m_mutexLockAppend);
@@ -302,6 +315,7 @@ void Watch::HandleQuote( const Quote& quote ) {
 
         //OnPossibleResizeEnd( stateTimeSeries_t( m_quotes.Capacity(), m_quotes.Size() ) );
         OnQuote( quote );
+        TF_LATENCY_STAGE( "delegates.quote" );
     }
   }
   else {
@@ -316,7 +330,10 @@ void Watch::HandleQuote( const Quote& quote ) {
 }
 
 void Watch::HandleTrade( const Trade& trade ) {
+  TF_LATENCY_STAGE( "watch.trade" );
   m_trade = trade;
+  m_slTrade.Store( trade );
+  Published();
   if ( trade.Price() > m_PriceMax ) m_PriceMax = trade.Price();
   if ( trade.Price() < m_PriceMin ) m_PriceMin = trade.Price();
   m_VolumeTotal += trade.Volume();
@@ -328,20 +345,33 @@ void Watch::HandleTrade( const Trade& trade ) {
   //OnPossibleResizeEnd( stateTimeSeries_t( m_trades.Capacity(), m_trades.Size() ) );
   //if ( 0 != m_OnTrade ) m_OnTrade( trade );
   OnTrade( trade );
+  TF_LATENCY_STAGE( "delegates.trade" );
 }
 
 void Watch::HandleDepthByMM( const DepthByMM& depth ) {
+  m_depth_mm = depth;
+  m_slDepthByMM.Store( depth );
+  Published();
   if ( m_bRecordSeries ) m_depths_mm.Append( depth );
   OnDepthByMM( depth );
 }
 
 void Watch::HandleDepthByOrder( const DepthByOrder& depth ) {
+  m_depth_order = depth;
+  m_slDepthByOrder.Store( depth );
+  Published();
   if ( m_bRecordSeries ) m_depths_order.Append( depth );
   OnDepthByOrder( depth );
 }
 
 void Watch::HandleIQFeedFundamentalMessage( ou::tf::iqfeed::IQFeedSymbol::pFundamentals_t pFundamentals ) {
   m_pFundamentals = pFundamentals;
+  if ( !m_bSeriesHint && ( 0 < m_pFundamentals->nAverageVolume ) ) {
+    // rough: average volume is in thousands of shares, about a round lot per trade, several quotes per trade
+    const Trades::size_type nTrades( (Trades::size_type) m_pFundamentals->nAverageVolume * 10 );
+    m_trades.BlockSizeHint( nTrades );
+    m_quotes.BlockSizeHint( nTrades * 4 );
+  }
   OnFundamentals( *m_pFundamentals );
 }
 
@@ -359,6 +389,9 @@ void Watch::HandleIQFeedSummaryMessage( ou::tf::iqfeed::IQFeedSymbol::pSummary_t
 
   m_quote = ou::tf::Quote( ou::TimeSource::GlobalInstance().External(), summary.dblBid, 0, summary.dblAsk, 0 );
   m_trade = ou::tf::Trade( ou::TimeSource::GlobalInstance().External(), summary.dblTrade, 0 );
+  m_slQuote.Store( m_quote );
+  m_slTrade.Store( m_trade );
+  Published();
 
   OnSummary( m_summary );
 }
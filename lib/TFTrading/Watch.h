@@ -14,12 +14,14 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
 
 #include <OUCommon/Delegate.h>
+#include <OUCommon/SeqLock.h>
 
 #include <TFTimeSeries/TimeSeries.h>
 
@@ -74,11 +76,30 @@ public:
 
   bool Watching() const { return 0 != m_cntWatching; };
 
-  // TODO: these need spinlocks
-  inline const Quote& LastQuote() const { return m_quote; };  // may have thread sync issue
-  inline const Trade& LastTrade() const { return m_trade; };  // may have thread sync issue
-  inline const DepthByMM& LastDepthByMM() const { return m_depth_mm; };  // may have thread sync issue
-  inline const DepthByOrder& LastDepthByOrder() const { return m_depth_order; };  // may have thread sync issue
+  // references are overwritten in place by the feed thread,
+  //   use from within the On... events, or from a thread otherwise synchronized with the feed
+  inline const Quote& LastQuote() const { return m_quote; };
+  inline const Trade& LastTrade() const { return m_trade; };
+  inline const DepthByMM& LastDepthByMM() const { return m_depth_mm; };
+  inline const DepthByOrder& LastDepthByOrder() const { return m_depth_order; };
+
+  // consistent copies for any other thread (strategy, option engine, gui), never torn,
+  //   the feed thread publishes without waiting on readers
+  Quote SnapshotQuote() const { return m_slQuote.Load(); }
+  Trade SnapshotTrade() const { return m_slTrade.Load(); }
+  DepthByMM SnapshotDepthByMM() const { return m_slDepthByMM.Load(); }
+  DepthByOrder SnapshotDepthByOrder() const { return m_slDepthByOrder.Load(); }
+
+  // incremented once per published quote, trade, depth, or summary
+  using version_t = ou::SeqLock<Quote>::version_t;
+  version_t Version() const { return m_nVersion.load( std::memory_order_acquire ); }
+  // for pollers: false while unchanged since version, otherwise version is updated
+  bool Changed( version_t& version ) const {
+    const version_t current( Version() );
+    if ( current == version ) return false;
+    version = current;
+    return true;
+  }
 
   const Fundamentals& GetFundamentals() const { assert( m_pFundamentals ); return *m_pFundamentals; };
   const Summary& GetSummary() const { return m_summary; };
@@ -101,6 +122,10 @@ public:
   virtual void EmitValues( bool bEmitName = true ) const;
 
   void RecordSeries( bool bRecord ) { m_bRecordSeries = bRecord; } // true by default
+
+  // typical session counts for the symbol, sizes the blocks of the recorded quote and trade series,
+  //   effective until the first is recorded, otherwise derived from iqfeed fundamentals average volume
+  void SeriesHint( Quotes::size_type nQuotes, Trades::size_type nTrades );
   bool RecordingSeries() const { return m_bRecordSeries; }
 
   virtual void SaveSeries( const std::string& sPrefix );
@@ -143,6 +168,7 @@ private:
   bool m_bWatchingEnabled;
   bool m_bWatching; // in/out of connected state
   bool m_bEventsAttached; // code validation
+  bool m_bSeriesHint;
 
   size_t m_cntWatching;
   size_t m_nEnableStats;
@@ -151,6 +177,13 @@ private:
 
   Summary m_summary;
 
+  // published copies of m_quote, m_trade, m_depth_mm, m_depth_order
+  ou::SeqLock<Quote> m_slQuote;
+  ou::SeqLock<Trade> m_slTrade;
+  ou::SeqLock<DepthByMM> m_slDepthByMM;
+  ou::SeqLock<DepthByOrder> m_slDepthByOrder;
+  std::atomic<version_t> m_nVersion; // written by the feed thread only
+
   ou::tf::Trade::price_t m_PriceMax;
   ou::tf::Trade::price_t m_PriceMin;
   ou::tf::Trade::volume_t m_VolumeTotal;
@@ -176,6 +209,8 @@ private:
   void EnableWatch();
   void DisableWatch();
 
+  void Published() { m_nVersion.store( m_nVersion.load( std::memory_order_relaxed ) + 1, std::memory_order_release ); }
+
   void HandleQuote( const Quote& );
   void HandleTrade( const Trade& );
   void HandleDepthByMM( const DepthByMM& );
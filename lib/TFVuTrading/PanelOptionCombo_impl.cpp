@@ -561,7 +561,7 @@ void PanelOptionCombo_impl::UpdateGui( void ) {
     const pPositionGreek_t pPositionGreek = vt->GetPositionGreek();
     const pOption_t pOption = pPositionGreek->GetOption();
     const ou::tf::PositionGreek::TableRowDef& row( pPositionGreek->GetRow() );
-    ou::tf::Quote quote( pOption->LastQuote() );
+    ou::tf::Quote quote( pOption->SnapshotQuote() ); // gui thread
     ou::tf::Greek greek( pOption->LastGreek() );
     boost::uint32_t nPending( row.nPositionPending );
 